@@ -71,6 +71,10 @@ for f in $sources; do
   elif [ -e example/$f/*.c ]; then
     echo "Building (C)   gen/bin/example-$f"
     $CC  $CFLAGS              example/$f/*.c  $LDFLAGS -o gen/bin/example-$f
+  elif [ $f = "tiff-to-nie" ]; then
+    # example/tiff-to-nie is unusual in that it uses threads.
+    echo "Building (C++) gen/bin/example-$f"
+    $CXX $CXXFLAGS -pthread   example/$f/*.cc $LDFLAGS -o gen/bin/example-$f
   elif [ $f = "jsonfindptrs" ]; then
     echo "Building (C++) gen/bin/example-$f"
     $CXX $CXXFLAGS -std=c++17 example/$f/*.cc $LDFLAGS -o gen/bin/example-$f
@@ -41,14 +41,28 @@ const (
 	IterscaleMax     = 1000000
 	IterscaleUsage   = `a scaling factor for the number of iterations per benchmark`
 
+	JSONDefault = false
+	JSONUsage   = `whether to print benchmark results as JSON (one object per line), including per-iteration percentiles`
+
 	MimicDefault = false
 	MimicUsage   = `whether to compare Wuffs' output with other libraries' output`
 
+	PerfDefault = false
+	PerfUsage   = `whether to also measure benchmarks' hardware performance counters (Linux only)`
+
+	RdtscDefault = false
+	RdtscUsage   = `whether to also measure benchmarks' x86 time stamp counter ticks per byte (with -json)`
+
 	RepsDefault = 5
 	RepsMin     = 0
 	RepsMax     = 1000000
 	RepsUsage   = `the number of repetitions per benchmark`
 
+	ThreadsDefault = 1
+	ThreadsMin     = 1
+	ThreadsMax     = 1024
+	ThreadsUsage   = `the number of concurrent (pinned) threads per benchmark, to measure multi-core scaling`
+
 	VersionDefault = "0.0.0"
 	VersionUsage   = `version string, e.g. "1.2.3-beta.4"`
 )
@@ -36,8 +36,12 @@ func doBenchTest(args []string, bench bool) error {
 	ccompilersFlag := flags.String("ccompilers", cf.CcompilersDefault, cf.CcompilersUsage)
 	focusFlag := flags.String("focus", cf.FocusDefault, cf.FocusUsage)
 	iterscaleFlag := flags.Int("iterscale", cf.IterscaleDefault, cf.IterscaleUsage)
+	jsonFlag := flags.Bool("json", cf.JSONDefault, cf.JSONUsage)
 	mimicFlag := flags.Bool("mimic", cf.MimicDefault, cf.MimicUsage)
+	perfFlag := flags.Bool("perf", cf.PerfDefault, cf.PerfUsage)
+	rdtscFlag := flags.Bool("rdtsc", cf.RdtscDefault, cf.RdtscUsage)
 	repsFlag := flags.Int("reps", cf.RepsDefault, cf.RepsUsage)
+	threadsFlag := flags.Int("threads", cf.ThreadsDefault, cf.ThreadsUsage)
 
 	if err := flags.Parse(args); err != nil {
 		return err
@@ -58,12 +62,37 @@ func doBenchTest(args []string, bench bool) error {
 			*repsFlag, cf.RepsMin, cf.RepsMax)
 	}
 
+	if *threadsFlag < cf.ThreadsMin || cf.ThreadsMax < *threadsFlag {
+		return fmt.Errorf("bad -threads flag value %d, outside the range [%d ..= %d]",
+			*threadsFlag, cf.ThreadsMin, cf.ThreadsMax)
+	}
+
 	args = flags.Args()
 
+	benchArgs := []string(nil)
+	if bench {
+		benchArgs = append(benchArgs, "-bench",
+			fmt.Sprintf("-iterscale=%d", *iterscaleFlag),
+			fmt.Sprintf("-reps=%d", *repsFlag),
+		)
+		if *jsonFlag {
+			benchArgs = append(benchArgs, "-json")
+		}
+		if *perfFlag {
+			benchArgs = append(benchArgs, "-perf")
+		}
+		if *rdtscFlag {
+			benchArgs = append(benchArgs, "-rdtsc")
+		}
+		if *threadsFlag > 1 {
+			benchArgs = append(benchArgs, fmt.Sprintf("-threads=%d", *threadsFlag))
+		}
+	}
+
 	failed := false
 	for _, arg := range args {
-		f, err := doBenchTest1(arg, bench,
-			*ccompilersFlag, *focusFlag, *iterscaleFlag, *mimicFlag, *repsFlag)
+		f, err := doBenchTest1(arg, bench, benchArgs,
+			*ccompilersFlag, *focusFlag, *mimicFlag)
 		if err != nil {
 			return err
 		}
@@ -79,8 +108,8 @@ func doBenchTest(args []string, bench bool) error {
 	return nil
 }
 
-func doBenchTest1(filename string, bench bool, ccompilers string, focus string,
-	iterscale int, mimic bool, reps int) (failed bool, err error) {
+func doBenchTest1(filename string, bench bool, benchArgs []string,
+	ccompilers string, focus string, mimic bool) (failed bool, err error) {
 
 	workDir, err := os.MkdirTemp("", "wuffs-c")
 	if err != nil {
@@ -95,7 +124,10 @@ func doBenchTest1(filename string, bench bool, ccompilers string, focus string,
 	if bench {
 		ccArgs = append(ccArgs, "-O3")
 	}
-	ccArgs = append(ccArgs, "-Wall", "-std=c99", "-o", out, in)
+	// _GNU_SOURCE enables clock_gettime (for the benchmark timer) and, on
+	// Linux, syscall (for perf_event_open) and pthread_setaffinity_np (for
+	// -threads) despite the strict "-std=c99".
+	ccArgs = append(ccArgs, "-Wall", "-std=c99", "-D_GNU_SOURCE", "-pthread", "-o", out, in)
 	if mimic {
 		extra, err := findWuffsMimicCflags(in)
 		if err != nil {
@@ -117,13 +149,7 @@ func doBenchTest1(filename string, bench bool, ccompilers string, focus string,
 			return false, err
 		}
 
-		outArgs := []string(nil)
-		if bench {
-			outArgs = append(outArgs, "-bench",
-				fmt.Sprintf("-iterscale=%d", iterscale),
-				fmt.Sprintf("-reps=%d", reps),
-			)
-		}
+		outArgs := append([]string(nil), benchArgs...)
 		if focus != "" {
 			outArgs = append(outArgs, fmt.Sprintf("-focus=%s", focus))
 		}
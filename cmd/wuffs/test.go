@@ -43,10 +43,18 @@ func doBenchTest(wuffsRoot string, args []string, bench bool) error {
 	skipgendepsFlag := flags.Bool("skipgendeps", skipgendepsDefault, skipgendepsUsage)
 
 	iterscaleFlag := (*int)(nil)
+	jsonFlag := (*bool)(nil)
+	perfFlag := (*bool)(nil)
+	rdtscFlag := (*bool)(nil)
 	repsFlag := (*int)(nil)
+	threadsFlag := (*int)(nil)
 	if bench {
 		iterscaleFlag = flags.Int("iterscale", cf.IterscaleDefault, cf.IterscaleUsage)
+		jsonFlag = flags.Bool("json", cf.JSONDefault, cf.JSONUsage)
+		perfFlag = flags.Bool("perf", cf.PerfDefault, cf.PerfUsage)
+		rdtscFlag = flags.Bool("rdtsc", cf.RdtscDefault, cf.RdtscUsage)
 		repsFlag = flags.Int("reps", cf.RepsDefault, cf.RepsUsage)
+		threadsFlag = flags.Int("threads", cf.ThreadsDefault, cf.ThreadsUsage)
 	}
 
 	if err := flags.Parse(args); err != nil {
@@ -72,6 +80,10 @@ func doBenchTest(wuffsRoot string, args []string, bench bool) error {
 			return fmt.Errorf("bad -reps flag value %d, outside the range [%d ..= %d]",
 				*repsFlag, cf.RepsMin, cf.RepsMax)
 		}
+		if *threadsFlag < cf.ThreadsMin || cf.ThreadsMax < *threadsFlag {
+			return fmt.Errorf("bad -threads flag value %d, outside the range [%d ..= %d]",
+				*threadsFlag, cf.ThreadsMin, cf.ThreadsMax)
+		}
 	}
 
 	args = flags.Args()
@@ -85,6 +97,18 @@ func doBenchTest(wuffsRoot string, args []string, bench bool) error {
 			fmt.Sprintf("-iterscale=%d", *iterscaleFlag),
 			fmt.Sprintf("-reps=%d", *repsFlag),
 		)
+		if *jsonFlag {
+			cmdArgs = append(cmdArgs, "-json")
+		}
+		if *perfFlag {
+			cmdArgs = append(cmdArgs, "-perf")
+		}
+		if *rdtscFlag {
+			cmdArgs = append(cmdArgs, "-rdtsc")
+		}
+		if *threadsFlag > 1 {
+			cmdArgs = append(cmdArgs, fmt.Sprintf("-threads=%d", *threadsFlag))
+		}
 	} else {
 		cmdArgs = append(cmdArgs, "test")
 	}
@@ -63,13 +63,17 @@ https://skia-review.googlesource.com/c/skia/+/290618
 #define WUFFS_CONFIG__MODULE__CRC32
 #define WUFFS_CONFIG__MODULE__DEFLATE
 #define WUFFS_CONFIG__MODULE__GIF
+#define WUFFS_CONFIG__MODULE__ICO
 #define WUFFS_CONFIG__MODULE__JPEG
 #define WUFFS_CONFIG__MODULE__LZW
 #define WUFFS_CONFIG__MODULE__NETPBM
 #define WUFFS_CONFIG__MODULE__NIE
 #define WUFFS_CONFIG__MODULE__PNG
+#define WUFFS_CONFIG__MODULE__QOI
 #define WUFFS_CONFIG__MODULE__TGA
+#define WUFFS_CONFIG__MODULE__TIFF
 #define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__WEBP
 #define WUFFS_CONFIG__MODULE__ZLIB
 
 // If building this program in an environment that doesn't easily accommodate
@@ -141,12 +145,16 @@ wuffs_base__image_decoder* g_image_decoder = NULL;
 union {
   wuffs_bmp__decoder bmp;
   wuffs_gif__decoder gif;
+  wuffs_ico__decoder ico;
   wuffs_jpeg__decoder jpeg;
   wuffs_netpbm__decoder netpbm;
   wuffs_nie__decoder nie;
   wuffs_png__decoder png;
+  wuffs_qoi__decoder qoi;
   wuffs_tga__decoder tga;
+  wuffs_tiff__decoder tiff;
   wuffs_wbmp__decoder wbmp;
+  wuffs_webp__decoder webp;
 } g_potential_decoders;
 
 // ----
@@ -161,6 +169,13 @@ union {
 #define SRC_BUFFER_ARRAY_SIZE (64 * 1024)
 #endif
 
+// TIFF decoding needs random access (the IFD often comes after the pixel data)
+// but the sandbox forbids lseek, so TIFF input is read whole into this larger
+// buffer before decoding.
+#ifndef SEEKABLE_SRC_BUFFER_ARRAY_SIZE
+#define SEEKABLE_SRC_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
+#endif
+
 #ifndef WORKBUF_ARRAY_SIZE
 #define WORKBUF_ARRAY_SIZE (256 * 1024 * 1024)
 #endif
@@ -170,6 +185,7 @@ union {
 #endif
 
 uint8_t g_src_buffer_array[SRC_BUFFER_ARRAY_SIZE] = {0};
+uint8_t g_seekable_src_buffer_array[SEEKABLE_SRC_BUFFER_ARRAY_SIZE] = {0};
 uint8_t g_workbuf_array[WORKBUF_ARRAY_SIZE] = {0};
 uint8_t g_pixbuf_array[PIXBUF_ARRAY_SIZE] = {0};
 
@@ -261,6 +277,21 @@ load_image_type() {
     }
     TRY(read_more_src());
   }
+
+  if (g_fourcc == WUFFS_BASE__FOURCC__TIFF) {
+    size_t n = g_src.meta.wi - g_src.meta.ri;
+    memcpy(g_seekable_src_buffer_array, g_src.data.ptr + g_src.meta.ri, n);
+    g_src.data = wuffs_base__make_slice_u8(g_seekable_src_buffer_array,
+                                           SEEKABLE_SRC_BUFFER_ARRAY_SIZE);
+    g_src.meta.wi = n;
+    g_src.meta.ri = 0;
+    while (!g_src.meta.closed) {
+      if (g_src.meta.wi == g_src.data.len) {
+        return "main: image is too large (to buffer the source)";
+      }
+      TRY(read_more_src());
+    }
+  }
   return NULL;
 }
 
@@ -288,6 +319,16 @@ initialize_image_decoder() {
               &g_potential_decoders.gif);
       return NULL;
 
+    case WUFFS_BASE__FOURCC__ICO:
+      status = wuffs_ico__decoder__initialize(
+          &g_potential_decoders.ico, sizeof g_potential_decoders.ico,
+          WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
+      TRY(wuffs_base__status__message(&status));
+      g_image_decoder =
+          wuffs_ico__decoder__upcast_as__wuffs_base__image_decoder(
+              &g_potential_decoders.ico);
+      return NULL;
+
     case WUFFS_BASE__FOURCC__JPEG:
       status = wuffs_jpeg__decoder__initialize(
           &g_potential_decoders.jpeg, sizeof g_potential_decoders.jpeg,
@@ -328,6 +369,16 @@ initialize_image_decoder() {
               &g_potential_decoders.png);
       return NULL;
 
+    case WUFFS_BASE__FOURCC__QOI:
+      status = wuffs_qoi__decoder__initialize(
+          &g_potential_decoders.qoi, sizeof g_potential_decoders.qoi,
+          WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
+      TRY(wuffs_base__status__message(&status));
+      g_image_decoder =
+          wuffs_qoi__decoder__upcast_as__wuffs_base__image_decoder(
+              &g_potential_decoders.qoi);
+      return NULL;
+
     case WUFFS_BASE__FOURCC__TGA:
       status = wuffs_tga__decoder__initialize(
           &g_potential_decoders.tga, sizeof g_potential_decoders.tga,
@@ -338,6 +389,16 @@ initialize_image_decoder() {
               &g_potential_decoders.tga);
       return NULL;
 
+    case WUFFS_BASE__FOURCC__TIFF:
+      status = wuffs_tiff__decoder__initialize(
+          &g_potential_decoders.tiff, sizeof g_potential_decoders.tiff,
+          WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
+      TRY(wuffs_base__status__message(&status));
+      g_image_decoder =
+          wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(
+              &g_potential_decoders.tiff);
+      return NULL;
+
     case WUFFS_BASE__FOURCC__WBMP:
       status = wuffs_wbmp__decoder__initialize(
           &g_potential_decoders.wbmp, sizeof g_potential_decoders.wbmp,
@@ -347,18 +408,53 @@ initialize_image_decoder() {
           wuffs_wbmp__decoder__upcast_as__wuffs_base__image_decoder(
               &g_potential_decoders.wbmp);
       return NULL;
+
+    case WUFFS_BASE__FOURCC__WEBP:
+      status = wuffs_webp__decoder__initialize(
+          &g_potential_decoders.webp, sizeof g_potential_decoders.webp,
+          WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS);
+      TRY(wuffs_base__status__message(&status));
+      g_image_decoder =
+          wuffs_webp__decoder__upcast_as__wuffs_base__image_decoder(
+              &g_potential_decoders.webp);
+      return NULL;
   }
   return "main: unsupported file format";
 }
 
+// seek_src sets g_src's reader_position to pos. It can skip forward (reading
+// more of stdin) or, if the bytes are still buffered, go backward.
 const char*  //
-advance_for_redirect() {
+seek_src(uint64_t pos) {
+  if (pos < g_src.meta.pos) {
+    return "main: cannot seek backwards past the buffered source";
+  }
+  while (true) {
+    uint64_t relative_pos = pos - g_src.meta.pos;
+    if (relative_pos <= g_src.meta.wi) {
+      g_src.meta.ri = relative_pos;
+      break;
+    }
+    g_src.meta.ri = g_src.meta.wi;
+    TRY(read_more_src());
+  }
+  return NULL;
+}
+
+// advance_for_redirect handles an "@I/O redirect" note. An IO_REDIRECT flavor
+// means that the image is in another format (and sets *reinitialize). An
+// IO_SEEK flavor means that the current decoder needs to read from elsewhere.
+const char*  //
+advance_for_redirect(bool* reinitialize) {
   wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
   wuffs_base__more_information minfo = wuffs_base__empty_more_information();
   wuffs_base__status status = wuffs_base__image_decoder__tell_me_more(
       g_image_decoder, &empty, &minfo, &g_src);
+  *reinitialize = false;
   if (status.repr != NULL) {
     return wuffs_base__status__message(&status);
+  } else if (minfo.flavor == WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+    return seek_src(wuffs_base__more_information__io_seek__position(&minfo));
   } else if (minfo.flavor !=
              WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_REDIRECT) {
     return "main: unsupported file format";
@@ -368,6 +464,7 @@ advance_for_redirect() {
   if (g_fourcc <= 0) {
     return "main: unsupported file format";
   }
+  *reinitialize = true;
 
   // Advance g_src's reader_position to pos.
   uint64_t pos =
@@ -376,17 +473,7 @@ advance_for_redirect() {
     // Redirects must go forward.
     return "main: unsupported file format";
   }
-  while (true) {
-    uint64_t relative_pos =
-        pos - wuffs_base__io_buffer__reader_position(&g_src);
-    if (relative_pos <= (g_src.meta.wi - g_src.meta.ri)) {
-      g_src.meta.ri += relative_pos;
-      break;
-    }
-    g_src.meta.ri = g_src.meta.wi;
-    TRY(read_more_src());
-  }
-  return NULL;
+  return seek_src(pos);
 }
 
 const char*  //
@@ -402,11 +489,14 @@ redirect:
     if (status.repr == NULL) {
       break;
     } else if (status.repr == wuffs_base__note__i_o_redirect) {
-      if (redirected) {
+      bool reinitialize = false;
+      TRY(advance_for_redirect(&reinitialize));
+      if (!reinitialize) {
+        continue;
+      } else if (redirected) {
         return "main: unsupported file format";
       }
       redirected = true;
-      TRY(advance_for_redirect());
       goto redirect;
     } else if (status.repr != wuffs_base__suspension__short_read) {
       return wuffs_base__status__message(&status);
@@ -565,12 +655,27 @@ convert_frames() {
         break;
       } else if (dfc_status.repr == wuffs_base__note__end_of_data) {
         return NULL;
+      } else if (dfc_status.repr == wuffs_base__note__i_o_redirect) {
+        bool reinitialize = false;
+        TRY(advance_for_redirect(&reinitialize));
+        if (reinitialize) {
+          return "main: unsupported file format";
+        }
+        continue;
       } else if (dfc_status.repr != wuffs_base__suspension__short_read) {
         return wuffs_base__status__message(&dfc_status);
       }
       TRY(read_more_src());
     }
 
+    // The work buffer length can vary from frame to frame (e.g. for TIFF).
+    uint64_t workbuf_len =
+        wuffs_base__image_decoder__workbuf_len(g_image_decoder).max_incl;
+    if (workbuf_len > WORKBUF_ARRAY_SIZE) {
+      return "main: image is too large (to configure work buffer)";
+    }
+    g_workbuf_slice.len = workbuf_len;
+
     wuffs_base__flicks duration =
         wuffs_base__frame_config__duration(&g_frame_config);
     if (duration < 0) {
@@ -607,7 +712,18 @@ convert_frames() {
               ? WUFFS_BASE__PIXEL_BLEND__SRC
               : WUFFS_BASE__PIXEL_BLEND__SRC_OVER,
           g_workbuf_slice, NULL);
-      if (df_status.repr != wuffs_base__suspension__short_read) {
+      if (df_status.repr == wuffs_base__note__i_o_redirect) {
+        bool reinitialize = false;
+        decode_frame_io_error_message = advance_for_redirect(&reinitialize);
+        if ((decode_frame_io_error_message == NULL) && reinitialize) {
+          decode_frame_io_error_message = "main: unsupported file format";
+        }
+        if (decode_frame_io_error_message == NULL) {
+          continue;
+        }
+        df_status.repr = NULL;
+        break;
+      } else if (df_status.repr != wuffs_base__suspension__short_read) {
         break;
       }
       decode_frame_io_error_message = read_more_src();
@@ -0,0 +1,427 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+tiff-to-nie converts one page of a TIFF image to the NIE format, decoding the
+TIFF's strips or tiles on multiple threads.
+
+See the "const char* g_usage" string below for details.
+
+----
+
+TIFF strips and tiles are compressed independently. This program runs one
+wuffs_tiff__decoder per thread, all reading from the same in-memory copy of
+the file and all writing to the same pixel buffer. Each decoder's
+QUIRK_CHUNK_MIN_INCL_Y and QUIRK_CHUNK_MAX_EXCL_Y quirks restrict it to those
+chunks whose top row falls in that thread's band of rows. Every chunk belongs
+to exactly one band and chunks never overlap, so the threads write to disjoint
+rows and need no locking.
+
+Decoder state is per-thread and the source bytes are read-only, so the only
+shared mutable state is the destination pixels.
+
+To run:
+
+$CXX -std=c++11 -pthread tiff-to-nie.cc && \
+  ./a.out ../../test/data/bricks-color.tiff > out.nie; rm -f a.out
+
+for a C++ compiler $CXX, such as clang++ or g++.
+*/
+
+#if defined(__cplusplus) && (__cplusplus < 201103L)
+#error "This C++ program requires -std=c++11 or later"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__STATIC_FUNCTIONS macro is optional, but when
+// combined with WUFFS_IMPLEMENTATION, it demonstrates making all of Wuffs'
+// functions have static storage.
+//
+// This can help the compiler ignore or discard unused code, which can produce
+// faster compiles and smaller binaries. Other motivations are discussed in the
+// "ALLOW STATIC IMPLEMENTATION" section of
+// https://raw.githubusercontent.com/nothings/stb/master/docs/stb_howto.txt
+#define WUFFS_CONFIG__STATIC_FUNCTIONS
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__LZW
+#define WUFFS_CONFIG__MODULE__TIFF
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C++ file.
+#include "../../release/c/wuffs-unsupported-snapshot.c"
+
+#define TRY(error_msg)         \
+  do {                         \
+    std::string z = error_msg; \
+    if (!z.empty()) {          \
+      return z;                \
+    }                          \
+  } while (false)
+
+static const char* g_usage =
+    "Usage: tiff-to-nie -flags input.tiff > output.nie\n"
+    "\n"
+    "Flags:\n"
+    "    -p=NUM  -page=NUM\n"
+    "    -t=NUM  -threads=NUM\n"
+    "\n"
+    "tiff-to-nie converts one page of a TIFF image to the NIE format (with\n"
+    "BGRA non-premultiplied pixels), decoding the image's strips or tiles\n"
+    "concurrently.\n"
+    "\n"
+    "NIE is a trivial image file format, specified at\n"
+    "https://github.com/google/wuffs/blob/main/doc/spec/nie-spec.md\n"
+    "\n"
+    "The -page flag selects which page (also known as an Image File\n"
+    "Directory) to convert. The first page is numbered 0, the default.\n"
+    "\n"
+    "The -threads flag sets the number of threads. The default is the number\n"
+    "of hardware threads. Using more threads than the TIFF has strips or rows\n"
+    "of tiles gives no further speed-up.";
+
+// ----
+
+#ifndef MAX_DIMENSION
+#define MAX_DIMENSION 16384
+#endif
+
+struct {
+  int remaining_argc;
+  char** remaining_argv;
+
+  uint64_t page;
+  uint32_t threads;
+} g_flags = {0};
+
+std::vector<uint8_t> g_src_bytes;
+std::vector<uint8_t> g_pixbuf_bytes;
+
+std::string  //
+parse_flags(int argc, char** argv) {
+  g_flags.threads = std::thread::hardware_concurrency();
+  if (g_flags.threads == 0) {
+    g_flags.threads = 1;
+  }
+
+  int c = (argc > 0) ? 1 : 0;  // Skip argv[0], the program name.
+  for (; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg++ != '-') {
+      break;
+    }
+
+    // A double-dash "--foo" is equivalent to a single-dash "-foo". As special
+    // cases, a bare "-" is not a flag (some programs may interpret it as
+    // stdin) and a bare "--" means to stop parsing flags.
+    if (*arg == '\x00') {
+      break;
+    } else if (*arg == '-') {
+      arg++;
+      if (*arg == '\x00') {
+        c++;
+        break;
+      }
+    }
+
+    if (!strncmp(arg, "p=", 2) || !strncmp(arg, "page=", 5) ||
+        !strncmp(arg, "t=", 2) || !strncmp(arg, "threads=", 8)) {
+      bool is_page = *arg == 'p';
+      while (*arg++ != '=') {
+      }
+      wuffs_base__result_u64 u = wuffs_base__parse_number_u64(
+          wuffs_base__make_slice_u8((uint8_t*)arg, strlen(arg)),
+          WUFFS_BASE__PARSE_NUMBER_XXX__DEFAULT_OPTIONS);
+      if (!wuffs_base__status__is_ok(&u.status)) {
+        return g_usage;
+      } else if (is_page) {
+        g_flags.page = u.value;
+        continue;
+      } else if ((0 < u.value) && (u.value <= 1024)) {
+        g_flags.threads = (uint32_t)(u.value);
+        continue;
+      }
+    }
+
+    return g_usage;
+  }
+
+  g_flags.remaining_argc = argc - c;
+  g_flags.remaining_argv = argv + c;
+  return "";
+}
+
+std::string  //
+read_src(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) {
+    return std::string("main: cannot read ") + filename;
+  }
+  uint8_t buf[65536];
+  while (true) {
+    size_t n = fread(buf, 1, sizeof buf, f);
+    g_src_bytes.insert(g_src_bytes.end(), buf, buf + n);
+    if (n < sizeof buf) {
+      break;
+    }
+  }
+  bool ok = !ferror(f);
+  fclose(f);
+  return ok ? "" : std::string("main: cannot read ") + filename;
+}
+
+// ----
+
+// Decoder wraps a wuffs_tiff__decoder and its own view (an io_buffer) of the
+// shared source bytes. The whole file is in memory, so handling an "@I/O
+// redirect" note (the TIFF decoder asking to seek) is just setting src.meta.ri
+// to where tell_me_more says.
+class Decoder {
+ public:
+  Decoder() : m_src(wuffs_base__ptr_u8__reader(g_src_bytes.data(),
+                                               g_src_bytes.size(),
+                                               true)) {}
+
+  std::string initialize(uint32_t min_incl_y, uint32_t max_excl_y) {
+    wuffs_base__status status = m_dec.initialize(
+        sizeof m_dec, WUFFS_VERSION,
+        WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED);
+    if (!status.is_ok()) {
+      return status.message();
+    }
+    m_dec.set_quirk(WUFFS_TIFF__QUIRK_CHUNK_MIN_INCL_Y, min_incl_y);
+    m_dec.set_quirk(WUFFS_TIFF__QUIRK_CHUNK_MAX_EXCL_Y, max_excl_y);
+    return "";
+  }
+
+  std::string decode_image_config(wuffs_base__image_config* ic) {
+    while (true) {
+      wuffs_base__status status = m_dec.decode_image_config(ic, &m_src);
+      if (status.repr != wuffs_base__note__i_o_redirect) {
+        return status.is_ok() ? "" : status.message();
+      }
+      TRY(seek());
+    }
+  }
+
+  std::string decode_frame_config(wuffs_base__frame_config* fc) {
+    while (true) {
+      wuffs_base__status status = m_dec.decode_frame_config(fc, &m_src);
+      if (status.repr == wuffs_base__note__end_of_data) {
+        return "main: no such page";
+      } else if (status.repr != wuffs_base__note__i_o_redirect) {
+        return status.is_ok() ? "" : status.message();
+      }
+      TRY(seek());
+    }
+  }
+
+  std::string decode_frame(wuffs_base__pixel_buffer* pb) {
+    m_workbuf.resize(m_dec.workbuf_len().max_incl);
+    while (true) {
+      wuffs_base__status status = m_dec.decode_frame(
+          pb, &m_src, WUFFS_BASE__PIXEL_BLEND__SRC,
+          wuffs_base__make_slice_u8(m_workbuf.data(), m_workbuf.size()),
+          nullptr);
+      if (status.repr != wuffs_base__note__i_o_redirect) {
+        return status.is_ok() ? "" : status.message();
+      }
+      TRY(seek());
+    }
+  }
+
+  std::string restart_frame(uint64_t index, uint64_t io_position) {
+    wuffs_base__status status = m_dec.restart_frame(index, io_position);
+    return status.is_ok() ? "" : status.message();
+  }
+
+ private:
+  std::string seek() {
+    wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+    wuffs_base__more_information minfo = wuffs_base__empty_more_information();
+    wuffs_base__status status = m_dec.tell_me_more(&empty, &minfo, &m_src);
+    if (!status.is_ok()) {
+      return status.message();
+    } else if (minfo.flavor != WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+      return "main: unexpected more_information flavor";
+    }
+    uint64_t pos = minfo.io_seek__position();
+    if (pos > m_src.meta.wi) {
+      return "main: seek position is out of bounds";
+    }
+    m_src.meta.ri = (size_t)pos;
+    return "";
+  }
+
+  wuffs_tiff__decoder m_dec;
+  wuffs_base__io_buffer m_src;
+  std::vector<uint8_t> m_workbuf;
+};
+
+// decode_band decodes those chunks (strips or tiles) of the given page whose
+// top row is in [min_incl_y, max_excl_y). A max_excl_y of zero means no limit.
+void  //
+decode_band(wuffs_base__pixel_buffer* pb,
+            uint64_t page_io_position,
+            uint32_t min_incl_y,
+            uint32_t max_excl_y,
+            std::string* error_message) {
+  Decoder dec;
+  wuffs_base__image_config ic = {};
+  wuffs_base__frame_config fc = {};
+  std::string z = dec.initialize(min_incl_y, max_excl_y);
+  if (z.empty()) {
+    z = dec.decode_image_config(&ic);
+  }
+  if (z.empty()) {
+    z = dec.restart_frame(g_flags.page, page_io_position);
+  }
+  if (z.empty()) {
+    z = dec.decode_frame_config(&fc);
+  }
+  if (z.empty()) {
+    z = dec.decode_frame(pb);
+  }
+  *error_message = z;
+}
+
+std::string  //
+main1(int argc, char** argv) {
+  TRY(parse_flags(argc, argv));
+  if (g_flags.remaining_argc != 1) {
+    return g_usage;
+  }
+  TRY(read_src(g_flags.remaining_argv[0]));
+
+  // Find the page's width, height and I/O position (the position of its Image
+  // File Directory) on the main thread.
+  Decoder dec;
+  wuffs_base__image_config ic = {};
+  wuffs_base__frame_config fc = {};
+  TRY(dec.initialize(0, 0));
+  TRY(dec.decode_image_config(&ic));
+  for (uint64_t i = 0; i <= g_flags.page; i++) {
+    TRY(dec.decode_frame_config(&fc));
+  }
+  uint32_t width = fc.width();
+  uint32_t height = fc.height();
+  if ((width > MAX_DIMENSION) || (height > MAX_DIMENSION)) {
+    return "main: image is too large";
+  }
+
+  wuffs_base__pixel_config pc = {};
+  pc.set(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+         WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+  g_pixbuf_bytes.resize(pc.pixbuf_len());
+  wuffs_base__pixel_buffer pb = {};
+  wuffs_base__status status = pb.set_from_slice(
+      &pc, wuffs_base__make_slice_u8(g_pixbuf_bytes.data(),
+                                     g_pixbuf_bytes.size()));
+  if (!status.is_ok()) {
+    return status.message();
+  }
+
+  // Split the rows into one band per thread. The last band has no upper limit
+  // (a max_excl_y of zero).
+  uint32_t num_threads = g_flags.threads;
+  if (num_threads > height) {
+    num_threads = (height > 0) ? height : 1;
+  }
+  std::vector<std::thread> threads;
+  std::vector<std::string> error_messages(num_threads);
+  for (uint32_t t = 0; t < num_threads; t++) {
+    uint32_t min_incl_y = (uint32_t)(((uint64_t)height * t) / num_threads);
+    uint32_t max_excl_y =
+        (t + 1 == num_threads)
+            ? 0
+            : (uint32_t)(((uint64_t)height * (t + 1)) / num_threads);
+    threads.emplace_back(decode_band, &pb, fc.io_position(), min_incl_y,
+                         max_excl_y, &error_messages[t]);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (auto& m : error_messages) {
+    TRY(m);
+  }
+
+  // Write the NIE header (magic, version-and-configuration, width, height)
+  // and then the pixels.
+  uint8_t header[16];
+  wuffs_base__poke_u32le__no_bounds_check(header + 0x00, 0x45AFC36E);
+  wuffs_base__poke_u32le__no_bounds_check(header + 0x04, 0x346E62FF);
+  wuffs_base__poke_u32le__no_bounds_check(header + 0x08, width);
+  wuffs_base__poke_u32le__no_bounds_check(header + 0x0C, height);
+  if ((fwrite(header, 1, sizeof header, stdout) != sizeof header) ||
+      (fwrite(g_pixbuf_bytes.data(), 1, g_pixbuf_bytes.size(), stdout) !=
+       g_pixbuf_bytes.size())) {
+    return "main: cannot write output";
+  }
+  return "";
+}
+
+int  //
+compute_exit_code(std::string status_msg) {
+  if (status_msg.empty()) {
+    return 0;
+  }
+  fprintf(stderr, "%s\n", status_msg.c_str());
+  // Return an exit code of 1 for regular (foreseen) errors, e.g. badly
+  // formatted or unsupported input.
+  //
+  // Return an exit code of 2 for internal (exceptional) errors, e.g. defensive
+  // run-time checks found that an internal invariant did not hold.
+  //
+  // Automated testing, including badly formatted inputs, can therefore
+  // discriminate between expected failure (exit code 1) and unexpected failure
+  // (other non-zero exit codes). Specifically, exit code 2 for internal
+  // invariant violation, exit code 139 (which is 128 + SIGSEGV on x86_64
+  // linux) for a segmentation fault (e.g. null pointer dereference).
+  return (status_msg.find("internal error:") != std::string::npos) ? 2 : 1;
+}
+
+int  //
+main(int argc, char** argv) {
+  int exit_code = compute_exit_code(main1(argc, argv));
+  fflush(stdout);
+  return exit_code;
+}
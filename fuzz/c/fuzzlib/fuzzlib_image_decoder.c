@@ -16,6 +16,29 @@
 #error "Wuffs' .h files need to be included before this file"
 #endif
 
+// fuzz_image_decoder__seek handles an "@I/O redirect" note that asks to seek
+// within the source (as opposed to redirecting to another image format). The
+// fuzz src holds the entire input, so seeking is just moving the read index.
+static const char*  //
+fuzz_image_decoder__seek(wuffs_base__image_decoder* dec,
+                         wuffs_base__io_buffer* src) {
+  wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+  wuffs_base__more_information minfo = wuffs_base__empty_more_information();
+  wuffs_base__status status =
+      wuffs_base__image_decoder__tell_me_more(dec, &empty, &minfo, src);
+  if (!wuffs_base__status__is_ok(&status)) {
+    return wuffs_base__status__message(&status);
+  } else if (minfo.flavor != WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+    return "unsupported I/O redirect";
+  }
+  uint64_t pos = wuffs_base__more_information__io_seek__position(&minfo);
+  if ((pos < src->meta.pos) || ((pos - src->meta.pos) > src->meta.wi)) {
+    return "I/O seek out of bounds";
+  }
+  src->meta.ri = (size_t)(pos - src->meta.pos);
+  return NULL;
+}
+
 static const char*  //
 fuzz_image_decoder(wuffs_base__io_buffer* src,
                    uint64_t hash,
@@ -30,6 +53,13 @@ fuzz_image_decoder(wuffs_base__io_buffer* src,
     wuffs_base__image_config ic = ((wuffs_base__image_config){});
     wuffs_base__status status =
         wuffs_base__image_decoder__decode_image_config(dec, &ic, src);
+    while (status.repr == wuffs_base__note__i_o_redirect) {
+      ret = fuzz_image_decoder__seek(dec, src);
+      if (ret) {
+        goto exit;
+      }
+      status = wuffs_base__image_decoder__decode_image_config(dec, &ic, src);
+    }
     if (!wuffs_base__status__is_ok(&status)) {
       ret = wuffs_base__status__message(&status);
       goto exit;
@@ -88,6 +118,13 @@ fuzz_image_decoder(wuffs_base__io_buffer* src,
     while (true) {
       wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
       status = wuffs_base__image_decoder__decode_frame_config(dec, &fc, src);
+      while (status.repr == wuffs_base__note__i_o_redirect) {
+        ret = fuzz_image_decoder__seek(dec, src);
+        if (ret) {
+          goto exit;
+        }
+        status = wuffs_base__image_decoder__decode_frame_config(dec, &fc, src);
+      }
       if (!wuffs_base__status__is_ok(&status)) {
         if ((status.repr != wuffs_base__note__end_of_data) || !seen_ok) {
           ret = wuffs_base__status__message(&status);
@@ -97,6 +134,14 @@ fuzz_image_decoder(wuffs_base__io_buffer* src,
 
       status = wuffs_base__image_decoder__decode_frame(
           dec, &pb, src, WUFFS_BASE__PIXEL_BLEND__SRC, workbuf, NULL);
+      while (status.repr == wuffs_base__note__i_o_redirect) {
+        ret = fuzz_image_decoder__seek(dec, src);
+        if (ret) {
+          goto exit;
+        }
+        status = wuffs_base__image_decoder__decode_frame(
+            dec, &pb, src, WUFFS_BASE__PIXEL_BLEND__SRC, workbuf, NULL);
+      }
 
       wuffs_base__rect_ie_u32 frame_rect =
           wuffs_base__frame_config__bounds(&fc);
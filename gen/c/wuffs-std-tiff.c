@@ -0,0 +1,5812 @@
+#ifndef WUFFS_INCLUDE_GUARD__TIFF
+#define WUFFS_INCLUDE_GUARD__TIFF
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__TIFF
+#define WUFFS_NONMONOLITHIC
+#endif
+
+#include "./wuffs-base.c"
+#include "./wuffs-std-lzw.c"
+#include "./wuffs-std-zlib.c"
+
+// ¡ WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__TIFF) || defined(WUFFS_NONMONOLITHIC)
+
+// ---------------- Status Codes
+
+extern const char wuffs_tiff__error__bad_header[];
+extern const char wuffs_tiff__error__truncated_input[];
+extern const char wuffs_tiff__error__unsupported_tiff_compression[];
+extern const char wuffs_tiff__error__unsupported_tiff_file[];
+
+// ---------------- Public Consts
+
+#define WUFFS_TIFF__QUIRK_CHUNK_MIN_INCL_Y 1772108800
+
+#define WUFFS_TIFF__QUIRK_CHUNK_MAX_EXCL_Y 1772108801
+
+#define WUFFS_TIFF__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 67108860
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_tiff__decoder__struct wuffs_tiff__decoder;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for options.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT
+wuffs_tiff__decoder__initialize(
+    wuffs_tiff__decoder* self,
+    size_t sizeof_star_self,
+    uint64_t wuffs_version,
+    uint32_t options);
+
+size_t
+sizeof__wuffs_tiff__decoder();
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+size_t
+wuffs_tiff__decoder__stats(
+    const wuffs_tiff__decoder* self,
+    wuffs_base__stats* dst_ptr,
+    size_t dst_len);
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_tiff__decoder*
+wuffs_tiff__decoder__alloc();
+
+static inline wuffs_base__image_decoder*
+wuffs_tiff__decoder__alloc_as__wuffs_base__image_decoder() {
+  return (wuffs_base__image_decoder*)(wuffs_tiff__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__image_decoder*
+wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(
+    wuffs_tiff__decoder* p) {
+  return (wuffs_base__image_decoder*)p;
+}
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__set_quirk(
+    wuffs_tiff__decoder* self,
+    uint32_t a_key,
+    uint64_t a_value);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__decode_image_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__decode_frame_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__decode_frame(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32
+wuffs_tiff__decoder__frame_dirty_rect(
+    const wuffs_tiff__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t
+wuffs_tiff__decoder__num_animation_loops(
+    const wuffs_tiff__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_tiff__decoder__num_decoded_frame_configs(
+    const wuffs_tiff__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_tiff__decoder__num_decoded_frames(
+    const wuffs_tiff__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__restart_frame(
+    wuffs_tiff__decoder* self,
+    uint64_t a_index,
+    uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct
+wuffs_tiff__decoder__set_report_metadata(
+    wuffs_tiff__decoder* self,
+    uint32_t a_fourcc,
+    bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__tell_me_more(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_dst,
+    wuffs_base__more_information* a_minfo,
+    wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64
+wuffs_tiff__decoder__workbuf_len(
+    const wuffs_tiff__decoder* self);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_tiff__decoder__struct {
+  // Do not access the private_impl's or private_data's fields directly. There
+  // is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+  // the wuffs_foo__bar__baz functions.
+  //
+  // It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+  // can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+  struct {
+    uint32_t magic;
+    uint32_t active_coroutine;
+    wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+    wuffs_base__vtable null_vtable;
+
+    uint32_t f_width;
+    uint32_t f_height;
+    uint8_t f_call_sequence;
+    bool f_is_big_endian;
+    uint64_t f_header_pos;
+    uint64_t f_seek_pos;
+    uint64_t f_ifd_pos;
+    bool f_ifd_pending;
+    uint32_t f_ifd_phase;
+    uint32_t f_next_ifd_offset;
+    uint64_t f_first_ifd_pos;
+    uint64_t f_frame_config_io_position;
+    uint64_t f_num_decoded_frame_configs_value;
+    uint64_t f_num_decoded_frames_value;
+    uint32_t f_frame_width;
+    uint32_t f_frame_height;
+    uint32_t f_bits_per_sample;
+    uint32_t f_bps_count;
+    uint32_t f_bps_offset;
+    uint32_t f_compression;
+    uint32_t f_photometric;
+    uint32_t f_fill_order;
+    uint32_t f_samples_per_pixel;
+    uint32_t f_rows_per_strip;
+    uint32_t f_planar_config;
+    uint32_t f_predictor;
+    uint32_t f_colormap_count;
+    uint32_t f_colormap_offset;
+    uint32_t f_tile_width;
+    uint32_t f_tile_height;
+    uint32_t f_extra_samples;
+    uint32_t f_sample_format;
+    uint32_t f_chunk_offsets_type;
+    uint32_t f_chunk_offsets_count;
+    uint32_t f_chunk_offsets_value;
+    uint32_t f_chunk_bytecounts_type;
+    uint32_t f_chunk_bytecounts_count;
+    uint32_t f_chunk_bytecounts_value;
+    bool f_is_tiled;
+    bool f_white_is_zero;
+    uint32_t f_src_pixfmt;
+    uint32_t f_src_bytes_per_pixel;
+    uint32_t f_gray_scale;
+    uint32_t f_chunk_width;
+    uint32_t f_chunk_height;
+    uint32_t f_chunks_across;
+    uint32_t f_num_chunks;
+    uint64_t f_bytes_per_row;
+    uint64_t f_workbuf_length;
+    uint32_t f_quirk_chunk_min_incl_y;
+    uint32_t f_quirk_chunk_max_excl_y;
+    uint32_t f_chunk_index;
+    uint32_t f_chunk_phase;
+    uint32_t f_table_phase;
+    uint32_t f_table_base;
+    uint32_t f_table_length;
+    uint32_t f_chunk_x;
+    uint32_t f_chunk_y;
+    uint32_t f_chunk_rows;
+    uint64_t f_chunk_src_pos;
+    uint64_t f_chunk_remaining;
+    uint64_t f_chunk_wpos;
+    uint32_t f_row_y;
+    uint64_t f_row_wi;
+    uint32_t f_packbits_literal;
+    uint32_t f_packbits_run;
+    uint8_t f_packbits_run_byte;
+    bool f_packbits_need_run_byte;
+    wuffs_base__pixel_swizzler f_swizzler;
+
+    wuffs_base__empty_struct (*choosy_undo_predictor)(
+        wuffs_tiff__decoder* self,
+        wuffs_base__slice_u8 a_curr);
+    uint32_t p_decode_image_config[1];
+    uint32_t p_do_decode_image_config[1];
+    uint32_t p_seek_to[1];
+    uint32_t p_decode_ifd[1];
+    uint32_t p_decode_frame_config[1];
+    uint32_t p_do_decode_frame_config[1];
+    uint32_t p_decode_frame[1];
+    uint32_t p_do_decode_frame[1];
+    uint32_t p_read_chunk_table[1];
+    uint32_t p_decode_chunk[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+    uint64_t stats_num_src_bytes;
+    uint64_t stats_num_dst_bytes;
+    wuffs_base__stats_counters stats_funcs[29];
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+  } private_impl;
+
+  struct {
+    wuffs_lzw__decoder f_lzw;
+    wuffs_zlib__decoder f_zlib;
+    uint32_t f_chunk_offsets[256];
+    uint32_t f_chunk_bytecounts[256];
+    uint8_t f_src_palette[1024];
+    uint8_t f_dst_palette[1024];
+
+    struct {
+      uint64_t scratch;
+    } s_do_decode_image_config[1];
+    struct {
+      uint64_t scratch;
+    } s_seek_to[1];
+    struct {
+      uint32_t v_num_entries;
+      uint32_t v_i;
+      uint32_t v_tag;
+      uint32_t v_ty;
+      uint32_t v_count;
+      uint32_t v_n;
+      uint64_t scratch;
+    } s_decode_ifd[1];
+    struct {
+      uint32_t v_base_index;
+      uint32_t v_length;
+      uint32_t v_i;
+      uint64_t v_elem_size;
+      uint64_t v_pos;
+      uint64_t scratch;
+    } s_read_chunk_table[1];
+  } private_data;
+
+#ifdef __cplusplus
+#if defined(WUFFS_BASE__HAVE_UNIQUE_PTR)
+  using unique_ptr = std::unique_ptr<wuffs_tiff__decoder, decltype(&free)>;
+
+  // On failure, the alloc_etc functions return nullptr. They don't throw.
+
+  static inline unique_ptr
+  alloc() {
+    return unique_ptr(wuffs_tiff__decoder__alloc(), &free);
+  }
+
+  static inline wuffs_base__image_decoder::unique_ptr
+  alloc_as__wuffs_base__image_decoder() {
+    return wuffs_base__image_decoder::unique_ptr(
+        wuffs_tiff__decoder__alloc_as__wuffs_base__image_decoder(), &free);
+  }
+#endif  // defined(WUFFS_BASE__HAVE_UNIQUE_PTR)
+
+#if defined(WUFFS_BASE__HAVE_EQ_DELETE) && !defined(WUFFS_IMPLEMENTATION)
+  // Disallow constructing or copying an object via standard C++ mechanisms,
+  // e.g. the "new" operator, as this struct is intentionally opaque. Its total
+  // size and field layout is not part of the public, stable, memory-safe API.
+  // Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+  // call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+  // their first argument) rather than tweaking bar.private_impl.qux fields.
+  //
+  // In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+  // WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+  // order to provide convenience methods. These forward on "this", so that you
+  // can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+  wuffs_tiff__decoder__struct() = delete;
+  wuffs_tiff__decoder__struct(const wuffs_tiff__decoder__struct&) = delete;
+  wuffs_tiff__decoder__struct& operator=(
+      const wuffs_tiff__decoder__struct&) = delete;
+#endif  // defined(WUFFS_BASE__HAVE_EQ_DELETE) && !defined(WUFFS_IMPLEMENTATION)
+
+#if !defined(WUFFS_IMPLEMENTATION)
+  // As above, the size of the struct is not part of the public API, and unless
+  // WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+  // allocated, not stack allocated. Its size is not intended to be known at
+  // compile time, but it is unfortunately divulged as a side effect of
+  // defining C++ convenience methods. Use "sizeof__T()", calling the function,
+  // instead of "sizeof T", invoking the operator. To make the two values
+  // different, so that passing the latter will be rejected by the initialize
+  // function, we add an arbitrary amount of dead weight.
+  uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // !defined(WUFFS_IMPLEMENTATION)
+
+  inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT
+  initialize(
+      size_t sizeof_star_self,
+      uint64_t wuffs_version,
+      uint32_t options) {
+    return wuffs_tiff__decoder__initialize(
+        this, sizeof_star_self, wuffs_version, options);
+  }
+
+  inline wuffs_base__image_decoder*
+  upcast_as__wuffs_base__image_decoder() {
+    return (wuffs_base__image_decoder*)this;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  inline size_t
+  stats(
+      wuffs_base__stats* dst_ptr,
+      size_t dst_len) const {
+    return wuffs_tiff__decoder__stats(this, dst_ptr, dst_len);
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  inline wuffs_base__status
+  set_quirk(
+      uint32_t a_key,
+      uint64_t a_value) {
+    return wuffs_tiff__decoder__set_quirk(this, a_key, a_value);
+  }
+
+  inline wuffs_base__status
+  decode_image_config(
+      wuffs_base__image_config* a_dst,
+      wuffs_base__io_buffer* a_src) {
+    return wuffs_tiff__decoder__decode_image_config(this, a_dst, a_src);
+  }
+
+  inline wuffs_base__status
+  decode_frame_config(
+      wuffs_base__frame_config* a_dst,
+      wuffs_base__io_buffer* a_src) {
+    return wuffs_tiff__decoder__decode_frame_config(this, a_dst, a_src);
+  }
+
+  inline wuffs_base__status
+  decode_frame(
+      wuffs_base__pixel_buffer* a_dst,
+      wuffs_base__io_buffer* a_src,
+      wuffs_base__pixel_blend a_blend,
+      wuffs_base__slice_u8 a_workbuf,
+      wuffs_base__decode_frame_options* a_opts) {
+    return wuffs_tiff__decoder__decode_frame(this, a_dst, a_src, a_blend, a_workbuf, a_opts);
+  }
+
+  inline wuffs_base__rect_ie_u32
+  frame_dirty_rect() const {
+    return wuffs_tiff__decoder__frame_dirty_rect(this);
+  }
+
+  inline uint32_t
+  num_animation_loops() const {
+    return wuffs_tiff__decoder__num_animation_loops(this);
+  }
+
+  inline uint64_t
+  num_decoded_frame_configs() const {
+    return wuffs_tiff__decoder__num_decoded_frame_configs(this);
+  }
+
+  inline uint64_t
+  num_decoded_frames() const {
+    return wuffs_tiff__decoder__num_decoded_frames(this);
+  }
+
+  inline wuffs_base__status
+  restart_frame(
+      uint64_t a_index,
+      uint64_t a_io_position) {
+    return wuffs_tiff__decoder__restart_frame(this, a_index, a_io_position);
+  }
+
+  inline wuffs_base__empty_struct
+  set_report_metadata(
+      uint32_t a_fourcc,
+      bool a_report) {
+    return wuffs_tiff__decoder__set_report_metadata(this, a_fourcc, a_report);
+  }
+
+  inline wuffs_base__status
+  tell_me_more(
+      wuffs_base__io_buffer* a_dst,
+      wuffs_base__more_information* a_minfo,
+      wuffs_base__io_buffer* a_src) {
+    return wuffs_tiff__decoder__tell_me_more(this, a_dst, a_minfo, a_src);
+  }
+
+  inline wuffs_base__range_ii_u64
+  workbuf_len() const {
+    return wuffs_tiff__decoder__workbuf_len(this);
+  }
+
+#endif  // __cplusplus
+};  // struct wuffs_tiff__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__TIFF) || defined(WUFFS_NONMONOLITHIC)
+
+// ‼ WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__TIFF)
+
+// ---------------- Status Codes Implementations
+
+const char wuffs_tiff__error__bad_header[] = "#tiff: bad header";
+const char wuffs_tiff__error__truncated_input[] = "#tiff: truncated input";
+const char wuffs_tiff__error__unsupported_tiff_compression[] = "#tiff: unsupported TIFF compression";
+const char wuffs_tiff__error__unsupported_tiff_file[] = "#tiff: unsupported TIFF file";
+
+// ---------------- Private Consts
+
+#define WUFFS_TIFF__QUIRKS_BASE 1772108800
+
+#define WUFFS_TIFF__COMPRESSION_NONE 1
+
+#define WUFFS_TIFF__COMPRESSION_LZW 5
+
+#define WUFFS_TIFF__COMPRESSION_DEFLATE 8
+
+#define WUFFS_TIFF__COMPRESSION_PACKBITS 32773
+
+#define WUFFS_TIFF__PHOTOMETRIC_WHITE_IS_ZERO 0
+
+#define WUFFS_TIFF__PHOTOMETRIC_BLACK_IS_ZERO 1
+
+#define WUFFS_TIFF__PHOTOMETRIC_RGB 2
+
+#define WUFFS_TIFF__PHOTOMETRIC_PALETTE 3
+
+#define WUFFS_TIFF__TYPE_BYTE 1
+
+#define WUFFS_TIFF__TYPE_SHORT 3
+
+#define WUFFS_TIFF__TYPE_LONG 4
+
+#define WUFFS_TIFF__TAG_IMAGE_WIDTH 256
+
+#define WUFFS_TIFF__TAG_IMAGE_LENGTH 257
+
+#define WUFFS_TIFF__TAG_BITS_PER_SAMPLE 258
+
+#define WUFFS_TIFF__TAG_COMPRESSION 259
+
+#define WUFFS_TIFF__TAG_PHOTOMETRIC 262
+
+#define WUFFS_TIFF__TAG_FILL_ORDER 266
+
+#define WUFFS_TIFF__TAG_STRIP_OFFSETS 273
+
+#define WUFFS_TIFF__TAG_SAMPLES_PER_PIXEL 277
+
+#define WUFFS_TIFF__TAG_ROWS_PER_STRIP 278
+
+#define WUFFS_TIFF__TAG_STRIP_BYTE_COUNTS 279
+
+#define WUFFS_TIFF__TAG_PLANAR_CONFIG 284
+
+#define WUFFS_TIFF__TAG_PREDICTOR 317
+
+#define WUFFS_TIFF__TAG_COLOR_MAP 320
+
+#define WUFFS_TIFF__TAG_TILE_WIDTH 322
+
+#define WUFFS_TIFF__TAG_TILE_LENGTH 323
+
+#define WUFFS_TIFF__TAG_TILE_OFFSETS 324
+
+#define WUFFS_TIFF__TAG_TILE_BYTE_COUNTS 325
+
+#define WUFFS_TIFF__TAG_EXTRA_SAMPLES 338
+
+#define WUFFS_TIFF__TAG_SAMPLE_FORMAT 339
+
+#define WUFFS_TIFF__CHUNK_TABLE_LENGTH 256
+
+#define WUFFS_TIFF__MAX_NUM_FRAMES 65535
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__choose_predictor_implementation(
+    wuffs_tiff__decoder* self);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor__choosy_default(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_1_fallback(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_3_fallback(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_4_fallback(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_1_x86_sse42(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_3_x86_sse42(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_4_x86_sse42(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+static wuffs_base__status
+wuffs_tiff__decoder__do_decode_image_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status
+wuffs_tiff__decoder__seek_to(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint64_t a_pos);
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_ifd(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_src);
+
+static uint32_t
+wuffs_tiff__decoder__first_value(
+    const wuffs_tiff__decoder* self,
+    uint32_t a_ty,
+    uint32_t a_value);
+
+static uint32_t
+wuffs_tiff__decoder__second_value(
+    const wuffs_tiff__decoder* self,
+    uint32_t a_ty,
+    uint32_t a_value);
+
+static wuffs_base__status
+wuffs_tiff__decoder__process_ifd_entry(
+    wuffs_tiff__decoder* self,
+    uint32_t a_tag,
+    uint32_t a_ty,
+    uint32_t a_count,
+    uint32_t a_value);
+
+static wuffs_base__status
+wuffs_tiff__decoder__process_ifd(
+    wuffs_tiff__decoder* self);
+
+static wuffs_base__status
+wuffs_tiff__decoder__do_decode_frame_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status
+wuffs_tiff__decoder__do_decode_frame(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts);
+
+static wuffs_base__status
+wuffs_tiff__decoder__read_chunk_table(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_chunk(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_rows_none(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_rows_packbits(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__process_row(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__swap_u16s(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__invert(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_u16be(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr);
+
+// ---------------- VTables
+
+const wuffs_base__image_decoder__func_ptrs
+wuffs_tiff__decoder__func_ptrs_for__wuffs_base__image_decoder = {
+  (wuffs_base__status(*)(void*,
+      wuffs_base__pixel_buffer*,
+      wuffs_base__io_buffer*,
+      wuffs_base__pixel_blend,
+      wuffs_base__slice_u8,
+      wuffs_base__decode_frame_options*))(&wuffs_tiff__decoder__decode_frame),
+  (wuffs_base__status(*)(void*,
+      wuffs_base__frame_config*,
+      wuffs_base__io_buffer*))(&wuffs_tiff__decoder__decode_frame_config),
+  (wuffs_base__status(*)(void*,
+      wuffs_base__image_config*,
+      wuffs_base__io_buffer*))(&wuffs_tiff__decoder__decode_image_config),
+  (wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_tiff__decoder__frame_dirty_rect),
+  (uint32_t(*)(const void*))(&wuffs_tiff__decoder__num_animation_loops),
+  (uint64_t(*)(const void*))(&wuffs_tiff__decoder__num_decoded_frame_configs),
+  (uint64_t(*)(const void*))(&wuffs_tiff__decoder__num_decoded_frames),
+  (wuffs_base__status(*)(void*,
+      uint64_t,
+      uint64_t))(&wuffs_tiff__decoder__restart_frame),
+  (wuffs_base__status(*)(void*,
+      uint32_t,
+      uint64_t))(&wuffs_tiff__decoder__set_quirk),
+  (wuffs_base__empty_struct(*)(void*,
+      uint32_t,
+      bool))(&wuffs_tiff__decoder__set_report_metadata),
+  (wuffs_base__status(*)(void*,
+      wuffs_base__io_buffer*,
+      wuffs_base__more_information*,
+      wuffs_base__io_buffer*))(&wuffs_tiff__decoder__tell_me_more),
+  (wuffs_base__range_ii_u64(*)(const void*))(&wuffs_tiff__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT
+wuffs_tiff__decoder__initialize(
+    wuffs_tiff__decoder* self,
+    size_t sizeof_star_self,
+    uint64_t wuffs_version,
+    uint32_t options){
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (sizeof(*self) != sizeof_star_self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+  }
+  if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) ||
+      (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+  }
+
+  if ((options & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+    // The whole point of this if-check is to detect an uninitialized *self.
+    // We disable the warning on GCC. Clang-5.0 does not have this warning.
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    if (self->private_impl.magic != 0) {
+      return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+    }
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+  } else {
+    if ((options & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+      memset(self, 0, sizeof(*self));
+      options |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+    } else {
+      memset(&(self->private_impl), 0, sizeof(self->private_impl));
+    }
+  }
+
+  self->private_impl.choosy_undo_predictor = &wuffs_tiff__decoder__undo_predictor__choosy_default;
+
+  {
+    wuffs_base__status z = wuffs_lzw__decoder__initialize(
+        &self->private_data.f_lzw, sizeof(self->private_data.f_lzw), WUFFS_VERSION, options);
+    if (z.repr) {
+      return z;
+    }
+  }
+  {
+    wuffs_base__status z = wuffs_zlib__decoder__initialize(
+        &self->private_data.f_zlib, sizeof(self->private_data.f_zlib), WUFFS_VERSION, options);
+    if (z.repr) {
+      return z;
+    }
+  }
+  self->private_impl.magic = WUFFS_BASE__MAGIC;
+  self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name =
+      wuffs_base__image_decoder__vtable_name;
+  self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers =
+      (const void*)(&wuffs_tiff__decoder__func_ptrs_for__wuffs_base__image_decoder);
+  return wuffs_base__make_status(NULL);
+}
+
+wuffs_tiff__decoder*
+wuffs_tiff__decoder__alloc() {
+  wuffs_tiff__decoder* x =
+      (wuffs_tiff__decoder*)(calloc(sizeof(wuffs_tiff__decoder), 1));
+  if (!x) {
+    return NULL;
+  }
+  if (wuffs_tiff__decoder__initialize(
+      x, sizeof(wuffs_tiff__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+    free(x);
+    return NULL;
+  }
+  return x;
+}
+
+size_t
+sizeof__wuffs_tiff__decoder() {
+  return sizeof(wuffs_tiff__decoder);
+}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+static const char* const wuffs_tiff__decoder__stats_func_names[29] = {
+  "tiff.decoder.choose_predictor_implementation",
+  "tiff.decoder.undo_predictor",
+  "tiff.decoder.undo_predictor_distance_1_fallback",
+  "tiff.decoder.undo_predictor_distance_3_fallback",
+  "tiff.decoder.undo_predictor_distance_4_fallback",
+  "tiff.decoder.undo_predictor_distance_1_x86_sse42",
+  "tiff.decoder.undo_predictor_distance_3_x86_sse42",
+  "tiff.decoder.undo_predictor_distance_4_x86_sse42",
+  "tiff.decoder.set_quirk",
+  "tiff.decoder.decode_image_config",
+  "tiff.decoder.do_decode_image_config",
+  "tiff.decoder.seek_to",
+  "tiff.decoder.decode_ifd",
+  "tiff.decoder.process_ifd_entry",
+  "tiff.decoder.process_ifd",
+  "tiff.decoder.decode_frame_config",
+  "tiff.decoder.do_decode_frame_config",
+  "tiff.decoder.decode_frame",
+  "tiff.decoder.do_decode_frame",
+  "tiff.decoder.read_chunk_table",
+  "tiff.decoder.decode_chunk",
+  "tiff.decoder.decode_rows_none",
+  "tiff.decoder.decode_rows_packbits",
+  "tiff.decoder.process_row",
+  "tiff.decoder.swap_u16s",
+  "tiff.decoder.invert",
+  "tiff.decoder.undo_predictor_u16be",
+  "tiff.decoder.restart_frame",
+  "tiff.decoder.tell_me_more",
+};
+
+size_t
+wuffs_tiff__decoder__stats(
+    const wuffs_tiff__decoder* self,
+    wuffs_base__stats* dst_ptr,
+    size_t dst_len) {
+  if (!self) {
+    return 0;
+  }
+  size_t n = 1;
+  if (dst_len > 0) {
+    dst_ptr->struct_name = "tiff.decoder";
+    dst_ptr->num_src_bytes = self->private_impl.stats_num_src_bytes;
+    dst_ptr->num_dst_bytes = self->private_impl.stats_num_dst_bytes;
+    dst_ptr->num_funcs = 29;
+    dst_ptr->func_names = wuffs_tiff__decoder__stats_func_names;
+    dst_ptr->func_counters = self->private_impl.stats_funcs;
+  }
+  n += wuffs_lzw__decoder__stats(
+      &self->private_data.f_lzw,
+      (n < dst_len) ? (dst_ptr + n) : NULL,
+      (n < dst_len) ? (dst_len - n) : 0);
+  n += wuffs_zlib__decoder__stats(
+      &self->private_data.f_zlib,
+      (n < dst_len) ? (dst_ptr + n) : NULL,
+      (n < dst_len) ? (dst_len - n) : 0);
+  return n;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func tiff.decoder.choose_predictor_implementation
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__choose_predictor_implementation(
+    wuffs_tiff__decoder* self) {
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[0].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (self->private_impl.f_bits_per_sample != 8) {
+    return wuffs_base__make_empty_struct();
+  } else if (self->private_impl.f_samples_per_pixel == 1) {
+    self->private_impl.choosy_undo_predictor = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_tiff__decoder__undo_predictor_distance_1_x86_sse42 :
+#endif
+        &wuffs_tiff__decoder__undo_predictor_distance_1_fallback);
+  } else if (self->private_impl.f_samples_per_pixel == 3) {
+    self->private_impl.choosy_undo_predictor = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_tiff__decoder__undo_predictor_distance_3_x86_sse42 :
+#endif
+        &wuffs_tiff__decoder__undo_predictor_distance_3_fallback);
+  } else if (self->private_impl.f_samples_per_pixel == 4) {
+    self->private_impl.choosy_undo_predictor = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_tiff__decoder__undo_predictor_distance_4_x86_sse42 :
+#endif
+        &wuffs_tiff__decoder__undo_predictor_distance_4_fallback);
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.undo_predictor
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  return (*self->private_impl.choosy_undo_predictor)(self, a_curr);
+}
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor__choosy_default(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  uint64_t v_distance = 0;
+  uint8_t v_fa = 0;
+  uint64_t v_i_start = 0;
+  uint64_t v_i = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[1].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_distance = ((uint64_t)(wuffs_base__u32__min(self->private_impl.f_samples_per_pixel, 4)));
+  if (v_distance == 0) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_i_start = 0;
+  while (v_i_start < v_distance) {
+    v_fa = 0;
+    v_i = v_i_start;
+    while (v_i < ((uint64_t)(a_curr.len))) {
+      a_curr.ptr[v_i] = ((uint8_t)(a_curr.ptr[v_i] + v_fa));
+      v_fa = a_curr.ptr[v_i];
+      v_i += v_distance;
+    }
+    v_i_start += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.undo_predictor_distance_1_fallback
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_1_fallback(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  uint8_t v_fa = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[2].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 1;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 4) * 4);
+    while (v_curr.ptr < i_end0_curr) {
+      v_fa = ((uint8_t)(v_fa + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa;
+      v_curr.ptr += 1;
+      v_fa = ((uint8_t)(v_fa + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa;
+      v_curr.ptr += 1;
+      v_fa = ((uint8_t)(v_fa + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa;
+      v_curr.ptr += 1;
+      v_fa = ((uint8_t)(v_fa + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa;
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end1_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end1_curr) {
+      v_fa = ((uint8_t)(v_fa + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa;
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.undo_predictor_distance_3_fallback
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_3_fallback(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  uint8_t v_fa0 = 0;
+  uint8_t v_fa1 = 0;
+  uint8_t v_fa2 = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[3].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 3;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 6) * 6);
+    while (v_curr.ptr < i_end0_curr) {
+      v_fa0 = ((uint8_t)(v_fa0 + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa0;
+      v_fa1 = ((uint8_t)(v_fa1 + v_curr.ptr[1]));
+      v_curr.ptr[1] = v_fa1;
+      v_fa2 = ((uint8_t)(v_fa2 + v_curr.ptr[2]));
+      v_curr.ptr[2] = v_fa2;
+      v_curr.ptr += 3;
+      v_fa0 = ((uint8_t)(v_fa0 + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa0;
+      v_fa1 = ((uint8_t)(v_fa1 + v_curr.ptr[1]));
+      v_curr.ptr[1] = v_fa1;
+      v_fa2 = ((uint8_t)(v_fa2 + v_curr.ptr[2]));
+      v_curr.ptr[2] = v_fa2;
+      v_curr.ptr += 3;
+    }
+    v_curr.len = 3;
+    uint8_t* i_end1_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 3) * 3);
+    while (v_curr.ptr < i_end1_curr) {
+      v_fa0 = ((uint8_t)(v_fa0 + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa0;
+      v_fa1 = ((uint8_t)(v_fa1 + v_curr.ptr[1]));
+      v_curr.ptr[1] = v_fa1;
+      v_fa2 = ((uint8_t)(v_fa2 + v_curr.ptr[2]));
+      v_curr.ptr[2] = v_fa2;
+      v_curr.ptr += 3;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end2_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end2_curr) {
+      v_fa0 = ((uint8_t)(v_fa0 + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa0;
+      v_fa0 = v_fa1;
+      v_fa1 = v_fa2;
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.undo_predictor_distance_4_fallback
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_4_fallback(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  uint8_t v_fa0 = 0;
+  uint8_t v_fa1 = 0;
+  uint8_t v_fa2 = 0;
+  uint8_t v_fa3 = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[4].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 4;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 4) * 4);
+    while (v_curr.ptr < i_end0_curr) {
+      v_fa0 = ((uint8_t)(v_fa0 + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa0;
+      v_fa1 = ((uint8_t)(v_fa1 + v_curr.ptr[1]));
+      v_curr.ptr[1] = v_fa1;
+      v_fa2 = ((uint8_t)(v_fa2 + v_curr.ptr[2]));
+      v_curr.ptr[2] = v_fa2;
+      v_fa3 = ((uint8_t)(v_fa3 + v_curr.ptr[3]));
+      v_curr.ptr[3] = v_fa3;
+      v_curr.ptr += 4;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end1_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end1_curr) {
+      v_fa0 = ((uint8_t)(v_fa0 + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa0;
+      v_fa0 = v_fa1;
+      v_fa1 = v_fa2;
+      v_fa2 = v_fa3;
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func tiff.decoder.undo_predictor_distance_1_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_1_x86_sse42(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  __m128i v_x128 = {0};
+  __m128i v_a128 = {0};
+  __m128i v_k128 = {0};
+  uint8_t v_fa = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[5].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_k128 = _mm_set1_epi8((int8_t)(15));
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 16;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 16) * 16);
+    while (v_curr.ptr < i_end0_curr) {
+      v_x128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_curr.ptr));
+      v_x128 = _mm_add_epi8(v_x128, _mm_slli_si128(v_x128, (int32_t)(1)));
+      v_x128 = _mm_add_epi8(v_x128, _mm_slli_si128(v_x128, (int32_t)(2)));
+      v_x128 = _mm_add_epi8(v_x128, _mm_slli_si128(v_x128, (int32_t)(4)));
+      v_x128 = _mm_add_epi8(v_x128, _mm_slli_si128(v_x128, (int32_t)(8)));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      _mm_storeu_si128((__m128i*)(void*)(v_curr.ptr), v_x128);
+      v_a128 = _mm_shuffle_epi8(v_x128, v_k128);
+      v_curr.ptr += 16;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end1_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end1_curr) {
+      v_fa = ((uint8_t)((((uint32_t)(_mm_cvtsi128_si32(v_a128))) & 255)));
+      v_fa = ((uint8_t)(v_fa + v_curr.ptr[0]));
+      v_curr.ptr[0] = v_fa;
+      v_a128 = _mm_cvtsi32_si128((int32_t)(((uint32_t)(v_fa))));
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func tiff.decoder.undo_predictor_distance_3_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_3_x86_sse42(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  __m128i v_x128 = {0};
+  __m128i v_a128 = {0};
+  __m128i v_k128 = {0};
+  __m128i v_m128 = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[6].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_k128 = _mm_set_epi8((int8_t)(128), (int8_t)(14), (int8_t)(13), (int8_t)(12), (int8_t)(14), (int8_t)(13), (int8_t)(12), (int8_t)(14), (int8_t)(13), (int8_t)(12), (int8_t)(14), (int8_t)(13), (int8_t)(12), (int8_t)(14), (int8_t)(13), (int8_t)(12));
+  v_m128 = _mm_set_epi8((int8_t)(0), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255), (int8_t)(255));
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 16;
+    uint8_t* i_end0_curr = v_curr.ptr + wuffs_base__iterate_total_advance((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)), 16, 15);
+    while (v_curr.ptr < i_end0_curr) {
+      v_x128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_curr.ptr));
+      v_x128 = _mm_add_epi8(v_x128, _mm_and_si128(_mm_slli_si128(v_x128, (int32_t)(3)), v_m128));
+      v_x128 = _mm_add_epi8(v_x128, _mm_and_si128(_mm_slli_si128(v_x128, (int32_t)(6)), v_m128));
+      v_x128 = _mm_add_epi8(v_x128, _mm_and_si128(_mm_slli_si128(v_x128, (int32_t)(12)), v_m128));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      _mm_storeu_si128((__m128i*)(void*)(v_curr.ptr), v_x128);
+      v_a128 = _mm_shuffle_epi8(v_x128, v_k128);
+      v_curr.ptr += 15;
+    }
+    v_curr.len = 3;
+    uint8_t* i_end1_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 3) * 3);
+    while (v_curr.ptr < i_end1_curr) {
+      v_x128 = _mm_cvtsi32_si128((int32_t)(wuffs_base__peek_u24le__no_bounds_check(v_curr.ptr)));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      v_a128 = v_x128;
+      wuffs_base__poke_u24le__no_bounds_check(v_curr.ptr, ((uint32_t)(_mm_cvtsi128_si32(v_x128))));
+      v_curr.ptr += 3;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end2_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end2_curr) {
+      v_x128 = _mm_cvtsi32_si128((int32_t)(((uint32_t)(v_curr.ptr[0]))));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      v_a128 = _mm_srli_si128(v_a128, (int32_t)(1));
+      v_curr.ptr[0] = ((uint8_t)((((uint32_t)(_mm_cvtsi128_si32(v_x128))) & 255)));
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func tiff.decoder.undo_predictor_distance_4_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_distance_4_x86_sse42(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  __m128i v_x128 = {0};
+  __m128i v_a128 = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[7].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 16;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 16) * 16);
+    while (v_curr.ptr < i_end0_curr) {
+      v_x128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_curr.ptr));
+      v_x128 = _mm_add_epi8(v_x128, _mm_slli_si128(v_x128, (int32_t)(4)));
+      v_x128 = _mm_add_epi8(v_x128, _mm_slli_si128(v_x128, (int32_t)(8)));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      _mm_storeu_si128((__m128i*)(void*)(v_curr.ptr), v_x128);
+      v_a128 = _mm_shuffle_epi32(v_x128, (int32_t)(255));
+      v_curr.ptr += 16;
+    }
+    v_curr.len = 4;
+    uint8_t* i_end1_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 4) * 4);
+    while (v_curr.ptr < i_end1_curr) {
+      v_x128 = _mm_cvtsi32_si128((int32_t)(wuffs_base__peek_u32le__no_bounds_check(v_curr.ptr)));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      v_a128 = v_x128;
+      wuffs_base__poke_u32le__no_bounds_check(v_curr.ptr, ((uint32_t)(_mm_cvtsi128_si32(v_x128))));
+      v_curr.ptr += 4;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end2_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end2_curr) {
+      v_x128 = _mm_cvtsi32_si128((int32_t)(((uint32_t)(v_curr.ptr[0]))));
+      v_x128 = _mm_add_epi8(v_x128, v_a128);
+      v_a128 = _mm_srli_si128(v_a128, (int32_t)(1));
+      v_curr.ptr[0] = ((uint8_t)((((uint32_t)(_mm_cvtsi128_si32(v_x128))) & 255)));
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// -------- func tiff.decoder.set_quirk
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__set_quirk(
+    wuffs_tiff__decoder* self,
+    uint32_t a_key,
+    uint64_t a_value) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[8].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (a_key == 1772108800) {
+    self->private_impl.f_quirk_chunk_min_incl_y = ((uint32_t)(wuffs_base__u64__min(a_value, 4294967295)));
+    return wuffs_base__make_status(NULL);
+  } else if (a_key == 1772108801) {
+    self->private_impl.f_quirk_chunk_max_excl_y = ((uint32_t)(wuffs_base__u64__min(a_value, 4294967295)));
+    return wuffs_base__make_status(NULL);
+  }
+  return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+}
+
+// -------- func tiff.decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__decode_image_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 1)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[9].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_tiff__decoder__do_decode_image_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_tiff__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_tiff__decoder__do_decode_image_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_tiff__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_decode_image_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[9].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[9].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func tiff.decoder.do_decode_image_config
+
+static wuffs_base__status
+wuffs_tiff__decoder__do_decode_image_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_magic = 0;
+  uint32_t v_offset = 0;
+  uint32_t v_dst_pixfmt = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[10].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_image_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_call_sequence != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    }
+    if ( ! self->private_impl.f_ifd_pending) {
+      self->private_impl.f_header_pos = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        uint32_t t_0;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_0 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_0 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;
+            if (num_bits_0 == 24) {
+              t_0 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_0 += 8;
+            *scratch |= ((uint64_t)(num_bits_0)) << 56;
+          }
+        }
+        v_magic = t_0;
+      }
+      if (v_magic == 2771273) {
+        self->private_impl.f_is_big_endian = false;
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+          uint32_t t_1;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_1 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+              if (num_bits_1 == 24) {
+                t_1 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_1 += 8;
+              *scratch |= ((uint64_t)(num_bits_1)) << 56;
+            }
+          }
+          v_offset = t_1;
+        }
+      } else if (v_magic == 704662861) {
+        self->private_impl.f_is_big_endian = true;
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+          uint32_t t_2;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_2 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_2 = ((uint32_t)(*scratch & 0xFF));
+              *scratch >>= 8;
+              *scratch <<= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);
+              if (num_bits_2 == 24) {
+                t_2 = ((uint32_t)(*scratch >> 32));
+                break;
+              }
+              num_bits_2 += 8;
+              *scratch |= ((uint64_t)(num_bits_2));
+            }
+          }
+          v_offset = t_2;
+        }
+      } else {
+        status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+        goto exit;
+      }
+      if (v_offset < 8) {
+        status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+        goto exit;
+      }
+      self->private_impl.f_ifd_pos = wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(v_offset)));
+      self->private_impl.f_ifd_pending = true;
+    }
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(7);
+    status = wuffs_tiff__decoder__decode_ifd(self, a_src);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    if ((self->private_impl.f_frame_width > 16777215) || (self->private_impl.f_frame_height > 16777215)) {
+      status = wuffs_base__make_status(wuffs_base__error__unsupported_image_dimension);
+      goto exit;
+    }
+    self->private_impl.f_width = self->private_impl.f_frame_width;
+    self->private_impl.f_height = self->private_impl.f_frame_height;
+    self->private_impl.f_first_ifd_pos = self->private_impl.f_ifd_pos;
+    self->private_impl.f_frame_config_io_position = self->private_impl.f_ifd_pos;
+    if (a_dst != NULL) {
+      v_dst_pixfmt = self->private_impl.f_src_pixfmt;
+      if (v_dst_pixfmt == 537919499) {
+        v_dst_pixfmt = 536870923;
+      } else if (v_dst_pixfmt == 2684356744) {
+        v_dst_pixfmt = 2147485832;
+      } else if (v_dst_pixfmt == 2701166728) {
+        v_dst_pixfmt = 2164295816;
+      } else if (v_dst_pixfmt == 2717943944) {
+        v_dst_pixfmt = 2181073032;
+      } else if (v_dst_pixfmt == 2198077448) {
+        v_dst_pixfmt = 2164295816;
+      }
+      wuffs_base__image_config__set(
+          a_dst,
+          v_dst_pixfmt,
+          0,
+          self->private_impl.f_width,
+          self->private_impl.f_height,
+          self->private_impl.f_first_ifd_pos,
+          (self->private_impl.f_extra_samples == 0));
+    }
+    self->private_impl.f_call_sequence = 32;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_call_sequence != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    }
+    if ( ! self->private_impl.f_ifd_pending) {
+      self->private_impl.f_header_pos = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        uint32_t t_0;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_0 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_0 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;
+            if (num_bits_0 == 24) {
+              t_0 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_0 += 8;
+            *scratch |= ((uint64_t)(num_bits_0)) << 56;
+          }
+        }
+        v_magic = t_0;
+      }
+      if (v_magic == 2771273) {
+        self->private_impl.f_is_big_endian = false;
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+          uint32_t t_1;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_1 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+              if (num_bits_1 == 24) {
+                t_1 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_1 += 8;
+              *scratch |= ((uint64_t)(num_bits_1)) << 56;
+            }
+          }
+          v_offset = t_1;
+        }
+      } else if (v_magic == 704662861) {
+        self->private_impl.f_is_big_endian = true;
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+          uint32_t t_2;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_2 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_2 = ((uint32_t)(*scratch & 0xFF));
+              *scratch >>= 8;
+              *scratch <<= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);
+              if (num_bits_2 == 24) {
+                t_2 = ((uint32_t)(*scratch >> 32));
+                break;
+              }
+              num_bits_2 += 8;
+              *scratch |= ((uint64_t)(num_bits_2));
+            }
+          }
+          v_offset = t_2;
+        }
+      } else {
+        status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+        goto exit;
+      }
+      if (v_offset < 8) {
+        status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+        goto exit;
+      }
+      self->private_impl.f_ifd_pos = wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(v_offset)));
+      self->private_impl.f_ifd_pending = true;
+    }
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+    status = wuffs_tiff__decoder__decode_ifd(self, a_src);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    if ((self->private_impl.f_frame_width > 16777215) || (self->private_impl.f_frame_height > 16777215)) {
+      status = wuffs_base__make_status(wuffs_base__error__unsupported_image_dimension);
+      goto exit;
+    }
+    self->private_impl.f_width = self->private_impl.f_frame_width;
+    self->private_impl.f_height = self->private_impl.f_frame_height;
+    self->private_impl.f_first_ifd_pos = self->private_impl.f_ifd_pos;
+    self->private_impl.f_frame_config_io_position = self->private_impl.f_ifd_pos;
+    if (a_dst != NULL) {
+      v_dst_pixfmt = self->private_impl.f_src_pixfmt;
+      if (v_dst_pixfmt == 537919499) {
+        v_dst_pixfmt = 536870923;
+      } else if (v_dst_pixfmt == 2684356744) {
+        v_dst_pixfmt = 2147485832;
+      } else if (v_dst_pixfmt == 2701166728) {
+        v_dst_pixfmt = 2164295816;
+      } else if (v_dst_pixfmt == 2717943944) {
+        v_dst_pixfmt = 2181073032;
+      } else if (v_dst_pixfmt == 2198077448) {
+        v_dst_pixfmt = 2164295816;
+      }
+      wuffs_base__image_config__set(
+          a_dst,
+          v_dst_pixfmt,
+          0,
+          self->private_impl.f_width,
+          self->private_impl.f_height,
+          self->private_impl.f_first_ifd_pos,
+          (self->private_impl.f_extra_samples == 0));
+    }
+    self->private_impl.f_call_sequence = 32;
+
+    goto ok;
+    ok:
+    self->private_impl.p_do_decode_image_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[10].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[10].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.seek_to
+
+static wuffs_base__status
+wuffs_tiff__decoder__seek_to(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint64_t a_pos) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint64_t v_position = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[11].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_seek_to[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_position = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+    if (a_pos < v_position) {
+      self->private_impl.f_seek_pos = a_pos;
+      self->private_impl.f_call_sequence |= 16;
+      status = wuffs_base__make_status(wuffs_base__note__i_o_redirect);
+      goto ok;
+    }
+    self->private_data.s_seek_to[0].scratch = (a_pos - v_position);
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+    if (self->private_data.s_seek_to[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+      self->private_data.s_seek_to[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+      iop_a_src = io2_a_src;
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      goto suspend;
+    }
+    iop_a_src += self->private_data.s_seek_to[0].scratch;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_position = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+    if (a_pos < v_position) {
+      self->private_impl.f_seek_pos = a_pos;
+      self->private_impl.f_call_sequence |= 16;
+      status = wuffs_base__make_status(wuffs_base__note__i_o_redirect);
+      goto ok;
+    }
+    self->private_data.s_seek_to[0].scratch = (a_pos - v_position);
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+    if (self->private_data.s_seek_to[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+      self->private_data.s_seek_to[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+      iop_a_src = io2_a_src;
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      goto suspend;
+    }
+    iop_a_src += self->private_data.s_seek_to[0].scratch;
+
+    ok:
+    self->private_impl.p_seek_to[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_seek_to[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[11].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[11].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.decode_ifd
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_ifd(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  uint32_t v_num_entries = 0;
+  uint32_t v_i = 0;
+  uint32_t v_tag = 0;
+  uint32_t v_ty = 0;
+  uint32_t v_count = 0;
+  uint32_t v_value = 0;
+  uint32_t v_bps = 0;
+  uint32_t v_n = 0;
+  uint32_t v_r = 0;
+  uint32_t v_g = 0;
+  uint32_t v_b = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[12].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_ifd[0];
+  if (coro_susp_point) {
+    v_num_entries = self->private_data.s_decode_ifd[0].v_num_entries;
+    v_i = self->private_data.s_decode_ifd[0].v_i;
+    v_tag = self->private_data.s_decode_ifd[0].v_tag;
+    v_ty = self->private_data.s_decode_ifd[0].v_ty;
+    v_count = self->private_data.s_decode_ifd[0].v_count;
+    v_n = self->private_data.s_decode_ifd[0].v_n;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_ifd_phase == 0) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      status = wuffs_tiff__decoder__seek_to(self, a_src, self->private_impl.f_ifd_pos);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_frame_width = 0;
+      self->private_impl.f_frame_height = 0;
+      self->private_impl.f_bits_per_sample = 1;
+      self->private_impl.f_bps_count = 0;
+      self->private_impl.f_bps_offset = 0;
+      self->private_impl.f_compression = 1;
+      self->private_impl.f_photometric = 4294967295;
+      self->private_impl.f_fill_order = 1;
+      self->private_impl.f_samples_per_pixel = 1;
+      self->private_impl.f_rows_per_strip = 4294967295;
+      self->private_impl.f_planar_config = 1;
+      self->private_impl.f_predictor = 1;
+      self->private_impl.f_colormap_count = 0;
+      self->private_impl.f_colormap_offset = 0;
+      self->private_impl.f_tile_width = 0;
+      self->private_impl.f_tile_height = 0;
+      self->private_impl.f_extra_samples = 0;
+      self->private_impl.f_sample_format = 1;
+      self->private_impl.f_chunk_offsets_type = 0;
+      self->private_impl.f_chunk_offsets_count = 0;
+      self->private_impl.f_chunk_offsets_value = 0;
+      self->private_impl.f_chunk_bytecounts_type = 0;
+      self->private_impl.f_chunk_bytecounts_count = 0;
+      self->private_impl.f_chunk_bytecounts_value = 0;
+      self->private_impl.f_is_tiled = false;
+      if (self->private_impl.f_is_big_endian) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          uint32_t t_0;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+            t_0 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+            iop_a_src += 2;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_0 = ((uint32_t)(*scratch & 0xFF));
+              *scratch >>= 8;
+              *scratch <<= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);
+              if (num_bits_0 == 8) {
+                t_0 = ((uint32_t)(*scratch >> 48));
+                break;
+              }
+              num_bits_0 += 8;
+              *scratch |= ((uint64_t)(num_bits_0));
+            }
+          }
+          v_num_entries = t_0;
+        }
+      } else {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+          uint32_t t_1;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+            t_1 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+            iop_a_src += 2;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+              if (num_bits_1 == 8) {
+                t_1 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_1 += 8;
+              *scratch |= ((uint64_t)(num_bits_1)) << 56;
+            }
+          }
+          v_num_entries = t_1;
+        }
+      }
+      if (v_num_entries == 0) {
+        status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+        goto exit;
+      }
+      while (v_i < v_num_entries) {
+        if (self->private_impl.f_is_big_endian) {
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+            uint32_t t_2;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_2 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(7);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_2 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);
+                if (num_bits_2 == 8) {
+                  t_2 = ((uint32_t)(*scratch >> 48));
+                  break;
+                }
+                num_bits_2 += 8;
+                *scratch |= ((uint64_t)(num_bits_2));
+              }
+            }
+            v_tag = t_2;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(8);
+            uint32_t t_3;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_3 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(9);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_3 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_3);
+                if (num_bits_3 == 8) {
+                  t_3 = ((uint32_t)(*scratch >> 48));
+                  break;
+                }
+                num_bits_3 += 8;
+                *scratch |= ((uint64_t)(num_bits_3));
+              }
+            }
+            v_ty = t_3;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(10);
+            uint32_t t_4;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_4 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(11);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_4 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_4);
+                if (num_bits_4 == 24) {
+                  t_4 = ((uint32_t)(*scratch >> 32));
+                  break;
+                }
+                num_bits_4 += 8;
+                *scratch |= ((uint64_t)(num_bits_4));
+              }
+            }
+            v_count = t_4;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(12);
+            uint32_t t_5;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_5 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(13);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_5 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_5);
+                if (num_bits_5 == 24) {
+                  t_5 = ((uint32_t)(*scratch >> 32));
+                  break;
+                }
+                num_bits_5 += 8;
+                *scratch |= ((uint64_t)(num_bits_5));
+              }
+            }
+            v_value = t_5;
+          }
+        } else {
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(14);
+            uint32_t t_6;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_6 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(15);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_6 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;
+                if (num_bits_6 == 8) {
+                  t_6 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_6 += 8;
+                *scratch |= ((uint64_t)(num_bits_6)) << 56;
+              }
+            }
+            v_tag = t_6;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(16);
+            uint32_t t_7;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_7 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(17);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_7 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_7;
+                if (num_bits_7 == 8) {
+                  t_7 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_7 += 8;
+                *scratch |= ((uint64_t)(num_bits_7)) << 56;
+              }
+            }
+            v_ty = t_7;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(18);
+            uint32_t t_8;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_8 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(19);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_8 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_8;
+                if (num_bits_8 == 24) {
+                  t_8 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_8 += 8;
+                *scratch |= ((uint64_t)(num_bits_8)) << 56;
+              }
+            }
+            v_count = t_8;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(20);
+            uint32_t t_9;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_9 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(21);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_9 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_9;
+                if (num_bits_9 == 24) {
+                  t_9 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_9 += 8;
+                *scratch |= ((uint64_t)(num_bits_9)) << 56;
+              }
+            }
+            v_value = t_9;
+          }
+        }
+        v_status = wuffs_tiff__decoder__process_ifd_entry(self,
+            v_tag,
+            v_ty,
+            v_count,
+            v_value);
+        if ( ! wuffs_base__status__is_ok(&v_status)) {
+          status = v_status;
+          if (wuffs_base__status__is_error(&status)) {
+            goto exit;
+          } else if (wuffs_base__status__is_suspension(&status)) {
+            status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+            goto exit;
+          }
+          goto ok;
+        }
+        v_i += 1;
+      }
+      if (self->private_impl.f_is_big_endian) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(22);
+          uint32_t t_10;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_10 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(23);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_10 = ((uint32_t)(*scratch & 0xFF));
+              *scratch >>= 8;
+              *scratch <<= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_10);
+              if (num_bits_10 == 24) {
+                t_10 = ((uint32_t)(*scratch >> 32));
+                break;
+              }
+              num_bits_10 += 8;
+              *scratch |= ((uint64_t)(num_bits_10));
+            }
+          }
+          self->private_impl.f_next_ifd_offset = t_10;
+        }
+      } else {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(24);
+          uint32_t t_11;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_11 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(25);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_11 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_11;
+              if (num_bits_11 == 24) {
+                t_11 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_11 += 8;
+              *scratch |= ((uint64_t)(num_bits_11)) << 56;
+            }
+          }
+          self->private_impl.f_next_ifd_offset = t_11;
+        }
+      }
+      self->private_impl.f_ifd_phase = 1;
+    }
+    if (self->private_impl.f_ifd_phase == 1) {
+      if (self->private_impl.f_bps_count > 2) {
+        if (self->private_impl.f_bps_count > 4) {
+          status = wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+          goto exit;
+        }
+        if (a_src) {
+          a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+        }
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(26);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_impl.f_bps_offset))));
+        if (a_src) {
+          iop_a_src = a_src->data.ptr + a_src->meta.ri;
+        }
+        if (status.repr) {
+          goto suspend;
+        }
+        v_i = 0;
+        while (v_i < self->private_impl.f_bps_count) {
+          if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(27);
+              uint32_t t_12;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_12 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(28);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_12 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_12);
+                  if (num_bits_12 == 8) {
+                    t_12 = ((uint32_t)(*scratch >> 48));
+                    break;
+                  }
+                  num_bits_12 += 8;
+                  *scratch |= ((uint64_t)(num_bits_12));
+                }
+              }
+              v_bps = t_12;
+            }
+          } else {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(29);
+              uint32_t t_13;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_13 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(30);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_13 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_13;
+                  if (num_bits_13 == 8) {
+                    t_13 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_13 += 8;
+                  *scratch |= ((uint64_t)(num_bits_13)) << 56;
+                }
+              }
+              v_bps = t_13;
+            }
+          }
+          if (v_i == 0) {
+            self->private_impl.f_bits_per_sample = v_bps;
+          } else if (self->private_impl.f_bits_per_sample != v_bps) {
+            status = wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+            goto exit;
+          }
+          v_i += 1;
+        }
+      }
+      self->private_impl.f_ifd_phase = 2;
+    }
+    if (self->private_impl.f_ifd_phase == 2) {
+      if (self->private_impl.f_photometric == 3) {
+        v_bps = self->private_impl.f_bits_per_sample;
+        if ((v_bps < 1) || (8 < v_bps)) {
+          status = wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+          goto exit;
+        }
+        v_n = (((uint32_t)(1)) << v_bps);
+        if (self->private_impl.f_colormap_count != ((uint32_t)(v_n * 3))) {
+          status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+          goto exit;
+        }
+        if (a_src) {
+          a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+        }
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(31);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_impl.f_colormap_offset))));
+        if (a_src) {
+          iop_a_src = a_src->data.ptr + a_src->meta.ri;
+        }
+        if (status.repr) {
+          goto suspend;
+        }
+        v_i = 0;
+        while (v_i < self->private_impl.f_colormap_count) {
+          if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(32);
+              uint32_t t_14;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_14 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(33);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_14 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_14);
+                  if (num_bits_14 == 8) {
+                    t_14 = ((uint32_t)(*scratch >> 48));
+                    break;
+                  }
+                  num_bits_14 += 8;
+                  *scratch |= ((uint64_t)(num_bits_14));
+                }
+              }
+              v_r = t_14;
+            }
+          } else {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(34);
+              uint32_t t_15;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_15 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(35);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_15 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_15;
+                  if (num_bits_15 == 8) {
+                    t_15 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_15 += 8;
+                  *scratch |= ((uint64_t)(num_bits_15)) << 56;
+                }
+              }
+              v_r = t_15;
+            }
+          }
+          if (v_i < v_n) {
+            self->private_data.f_src_palette[((4 * (v_i & 255)) + 2)] = ((uint8_t)((v_r >> 8)));
+            self->private_data.f_src_palette[((4 * (v_i & 255)) + 3)] = 255;
+          } else if (v_i < ((uint32_t)(v_n * 2))) {
+            v_g = (v_i - v_n);
+            self->private_data.f_src_palette[((4 * (v_g & 255)) + 1)] = ((uint8_t)((v_r >> 8)));
+          } else {
+            v_b = ((uint32_t)(v_i - ((uint32_t)(v_n * 2))));
+            self->private_data.f_src_palette[((4 * (v_b & 255)) + 0)] = ((uint8_t)((v_r >> 8)));
+          }
+          v_i += 1;
+        }
+        v_i = v_n;
+        while (v_i < 256) {
+          self->private_data.f_src_palette[((4 * v_i) + 0)] = 0;
+          self->private_data.f_src_palette[((4 * v_i) + 1)] = 0;
+          self->private_data.f_src_palette[((4 * v_i) + 2)] = 0;
+          self->private_data.f_src_palette[((4 * v_i) + 3)] = 255;
+          v_i += 1;
+        }
+      }
+      self->private_impl.f_ifd_phase = 0;
+    }
+    v_status = wuffs_tiff__decoder__process_ifd(self);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    self->private_impl.f_ifd_pending = false;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_ifd_phase == 0) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      status = wuffs_tiff__decoder__seek_to(self, a_src, self->private_impl.f_ifd_pos);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_frame_width = 0;
+      self->private_impl.f_frame_height = 0;
+      self->private_impl.f_bits_per_sample = 1;
+      self->private_impl.f_bps_count = 0;
+      self->private_impl.f_bps_offset = 0;
+      self->private_impl.f_compression = 1;
+      self->private_impl.f_photometric = 4294967295;
+      self->private_impl.f_fill_order = 1;
+      self->private_impl.f_samples_per_pixel = 1;
+      self->private_impl.f_rows_per_strip = 4294967295;
+      self->private_impl.f_planar_config = 1;
+      self->private_impl.f_predictor = 1;
+      self->private_impl.f_colormap_count = 0;
+      self->private_impl.f_colormap_offset = 0;
+      self->private_impl.f_tile_width = 0;
+      self->private_impl.f_tile_height = 0;
+      self->private_impl.f_extra_samples = 0;
+      self->private_impl.f_sample_format = 1;
+      self->private_impl.f_chunk_offsets_type = 0;
+      self->private_impl.f_chunk_offsets_count = 0;
+      self->private_impl.f_chunk_offsets_value = 0;
+      self->private_impl.f_chunk_bytecounts_type = 0;
+      self->private_impl.f_chunk_bytecounts_count = 0;
+      self->private_impl.f_chunk_bytecounts_value = 0;
+      self->private_impl.f_is_tiled = false;
+      if (self->private_impl.f_is_big_endian) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          uint32_t t_0;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+            t_0 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+            iop_a_src += 2;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_0 = ((uint32_t)(*scratch & 0xFF));
+              *scratch >>= 8;
+              *scratch <<= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);
+              if (num_bits_0 == 8) {
+                t_0 = ((uint32_t)(*scratch >> 48));
+                break;
+              }
+              num_bits_0 += 8;
+              *scratch |= ((uint64_t)(num_bits_0));
+            }
+          }
+          v_num_entries = t_0;
+        }
+      } else {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+          uint32_t t_1;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+            t_1 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+            iop_a_src += 2;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+              if (num_bits_1 == 8) {
+                t_1 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_1 += 8;
+              *scratch |= ((uint64_t)(num_bits_1)) << 56;
+            }
+          }
+          v_num_entries = t_1;
+        }
+      }
+      if (v_num_entries == 0) {
+        status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+        goto exit;
+      }
+      while (v_i < v_num_entries) {
+        if (self->private_impl.f_is_big_endian) {
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+            uint32_t t_2;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_2 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_2 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);
+                if (num_bits_2 == 8) {
+                  t_2 = ((uint32_t)(*scratch >> 48));
+                  break;
+                }
+                num_bits_2 += 8;
+                *scratch |= ((uint64_t)(num_bits_2));
+              }
+            }
+            v_tag = t_2;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+            uint32_t t_3;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_3 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_3 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_3);
+                if (num_bits_3 == 8) {
+                  t_3 = ((uint32_t)(*scratch >> 48));
+                  break;
+                }
+                num_bits_3 += 8;
+                *scratch |= ((uint64_t)(num_bits_3));
+              }
+            }
+            v_ty = t_3;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+            uint32_t t_4;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_4 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_4 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_4);
+                if (num_bits_4 == 24) {
+                  t_4 = ((uint32_t)(*scratch >> 32));
+                  break;
+                }
+                num_bits_4 += 8;
+                *scratch |= ((uint64_t)(num_bits_4));
+              }
+            }
+            v_count = t_4;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+            uint32_t t_5;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_5 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(13);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_5 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_5);
+                if (num_bits_5 == 24) {
+                  t_5 = ((uint32_t)(*scratch >> 32));
+                  break;
+                }
+                num_bits_5 += 8;
+                *scratch |= ((uint64_t)(num_bits_5));
+              }
+            }
+            v_value = t_5;
+          }
+        } else {
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+            uint32_t t_6;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_6 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(15);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_6 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;
+                if (num_bits_6 == 8) {
+                  t_6 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_6 += 8;
+                *scratch |= ((uint64_t)(num_bits_6)) << 56;
+              }
+            }
+            v_tag = t_6;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(16);
+            uint32_t t_7;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+              t_7 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+              iop_a_src += 2;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(17);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_7 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_7;
+                if (num_bits_7 == 8) {
+                  t_7 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_7 += 8;
+                *scratch |= ((uint64_t)(num_bits_7)) << 56;
+              }
+            }
+            v_ty = t_7;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(18);
+            uint32_t t_8;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_8 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(19);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_8 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_8;
+                if (num_bits_8 == 24) {
+                  t_8 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_8 += 8;
+                *scratch |= ((uint64_t)(num_bits_8)) << 56;
+              }
+            }
+            v_count = t_8;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(20);
+            uint32_t t_9;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_9 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_decode_ifd[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(21);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                uint32_t num_bits_9 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_9;
+                if (num_bits_9 == 24) {
+                  t_9 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_9 += 8;
+                *scratch |= ((uint64_t)(num_bits_9)) << 56;
+              }
+            }
+            v_value = t_9;
+          }
+        }
+        v_status = wuffs_tiff__decoder__process_ifd_entry(self,
+            v_tag,
+            v_ty,
+            v_count,
+            v_value);
+        if ( ! wuffs_base__status__is_ok(&v_status)) {
+          status = v_status;
+          if (wuffs_base__status__is_error(&status)) {
+            goto exit;
+          } else if (wuffs_base__status__is_suspension(&status)) {
+            status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+            goto exit;
+          }
+          goto ok;
+        }
+        v_i += 1;
+      }
+      if (self->private_impl.f_is_big_endian) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(22);
+          uint32_t t_10;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_10 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(23);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_10 = ((uint32_t)(*scratch & 0xFF));
+              *scratch >>= 8;
+              *scratch <<= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_10);
+              if (num_bits_10 == 24) {
+                t_10 = ((uint32_t)(*scratch >> 32));
+                break;
+              }
+              num_bits_10 += 8;
+              *scratch |= ((uint64_t)(num_bits_10));
+            }
+          }
+          self->private_impl.f_next_ifd_offset = t_10;
+        }
+      } else {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(24);
+          uint32_t t_11;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_11 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_decode_ifd[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(25);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+              uint32_t num_bits_11 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_11;
+              if (num_bits_11 == 24) {
+                t_11 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_11 += 8;
+              *scratch |= ((uint64_t)(num_bits_11)) << 56;
+            }
+          }
+          self->private_impl.f_next_ifd_offset = t_11;
+        }
+      }
+      self->private_impl.f_ifd_phase = 1;
+    }
+    if (self->private_impl.f_ifd_phase == 1) {
+      if (self->private_impl.f_bps_count > 2) {
+        if (self->private_impl.f_bps_count > 4) {
+          status = wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+          goto exit;
+        }
+        if (a_src) {
+          a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+        }
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(26);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_impl.f_bps_offset))));
+        if (a_src) {
+          iop_a_src = a_src->data.ptr + a_src->meta.ri;
+        }
+        if (status.repr) {
+          goto suspend;
+        }
+        v_i = 0;
+        while (v_i < self->private_impl.f_bps_count) {
+          if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(27);
+              uint32_t t_12;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_12 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(28);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_12 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_12);
+                  if (num_bits_12 == 8) {
+                    t_12 = ((uint32_t)(*scratch >> 48));
+                    break;
+                  }
+                  num_bits_12 += 8;
+                  *scratch |= ((uint64_t)(num_bits_12));
+                }
+              }
+              v_bps = t_12;
+            }
+          } else {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(29);
+              uint32_t t_13;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_13 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(30);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_13 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_13;
+                  if (num_bits_13 == 8) {
+                    t_13 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_13 += 8;
+                  *scratch |= ((uint64_t)(num_bits_13)) << 56;
+                }
+              }
+              v_bps = t_13;
+            }
+          }
+          if (v_i == 0) {
+            self->private_impl.f_bits_per_sample = v_bps;
+          } else if (self->private_impl.f_bits_per_sample != v_bps) {
+            status = wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+            goto exit;
+          }
+          v_i += 1;
+        }
+      }
+      self->private_impl.f_ifd_phase = 2;
+    }
+    if (self->private_impl.f_ifd_phase == 2) {
+      if (self->private_impl.f_photometric == 3) {
+        v_bps = self->private_impl.f_bits_per_sample;
+        if ((v_bps < 1) || (8 < v_bps)) {
+          status = wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+          goto exit;
+        }
+        v_n = (((uint32_t)(1)) << v_bps);
+        if (self->private_impl.f_colormap_count != ((uint32_t)(v_n * 3))) {
+          status = wuffs_base__make_status(wuffs_tiff__error__bad_header);
+          goto exit;
+        }
+        if (a_src) {
+          a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+        }
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(31);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_impl.f_colormap_offset))));
+        if (a_src) {
+          iop_a_src = a_src->data.ptr + a_src->meta.ri;
+        }
+        if (status.repr) {
+          goto suspend;
+        }
+        v_i = 0;
+        while (v_i < self->private_impl.f_colormap_count) {
+          if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(32);
+              uint32_t t_14;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_14 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(33);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_14 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_14);
+                  if (num_bits_14 == 8) {
+                    t_14 = ((uint32_t)(*scratch >> 48));
+                    break;
+                  }
+                  num_bits_14 += 8;
+                  *scratch |= ((uint64_t)(num_bits_14));
+                }
+              }
+              v_r = t_14;
+            }
+          } else {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(34);
+              uint32_t t_15;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_15 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_decode_ifd[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(35);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_decode_ifd[0].scratch;
+                  uint32_t num_bits_15 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_15;
+                  if (num_bits_15 == 8) {
+                    t_15 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_15 += 8;
+                  *scratch |= ((uint64_t)(num_bits_15)) << 56;
+                }
+              }
+              v_r = t_15;
+            }
+          }
+          if (v_i < v_n) {
+            self->private_data.f_src_palette[((4 * (v_i & 255)) + 2)] = ((uint8_t)((v_r >> 8)));
+            self->private_data.f_src_palette[((4 * (v_i & 255)) + 3)] = 255;
+          } else if (v_i < ((uint32_t)(v_n * 2))) {
+            v_g = (v_i - v_n);
+            self->private_data.f_src_palette[((4 * (v_g & 255)) + 1)] = ((uint8_t)((v_r >> 8)));
+          } else {
+            v_b = ((uint32_t)(v_i - ((uint32_t)(v_n * 2))));
+            self->private_data.f_src_palette[((4 * (v_b & 255)) + 0)] = ((uint8_t)((v_r >> 8)));
+          }
+          v_i += 1;
+        }
+        v_i = v_n;
+        while (v_i < 256) {
+          self->private_data.f_src_palette[((4 * v_i) + 0)] = 0;
+          self->private_data.f_src_palette[((4 * v_i) + 1)] = 0;
+          self->private_data.f_src_palette[((4 * v_i) + 2)] = 0;
+          self->private_data.f_src_palette[((4 * v_i) + 3)] = 255;
+          v_i += 1;
+        }
+      }
+      self->private_impl.f_ifd_phase = 0;
+    }
+    v_status = wuffs_tiff__decoder__process_ifd(self);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    self->private_impl.f_ifd_pending = false;
+
+    ok:
+    self->private_impl.p_decode_ifd[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_ifd[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_ifd[0].v_num_entries = v_num_entries;
+  self->private_data.s_decode_ifd[0].v_i = v_i;
+  self->private_data.s_decode_ifd[0].v_tag = v_tag;
+  self->private_data.s_decode_ifd[0].v_ty = v_ty;
+  self->private_data.s_decode_ifd[0].v_count = v_count;
+  self->private_data.s_decode_ifd[0].v_n = v_n;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[12].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[12].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.first_value
+
+static uint32_t
+wuffs_tiff__decoder__first_value(
+    const wuffs_tiff__decoder* self,
+    uint32_t a_ty,
+    uint32_t a_value) {
+  if (a_ty == 3) {
+    if (self->private_impl.f_is_big_endian) {
+      return (a_value >> 16);
+    }
+    return (a_value & 65535);
+  } else if (a_ty == 1) {
+    if (self->private_impl.f_is_big_endian) {
+      return (a_value >> 24);
+    }
+    return (a_value & 255);
+  }
+  return a_value;
+}
+
+// -------- func tiff.decoder.second_value
+
+static uint32_t
+wuffs_tiff__decoder__second_value(
+    const wuffs_tiff__decoder* self,
+    uint32_t a_ty,
+    uint32_t a_value) {
+  if (a_ty == 3) {
+    if (self->private_impl.f_is_big_endian) {
+      return (a_value & 65535);
+    }
+    return (a_value >> 16);
+  } else if (a_ty == 1) {
+    if (self->private_impl.f_is_big_endian) {
+      return ((a_value >> 16) & 255);
+    }
+    return ((a_value >> 8) & 255);
+  }
+  return 0;
+}
+
+// -------- func tiff.decoder.process_ifd_entry
+
+static wuffs_base__status
+wuffs_tiff__decoder__process_ifd_entry(
+    wuffs_tiff__decoder* self,
+    uint32_t a_tag,
+    uint32_t a_ty,
+    uint32_t a_count,
+    uint32_t a_value) {
+  uint32_t v_v = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[13].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if ((a_ty != 1) && (a_ty != 3) && (a_ty != 4)) {
+    return wuffs_base__make_status(NULL);
+  } else if (a_count == 0) {
+    return wuffs_base__make_status(NULL);
+  }
+  v_v = wuffs_tiff__decoder__first_value(self, a_ty, a_value);
+  if (a_tag == 256) {
+    self->private_impl.f_frame_width = v_v;
+  } else if (a_tag == 257) {
+    self->private_impl.f_frame_height = v_v;
+  } else if (a_tag == 258) {
+    self->private_impl.f_bps_count = a_count;
+    if (a_count <= 2) {
+      self->private_impl.f_bits_per_sample = v_v;
+      if ((a_count == 2) && (v_v != wuffs_tiff__decoder__second_value(self, a_ty, a_value))) {
+        return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+      }
+    } else {
+      self->private_impl.f_bps_offset = a_value;
+    }
+  } else if (a_tag == 259) {
+    self->private_impl.f_compression = v_v;
+  } else if (a_tag == 262) {
+    self->private_impl.f_photometric = v_v;
+  } else if (a_tag == 266) {
+    self->private_impl.f_fill_order = v_v;
+  } else if ((a_tag == 273) || (a_tag == 324)) {
+    if (a_ty == 1) {
+      return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+    }
+    self->private_impl.f_chunk_offsets_type = a_ty;
+    self->private_impl.f_chunk_offsets_count = a_count;
+    self->private_impl.f_chunk_offsets_value = a_value;
+    self->private_impl.f_is_tiled = (a_tag == 324);
+  } else if (a_tag == 277) {
+    self->private_impl.f_samples_per_pixel = v_v;
+  } else if (a_tag == 278) {
+    self->private_impl.f_rows_per_strip = v_v;
+  } else if ((a_tag == 279) || (a_tag == 325)) {
+    if (a_ty == 1) {
+      return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+    }
+    self->private_impl.f_chunk_bytecounts_type = a_ty;
+    self->private_impl.f_chunk_bytecounts_count = a_count;
+    self->private_impl.f_chunk_bytecounts_value = a_value;
+  } else if (a_tag == 284) {
+    self->private_impl.f_planar_config = v_v;
+  } else if (a_tag == 317) {
+    self->private_impl.f_predictor = v_v;
+  } else if (a_tag == 320) {
+    self->private_impl.f_colormap_count = a_count;
+    self->private_impl.f_colormap_offset = a_value;
+  } else if (a_tag == 322) {
+    self->private_impl.f_tile_width = v_v;
+  } else if (a_tag == 323) {
+    self->private_impl.f_tile_height = v_v;
+  } else if (a_tag == 338) {
+    if (a_count > 1) {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+    self->private_impl.f_extra_samples = v_v;
+  } else if (a_tag == 339) {
+    self->private_impl.f_sample_format = v_v;
+  }
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func tiff.decoder.process_ifd
+
+static wuffs_base__status
+wuffs_tiff__decoder__process_ifd(
+    wuffs_tiff__decoder* self) {
+  uint32_t v_fw = 0;
+  uint32_t v_fh = 0;
+  uint32_t v_cw = 0;
+  uint32_t v_ch = 0;
+  uint32_t v_bits_per_pixel = 0;
+  uint64_t v_n = 0;
+  uint64_t v_unpacked = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[14].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if ((self->private_impl.f_frame_width == 0) ||
+      (self->private_impl.f_frame_height == 0) ||
+      (self->private_impl.f_chunk_offsets_count == 0) ||
+      (self->private_impl.f_chunk_bytecounts_count == 0)) {
+    return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+  } else if ((self->private_impl.f_frame_width > 16777215) || (self->private_impl.f_frame_height > 16777215)) {
+    return wuffs_base__make_status(wuffs_base__error__unsupported_image_dimension);
+  }
+  if (self->private_impl.f_compression == 32946) {
+    self->private_impl.f_compression = 8;
+  }
+  if ((self->private_impl.f_compression != 1) &&
+      (self->private_impl.f_compression != 5) &&
+      (self->private_impl.f_compression != 8) &&
+      (self->private_impl.f_compression != 32773)) {
+    return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_compression);
+  }
+  if ((self->private_impl.f_fill_order != 1) || (self->private_impl.f_sample_format != 1) || ((self->private_impl.f_planar_config != 1) && (self->private_impl.f_samples_per_pixel != 1))) {
+    return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+  }
+  self->private_impl.f_white_is_zero = false;
+  if ((self->private_impl.f_photometric == 0) || (self->private_impl.f_photometric == 1)) {
+    if (self->private_impl.f_samples_per_pixel != 1) {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+    self->private_impl.f_white_is_zero = (self->private_impl.f_photometric == 0);
+    if (self->private_impl.f_bits_per_sample == 1) {
+      self->private_impl.f_gray_scale = 255;
+    } else if (self->private_impl.f_bits_per_sample == 2) {
+      self->private_impl.f_gray_scale = 85;
+    } else if (self->private_impl.f_bits_per_sample == 4) {
+      self->private_impl.f_gray_scale = 17;
+    } else if (self->private_impl.f_bits_per_sample == 8) {
+      self->private_impl.f_gray_scale = 1;
+    } else if (self->private_impl.f_bits_per_sample == 16) {
+      self->private_impl.f_src_pixfmt = 537919499;
+      self->private_impl.f_src_bytes_per_pixel = 2;
+    } else {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+    if (self->private_impl.f_bits_per_sample <= 8) {
+      self->private_impl.f_src_pixfmt = 536870920;
+      self->private_impl.f_src_bytes_per_pixel = 1;
+    }
+  } else if (self->private_impl.f_photometric == 2) {
+    if (self->private_impl.f_bits_per_sample != 8) {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    } else if (self->private_impl.f_samples_per_pixel == 3) {
+      if (self->private_impl.f_extra_samples != 0) {
+        return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+      }
+      self->private_impl.f_src_pixfmt = 2684356744;
+      self->private_impl.f_src_bytes_per_pixel = 3;
+    } else if (self->private_impl.f_samples_per_pixel == 4) {
+      if (self->private_impl.f_extra_samples == 1) {
+        self->private_impl.f_src_pixfmt = 2717943944;
+      } else if (self->private_impl.f_extra_samples == 2) {
+        self->private_impl.f_src_pixfmt = 2701166728;
+      } else {
+        return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+      }
+      self->private_impl.f_src_bytes_per_pixel = 4;
+    } else {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+  } else if (self->private_impl.f_photometric == 3) {
+    if ((self->private_impl.f_samples_per_pixel != 1) || ((self->private_impl.f_bits_per_sample != 1) &&
+        (self->private_impl.f_bits_per_sample != 2) &&
+        (self->private_impl.f_bits_per_sample != 4) &&
+        (self->private_impl.f_bits_per_sample != 8))) {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+    self->private_impl.f_src_pixfmt = 2198077448;
+    self->private_impl.f_src_bytes_per_pixel = 1;
+    self->private_impl.f_gray_scale = 1;
+  } else if (self->private_impl.f_photometric == 4294967295) {
+    return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+  } else {
+    return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+  }
+  if (self->private_impl.f_predictor == 2) {
+    if (self->private_impl.f_bits_per_sample < 8) {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+  } else if (self->private_impl.f_predictor != 1) {
+    return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+  }
+  v_fw = self->private_impl.f_frame_width;
+  v_fh = self->private_impl.f_frame_height;
+  if (self->private_impl.f_is_tiled) {
+    if ((self->private_impl.f_tile_width == 0) || (self->private_impl.f_tile_height == 0)) {
+      return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+    } else if ((self->private_impl.f_tile_width > 16777215) || (self->private_impl.f_tile_height > 16777215)) {
+      return wuffs_base__make_status(wuffs_tiff__error__unsupported_tiff_file);
+    }
+    v_cw = self->private_impl.f_tile_width;
+    v_ch = self->private_impl.f_tile_height;
+    self->private_impl.f_chunks_across = (((v_fw + v_cw) - 1) / v_cw);
+    v_n = (((uint64_t)(self->private_impl.f_chunks_across)) * ((uint64_t)((((v_fh + v_ch) - 1) / v_ch))));
+  } else {
+    if (self->private_impl.f_rows_per_strip == 0) {
+      return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+    }
+    v_cw = v_fw;
+    v_ch = v_fh;
+    if (self->private_impl.f_rows_per_strip < v_fh) {
+      v_ch = self->private_impl.f_rows_per_strip;
+    }
+    self->private_impl.f_chunks_across = 1;
+    v_n = ((uint64_t)((((v_fh + v_ch) - 1) / v_ch)));
+  }
+  self->private_impl.f_chunk_width = v_cw;
+  self->private_impl.f_chunk_height = v_ch;
+  if ((v_n > ((uint64_t)(self->private_impl.f_chunk_offsets_count))) || (v_n > ((uint64_t)(self->private_impl.f_chunk_bytecounts_count)))) {
+    return wuffs_base__make_status(wuffs_tiff__error__bad_header);
+  }
+  self->private_impl.f_num_chunks = ((uint32_t)((v_n & 4294967295)));
+  if (self->private_impl.f_bits_per_sample < 8) {
+    v_bits_per_pixel = (self->private_impl.f_bits_per_sample & 7);
+  } else {
+    v_bits_per_pixel = (self->private_impl.f_src_bytes_per_pixel * 8);
+  }
+  self->private_impl.f_bytes_per_row = (((((uint64_t)(self->private_impl.f_chunk_width)) * ((uint64_t)(v_bits_per_pixel))) + 7) / 8);
+  v_unpacked = 0;
+  if (self->private_impl.f_bits_per_sample < 8) {
+    v_unpacked = ((uint64_t)(self->private_impl.f_chunk_width));
+  }
+  self->private_impl.f_workbuf_length = (self->private_impl.f_bytes_per_row + v_unpacked);
+  wuffs_tiff__decoder__choose_predictor_implementation(self);
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func tiff.decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__decode_frame_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 2)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[15].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_tiff__decoder__do_decode_frame_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_tiff__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_tiff__decoder__do_decode_frame_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_tiff__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_decode_frame_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[15].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[15].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func tiff.decoder.do_decode_frame_config
+
+static wuffs_base__status
+wuffs_tiff__decoder__do_decode_frame_config(
+    wuffs_tiff__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[16].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_frame_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if ((self->private_impl.f_call_sequence & 16) != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    } else if (self->private_impl.f_call_sequence < 32) {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      status = wuffs_tiff__decoder__do_decode_image_config(self, NULL, a_src);
+      if (status.repr) {
+        goto suspend;
+      }
+    } else if (self->private_impl.f_ifd_pending) {
+    } else if (self->private_impl.f_call_sequence == 40) {
+      self->private_impl.f_ifd_pos = self->private_impl.f_frame_config_io_position;
+      self->private_impl.f_ifd_pending = true;
+    } else if ((self->private_impl.f_call_sequence == 64) || ((self->private_impl.f_call_sequence == 32) && (self->private_impl.f_num_decoded_frame_configs_value > 0))) {
+      if ((self->private_impl.f_next_ifd_offset == 0) || (self->private_impl.f_num_decoded_frame_configs_value >= 65535)) {
+        self->private_impl.f_call_sequence = 96;
+        status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+        goto ok;
+      }
+      self->private_impl.f_ifd_pos = wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_impl.f_next_ifd_offset)));
+      self->private_impl.f_ifd_pending = true;
+    } else if (self->private_impl.f_call_sequence != 32) {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    }
+    if (self->private_impl.f_ifd_pending) {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+      status = wuffs_tiff__decoder__decode_ifd(self, a_src);
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_frame_config_io_position = self->private_impl.f_ifd_pos;
+    }
+    if (a_dst != NULL) {
+      wuffs_base__frame_config__set(
+          a_dst,
+          wuffs_base__utility__make_rect_ie_u32(
+          0,
+          0,
+          wuffs_base__u32__min(self->private_impl.f_frame_width, self->private_impl.f_width),
+          wuffs_base__u32__min(self->private_impl.f_frame_height, self->private_impl.f_height)),
+          ((wuffs_base__flicks)(0)),
+          self->private_impl.f_num_decoded_frame_configs_value,
+          self->private_impl.f_frame_config_io_position,
+          0,
+          (self->private_impl.f_extra_samples == 0),
+          false,
+          0);
+    }
+    self->private_impl.f_chunk_index = 0;
+    self->private_impl.f_chunk_phase = 0;
+    self->private_impl.f_table_phase = 0;
+    self->private_impl.f_table_base = 0;
+    self->private_impl.f_table_length = 0;
+    wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frame_configs_value, 1);
+    self->private_impl.f_call_sequence = 64;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if ((self->private_impl.f_call_sequence & 16) != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    } else if (self->private_impl.f_call_sequence < 32) {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      status = wuffs_tiff__decoder__do_decode_image_config(self, NULL, a_src);
+      if (status.repr) {
+        goto suspend;
+      }
+    } else if (self->private_impl.f_ifd_pending) {
+    } else if (self->private_impl.f_call_sequence == 40) {
+      self->private_impl.f_ifd_pos = self->private_impl.f_frame_config_io_position;
+      self->private_impl.f_ifd_pending = true;
+    } else if ((self->private_impl.f_call_sequence == 64) || ((self->private_impl.f_call_sequence == 32) && (self->private_impl.f_num_decoded_frame_configs_value > 0))) {
+      if ((self->private_impl.f_next_ifd_offset == 0) || (self->private_impl.f_num_decoded_frame_configs_value >= 65535)) {
+        self->private_impl.f_call_sequence = 96;
+        status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+        goto ok;
+      }
+      self->private_impl.f_ifd_pos = wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_impl.f_next_ifd_offset)));
+      self->private_impl.f_ifd_pending = true;
+    } else if (self->private_impl.f_call_sequence != 32) {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    }
+    if (self->private_impl.f_ifd_pending) {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+      status = wuffs_tiff__decoder__decode_ifd(self, a_src);
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_frame_config_io_position = self->private_impl.f_ifd_pos;
+    }
+    if (a_dst != NULL) {
+      wuffs_base__frame_config__set(
+          a_dst,
+          wuffs_base__utility__make_rect_ie_u32(
+          0,
+          0,
+          wuffs_base__u32__min(self->private_impl.f_frame_width, self->private_impl.f_width),
+          wuffs_base__u32__min(self->private_impl.f_frame_height, self->private_impl.f_height)),
+          ((wuffs_base__flicks)(0)),
+          self->private_impl.f_num_decoded_frame_configs_value,
+          self->private_impl.f_frame_config_io_position,
+          0,
+          (self->private_impl.f_extra_samples == 0),
+          false,
+          0);
+    }
+    self->private_impl.f_chunk_index = 0;
+    self->private_impl.f_chunk_phase = 0;
+    self->private_impl.f_table_phase = 0;
+    self->private_impl.f_table_base = 0;
+    self->private_impl.f_table_length = 0;
+    wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frame_configs_value, 1);
+    self->private_impl.f_call_sequence = 64;
+
+    ok:
+    self->private_impl.p_do_decode_frame_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[16].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[16].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__decode_frame(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_dst || !a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 3)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[17].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_tiff__decoder__do_decode_frame(self,
+            a_dst,
+            a_src,
+            a_blend,
+            a_workbuf,
+            a_opts);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_tiff__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_tiff__decoder__do_decode_frame(self,
+            a_dst,
+            a_src,
+            a_blend,
+            a_workbuf,
+            a_opts);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_tiff__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_decode_frame[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[17].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[17].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func tiff.decoder.do_decode_frame
+
+static wuffs_base__status
+wuffs_tiff__decoder__do_decode_frame(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  uint32_t v_i = 0;
+  uint32_t v_j = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[18].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_frame[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if ((self->private_impl.f_call_sequence & 16) != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    } else if (self->private_impl.f_call_sequence >= 96) {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    } else if (self->private_impl.f_call_sequence != 64) {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      status = wuffs_tiff__decoder__do_decode_frame_config(self, NULL, a_src);
+      if (status.repr) {
+        goto suspend;
+      }
+    }
+    if (self->private_impl.f_workbuf_length > ((uint64_t)(a_workbuf.len))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,
+        wuffs_base__pixel_buffer__pixel_format(a_dst),
+        wuffs_base__pixel_buffer__palette_or_else(a_dst, wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024)),
+        wuffs_base__utility__make_pixel_format(self->private_impl.f_src_pixfmt),
+        wuffs_base__make_slice_u8(self->private_data.f_src_palette, 1024),
+        a_blend);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    label__fast__0__continue:;
+    while (self->private_impl.f_chunk_index < self->private_impl.f_num_chunks) {
+      if (self->private_impl.f_chunk_phase == 0) {
+        v_i = self->private_impl.f_chunk_index;
+        v_j = 0;
+        if (self->private_impl.f_chunks_across > 0) {
+          v_i = (self->private_impl.f_chunk_index / self->private_impl.f_chunks_across);
+          v_j = (self->private_impl.f_chunk_index % self->private_impl.f_chunks_across);
+        }
+        self->private_impl.f_chunk_x = ((uint32_t)(v_j * self->private_impl.f_chunk_width));
+        self->private_impl.f_chunk_y = ((uint32_t)(v_i * self->private_impl.f_chunk_height));
+        if ((self->private_impl.f_chunk_y < self->private_impl.f_quirk_chunk_min_incl_y) || ((self->private_impl.f_quirk_chunk_max_excl_y > 0) && (self->private_impl.f_chunk_y >= self->private_impl.f_quirk_chunk_max_excl_y))) {
+          self->private_impl.f_chunk_index += 1;
+          goto label__fast__0__continue;
+        }
+        if ((self->private_impl.f_chunk_index < self->private_impl.f_table_base) || (((uint32_t)(self->private_impl.f_chunk_index - self->private_impl.f_table_base)) >= self->private_impl.f_table_length)) {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          status = wuffs_tiff__decoder__read_chunk_table(self, a_src);
+          if (status.repr) {
+            goto suspend;
+          }
+        }
+        v_i = ((uint32_t)(self->private_impl.f_chunk_index - self->private_impl.f_table_base));
+        self->private_impl.f_chunk_src_pos = wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_data.f_chunk_offsets[(v_i & 255)])));
+        self->private_impl.f_chunk_remaining = ((uint64_t)(self->private_data.f_chunk_bytecounts[(v_i & 255)]));
+        self->private_impl.f_chunk_rows = wuffs_base__u32__sat_sub(wuffs_base__u32__min(self->private_impl.f_frame_height, self->private_impl.f_height), self->private_impl.f_chunk_y);
+        self->private_impl.f_chunk_rows = wuffs_base__u32__min(self->private_impl.f_chunk_rows, self->private_impl.f_chunk_height);
+        self->private_impl.f_chunk_wpos = 0;
+        self->private_impl.f_row_y = 0;
+        self->private_impl.f_row_wi = 0;
+        self->private_impl.f_packbits_literal = 0;
+        self->private_impl.f_packbits_run = 0;
+        self->private_impl.f_packbits_need_run_byte = false;
+        if (self->private_impl.f_compression == 5) {
+          wuffs_base__ignore_status(wuffs_lzw__decoder__initialize(&self->private_data.f_lzw,
+              sizeof (wuffs_lzw__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_lzw__decoder__set_quirk(&self->private_data.f_lzw, 1348378625, 1);
+        } else if (self->private_impl.f_compression == 8) {
+          wuffs_base__ignore_status(wuffs_zlib__decoder__initialize(&self->private_data.f_zlib,
+              sizeof (wuffs_zlib__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        }
+        self->private_impl.f_chunk_phase = 1;
+      }
+      if (self->private_impl.f_chunk_phase == 1) {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, self->private_impl.f_chunk_src_pos);
+        if (status.repr) {
+          goto suspend;
+        }
+        self->private_impl.f_chunk_phase = 2;
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+      status = wuffs_tiff__decoder__decode_chunk(self, a_dst, a_src, a_workbuf);
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_chunk_phase = 0;
+      self->private_impl.f_chunk_index += 1;
+    }
+    wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value, 1);
+    self->private_impl.f_call_sequence = 32;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if ((self->private_impl.f_call_sequence & 16) != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    } else if (self->private_impl.f_call_sequence >= 96) {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    } else if (self->private_impl.f_call_sequence != 64) {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      status = wuffs_tiff__decoder__do_decode_frame_config(self, NULL, a_src);
+      if (status.repr) {
+        goto suspend;
+      }
+    }
+    if (self->private_impl.f_workbuf_length > ((uint64_t)(a_workbuf.len))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,
+        wuffs_base__pixel_buffer__pixel_format(a_dst),
+        wuffs_base__pixel_buffer__palette_or_else(a_dst, wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024)),
+        wuffs_base__utility__make_pixel_format(self->private_impl.f_src_pixfmt),
+        wuffs_base__make_slice_u8(self->private_data.f_src_palette, 1024),
+        a_blend);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    label__0__continue:;
+    while (self->private_impl.f_chunk_index < self->private_impl.f_num_chunks) {
+      if (self->private_impl.f_chunk_phase == 0) {
+        v_i = self->private_impl.f_chunk_index;
+        v_j = 0;
+        if (self->private_impl.f_chunks_across > 0) {
+          v_i = (self->private_impl.f_chunk_index / self->private_impl.f_chunks_across);
+          v_j = (self->private_impl.f_chunk_index % self->private_impl.f_chunks_across);
+        }
+        self->private_impl.f_chunk_x = ((uint32_t)(v_j * self->private_impl.f_chunk_width));
+        self->private_impl.f_chunk_y = ((uint32_t)(v_i * self->private_impl.f_chunk_height));
+        if ((self->private_impl.f_chunk_y < self->private_impl.f_quirk_chunk_min_incl_y) || ((self->private_impl.f_quirk_chunk_max_excl_y > 0) && (self->private_impl.f_chunk_y >= self->private_impl.f_quirk_chunk_max_excl_y))) {
+          self->private_impl.f_chunk_index += 1;
+          goto label__0__continue;
+        }
+        if ((self->private_impl.f_chunk_index < self->private_impl.f_table_base) || (((uint32_t)(self->private_impl.f_chunk_index - self->private_impl.f_table_base)) >= self->private_impl.f_table_length)) {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          status = wuffs_tiff__decoder__read_chunk_table(self, a_src);
+          if (status.repr) {
+            goto suspend;
+          }
+        }
+        v_i = ((uint32_t)(self->private_impl.f_chunk_index - self->private_impl.f_table_base));
+        self->private_impl.f_chunk_src_pos = wuffs_base__u64__sat_add(self->private_impl.f_header_pos, ((uint64_t)(self->private_data.f_chunk_offsets[(v_i & 255)])));
+        self->private_impl.f_chunk_remaining = ((uint64_t)(self->private_data.f_chunk_bytecounts[(v_i & 255)]));
+        self->private_impl.f_chunk_rows = wuffs_base__u32__sat_sub(wuffs_base__u32__min(self->private_impl.f_frame_height, self->private_impl.f_height), self->private_impl.f_chunk_y);
+        self->private_impl.f_chunk_rows = wuffs_base__u32__min(self->private_impl.f_chunk_rows, self->private_impl.f_chunk_height);
+        self->private_impl.f_chunk_wpos = 0;
+        self->private_impl.f_row_y = 0;
+        self->private_impl.f_row_wi = 0;
+        self->private_impl.f_packbits_literal = 0;
+        self->private_impl.f_packbits_run = 0;
+        self->private_impl.f_packbits_need_run_byte = false;
+        if (self->private_impl.f_compression == 5) {
+          wuffs_base__ignore_status(wuffs_lzw__decoder__initialize(&self->private_data.f_lzw,
+              sizeof (wuffs_lzw__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+          wuffs_lzw__decoder__set_quirk(&self->private_data.f_lzw, 1348378625, 1);
+        } else if (self->private_impl.f_compression == 8) {
+          wuffs_base__ignore_status(wuffs_zlib__decoder__initialize(&self->private_data.f_zlib,
+              sizeof (wuffs_zlib__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+        }
+        self->private_impl.f_chunk_phase = 1;
+      }
+      if (self->private_impl.f_chunk_phase == 1) {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, self->private_impl.f_chunk_src_pos);
+        if (status.repr) {
+          goto suspend;
+        }
+        self->private_impl.f_chunk_phase = 2;
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+      status = wuffs_tiff__decoder__decode_chunk(self, a_dst, a_src, a_workbuf);
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_chunk_phase = 0;
+      self->private_impl.f_chunk_index += 1;
+    }
+    wuffs_base__u64__sat_add_indirect(&self->private_impl.f_num_decoded_frames_value, 1);
+    self->private_impl.f_call_sequence = 32;
+
+    ok:
+    self->private_impl.p_do_decode_frame[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[18].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[18].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.read_chunk_table
+
+static wuffs_base__status
+wuffs_tiff__decoder__read_chunk_table(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_base_index = 0;
+  uint32_t v_length = 0;
+  uint32_t v_n = 0;
+  uint32_t v_i = 0;
+  uint32_t v_element = 0;
+  uint64_t v_elem_size = 0;
+  uint64_t v_pos = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[19].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_read_chunk_table[0];
+  if (coro_susp_point) {
+    v_base_index = self->private_data.s_read_chunk_table[0].v_base_index;
+    v_length = self->private_data.s_read_chunk_table[0].v_length;
+    v_i = self->private_data.s_read_chunk_table[0].v_i;
+    v_elem_size = self->private_data.s_read_chunk_table[0].v_elem_size;
+    v_pos = self->private_data.s_read_chunk_table[0].v_pos;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_base_index = self->private_impl.f_chunk_index;
+    v_n = wuffs_base__u32__sat_sub(self->private_impl.f_num_chunks, v_base_index);
+    v_length = wuffs_base__u32__min(v_n, 256);
+    if (self->private_impl.f_table_phase == 0) {
+      v_elem_size = 4;
+      if (self->private_impl.f_chunk_offsets_type == 3) {
+        v_elem_size = 2;
+      }
+      if ((((uint64_t)(self->private_impl.f_chunk_offsets_count)) * v_elem_size) <= 4) {
+        v_i = 0;
+        while (v_i < v_length) {
+          v_element = self->private_impl.f_chunk_offsets_value;
+          if (v_elem_size == 2) {
+            if ((((uint32_t)(v_base_index + v_i)) & 1) == 0) {
+              v_element = wuffs_tiff__decoder__first_value(self, 3, v_element);
+            } else {
+              v_element = wuffs_tiff__decoder__second_value(self, 3, v_element);
+            }
+          }
+          self->private_data.f_chunk_offsets[v_i] = v_element;
+          v_i += 1;
+        }
+      } else {
+        v_pos = (((uint64_t)(self->private_impl.f_chunk_offsets_value)) + (((uint64_t)(v_base_index)) * v_elem_size));
+        if (a_src) {
+          a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+        }
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, v_pos));
+        if (a_src) {
+          iop_a_src = a_src->data.ptr + a_src->meta.ri;
+        }
+        if (status.repr) {
+          goto suspend;
+        }
+        v_i = 0;
+        while (v_i < v_length) {
+          if (v_elem_size == 2) {
+            if (self->private_impl.f_is_big_endian) {
+              {
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+                uint32_t t_0;
+                if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                  t_0 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                  iop_a_src += 2;
+                } else {
+                  self->private_data.s_read_chunk_table[0].scratch = 0;
+                  WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+                  while (true) {
+                    if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                      goto suspend;
+                    }
+                    uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                    uint32_t num_bits_0 = ((uint32_t)(*scratch & 0xFF));
+                    *scratch >>= 8;
+                    *scratch <<= 8;
+                    *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);
+                    if (num_bits_0 == 8) {
+                      t_0 = ((uint32_t)(*scratch >> 48));
+                      break;
+                    }
+                    num_bits_0 += 8;
+                    *scratch |= ((uint64_t)(num_bits_0));
+                  }
+                }
+                v_element = t_0;
+              }
+            } else {
+              {
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+                uint32_t t_1;
+                if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                  t_1 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                  iop_a_src += 2;
+                } else {
+                  self->private_data.s_read_chunk_table[0].scratch = 0;
+                  WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+                  while (true) {
+                    if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                      goto suspend;
+                    }
+                    uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                    uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+                    *scratch <<= 8;
+                    *scratch >>= 8;
+                    *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+                    if (num_bits_1 == 8) {
+                      t_1 = ((uint32_t)(*scratch));
+                      break;
+                    }
+                    num_bits_1 += 8;
+                    *scratch |= ((uint64_t)(num_bits_1)) << 56;
+                  }
+                }
+                v_element = t_1;
+              }
+            }
+          } else if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+              uint32_t t_2;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+                t_2 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+                iop_a_src += 4;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(7);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_2 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);
+                  if (num_bits_2 == 24) {
+                    t_2 = ((uint32_t)(*scratch >> 32));
+                    break;
+                  }
+                  num_bits_2 += 8;
+                  *scratch |= ((uint64_t)(num_bits_2));
+                }
+              }
+              v_element = t_2;
+            }
+          } else {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(8);
+              uint32_t t_3;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+                t_3 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+                iop_a_src += 4;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(9);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_3 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;
+                  if (num_bits_3 == 24) {
+                    t_3 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_3 += 8;
+                  *scratch |= ((uint64_t)(num_bits_3)) << 56;
+                }
+              }
+              v_element = t_3;
+            }
+          }
+          self->private_data.f_chunk_offsets[v_i] = v_element;
+          v_i += 1;
+        }
+      }
+      self->private_impl.f_table_phase = 1;
+    }
+    v_elem_size = 4;
+    if (self->private_impl.f_chunk_bytecounts_type == 3) {
+      v_elem_size = 2;
+    }
+    if ((((uint64_t)(self->private_impl.f_chunk_bytecounts_count)) * v_elem_size) <= 4) {
+      v_i = 0;
+      while (v_i < v_length) {
+        v_element = self->private_impl.f_chunk_bytecounts_value;
+        if (v_elem_size == 2) {
+          if ((((uint32_t)(v_base_index + v_i)) & 1) == 0) {
+            v_element = wuffs_tiff__decoder__first_value(self, 3, v_element);
+          } else {
+            v_element = wuffs_tiff__decoder__second_value(self, 3, v_element);
+          }
+        }
+        self->private_data.f_chunk_bytecounts[v_i] = v_element;
+        v_i += 1;
+      }
+    } else {
+      v_pos = (((uint64_t)(self->private_impl.f_chunk_bytecounts_value)) + (((uint64_t)(v_base_index)) * v_elem_size));
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(10);
+      status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, v_pos));
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      v_i = 0;
+      while (v_i < v_length) {
+        if (v_elem_size == 2) {
+          if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(11);
+              uint32_t t_4;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_4 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(12);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_4 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_4);
+                  if (num_bits_4 == 8) {
+                    t_4 = ((uint32_t)(*scratch >> 48));
+                    break;
+                  }
+                  num_bits_4 += 8;
+                  *scratch |= ((uint64_t)(num_bits_4));
+                }
+              }
+              v_element = t_4;
+            }
+          } else {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(13);
+              uint32_t t_5;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_5 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(14);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_5 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_5;
+                  if (num_bits_5 == 8) {
+                    t_5 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_5 += 8;
+                  *scratch |= ((uint64_t)(num_bits_5)) << 56;
+                }
+              }
+              v_element = t_5;
+            }
+          }
+        } else if (self->private_impl.f_is_big_endian) {
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(15);
+            uint32_t t_6;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_6 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_read_chunk_table[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(16);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                uint32_t num_bits_6 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_6);
+                if (num_bits_6 == 24) {
+                  t_6 = ((uint32_t)(*scratch >> 32));
+                  break;
+                }
+                num_bits_6 += 8;
+                *scratch |= ((uint64_t)(num_bits_6));
+              }
+            }
+            v_element = t_6;
+          }
+        } else {
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(17);
+            uint32_t t_7;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_7 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_read_chunk_table[0].scratch = 0;
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(18);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                uint32_t num_bits_7 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_7;
+                if (num_bits_7 == 24) {
+                  t_7 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_7 += 8;
+                *scratch |= ((uint64_t)(num_bits_7)) << 56;
+              }
+            }
+            v_element = t_7;
+          }
+        }
+        self->private_data.f_chunk_bytecounts[v_i] = v_element;
+        v_i += 1;
+      }
+    }
+    self->private_impl.f_table_phase = 0;
+    self->private_impl.f_table_base = v_base_index;
+    self->private_impl.f_table_length = v_length;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_base_index = self->private_impl.f_chunk_index;
+    v_n = wuffs_base__u32__sat_sub(self->private_impl.f_num_chunks, v_base_index);
+    v_length = wuffs_base__u32__min(v_n, 256);
+    if (self->private_impl.f_table_phase == 0) {
+      v_elem_size = 4;
+      if (self->private_impl.f_chunk_offsets_type == 3) {
+        v_elem_size = 2;
+      }
+      if ((((uint64_t)(self->private_impl.f_chunk_offsets_count)) * v_elem_size) <= 4) {
+        v_i = 0;
+        while (v_i < v_length) {
+          v_element = self->private_impl.f_chunk_offsets_value;
+          if (v_elem_size == 2) {
+            if ((((uint32_t)(v_base_index + v_i)) & 1) == 0) {
+              v_element = wuffs_tiff__decoder__first_value(self, 3, v_element);
+            } else {
+              v_element = wuffs_tiff__decoder__second_value(self, 3, v_element);
+            }
+          }
+          self->private_data.f_chunk_offsets[v_i] = v_element;
+          v_i += 1;
+        }
+      } else {
+        v_pos = (((uint64_t)(self->private_impl.f_chunk_offsets_value)) + (((uint64_t)(v_base_index)) * v_elem_size));
+        if (a_src) {
+          a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+        }
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, v_pos));
+        if (a_src) {
+          iop_a_src = a_src->data.ptr + a_src->meta.ri;
+        }
+        if (status.repr) {
+          goto suspend;
+        }
+        v_i = 0;
+        while (v_i < v_length) {
+          if (v_elem_size == 2) {
+            if (self->private_impl.f_is_big_endian) {
+              {
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+                uint32_t t_0;
+                if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                  t_0 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                  iop_a_src += 2;
+                } else {
+                  self->private_data.s_read_chunk_table[0].scratch = 0;
+                  WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+                  while (true) {
+                    if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                      goto suspend;
+                    }
+                    uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                    uint32_t num_bits_0 = ((uint32_t)(*scratch & 0xFF));
+                    *scratch >>= 8;
+                    *scratch <<= 8;
+                    *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_0);
+                    if (num_bits_0 == 8) {
+                      t_0 = ((uint32_t)(*scratch >> 48));
+                      break;
+                    }
+                    num_bits_0 += 8;
+                    *scratch |= ((uint64_t)(num_bits_0));
+                  }
+                }
+                v_element = t_0;
+              }
+            } else {
+              {
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+                uint32_t t_1;
+                if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                  t_1 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                  iop_a_src += 2;
+                } else {
+                  self->private_data.s_read_chunk_table[0].scratch = 0;
+                  WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+                  while (true) {
+                    if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                      goto suspend;
+                    }
+                    uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                    uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+                    *scratch <<= 8;
+                    *scratch >>= 8;
+                    *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+                    if (num_bits_1 == 8) {
+                      t_1 = ((uint32_t)(*scratch));
+                      break;
+                    }
+                    num_bits_1 += 8;
+                    *scratch |= ((uint64_t)(num_bits_1)) << 56;
+                  }
+                }
+                v_element = t_1;
+              }
+            }
+          } else if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+              uint32_t t_2;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+                t_2 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+                iop_a_src += 4;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_2 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_2);
+                  if (num_bits_2 == 24) {
+                    t_2 = ((uint32_t)(*scratch >> 32));
+                    break;
+                  }
+                  num_bits_2 += 8;
+                  *scratch |= ((uint64_t)(num_bits_2));
+                }
+              }
+              v_element = t_2;
+            }
+          } else {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+              uint32_t t_3;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+                t_3 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+                iop_a_src += 4;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_3 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;
+                  if (num_bits_3 == 24) {
+                    t_3 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_3 += 8;
+                  *scratch |= ((uint64_t)(num_bits_3)) << 56;
+                }
+              }
+              v_element = t_3;
+            }
+          }
+          self->private_data.f_chunk_offsets[v_i] = v_element;
+          v_i += 1;
+        }
+      }
+      self->private_impl.f_table_phase = 1;
+    }
+    v_elem_size = 4;
+    if (self->private_impl.f_chunk_bytecounts_type == 3) {
+      v_elem_size = 2;
+    }
+    if ((((uint64_t)(self->private_impl.f_chunk_bytecounts_count)) * v_elem_size) <= 4) {
+      v_i = 0;
+      while (v_i < v_length) {
+        v_element = self->private_impl.f_chunk_bytecounts_value;
+        if (v_elem_size == 2) {
+          if ((((uint32_t)(v_base_index + v_i)) & 1) == 0) {
+            v_element = wuffs_tiff__decoder__first_value(self, 3, v_element);
+          } else {
+            v_element = wuffs_tiff__decoder__second_value(self, 3, v_element);
+          }
+        }
+        self->private_data.f_chunk_bytecounts[v_i] = v_element;
+        v_i += 1;
+      }
+    } else {
+      v_pos = (((uint64_t)(self->private_impl.f_chunk_bytecounts_value)) + (((uint64_t)(v_base_index)) * v_elem_size));
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+      status = wuffs_tiff__decoder__seek_to(self, a_src, wuffs_base__u64__sat_add(self->private_impl.f_header_pos, v_pos));
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      v_i = 0;
+      while (v_i < v_length) {
+        if (v_elem_size == 2) {
+          if (self->private_impl.f_is_big_endian) {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+              uint32_t t_4;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_4 = ((uint32_t)(wuffs_base__peek_u16be__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_4 = ((uint32_t)(*scratch & 0xFF));
+                  *scratch >>= 8;
+                  *scratch <<= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_4);
+                  if (num_bits_4 == 8) {
+                    t_4 = ((uint32_t)(*scratch >> 48));
+                    break;
+                  }
+                  num_bits_4 += 8;
+                  *scratch |= ((uint64_t)(num_bits_4));
+                }
+              }
+              v_element = t_4;
+            }
+          } else {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(13);
+              uint32_t t_5;
+              if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 2)) {
+                t_5 = ((uint32_t)(wuffs_base__peek_u16le__no_bounds_check(iop_a_src)));
+                iop_a_src += 2;
+              } else {
+                self->private_data.s_read_chunk_table[0].scratch = 0;
+                WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+                while (true) {
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                  uint32_t num_bits_5 = ((uint32_t)(*scratch >> 56));
+                  *scratch <<= 8;
+                  *scratch >>= 8;
+                  *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_5;
+                  if (num_bits_5 == 8) {
+                    t_5 = ((uint32_t)(*scratch));
+                    break;
+                  }
+                  num_bits_5 += 8;
+                  *scratch |= ((uint64_t)(num_bits_5)) << 56;
+                }
+              }
+              v_element = t_5;
+            }
+          }
+        } else if (self->private_impl.f_is_big_endian) {
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(15);
+            uint32_t t_6;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_6 = wuffs_base__peek_u32be__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_read_chunk_table[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(16);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                uint32_t num_bits_6 = ((uint32_t)(*scratch & 0xFF));
+                *scratch >>= 8;
+                *scratch <<= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << (56 - num_bits_6);
+                if (num_bits_6 == 24) {
+                  t_6 = ((uint32_t)(*scratch >> 32));
+                  break;
+                }
+                num_bits_6 += 8;
+                *scratch |= ((uint64_t)(num_bits_6));
+              }
+            }
+            v_element = t_6;
+          }
+        } else {
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(17);
+            uint32_t t_7;
+            if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+              t_7 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+              iop_a_src += 4;
+            } else {
+              self->private_data.s_read_chunk_table[0].scratch = 0;
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(18);
+              while (true) {
+                if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                  status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                  goto suspend;
+                }
+                uint64_t* scratch = &self->private_data.s_read_chunk_table[0].scratch;
+                uint32_t num_bits_7 = ((uint32_t)(*scratch >> 56));
+                *scratch <<= 8;
+                *scratch >>= 8;
+                *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_7;
+                if (num_bits_7 == 24) {
+                  t_7 = ((uint32_t)(*scratch));
+                  break;
+                }
+                num_bits_7 += 8;
+                *scratch |= ((uint64_t)(num_bits_7)) << 56;
+              }
+            }
+            v_element = t_7;
+          }
+        }
+        self->private_data.f_chunk_bytecounts[v_i] = v_element;
+        v_i += 1;
+      }
+    }
+    self->private_impl.f_table_phase = 0;
+    self->private_impl.f_table_base = v_base_index;
+    self->private_impl.f_table_length = v_length;
+
+    goto ok;
+    ok:
+    self->private_impl.p_read_chunk_table[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_read_chunk_table[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_read_chunk_table[0].v_base_index = v_base_index;
+  self->private_data.s_read_chunk_table[0].v_length = v_length;
+  self->private_data.s_read_chunk_table[0].v_i = v_i;
+  self->private_data.s_read_chunk_table[0].v_elem_size = v_elem_size;
+  self->private_data.s_read_chunk_table[0].v_pos = v_pos;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[19].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[19].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.decode_chunk
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_chunk(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  wuffs_base__io_buffer u_w = wuffs_base__empty_io_buffer();
+  wuffs_base__io_buffer* v_w = &u_w;
+  uint8_t* iop_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  uint8_t* io0_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  uint8_t* io1_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  uint8_t* io2_v_w WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  uint64_t v_w_mark = 0;
+  uint64_t v_r_mark = 0;
+  uint64_t v_n = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[20].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_chunk[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if ((self->private_impl.f_compression == 1) || (self->private_impl.f_compression == 32773)) {
+      while (true) {
+        if (self->private_impl.f_compression == 1) {
+          if (a_src) {
+            a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+          }
+          v_status = wuffs_tiff__decoder__decode_rows_none(self, a_dst, a_src, a_workbuf);
+          if (a_src) {
+            iop_a_src = a_src->data.ptr + a_src->meta.ri;
+          }
+        } else {
+          if (a_src) {
+            a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+          }
+          v_status = wuffs_tiff__decoder__decode_rows_packbits(self, a_dst, a_src, a_workbuf);
+          if (a_src) {
+            iop_a_src = a_src->data.ptr + a_src->meta.ri;
+          }
+        }
+        if (wuffs_base__status__is_ok(&v_status)) {
+          goto label__fast__0__break;
+        } else if (v_status.repr != wuffs_base__suspension__short_read) {
+          status = v_status;
+          if (wuffs_base__status__is_error(&status)) {
+            goto exit;
+          } else if (wuffs_base__status__is_suspension(&status)) {
+            status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+            goto exit;
+          }
+          goto ok;
+        }
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+      }
+      label__fast__0__break:;
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    label__fast__1__continue:;
+    while (self->private_impl.f_row_y < self->private_impl.f_chunk_rows) {
+      if ((self->private_impl.f_row_wi > self->private_impl.f_bytes_per_row) || (self->private_impl.f_bytes_per_row > ((uint64_t)(a_workbuf.len)))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      {
+        wuffs_base__io_buffer* o_0_v_w = v_w;
+        uint8_t *o_0_iop_v_w = iop_v_w;
+        uint8_t *o_0_io0_v_w = io0_v_w;
+        uint8_t *o_0_io1_v_w = io1_v_w;
+        uint8_t *o_0_io2_v_w = io2_v_w;
+        v_w = wuffs_base__io_writer__set(
+            &u_w,
+            &iop_v_w,
+            &io0_v_w,
+            &io1_v_w,
+            &io2_v_w,
+            wuffs_base__slice_u8__subslice_ij(a_workbuf,
+            self->private_impl.f_row_wi,
+            self->private_impl.f_bytes_per_row),
+            self->private_impl.f_chunk_wpos);
+        {
+          const bool o_1_closed_a_src = a_src->meta.closed;
+          const uint8_t *o_1_io2_a_src = io2_a_src;
+          wuffs_base__io_reader__limit(&io2_a_src, iop_a_src,
+              self->private_impl.f_chunk_remaining);
+          if (a_src) {
+            size_t n = ((size_t)(io2_a_src - a_src->data.ptr));
+            a_src->meta.closed = a_src->meta.closed && (a_src->meta.wi <= n);
+            a_src->meta.wi = n;
+          }
+          v_w_mark = ((uint64_t)(iop_v_w - io0_v_w));
+          v_r_mark = ((uint64_t)(iop_a_src - io0_a_src));
+          if (self->private_impl.f_compression == 5) {
+            {
+              u_w.meta.wi = ((size_t)(iop_v_w - u_w.data.ptr));
+              if (a_src) {
+                a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+              }
+              wuffs_base__status t_0 = wuffs_lzw__decoder__transform_io(&self->private_data.f_lzw, v_w, a_src, wuffs_base__utility__empty_slice_u8());
+              v_status = t_0;
+              iop_v_w = u_w.data.ptr + u_w.meta.wi;
+              if (a_src) {
+                iop_a_src = a_src->data.ptr + a_src->meta.ri;
+              }
+            }
+          } else {
+            {
+              u_w.meta.wi = ((size_t)(iop_v_w - u_w.data.ptr));
+              if (a_src) {
+                a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+              }
+              wuffs_base__status t_1 = wuffs_zlib__decoder__transform_io(&self->private_data.f_zlib, v_w, a_src, wuffs_base__utility__empty_slice_u8());
+              v_status = t_1;
+              iop_v_w = u_w.data.ptr + u_w.meta.wi;
+              if (a_src) {
+                iop_a_src = a_src->data.ptr + a_src->meta.ri;
+              }
+            }
+          }
+          wuffs_base__u64__sat_sub_indirect(&self->private_impl.f_chunk_remaining, wuffs_base__io__count_since(v_r_mark, ((uint64_t)(iop_a_src - io0_a_src))));
+          v_n = wuffs_base__io__count_since(v_w_mark, ((uint64_t)(iop_v_w - io0_v_w)));
+          wuffs_base__u64__sat_add_indirect(&self->private_impl.f_row_wi, v_n);
+          self->private_impl.f_chunk_wpos += v_n;
+          io2_a_src = o_1_io2_a_src;
+          if (a_src) {
+            a_src->meta.closed = o_1_closed_a_src;
+            a_src->meta.wi = ((size_t)(io2_a_src - a_src->data.ptr));
+          }
+        }
+        v_w = o_0_v_w;
+        iop_v_w = o_0_iop_v_w;
+        io0_v_w = o_0_io0_v_w;
+        io1_v_w = o_0_io1_v_w;
+        io2_v_w = o_0_io2_v_w;
+      }
+      if (self->private_impl.f_row_wi >= self->private_impl.f_bytes_per_row) {
+        wuffs_tiff__decoder__process_row(self, a_dst, a_workbuf);
+        self->private_impl.f_row_y += 1;
+        self->private_impl.f_row_wi = 0;
+      }
+      if (wuffs_base__status__is_ok(&v_status)) {
+        goto label__fast__1__break;
+      } else if (v_status.repr == wuffs_base__suspension__short_write) {
+        goto label__fast__1__continue;
+      } else if (self->private_impl.f_chunk_remaining <= 0) {
+        goto label__fast__1__break;
+      } else if (wuffs_base__status__is_error(&v_status)) {
+        status = v_status;
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+    }
+    label__fast__1__break:;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if ((self->private_impl.f_compression == 1) || (self->private_impl.f_compression == 32773)) {
+      while (true) {
+        if (self->private_impl.f_compression == 1) {
+          if (a_src) {
+            a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+          }
+          v_status = wuffs_tiff__decoder__decode_rows_none(self, a_dst, a_src, a_workbuf);
+          if (a_src) {
+            iop_a_src = a_src->data.ptr + a_src->meta.ri;
+          }
+        } else {
+          if (a_src) {
+            a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+          }
+          v_status = wuffs_tiff__decoder__decode_rows_packbits(self, a_dst, a_src, a_workbuf);
+          if (a_src) {
+            iop_a_src = a_src->data.ptr + a_src->meta.ri;
+          }
+        }
+        if (wuffs_base__status__is_ok(&v_status)) {
+          goto label__0__break;
+        } else if (v_status.repr != wuffs_base__suspension__short_read) {
+          status = v_status;
+          if (wuffs_base__status__is_error(&status)) {
+            goto exit;
+          } else if (wuffs_base__status__is_suspension(&status)) {
+            status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+            goto exit;
+          }
+          goto ok;
+        }
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+      }
+      label__0__break:;
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    label__1__continue:;
+    while (self->private_impl.f_row_y < self->private_impl.f_chunk_rows) {
+      if ((self->private_impl.f_row_wi > self->private_impl.f_bytes_per_row) || (self->private_impl.f_bytes_per_row > ((uint64_t)(a_workbuf.len)))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      {
+        wuffs_base__io_buffer* o_0_v_w = v_w;
+        uint8_t *o_0_iop_v_w = iop_v_w;
+        uint8_t *o_0_io0_v_w = io0_v_w;
+        uint8_t *o_0_io1_v_w = io1_v_w;
+        uint8_t *o_0_io2_v_w = io2_v_w;
+        v_w = wuffs_base__io_writer__set(
+            &u_w,
+            &iop_v_w,
+            &io0_v_w,
+            &io1_v_w,
+            &io2_v_w,
+            wuffs_base__slice_u8__subslice_ij(a_workbuf,
+            self->private_impl.f_row_wi,
+            self->private_impl.f_bytes_per_row),
+            self->private_impl.f_chunk_wpos);
+        {
+          const bool o_1_closed_a_src = a_src->meta.closed;
+          const uint8_t *o_1_io2_a_src = io2_a_src;
+          wuffs_base__io_reader__limit(&io2_a_src, iop_a_src,
+              self->private_impl.f_chunk_remaining);
+          if (a_src) {
+            size_t n = ((size_t)(io2_a_src - a_src->data.ptr));
+            a_src->meta.closed = a_src->meta.closed && (a_src->meta.wi <= n);
+            a_src->meta.wi = n;
+          }
+          v_w_mark = ((uint64_t)(iop_v_w - io0_v_w));
+          v_r_mark = ((uint64_t)(iop_a_src - io0_a_src));
+          if (self->private_impl.f_compression == 5) {
+            {
+              u_w.meta.wi = ((size_t)(iop_v_w - u_w.data.ptr));
+              if (a_src) {
+                a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+              }
+              wuffs_base__status t_0 = wuffs_lzw__decoder__transform_io(&self->private_data.f_lzw, v_w, a_src, wuffs_base__utility__empty_slice_u8());
+              v_status = t_0;
+              iop_v_w = u_w.data.ptr + u_w.meta.wi;
+              if (a_src) {
+                iop_a_src = a_src->data.ptr + a_src->meta.ri;
+              }
+            }
+          } else {
+            {
+              u_w.meta.wi = ((size_t)(iop_v_w - u_w.data.ptr));
+              if (a_src) {
+                a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+              }
+              wuffs_base__status t_1 = wuffs_zlib__decoder__transform_io(&self->private_data.f_zlib, v_w, a_src, wuffs_base__utility__empty_slice_u8());
+              v_status = t_1;
+              iop_v_w = u_w.data.ptr + u_w.meta.wi;
+              if (a_src) {
+                iop_a_src = a_src->data.ptr + a_src->meta.ri;
+              }
+            }
+          }
+          wuffs_base__u64__sat_sub_indirect(&self->private_impl.f_chunk_remaining, wuffs_base__io__count_since(v_r_mark, ((uint64_t)(iop_a_src - io0_a_src))));
+          v_n = wuffs_base__io__count_since(v_w_mark, ((uint64_t)(iop_v_w - io0_v_w)));
+          wuffs_base__u64__sat_add_indirect(&self->private_impl.f_row_wi, v_n);
+          self->private_impl.f_chunk_wpos += v_n;
+          io2_a_src = o_1_io2_a_src;
+          if (a_src) {
+            a_src->meta.closed = o_1_closed_a_src;
+            a_src->meta.wi = ((size_t)(io2_a_src - a_src->data.ptr));
+          }
+        }
+        v_w = o_0_v_w;
+        iop_v_w = o_0_iop_v_w;
+        io0_v_w = o_0_io0_v_w;
+        io1_v_w = o_0_io1_v_w;
+        io2_v_w = o_0_io2_v_w;
+      }
+      if (self->private_impl.f_row_wi >= self->private_impl.f_bytes_per_row) {
+        wuffs_tiff__decoder__process_row(self, a_dst, a_workbuf);
+        self->private_impl.f_row_y += 1;
+        self->private_impl.f_row_wi = 0;
+      }
+      if (wuffs_base__status__is_ok(&v_status)) {
+        goto label__1__break;
+      } else if (v_status.repr == wuffs_base__suspension__short_write) {
+        goto label__1__continue;
+      } else if (self->private_impl.f_chunk_remaining <= 0) {
+        goto label__1__break;
+      } else if (wuffs_base__status__is_error(&v_status)) {
+        status = v_status;
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(2);
+    }
+    label__1__break:;
+
+    ok:
+    self->private_impl.p_decode_chunk[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_chunk[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[20].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[20].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func tiff.decoder.decode_rows_none
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_rows_none(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_n = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[21].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  while (self->private_impl.f_row_y < self->private_impl.f_chunk_rows) {
+    if ((self->private_impl.f_row_wi > self->private_impl.f_bytes_per_row) || (self->private_impl.f_bytes_per_row > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    } else if (self->private_impl.f_chunk_remaining <= 0) {
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    } else if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    v_n = wuffs_base__io_reader__limited_copy_u32_to_slice(
+        &iop_a_src, io2_a_src,((uint32_t)(wuffs_base__u64__min(self->private_impl.f_chunk_remaining, 4294967295))), wuffs_base__slice_u8__subslice_ij(a_workbuf,
+        self->private_impl.f_row_wi,
+        self->private_impl.f_bytes_per_row));
+    wuffs_base__u64__sat_sub_indirect(&self->private_impl.f_chunk_remaining, ((uint64_t)(v_n)));
+    wuffs_base__u64__sat_add_indirect(&self->private_impl.f_row_wi, ((uint64_t)(v_n)));
+    if (self->private_impl.f_row_wi >= self->private_impl.f_bytes_per_row) {
+      wuffs_tiff__decoder__process_row(self, a_dst, a_workbuf);
+      self->private_impl.f_row_y += 1;
+      self->private_impl.f_row_wi = 0;
+    }
+  }
+  status = wuffs_base__make_status(NULL);
+  goto ok;
+
+  ok:
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+  return status;
+}
+
+// -------- func tiff.decoder.decode_rows_packbits
+
+static wuffs_base__status
+wuffs_tiff__decoder__decode_rows_packbits(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__slice_u8 v_row = {0};
+  uint64_t v_wi = 0;
+  uint32_t v_c = 0;
+  uint32_t v_n = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[22].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  while (self->private_impl.f_row_y < self->private_impl.f_chunk_rows) {
+    if ((self->private_impl.f_row_wi > self->private_impl.f_bytes_per_row) || (self->private_impl.f_bytes_per_row > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_row = wuffs_base__slice_u8__subslice_ij(a_workbuf,
+        self->private_impl.f_row_wi,
+        self->private_impl.f_bytes_per_row);
+    if (self->private_impl.f_packbits_literal > 0) {
+      if (self->private_impl.f_chunk_remaining <= 0) {
+        status = wuffs_base__make_status(NULL);
+        goto ok;
+      } else if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        if (wuffs_base__status__is_error(&status)) {
+          goto exit;
+        } else if (wuffs_base__status__is_suspension(&status)) {
+          status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+          goto exit;
+        }
+        goto ok;
+      }
+      v_n = wuffs_base__io_reader__limited_copy_u32_to_slice(
+          &iop_a_src, io2_a_src,wuffs_base__u32__min(self->private_impl.f_packbits_literal, ((uint32_t)(wuffs_base__u64__min(self->private_impl.f_chunk_remaining, 4294967295)))), v_row);
+      wuffs_base__u32__sat_sub_indirect(&self->private_impl.f_packbits_literal, v_n);
+      wuffs_base__u64__sat_sub_indirect(&self->private_impl.f_chunk_remaining, ((uint64_t)(v_n)));
+      wuffs_base__u64__sat_add_indirect(&self->private_impl.f_row_wi, ((uint64_t)(v_n)));
+    } else if (self->private_impl.f_packbits_need_run_byte) {
+      if (self->private_impl.f_chunk_remaining <= 0) {
+        status = wuffs_base__make_status(NULL);
+        goto ok;
+      } else if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        if (wuffs_base__status__is_error(&status)) {
+          goto exit;
+        } else if (wuffs_base__status__is_suspension(&status)) {
+          status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+          goto exit;
+        }
+        goto ok;
+      }
+      self->private_impl.f_packbits_run_byte = wuffs_base__peek_u8be__no_bounds_check(iop_a_src);
+      iop_a_src += 1;
+      wuffs_base__u64__sat_sub_indirect(&self->private_impl.f_chunk_remaining, 1);
+      self->private_impl.f_packbits_need_run_byte = false;
+    } else if (self->private_impl.f_packbits_run > 0) {
+      v_wi = 0;
+      while ((self->private_impl.f_packbits_run > 0) && (v_wi < ((uint64_t)(v_row.len)))) {
+        v_row.ptr[v_wi] = self->private_impl.f_packbits_run_byte;
+        v_wi += 1;
+        self->private_impl.f_packbits_run -= 1;
+      }
+      wuffs_base__u64__sat_add_indirect(&self->private_impl.f_row_wi, v_wi);
+    } else {
+      if (self->private_impl.f_chunk_remaining <= 0) {
+        status = wuffs_base__make_status(NULL);
+        goto ok;
+      } else if (((uint64_t)(io2_a_src - iop_a_src)) <= 0) {
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        if (wuffs_base__status__is_error(&status)) {
+          goto exit;
+        } else if (wuffs_base__status__is_suspension(&status)) {
+          status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+          goto exit;
+        }
+        goto ok;
+      }
+      v_c = ((uint32_t)(wuffs_base__peek_u8be__no_bounds_check(iop_a_src)));
+      iop_a_src += 1;
+      wuffs_base__u64__sat_sub_indirect(&self->private_impl.f_chunk_remaining, 1);
+      if (v_c < 128) {
+        self->private_impl.f_packbits_literal = (v_c + 1);
+      } else if (v_c > 128) {
+        self->private_impl.f_packbits_run = (257 - v_c);
+        self->private_impl.f_packbits_need_run_byte = true;
+      }
+    }
+    if (self->private_impl.f_row_wi >= self->private_impl.f_bytes_per_row) {
+      wuffs_tiff__decoder__process_row(self, a_dst, a_workbuf);
+      self->private_impl.f_row_y += 1;
+      self->private_impl.f_row_wi = 0;
+    }
+  }
+  status = wuffs_base__make_status(NULL);
+  goto ok;
+
+  ok:
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+  return status;
+}
+
+// -------- func tiff.decoder.process_row
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__process_row(
+    wuffs_tiff__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__slice_u8 v_row = {0};
+  wuffs_base__slice_u8 v_unpacked = {0};
+  uint32_t v_y = 0;
+  wuffs_base__pixel_format v_dst_pixfmt = {0};
+  uint32_t v_dst_bits_per_pixel = 0;
+  uint64_t v_dst_bytes_per_pixel = 0;
+  wuffs_base__slice_u8 v_dst_palette = {0};
+  wuffs_base__table_u8 v_tab = {0};
+  wuffs_base__slice_u8 v_dst = {0};
+  uint64_t v_width = 0;
+  uint64_t v_i = 0;
+  uint64_t v_j = 0;
+  uint8_t v_c = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_shift = 0;
+  uint32_t v_mask = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[23].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (self->private_impl.f_bytes_per_row > ((uint64_t)(a_workbuf.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_row = wuffs_base__slice_u8__subslice_j(a_workbuf, self->private_impl.f_bytes_per_row);
+  v_y = wuffs_base__u32__sat_add(self->private_impl.f_chunk_y, self->private_impl.f_row_y);
+  if ((v_y >= self->private_impl.f_height) || (self->private_impl.f_chunk_x >= self->private_impl.f_width)) {
+    return wuffs_base__make_empty_struct();
+  }
+  if (self->private_impl.f_bits_per_sample == 16) {
+    if ( ! self->private_impl.f_is_big_endian) {
+      wuffs_tiff__decoder__swap_u16s(self, v_row);
+    }
+    if (self->private_impl.f_predictor == 2) {
+      wuffs_tiff__decoder__undo_predictor_u16be(self, v_row);
+    }
+    if (self->private_impl.f_white_is_zero) {
+      wuffs_tiff__decoder__invert(self, v_row);
+    }
+  } else if (self->private_impl.f_bits_per_sample == 8) {
+    if (self->private_impl.f_predictor == 2) {
+      wuffs_tiff__decoder__undo_predictor(self, v_row);
+    }
+    if (self->private_impl.f_white_is_zero) {
+      wuffs_tiff__decoder__invert(self, v_row);
+    }
+  } else {
+    v_unpacked = wuffs_base__slice_u8__subslice_i(a_workbuf, self->private_impl.f_bytes_per_row);
+    if (((uint64_t)(self->private_impl.f_chunk_width)) < ((uint64_t)(v_unpacked.len))) {
+      v_unpacked = wuffs_base__slice_u8__subslice_j(v_unpacked, ((uint64_t)(self->private_impl.f_chunk_width)));
+    }
+    v_mask = (((uint32_t)((((uint32_t)(1)) << (self->private_impl.f_bits_per_sample & 7)) - 1)) & 255);
+    v_c = 0;
+    if (self->private_impl.f_white_is_zero) {
+      v_c = 255;
+    }
+    v_i = 0;
+    v_j = 0;
+    v_shift = 0;
+    while (v_j < ((uint64_t)(v_unpacked.len))) {
+      if (v_shift == 0) {
+        if (v_i >= ((uint64_t)(v_row.len))) {
+          goto label__0__break;
+        }
+        v_bits = ((uint32_t)(v_row.ptr[v_i]));
+        v_i += 1;
+        v_shift = 8;
+      }
+      v_shift -= self->private_impl.f_bits_per_sample;
+      v_unpacked.ptr[v_j] = (((uint8_t)((((uint32_t)(((v_bits >> (v_shift & 7)) & v_mask) * self->private_impl.f_gray_scale)) & 255))) ^ v_c);
+      v_j += 1;
+    }
+    label__0__break:;
+    v_row = v_unpacked;
+  }
+  v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+  v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+  if ((v_dst_bits_per_pixel & 7) != 0) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+  v_dst_palette = wuffs_base__pixel_buffer__palette_or_else(a_dst, wuffs_base__make_slice_u8(self->private_data.f_dst_palette, 1024));
+  v_tab = wuffs_base__pixel_buffer__plane(a_dst, 0);
+  v_dst = wuffs_base__table_u8__row_u32(v_tab, v_y);
+  v_width = ((uint64_t)(wuffs_base__u32__sat_sub(self->private_impl.f_width, self->private_impl.f_chunk_x)));
+  v_width = wuffs_base__u64__min(v_width, ((uint64_t)(self->private_impl.f_chunk_width)));
+  v_i = (((uint64_t)(self->private_impl.f_chunk_x)) * v_dst_bytes_per_pixel);
+  if (v_i >= ((uint64_t)(v_dst.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_dst = wuffs_base__slice_u8__subslice_i(v_dst, v_i);
+  v_j = (v_width * v_dst_bytes_per_pixel);
+  if (v_j < ((uint64_t)(v_dst.len))) {
+    v_dst = wuffs_base__slice_u8__subslice_j(v_dst, v_j);
+  }
+  wuffs_base__pixel_swizzler__swizzle_interleaved_from_slice(&self->private_impl.f_swizzler, v_dst, v_dst_palette, v_row);
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.swap_u16s
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__swap_u16s(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+  uint8_t v_c = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[24].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 2;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 8) * 8);
+    while (v_curr.ptr < i_end0_curr) {
+      v_c = v_curr.ptr[0];
+      v_curr.ptr[0] = v_curr.ptr[1];
+      v_curr.ptr[1] = v_c;
+      v_curr.ptr += 2;
+      v_c = v_curr.ptr[0];
+      v_curr.ptr[0] = v_curr.ptr[1];
+      v_curr.ptr[1] = v_c;
+      v_curr.ptr += 2;
+      v_c = v_curr.ptr[0];
+      v_curr.ptr[0] = v_curr.ptr[1];
+      v_curr.ptr[1] = v_c;
+      v_curr.ptr += 2;
+      v_c = v_curr.ptr[0];
+      v_curr.ptr[0] = v_curr.ptr[1];
+      v_curr.ptr[1] = v_c;
+      v_curr.ptr += 2;
+    }
+    v_curr.len = 2;
+    uint8_t* i_end1_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 2) * 2);
+    while (v_curr.ptr < i_end1_curr) {
+      v_c = v_curr.ptr[0];
+      v_curr.ptr[0] = v_curr.ptr[1];
+      v_curr.ptr[1] = v_c;
+      v_curr.ptr += 2;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.invert
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__invert(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  wuffs_base__slice_u8 v_curr = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[25].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    v_curr.len = 8;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 8) * 8);
+    while (v_curr.ptr < i_end0_curr) {
+      wuffs_base__poke_u64le__no_bounds_check(v_curr.ptr, (wuffs_base__peek_u64le__no_bounds_check(v_curr.ptr) ^ 18446744073709551615u));
+      v_curr.ptr += 8;
+    }
+    v_curr.len = 1;
+    uint8_t* i_end1_curr = i_slice_curr.ptr + i_slice_curr.len;
+    while (v_curr.ptr < i_end1_curr) {
+      v_curr.ptr[0] ^= 255;
+      v_curr.ptr += 1;
+    }
+    v_curr.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.undo_predictor_u16be
+
+static wuffs_base__empty_struct
+wuffs_tiff__decoder__undo_predictor_u16be(
+    wuffs_tiff__decoder* self,
+    wuffs_base__slice_u8 a_curr) {
+  uint64_t v_distance = 0;
+  wuffs_base__slice_u8 v_curr = {0};
+  wuffs_base__slice_u8 v_prev = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[26].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_distance = ((uint64_t)((2 * wuffs_base__u32__min(self->private_impl.f_samples_per_pixel, 4))));
+  if (v_distance > ((uint64_t)(a_curr.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  {
+    wuffs_base__slice_u8 i_slice_curr = wuffs_base__slice_u8__subslice_i(a_curr, v_distance);
+    v_curr.ptr = i_slice_curr.ptr;
+    wuffs_base__slice_u8 i_slice_prev = a_curr;
+    v_prev.ptr = i_slice_prev.ptr;
+    i_slice_curr.len = ((size_t)(wuffs_base__u64__min(i_slice_curr.len, i_slice_prev.len)));
+    v_curr.len = 2;
+    v_prev.len = 2;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 2) * 2);
+    while (v_curr.ptr < i_end0_curr) {
+      wuffs_base__poke_u16be__no_bounds_check(v_curr.ptr, ((uint16_t)(wuffs_base__peek_u16be__no_bounds_check(v_curr.ptr) + wuffs_base__peek_u16be__no_bounds_check(v_prev.ptr))));
+      v_curr.ptr += 2;
+      v_prev.ptr += 2;
+    }
+    v_curr.len = 0;
+    v_prev.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32
+wuffs_tiff__decoder__frame_dirty_rect(
+    const wuffs_tiff__decoder* self) {
+  if (!self) {
+    return wuffs_base__utility__empty_rect_ie_u32();
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return wuffs_base__utility__empty_rect_ie_u32();
+  }
+
+  return wuffs_base__utility__make_rect_ie_u32(
+      0,
+      0,
+      wuffs_base__u32__min(self->private_impl.f_frame_width, self->private_impl.f_width),
+      wuffs_base__u32__min(self->private_impl.f_frame_height, self->private_impl.f_height));
+}
+
+// -------- func tiff.decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t
+wuffs_tiff__decoder__num_animation_loops(
+    const wuffs_tiff__decoder* self) {
+  if (!self) {
+    return 0;
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return 0;
+  }
+
+  return 0;
+}
+
+// -------- func tiff.decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_tiff__decoder__num_decoded_frame_configs(
+    const wuffs_tiff__decoder* self) {
+  if (!self) {
+    return 0;
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return 0;
+  }
+
+  return self->private_impl.f_num_decoded_frame_configs_value;
+}
+
+// -------- func tiff.decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_tiff__decoder__num_decoded_frames(
+    const wuffs_tiff__decoder* self) {
+  if (!self) {
+    return 0;
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return 0;
+  }
+
+  return self->private_impl.f_num_decoded_frames_value;
+}
+
+// -------- func tiff.decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__restart_frame(
+    wuffs_tiff__decoder* self,
+    uint64_t a_index,
+    uint64_t a_io_position) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[27].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if ((self->private_impl.f_call_sequence < 32) || ((self->private_impl.f_call_sequence & 16) != 0)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+  } else if ((a_index == 0) && (a_io_position != self->private_impl.f_first_ifd_pos)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  self->private_impl.f_call_sequence = 40;
+  self->private_impl.f_ifd_pending = false;
+  self->private_impl.f_ifd_phase = 0;
+  self->private_impl.f_frame_config_io_position = a_io_position;
+  self->private_impl.f_num_decoded_frame_configs_value = a_index;
+  self->private_impl.f_num_decoded_frames_value = a_index;
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func tiff.decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct
+wuffs_tiff__decoder__set_report_metadata(
+    wuffs_tiff__decoder* self,
+    uint32_t a_fourcc,
+    bool a_report) {
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func tiff.decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_tiff__decoder__tell_me_more(
+    wuffs_tiff__decoder* self,
+    wuffs_base__io_buffer* a_dst,
+    wuffs_base__more_information* a_minfo,
+    wuffs_base__io_buffer* a_src) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_dst || !a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 4)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[28].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+  const uint64_t stats_a_dst = a_dst->meta.wi;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if ((self->private_impl.f_call_sequence & 16) == 0) {
+    status = wuffs_base__make_status(wuffs_base__error__no_more_information);
+    goto exit;
+  }
+  if (a_minfo != NULL) {
+    wuffs_base__more_information__set(a_minfo,
+        2,
+        0,
+        self->private_impl.f_seek_pos,
+        0,
+        0);
+  }
+  self->private_impl.f_call_sequence &= 239;
+
+  goto ok;
+  ok:
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[28].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[28].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+  self->private_impl.stats_num_dst_bytes += a_dst->meta.wi - stats_a_dst;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func tiff.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64
+wuffs_tiff__decoder__workbuf_len(
+    const wuffs_tiff__decoder* self) {
+  if (!self) {
+    return wuffs_base__utility__empty_range_ii_u64();
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return wuffs_base__utility__empty_range_ii_u64();
+  }
+
+  return wuffs_base__utility__make_range_ii_u64(self->private_impl.f_workbuf_length, self->private_impl.f_workbuf_length);
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__TIFF)
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// ¡ WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__TIFF
@@ -0,0 +1,11466 @@
+#ifndef WUFFS_INCLUDE_GUARD__WEBP
+#define WUFFS_INCLUDE_GUARD__WEBP
+
+#if defined(WUFFS_IMPLEMENTATION) && !defined(WUFFS_CONFIG__MODULES)
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__WEBP
+#define WUFFS_NONMONOLITHIC
+#endif
+
+#include "./wuffs-base.c"
+
+// ¡ WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING ABOVE.
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WEBP) || defined(WUFFS_NONMONOLITHIC)
+
+// ---------------- Status Codes
+
+extern const char wuffs_webp__error__bad_huffman_code_over_subscribed[];
+extern const char wuffs_webp__error__bad_huffman_code_under_subscribed[];
+extern const char wuffs_webp__error__bad_huffman_code[];
+extern const char wuffs_webp__error__bad_back_reference[];
+extern const char wuffs_webp__error__bad_color_cache[];
+extern const char wuffs_webp__error__bad_header[];
+extern const char wuffs_webp__error__bad_partition[];
+extern const char wuffs_webp__error__bad_transform[];
+extern const char wuffs_webp__error__short_chunk[];
+extern const char wuffs_webp__error__truncated_input[];
+extern const char wuffs_webp__error__unsupported_number_of_huffman_groups[];
+extern const char wuffs_webp__error__unsupported_webp_file[];
+
+// ---------------- Public Consts
+
+#define WUFFS_WEBP__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE 1275069440
+
+// ---------------- Struct Declarations
+
+typedef struct wuffs_webp__decoder__struct wuffs_webp__decoder;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------- Public Initializer Prototypes
+
+// For any given "wuffs_foo__bar* self", "wuffs_foo__bar__initialize(self,
+// etc)" should be called before any other "wuffs_foo__bar__xxx(self, etc)".
+//
+// Pass sizeof(*self) and WUFFS_VERSION for sizeof_star_self and wuffs_version.
+// Pass 0 (or some combination of WUFFS_INITIALIZE__XXX) for options.
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT
+wuffs_webp__decoder__initialize(
+    wuffs_webp__decoder* self,
+    size_t sizeof_star_self,
+    uint64_t wuffs_version,
+    uint32_t options);
+
+size_t
+sizeof__wuffs_webp__decoder();
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+size_t
+wuffs_webp__decoder__stats(
+    const wuffs_webp__decoder* self,
+    wuffs_base__stats* dst_ptr,
+    size_t dst_len);
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Allocs
+
+// These functions allocate and initialize Wuffs structs. They return NULL if
+// memory allocation fails. If they return non-NULL, there is no need to call
+// wuffs_foo__bar__initialize, but the caller is responsible for eventually
+// calling free on the returned pointer. That pointer is effectively a C++
+// std::unique_ptr<T, decltype(&free)>.
+
+wuffs_webp__decoder*
+wuffs_webp__decoder__alloc();
+
+static inline wuffs_base__image_decoder*
+wuffs_webp__decoder__alloc_as__wuffs_base__image_decoder() {
+  return (wuffs_base__image_decoder*)(wuffs_webp__decoder__alloc());
+}
+
+// ---------------- Upcasts
+
+static inline wuffs_base__image_decoder*
+wuffs_webp__decoder__upcast_as__wuffs_base__image_decoder(
+    wuffs_webp__decoder* p) {
+  return (wuffs_base__image_decoder*)p;
+}
+
+// ---------------- Public Function Prototypes
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__set_quirk(
+    wuffs_webp__decoder* self,
+    uint32_t a_key,
+    uint64_t a_value);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__decode_image_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__decode_frame_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__decode_frame(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32
+wuffs_webp__decoder__frame_dirty_rect(
+    const wuffs_webp__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC uint32_t
+wuffs_webp__decoder__num_animation_loops(
+    const wuffs_webp__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_webp__decoder__num_decoded_frame_configs(
+    const wuffs_webp__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_webp__decoder__num_decoded_frames(
+    const wuffs_webp__decoder* self);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__restart_frame(
+    wuffs_webp__decoder* self,
+    uint64_t a_index,
+    uint64_t a_io_position);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct
+wuffs_webp__decoder__set_report_metadata(
+    wuffs_webp__decoder* self,
+    uint32_t a_fourcc,
+    bool a_report);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__tell_me_more(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_dst,
+    wuffs_base__more_information* a_minfo,
+    wuffs_base__io_buffer* a_src);
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64
+wuffs_webp__decoder__workbuf_len(
+    const wuffs_webp__decoder* self);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+// ---------------- Struct Definitions
+
+// These structs' fields, and the sizeof them, are private implementation
+// details that aren't guaranteed to be stable across Wuffs versions.
+//
+// See https://en.wikipedia.org/wiki/Opaque_pointer#C
+
+#if defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+struct wuffs_webp__decoder__struct {
+  // Do not access the private_impl's or private_data's fields directly. There
+  // is no API/ABI compatibility or safety guarantee if you do so. Instead, use
+  // the wuffs_foo__bar__baz functions.
+  //
+  // It is a struct, not a struct*, so that the outermost wuffs_foo__bar struct
+  // can be stack allocated when WUFFS_IMPLEMENTATION is defined.
+
+  struct {
+    uint32_t magic;
+    uint32_t active_coroutine;
+    wuffs_base__vtable vtable_for__wuffs_base__image_decoder;
+    wuffs_base__vtable null_vtable;
+
+    uint32_t f_pixfmt;
+    uint32_t f_width;
+    uint32_t f_height;
+    uint8_t f_call_sequence;
+    uint32_t f_bits;
+    uint32_t f_n_bits;
+    uint64_t f_frame_config_io_position;
+    bool f_seen_vp8x;
+    bool f_report_metadata_exif;
+    bool f_report_metadata_iccp;
+    bool f_report_metadata_xmp;
+    uint32_t f_metadata_fourcc;
+    uint32_t f_metadata_padding;
+    uint64_t f_metadata_y;
+    uint64_t f_metadata_z;
+    uint32_t f_pixel_width;
+    uint32_t f_pixel_x;
+    uint32_t f_pixel_y;
+    uint32_t f_color_cache_bits;
+    uint32_t f_n_huffman_groups;
+    uint32_t f_huffman_image_bits;
+    uint32_t f_huffman_image_width;
+    uint32_t f_n_transforms;
+    bool f_seen_transform[4];
+    uint32_t f_transform_type[4];
+    uint32_t f_transform_tile_size_log2[4];
+    uint32_t f_transform_width[4];
+    uint64_t f_workbuf_offset_for_transform[4];
+    uint64_t f_overall_workbuf_length;
+    bool f_is_vp8;
+    uint32_t f_vp8_data_length;
+    uint32_t f_vp8_first_partition_length;
+    uint32_t f_vp8_mb_width;
+    uint32_t f_vp8_mb_height;
+    uint64_t f_vp8_plane_offsets[4];
+    uint64_t f_vp8_bd_values[9];
+    uint32_t f_vp8_bd_n_bits[9];
+    uint32_t f_vp8_bd_ranges[9];
+    uint64_t f_vp8_bd_positions[9];
+    uint64_t f_vp8_bd_ends[9];
+    bool f_vp8_bd_eofs[9];
+    uint32_t f_vp8_n_partitions;
+    bool f_vp8_use_segment;
+    bool f_vp8_update_segment_map;
+    uint32_t f_vp8_segment_probs[3];
+    bool f_vp8_use_skip;
+    uint32_t f_vp8_skip_prob;
+    uint32_t f_vp8_dequant[24];
+    uint32_t f_vp8_filter_type;
+    uint32_t f_vp8_filter_limits[8];
+    uint32_t f_vp8_filter_ilevels[8];
+    uint32_t f_vp8_filter_hev_thresholds[8];
+    uint32_t f_vp8_mb_segment;
+    bool f_vp8_mb_skip;
+    bool f_vp8_mb_is_i4x4;
+    uint32_t f_vp8_mb_ymode;
+    uint32_t f_vp8_mb_uvmode;
+    uint32_t f_vp8_mb_bmodes[16];
+    uint32_t f_vp8_mb_block_kinds[24];
+    uint32_t f_vp8_intra_left[4];
+    uint32_t f_vp8_nz_left;
+    uint32_t f_vp8_nz_dc_left;
+    wuffs_base__pixel_swizzler f_swizzler;
+
+    uint32_t p_decode_huffman_groups[1];
+    uint32_t p_decode_huffman_tree[1];
+    uint32_t p_decode_code_lengths[1];
+    uint32_t p_decode_pixels[1];
+    uint32_t p_decode_pixels_slow[1];
+    wuffs_base__empty_struct (*choosy_predict_segment_no_left)(
+        wuffs_webp__decoder* self,
+        wuffs_base__slice_u8 a_curr,
+        wuffs_base__slice_u8 a_prev,
+        uint32_t a_top,
+        uint32_t a_top_left,
+        uint32_t a_mode);
+    wuffs_base__empty_struct (*choosy_cross_color_segment)(
+        wuffs_webp__decoder* self,
+        wuffs_base__slice_u8 a_pix,
+        uint32_t a_t);
+    wuffs_base__empty_struct (*choosy_apply_transform_subtract_green)(
+        wuffs_webp__decoder* self,
+        wuffs_base__slice_u8 a_pix);
+    uint32_t p_do_decode_image_config_vp8[1];
+    uint32_t p_decode_vp8[1];
+    wuffs_base__empty_struct (*choosy_vp8_filter_across_cols)(
+        wuffs_webp__decoder* self,
+        wuffs_base__slice_u8 a_pix,
+        uint64_t a_stride,
+        uint32_t a_n_rows,
+        uint32_t a_kind,
+        uint32_t a_limit,
+        uint32_t a_ilevel,
+        uint32_t a_hev);
+    wuffs_base__empty_struct (*choosy_vp8_filter_across_rows)(
+        wuffs_webp__decoder* self,
+        wuffs_base__slice_u8 a_pix,
+        uint64_t a_stride,
+        uint32_t a_n_cols,
+        uint32_t a_kind,
+        uint32_t a_limit,
+        uint32_t a_ilevel,
+        uint32_t a_hev);
+    uint32_t p_decode_image_config[1];
+    uint32_t p_do_decode_image_config[1];
+    uint32_t p_decode_frame_config[1];
+    uint32_t p_do_decode_frame_config[1];
+    uint32_t p_decode_frame[1];
+    uint32_t p_do_decode_frame[1];
+    uint32_t p_decode_transform[1];
+    uint32_t p_decode_color_cache_parameters[1];
+    uint32_t p_decode_huffman_image[1];
+    uint32_t p_decode_sub_image[1];
+    uint32_t p_tell_me_more[1];
+    uint32_t p_do_tell_me_more[1];
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+    uint64_t stats_num_src_bytes;
+    uint64_t stats_num_dst_bytes;
+    wuffs_base__stats_counters stats_funcs[60];
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+  } private_impl;
+
+  struct {
+    uint8_t f_palette[1024];
+    uint32_t f_color_cache[2048];
+    uint8_t f_code_lengths[2328];
+    uint16_t f_sorted_symbols[2328];
+    uint16_t f_huffman_tables[256][5004];
+    uint8_t f_vp8_coeff_probs[1056];
+    uint16_t f_vp8_coeffs[400];
+    uint8_t f_vp8_intra_top[4096];
+    uint8_t f_vp8_nz_top[1024];
+    uint8_t f_vp8_nz_dc_top[1024];
+    uint8_t f_vp8_mb_filters[1024];
+    uint8_t f_vp8_top_y[16384];
+    uint8_t f_vp8_top_u[8192];
+    uint8_t f_vp8_top_v[8192];
+    uint8_t f_vp8_mb[832];
+
+    struct {
+      uint32_t v_hg;
+      uint32_t v_ht;
+    } s_decode_huffman_groups[1];
+    struct {
+      uint32_t v_bits;
+      uint32_t v_n_bits;
+      uint32_t v_alphabet_size;
+      uint32_t v_n_symbols;
+      uint32_t v_n;
+    } s_decode_huffman_tree[1];
+    struct {
+      uint32_t v_bits;
+      uint32_t v_n_bits;
+      uint32_t v_n_codes;
+      uint32_t v_i;
+      uint32_t v_table_base;
+      uint32_t v_max_symbol;
+      uint32_t v_n;
+      uint32_t v_symbol;
+      uint8_t v_prev_code_length;
+      uint32_t v_code_length;
+      uint32_t v_repeat_index;
+    } s_decode_code_lengths[1];
+    struct {
+      uint32_t v_bits;
+      uint32_t v_n_bits;
+      uint64_t v_p;
+      uint64_t v_p_max;
+      uint32_t v_x;
+      uint32_t v_y;
+      uint64_t v_width_in_tiles;
+      uint32_t v_hg;
+      uint32_t v_ht;
+      uint32_t v_table_base;
+      uint32_t v_argb[4];
+      uint32_t v_color;
+      uint32_t v_prefix;
+      uint32_t v_n_extra;
+      uint32_t v_length;
+      uint32_t v_dist;
+      uint32_t v_cache_shift;
+    } s_decode_pixels_slow[1];
+    struct {
+      uint64_t scratch;
+    } s_do_decode_image_config_vp8[1];
+    struct {
+      uint64_t v_n;
+      uint64_t v_copied;
+    } s_decode_vp8[1];
+    struct {
+      uint32_t v_c32;
+      uint32_t v_chunk_length;
+      uint64_t scratch;
+    } s_do_decode_image_config[1];
+    struct {
+      uint32_t v_color_cache_bits;
+      uint64_t v_main_length;
+      uint64_t v_q;
+      uint64_t v_q_end;
+    } s_do_decode_frame[1];
+    struct {
+      uint32_t v_bits;
+      uint32_t v_n_bits;
+      uint32_t v_transform_type;
+      uint32_t v_tile_size_log2;
+      uint32_t v_n_colors;
+      uint32_t v_n_deltas;
+    } s_decode_transform[1];
+    struct {
+      uint32_t v_bits;
+      uint32_t v_n_bits;
+    } s_decode_color_cache_parameters[1];
+    struct {
+      uint32_t v_bits;
+      uint32_t v_n_bits;
+      uint32_t v_tile_size_log2;
+      uint32_t v_w;
+      uint32_t v_h;
+    } s_decode_huffman_image[1];
+    struct {
+      uint64_t v_offset_end;
+    } s_decode_sub_image[1];
+    struct {
+      uint64_t scratch;
+    } s_do_tell_me_more[1];
+  } private_data;
+
+#ifdef __cplusplus
+#if defined(WUFFS_BASE__HAVE_UNIQUE_PTR)
+  using unique_ptr = std::unique_ptr<wuffs_webp__decoder, decltype(&free)>;
+
+  // On failure, the alloc_etc functions return nullptr. They don't throw.
+
+  static inline unique_ptr
+  alloc() {
+    return unique_ptr(wuffs_webp__decoder__alloc(), &free);
+  }
+
+  static inline wuffs_base__image_decoder::unique_ptr
+  alloc_as__wuffs_base__image_decoder() {
+    return wuffs_base__image_decoder::unique_ptr(
+        wuffs_webp__decoder__alloc_as__wuffs_base__image_decoder(), &free);
+  }
+#endif  // defined(WUFFS_BASE__HAVE_UNIQUE_PTR)
+
+#if defined(WUFFS_BASE__HAVE_EQ_DELETE) && !defined(WUFFS_IMPLEMENTATION)
+  // Disallow constructing or copying an object via standard C++ mechanisms,
+  // e.g. the "new" operator, as this struct is intentionally opaque. Its total
+  // size and field layout is not part of the public, stable, memory-safe API.
+  // Use malloc or memcpy and the sizeof__wuffs_foo__bar function instead, and
+  // call wuffs_foo__bar__baz methods (which all take a "this"-like pointer as
+  // their first argument) rather than tweaking bar.private_impl.qux fields.
+  //
+  // In C, we can just leave wuffs_foo__bar as an incomplete type (unless
+  // WUFFS_IMPLEMENTATION is #define'd). In C++, we define a complete type in
+  // order to provide convenience methods. These forward on "this", so that you
+  // can write "bar->baz(etc)" instead of "wuffs_foo__bar__baz(bar, etc)".
+  wuffs_webp__decoder__struct() = delete;
+  wuffs_webp__decoder__struct(const wuffs_webp__decoder__struct&) = delete;
+  wuffs_webp__decoder__struct& operator=(
+      const wuffs_webp__decoder__struct&) = delete;
+#endif  // defined(WUFFS_BASE__HAVE_EQ_DELETE) && !defined(WUFFS_IMPLEMENTATION)
+
+#if !defined(WUFFS_IMPLEMENTATION)
+  // As above, the size of the struct is not part of the public API, and unless
+  // WUFFS_IMPLEMENTATION is #define'd, this struct type T should be heap
+  // allocated, not stack allocated. Its size is not intended to be known at
+  // compile time, but it is unfortunately divulged as a side effect of
+  // defining C++ convenience methods. Use "sizeof__T()", calling the function,
+  // instead of "sizeof T", invoking the operator. To make the two values
+  // different, so that passing the latter will be rejected by the initialize
+  // function, we add an arbitrary amount of dead weight.
+  uint8_t dead_weight[123000000];  // 123 MB.
+#endif  // !defined(WUFFS_IMPLEMENTATION)
+
+  inline wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT
+  initialize(
+      size_t sizeof_star_self,
+      uint64_t wuffs_version,
+      uint32_t options) {
+    return wuffs_webp__decoder__initialize(
+        this, sizeof_star_self, wuffs_version, options);
+  }
+
+  inline wuffs_base__image_decoder*
+  upcast_as__wuffs_base__image_decoder() {
+    return (wuffs_base__image_decoder*)this;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  inline size_t
+  stats(
+      wuffs_base__stats* dst_ptr,
+      size_t dst_len) const {
+    return wuffs_webp__decoder__stats(this, dst_ptr, dst_len);
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  inline wuffs_base__status
+  set_quirk(
+      uint32_t a_key,
+      uint64_t a_value) {
+    return wuffs_webp__decoder__set_quirk(this, a_key, a_value);
+  }
+
+  inline wuffs_base__status
+  decode_image_config(
+      wuffs_base__image_config* a_dst,
+      wuffs_base__io_buffer* a_src) {
+    return wuffs_webp__decoder__decode_image_config(this, a_dst, a_src);
+  }
+
+  inline wuffs_base__status
+  decode_frame_config(
+      wuffs_base__frame_config* a_dst,
+      wuffs_base__io_buffer* a_src) {
+    return wuffs_webp__decoder__decode_frame_config(this, a_dst, a_src);
+  }
+
+  inline wuffs_base__status
+  decode_frame(
+      wuffs_base__pixel_buffer* a_dst,
+      wuffs_base__io_buffer* a_src,
+      wuffs_base__pixel_blend a_blend,
+      wuffs_base__slice_u8 a_workbuf,
+      wuffs_base__decode_frame_options* a_opts) {
+    return wuffs_webp__decoder__decode_frame(this, a_dst, a_src, a_blend, a_workbuf, a_opts);
+  }
+
+  inline wuffs_base__rect_ie_u32
+  frame_dirty_rect() const {
+    return wuffs_webp__decoder__frame_dirty_rect(this);
+  }
+
+  inline uint32_t
+  num_animation_loops() const {
+    return wuffs_webp__decoder__num_animation_loops(this);
+  }
+
+  inline uint64_t
+  num_decoded_frame_configs() const {
+    return wuffs_webp__decoder__num_decoded_frame_configs(this);
+  }
+
+  inline uint64_t
+  num_decoded_frames() const {
+    return wuffs_webp__decoder__num_decoded_frames(this);
+  }
+
+  inline wuffs_base__status
+  restart_frame(
+      uint64_t a_index,
+      uint64_t a_io_position) {
+    return wuffs_webp__decoder__restart_frame(this, a_index, a_io_position);
+  }
+
+  inline wuffs_base__empty_struct
+  set_report_metadata(
+      uint32_t a_fourcc,
+      bool a_report) {
+    return wuffs_webp__decoder__set_report_metadata(this, a_fourcc, a_report);
+  }
+
+  inline wuffs_base__status
+  tell_me_more(
+      wuffs_base__io_buffer* a_dst,
+      wuffs_base__more_information* a_minfo,
+      wuffs_base__io_buffer* a_src) {
+    return wuffs_webp__decoder__tell_me_more(this, a_dst, a_minfo, a_src);
+  }
+
+  inline wuffs_base__range_ii_u64
+  workbuf_len() const {
+    return wuffs_webp__decoder__workbuf_len(this);
+  }
+
+#endif  // __cplusplus
+};  // struct wuffs_webp__decoder__struct
+
+#endif  // defined(__cplusplus) || defined(WUFFS_IMPLEMENTATION)
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WEBP) || defined(WUFFS_NONMONOLITHIC)
+
+// ‼ WUFFS C HEADER ENDS HERE.
+#ifdef WUFFS_IMPLEMENTATION
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WEBP)
+
+// ---------------- Status Codes Implementations
+
+const char wuffs_webp__error__bad_huffman_code_over_subscribed[] = "#webp: bad Huffman code (over-subscribed)";
+const char wuffs_webp__error__bad_huffman_code_under_subscribed[] = "#webp: bad Huffman code (under-subscribed)";
+const char wuffs_webp__error__bad_huffman_code[] = "#webp: bad Huffman code";
+const char wuffs_webp__error__bad_back_reference[] = "#webp: bad back-reference";
+const char wuffs_webp__error__bad_color_cache[] = "#webp: bad color cache";
+const char wuffs_webp__error__bad_header[] = "#webp: bad header";
+const char wuffs_webp__error__bad_partition[] = "#webp: bad partition";
+const char wuffs_webp__error__bad_transform[] = "#webp: bad transform";
+const char wuffs_webp__error__short_chunk[] = "#webp: short chunk";
+const char wuffs_webp__error__truncated_input[] = "#webp: truncated input";
+const char wuffs_webp__error__unsupported_number_of_huffman_groups[] = "#webp: unsupported number of Huffman groups";
+const char wuffs_webp__error__unsupported_webp_file[] = "#webp: unsupported WebP file";
+const char wuffs_webp__error__internal_error_inconsistent_i_o[] = "#webp: internal error: inconsistent I/O";
+const char wuffs_webp__error__internal_error_inconsistent_n_bits[] = "#webp: internal error: inconsistent n_bits";
+
+// ---------------- Private Consts
+
+static const uint16_t
+WUFFS_WEBP__HUFFMAN_TABLE_BASE_OFFSETS[5] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 2704, 3334, 3964, 4594,
+};
+
+static const uint16_t
+WUFFS_WEBP__HUFFMAN_TABLE_END_OFFSETS[5] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  2704, 3334, 3964, 4594, 5004,
+};
+
+static const uint8_t
+WUFFS_WEBP__CODE_LENGTH_CODE_ORDER[19] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  17, 18, 0, 1, 2, 3, 4, 5,
+  16, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15,
+};
+
+static const uint8_t
+WUFFS_WEBP__REPEAT_N_BITS[4] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  2, 3, 7, 0,
+};
+
+static const uint8_t
+WUFFS_WEBP__REPEAT_OFFSETS[4] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  3, 3, 11, 0,
+};
+
+static const uint8_t
+WUFFS_WEBP__DISTANCE_MAP[128] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  24, 7, 23, 25, 40, 6, 39, 41,
+  22, 26, 38, 42, 56, 5, 55, 57,
+  21, 27, 54, 58, 37, 43, 72, 4,
+  71, 73, 20, 28, 53, 59, 70, 74,
+  36, 44, 88, 69, 75, 52, 60, 3,
+  87, 89, 19, 29, 86, 90, 35, 45,
+  68, 76, 85, 91, 51, 61, 104, 2,
+  103, 105, 18, 30, 102, 106, 34, 46,
+  84, 92, 67, 77, 101, 107, 50, 62,
+  120, 1, 119, 121, 83, 93, 17, 31,
+  100, 108, 66, 78, 118, 122, 33, 47,
+  117, 123, 49, 63, 99, 109, 82, 94,
+  0, 116, 124, 65, 79, 16, 32, 98,
+  110, 48, 115, 125, 81, 95, 64, 114,
+  126, 97, 111, 80, 113, 127, 96, 112,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_COEFF_PROBS_DEFAULT[1056] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 253, 136, 254, 255, 228, 219, 128,
+  128, 128, 128, 128, 189, 129, 242, 255,
+  227, 213, 255, 219, 128, 128, 128, 106,
+  126, 227, 252, 214, 209, 255, 255, 128,
+  128, 128, 1, 98, 248, 255, 236, 226,
+  255, 255, 128, 128, 128, 181, 133, 238,
+  254, 221, 234, 255, 154, 128, 128, 128,
+  78, 134, 202, 247, 198, 180, 255, 219,
+  128, 128, 128, 1, 185, 249, 255, 243,
+  255, 128, 128, 128, 128, 128, 184, 150,
+  247, 255, 236, 224, 128, 128, 128, 128,
+  128, 77, 110, 216, 255, 236, 230, 128,
+  128, 128, 128, 128, 1, 101, 251, 255,
+  241, 255, 128, 128, 128, 128, 128, 170,
+  139, 241, 252, 236, 209, 255, 255, 128,
+  128, 128, 37, 116, 196, 243, 228, 255,
+  255, 255, 128, 128, 128, 1, 204, 254,
+  255, 245, 255, 128, 128, 128, 128, 128,
+  207, 160, 250, 255, 238, 128, 128, 128,
+  128, 128, 128, 102, 103, 231, 255, 211,
+  171, 128, 128, 128, 128, 128, 1, 152,
+  252, 255, 240, 255, 128, 128, 128, 128,
+  128, 177, 135, 243, 255, 234, 225, 128,
+  128, 128, 128, 128, 80, 129, 211, 255,
+  194, 224, 128, 128, 128, 128, 128, 1,
+  1, 255, 128, 128, 128, 128, 128, 128,
+  128, 128, 246, 1, 255, 128, 128, 128,
+  128, 128, 128, 128, 128, 255, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  198, 35, 237, 223, 193, 187, 162, 160,
+  145, 155, 62, 131, 45, 198, 221, 172,
+  176, 220, 157, 252, 221, 1, 68, 47,
+  146, 208, 149, 167, 221, 162, 255, 223,
+  128, 1, 149, 241, 255, 221, 224, 255,
+  255, 128, 128, 128, 184, 141, 234, 253,
+  222, 220, 255, 199, 128, 128, 128, 81,
+  99, 181, 242, 176, 190, 249, 202, 255,
+  255, 128, 1, 129, 232, 253, 214, 197,
+  242, 196, 255, 255, 128, 99, 121, 210,
+  250, 201, 198, 255, 202, 128, 128, 128,
+  23, 91, 163, 242, 170, 187, 247, 210,
+  255, 255, 128, 1, 200, 246, 255, 234,
+  255, 128, 128, 128, 128, 128, 109, 178,
+  241, 255, 231, 245, 255, 255, 128, 128,
+  128, 44, 130, 201, 253, 205, 192, 255,
+  255, 128, 128, 128, 1, 132, 239, 251,
+  219, 209, 255, 165, 128, 128, 128, 94,
+  136, 225, 251, 218, 190, 255, 255, 128,
+  128, 128, 22, 100, 174, 245, 186, 161,
+  255, 199, 128, 128, 128, 1, 182, 249,
+  255, 232, 235, 128, 128, 128, 128, 128,
+  124, 143, 241, 255, 227, 234, 128, 128,
+  128, 128, 128, 35, 77, 181, 251, 193,
+  211, 255, 205, 128, 128, 128, 1, 157,
+  247, 255, 236, 231, 255, 255, 128, 128,
+  128, 121, 141, 235, 255, 225, 227, 255,
+  255, 128, 128, 128, 45, 99, 188, 251,
+  195, 217, 255, 224, 128, 128, 128, 1,
+  1, 251, 255, 213, 255, 128, 128, 128,
+  128, 128, 203, 1, 248, 255, 255, 128,
+  128, 128, 128, 128, 128, 137, 1, 177,
+  255, 224, 255, 128, 128, 128, 128, 128,
+  253, 9, 248, 251, 207, 208, 255, 192,
+  128, 128, 128, 175, 13, 224, 243, 193,
+  185, 249, 198, 255, 255, 128, 73, 17,
+  171, 221, 161, 179, 236, 167, 255, 234,
+  128, 1, 95, 247, 253, 212, 183, 255,
+  255, 128, 128, 128, 239, 90, 244, 250,
+  211, 209, 255, 255, 128, 128, 128, 155,
+  77, 195, 248, 188, 195, 255, 255, 128,
+  128, 128, 1, 24, 239, 251, 218, 219,
+  255, 205, 128, 128, 128, 201, 51, 219,
+  255, 196, 186, 128, 128, 128, 128, 128,
+  69, 46, 190, 239, 201, 218, 255, 228,
+  128, 128, 128, 1, 191, 251, 255, 255,
+  128, 128, 128, 128, 128, 128, 223, 165,
+  249, 255, 213, 255, 128, 128, 128, 128,
+  128, 141, 124, 248, 255, 255, 128, 128,
+  128, 128, 128, 128, 1, 16, 248, 255,
+  255, 128, 128, 128, 128, 128, 128, 190,
+  36, 230, 255, 236, 255, 128, 128, 128,
+  128, 128, 149, 1, 255, 128, 128, 128,
+  128, 128, 128, 128, 128, 1, 226, 255,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  247, 192, 255, 128, 128, 128, 128, 128,
+  128, 128, 128, 240, 128, 255, 128, 128,
+  128, 128, 128, 128, 128, 128, 1, 134,
+  252, 255, 255, 128, 128, 128, 128, 128,
+  128, 213, 62, 250, 255, 255, 128, 128,
+  128, 128, 128, 128, 55, 93, 255, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128,
+  202, 24, 213, 235, 186, 191, 220, 160,
+  240, 175, 255, 126, 38, 182, 232, 169,
+  184, 228, 174, 255, 187, 128, 61, 46,
+  138, 219, 151, 178, 240, 170, 255, 216,
+  128, 1, 112, 230, 250, 199, 191, 247,
+  159, 255, 255, 128, 166, 109, 228, 252,
+  211, 215, 255, 174, 128, 128, 128, 39,
+  77, 162, 232, 172, 180, 245, 178, 255,
+  255, 128, 1, 52, 220, 246, 198, 199,
+  249, 220, 255, 255, 128, 124, 74, 191,
+  243, 183, 193, 250, 221, 255, 255, 128,
+  24, 71, 130, 219, 154, 170, 243, 182,
+  255, 255, 128, 1, 182, 225, 249, 219,
+  240, 255, 224, 128, 128, 128, 149, 150,
+  226, 252, 216, 205, 255, 171, 128, 128,
+  128, 28, 108, 170, 242, 183, 194, 254,
+  223, 255, 255, 128, 1, 81, 230, 252,
+  204, 203, 255, 192, 128, 128, 128, 123,
+  102, 209, 247, 188, 196, 255, 233, 128,
+  128, 128, 20, 95, 153, 243, 164, 173,
+  255, 203, 128, 128, 128, 1, 222, 248,
+  255, 216, 213, 128, 128, 128, 128, 128,
+  168, 175, 246, 252, 235, 205, 255, 255,
+  128, 128, 128, 47, 116, 215, 255, 211,
+  212, 255, 255, 128, 128, 128, 1, 121,
+  236, 253, 212, 214, 255, 255, 128, 128,
+  128, 141, 84, 213, 252, 201, 202, 255,
+  219, 128, 128, 128, 42, 80, 160, 240,
+  162, 185, 255, 205, 128, 128, 128, 1,
+  1, 255, 128, 128, 128, 128, 128, 128,
+  128, 128, 244, 1, 255, 128, 128, 128,
+  128, 128, 128, 128, 128, 238, 1, 255,
+  128, 128, 128, 128, 128, 128, 128, 128,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_COEFF_UPDATE_PROBS[1056] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 176, 246, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 223, 241, 252, 255,
+  255, 255, 255, 255, 255, 255, 255, 249,
+  253, 253, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 244, 252, 255, 255, 255,
+  255, 255, 255, 255, 255, 234, 254, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  253, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 246, 254, 255, 255,
+  255, 255, 255, 255, 255, 255, 239, 253,
+  254, 255, 255, 255, 255, 255, 255, 255,
+  255, 254, 255, 254, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 248, 254, 255,
+  255, 255, 255, 255, 255, 255, 255, 251,
+  255, 254, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 253, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  251, 254, 254, 255, 255, 255, 255, 255,
+  255, 255, 255, 254, 255, 254, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 254,
+  253, 255, 254, 255, 255, 255, 255, 255,
+  255, 250, 255, 254, 255, 254, 255, 255,
+  255, 255, 255, 255, 254, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  217, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 225, 252, 241, 253, 255,
+  255, 254, 255, 255, 255, 255, 234, 250,
+  241, 250, 253, 255, 253, 254, 255, 255,
+  255, 255, 254, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 223, 254, 254, 255,
+  255, 255, 255, 255, 255, 255, 255, 238,
+  253, 254, 254, 255, 255, 255, 255, 255,
+  255, 255, 255, 248, 254, 255, 255, 255,
+  255, 255, 255, 255, 255, 249, 254, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 253, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 247, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 253, 254, 255,
+  255, 255, 255, 255, 255, 255, 255, 252,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 254, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  253, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 254,
+  253, 255, 255, 255, 255, 255, 255, 255,
+  255, 250, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 254, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  186, 251, 250, 255, 255, 255, 255, 255,
+  255, 255, 255, 234, 251, 244, 254, 255,
+  255, 255, 255, 255, 255, 255, 251, 251,
+  243, 253, 254, 255, 254, 255, 255, 255,
+  255, 255, 253, 254, 255, 255, 255, 255,
+  255, 255, 255, 255, 236, 253, 254, 255,
+  255, 255, 255, 255, 255, 255, 255, 251,
+  253, 253, 254, 254, 255, 255, 255, 255,
+  255, 255, 255, 254, 254, 255, 255, 255,
+  255, 255, 255, 255, 255, 254, 254, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 254, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 254, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 254, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  248, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 250, 254, 252, 254, 255,
+  255, 255, 255, 255, 255, 255, 248, 254,
+  249, 253, 255, 255, 255, 255, 255, 255,
+  255, 255, 253, 253, 255, 255, 255, 255,
+  255, 255, 255, 255, 246, 253, 253, 255,
+  255, 255, 255, 255, 255, 255, 255, 252,
+  254, 251, 254, 254, 255, 255, 255, 255,
+  255, 255, 255, 254, 252, 255, 255, 255,
+  255, 255, 255, 255, 255, 248, 254, 253,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  253, 255, 254, 254, 255, 255, 255, 255,
+  255, 255, 255, 255, 251, 254, 255, 255,
+  255, 255, 255, 255, 255, 255, 245, 251,
+  254, 255, 255, 255, 255, 255, 255, 255,
+  255, 253, 253, 254, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 251, 253, 255,
+  255, 255, 255, 255, 255, 255, 255, 252,
+  253, 254, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 254, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 252, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  249, 255, 254, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 254, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  253, 255, 255, 255, 255, 255, 255, 255,
+  255, 250, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 254, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_BMODE_PROBS[900] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  231, 120, 48, 89, 115, 113, 120, 152,
+  112, 152, 179, 64, 126, 170, 118, 46,
+  70, 95, 175, 69, 143, 80, 85, 82,
+  72, 155, 103, 56, 58, 10, 171, 218,
+  189, 17, 13, 152, 114, 26, 17, 163,
+  44, 195, 21, 10, 173, 121, 24, 80,
+  195, 26, 62, 44, 64, 85, 144, 71,
+  10, 38, 171, 213, 144, 34, 26, 170,
+  46, 55, 19, 136, 160, 33, 206, 71,
+  63, 20, 8, 114, 114, 208, 12, 9,
+  226, 81, 40, 11, 96, 182, 84, 29,
+  16, 36, 134, 183, 89, 137, 98, 101,
+  106, 165, 148, 72, 187, 100, 130, 157,
+  111, 32, 75, 80, 66, 102, 167, 99,
+  74, 62, 40, 234, 128, 41, 53, 9,
+  178, 241, 141, 26, 8, 107, 74, 43,
+  26, 146, 73, 166, 49, 23, 157, 65,
+  38, 105, 160, 51, 52, 31, 115, 128,
+  104, 79, 12, 27, 217, 255, 87, 17,
+  7, 87, 68, 71, 44, 114, 51, 15,
+  186, 23, 47, 41, 14, 110, 182, 183,
+  21, 17, 194, 66, 45, 25, 102, 197,
+  189, 23, 18, 22, 88, 88, 147, 150,
+  42, 46, 45, 196, 205, 43, 97, 183,
+  117, 85, 38, 35, 179, 61, 39, 53,
+  200, 87, 26, 21, 43, 232, 171, 56,
+  34, 51, 104, 114, 102, 29, 93, 77,
+  39, 28, 85, 171, 58, 165, 90, 98,
+  64, 34, 22, 116, 206, 23, 34, 43,
+  166, 73, 107, 54, 32, 26, 51, 1,
+  81, 43, 31, 68, 25, 106, 22, 64,
+  171, 36, 225, 114, 34, 19, 21, 102,
+  132, 188, 16, 76, 124, 62, 18, 78,
+  95, 85, 57, 50, 48, 51, 193, 101,
+  35, 159, 215, 111, 89, 46, 111, 60,
+  148, 31, 172, 219, 228, 21, 18, 111,
+  112, 113, 77, 85, 179, 255, 38, 120,
+  114, 40, 42, 1, 196, 245, 209, 10,
+  25, 109, 88, 43, 29, 140, 166, 213,
+  37, 43, 154, 61, 63, 30, 155, 67,
+  45, 68, 1, 209, 100, 80, 8, 43,
+  154, 1, 51, 26, 71, 142, 78, 78,
+  16, 255, 128, 34, 197, 171, 41, 40,
+  5, 102, 211, 183, 4, 1, 221, 51,
+  50, 17, 168, 209, 192, 23, 25, 82,
+  138, 31, 36, 171, 27, 166, 38, 44,
+  229, 67, 87, 58, 169, 82, 115, 26,
+  59, 179, 63, 59, 90, 180, 59, 166,
+  93, 73, 154, 40, 40, 21, 116, 143,
+  209, 34, 39, 175, 47, 15, 16, 183,
+  34, 223, 49, 45, 183, 46, 17, 33,
+  183, 6, 98, 15, 32, 183, 57, 46,
+  22, 24, 128, 1, 54, 17, 37, 65,
+  32, 73, 115, 28, 128, 23, 128, 205,
+  40, 3, 9, 115, 51, 192, 18, 6,
+  223, 87, 37, 9, 115, 59, 77, 64,
+  21, 47, 104, 55, 44, 218, 9, 54,
+  53, 130, 226, 64, 90, 70, 205, 40,
+  41, 23, 26, 57, 54, 57, 112, 184,
+  5, 41, 38, 166, 213, 30, 34, 26,
+  133, 152, 116, 10, 32, 134, 39, 19,
+  53, 221, 26, 114, 32, 73, 255, 31,
+  9, 65, 234, 2, 15, 1, 118, 73,
+  75, 32, 12, 51, 192, 255, 160, 43,
+  51, 88, 31, 35, 67, 102, 85, 55,
+  186, 85, 56, 21, 23, 111, 59, 205,
+  45, 37, 192, 55, 38, 70, 124, 73,
+  102, 1, 34, 98, 125, 98, 42, 88,
+  104, 85, 117, 175, 82, 95, 84, 53,
+  89, 128, 100, 113, 101, 45, 75, 79,
+  123, 47, 51, 128, 81, 171, 1, 57,
+  17, 5, 71, 102, 57, 53, 41, 49,
+  38, 33, 13, 121, 57, 73, 26, 1,
+  85, 41, 10, 67, 138, 77, 110, 90,
+  47, 114, 115, 21, 2, 10, 102, 255,
+  166, 23, 6, 101, 29, 16, 10, 85,
+  128, 101, 196, 26, 57, 18, 10, 102,
+  102, 213, 34, 20, 43, 117, 20, 15,
+  36, 163, 128, 68, 1, 26, 102, 61,
+  71, 37, 34, 53, 31, 243, 192, 69,
+  60, 71, 38, 73, 119, 28, 222, 37,
+  68, 45, 128, 34, 1, 47, 11, 245,
+  171, 62, 17, 19, 70, 146, 85, 55,
+  62, 70, 37, 43, 37, 154, 100, 163,
+  85, 160, 1, 63, 9, 92, 136, 28,
+  64, 32, 201, 85, 75, 15, 9, 9,
+  64, 255, 184, 119, 16, 86, 6, 28,
+  5, 64, 255, 25, 248, 1, 56, 8,
+  17, 132, 137, 255, 55, 116, 128, 58,
+  15, 20, 82, 135, 57, 26, 121, 40,
+  164, 50, 31, 137, 154, 133, 25, 35,
+  218, 51, 103, 44, 131, 131, 123, 31,
+  6, 158, 86, 40, 64, 135, 148, 224,
+  45, 183, 128, 22, 26, 17, 131, 240,
+  154, 14, 1, 209, 45, 16, 21, 91,
+  64, 222, 7, 1, 197, 56, 21, 39,
+  155, 60, 138, 23, 102, 213, 83, 12,
+  13, 54, 192, 255, 68, 47, 28, 85,
+  26, 85, 85, 128, 128, 32, 146, 171,
+  18, 11, 7, 63, 144, 171, 4, 4,
+  246, 35, 27, 10, 146, 174, 171, 12,
+  26, 128, 190, 80, 35, 99, 180, 80,
+  126, 54, 45, 85, 126, 47, 87, 176,
+  51, 41, 20, 32, 101, 75, 128, 139,
+  118, 146, 116, 128, 85, 56, 41, 15,
+  176, 236, 85, 37, 9, 62, 71, 30,
+  17, 119, 118, 255, 17, 18, 138, 101,
+  38, 60, 138, 55, 70, 43, 26, 142,
+  146, 36, 19, 30, 171, 255, 97, 27,
+  20, 138, 45, 61, 62, 219, 1, 81,
+  188, 64, 32, 41, 20, 117, 151, 142,
+  20, 21, 163, 112, 19, 12, 61, 195,
+  128, 48, 4, 24,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_BMODE_TREE[18] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  128, 1, 129, 2, 130, 3, 4, 6,
+  131, 5, 132, 133, 134, 7, 135, 8,
+  136, 137,
+};
+
+static const uint16_t
+WUFFS_WEBP__VP8_DC_QUANT[128] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  4, 5, 6, 7, 8, 9, 10, 10,
+  11, 12, 13, 14, 15, 16, 17, 17,
+  18, 19, 20, 20, 21, 21, 22, 22,
+  23, 23, 24, 25, 25, 26, 27, 28,
+  29, 30, 31, 32, 33, 34, 35, 36,
+  37, 37, 38, 39, 40, 41, 42, 43,
+  44, 45, 46, 46, 47, 48, 49, 50,
+  51, 52, 53, 54, 55, 56, 57, 58,
+  59, 60, 61, 62, 63, 64, 65, 66,
+  67, 68, 69, 70, 71, 72, 73, 74,
+  75, 76, 76, 77, 78, 79, 80, 81,
+  82, 83, 84, 85, 86, 87, 88, 89,
+  91, 93, 95, 96, 98, 100, 101, 102,
+  104, 106, 108, 110, 112, 114, 116, 118,
+  122, 124, 126, 128, 130, 132, 134, 136,
+  138, 140, 143, 145, 148, 151, 154, 157,
+};
+
+static const uint16_t
+WUFFS_WEBP__VP8_AC_QUANT[128] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  4, 5, 6, 7, 8, 9, 10, 11,
+  12, 13, 14, 15, 16, 17, 18, 19,
+  20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35,
+  36, 37, 38, 39, 40, 41, 42, 43,
+  44, 45, 46, 47, 48, 49, 50, 51,
+  52, 53, 54, 55, 56, 57, 58, 60,
+  62, 64, 66, 68, 70, 72, 74, 76,
+  78, 80, 82, 84, 86, 88, 90, 92,
+  94, 96, 98, 100, 102, 104, 106, 108,
+  110, 112, 114, 116, 119, 122, 125, 128,
+  131, 134, 137, 140, 143, 146, 149, 152,
+  155, 158, 161, 164, 167, 170, 173, 177,
+  181, 185, 189, 193, 197, 201, 205, 209,
+  213, 217, 221, 225, 229, 234, 239, 245,
+  249, 254, 259, 264, 269, 274, 279, 284,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_BANDS_X33[17] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 33, 66, 99, 198, 132, 165, 198,
+  198, 198, 198, 198, 198, 198, 198, 231,
+  0,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_ZIGZAG[16] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 1, 4, 8, 5, 2, 3, 6,
+  9, 12, 13, 10, 7, 11, 14, 15,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_COEFF_TREE[22] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 0, 0, 0, 129, 6, 8, 12,
+  130, 10, 131, 132, 14, 16, 133, 134,
+  18, 20, 135, 136, 137, 138,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_TOKEN_BASES[11] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 1, 2, 3, 4, 5, 7, 11,
+  19, 35, 67,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_TOKEN_EXTRA_PROBS_OFFSETS[12] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 0, 0, 0, 0, 0, 1, 3,
+  6, 10, 15, 26,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_TOKEN_EXTRA_PROBS[26] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  159, 165, 145, 173, 148, 140, 176, 155,
+  140, 135, 180, 157, 141, 134, 130, 254,
+  254, 243, 230, 196, 177, 153, 140, 133,
+  130, 129,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_NZ_SHIFTS[24] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 1, 2, 3, 16, 17, 18, 19,
+  32, 33, 34, 35, 48, 49, 50, 51,
+  68, 69, 84, 85, 102, 103, 118, 119,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_NORM_SHIFTS[256] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  7, 7, 6, 6, 5, 5, 5, 5,
+  4, 4, 4, 4, 4, 4, 4, 4,
+  3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_Y_REMAP[256] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 2, 3, 5, 6, 7, 8,
+  9, 10, 12, 13, 14, 15, 16, 17,
+  19, 20, 21, 22, 23, 24, 26, 27,
+  28, 29, 30, 31, 33, 34, 35, 36,
+  37, 38, 40, 41, 42, 43, 44, 45,
+  47, 48, 49, 50, 51, 52, 54, 55,
+  56, 57, 58, 59, 61, 62, 63, 64,
+  65, 66, 68, 69, 70, 71, 72, 73,
+  75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 86, 87, 88, 90, 91, 92,
+  93, 94, 95, 97, 98, 99, 100, 101,
+  102, 104, 105, 106, 107, 108, 109, 111,
+  112, 113, 114, 115, 116, 118, 119, 120,
+  121, 122, 123, 125, 126, 127, 128, 129,
+  130, 132, 133, 134, 135, 136, 137, 139,
+  140, 141, 142, 143, 144, 146, 147, 148,
+  149, 150, 151, 153, 154, 155, 156, 157,
+  158, 160, 161, 162, 163, 164, 165, 167,
+  168, 169, 170, 171, 172, 173, 175, 176,
+  177, 178, 179, 180, 182, 183, 184, 185,
+  186, 187, 189, 190, 191, 192, 193, 194,
+  196, 197, 198, 199, 200, 201, 203, 204,
+  205, 206, 207, 208, 210, 211, 212, 213,
+  214, 215, 217, 218, 219, 220, 221, 222,
+  224, 225, 226, 227, 228, 229, 231, 232,
+  233, 234, 235, 236, 238, 239, 240, 241,
+  242, 243, 245, 246, 247, 248, 249, 250,
+  252, 253, 254, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+static const uint8_t
+WUFFS_WEBP__VP8_C_REMAP[256] WUFFS_BASE__POTENTIALLY_UNUSED = {
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  1, 2, 3, 4, 5, 6, 7, 8,
+  10, 11, 12, 13, 14, 15, 16, 18,
+  19, 20, 21, 22, 23, 24, 26, 27,
+  28, 29, 30, 31, 32, 34, 35, 36,
+  37, 38, 39, 40, 41, 43, 44, 45,
+  46, 47, 48, 49, 51, 52, 53, 54,
+  55, 56, 57, 59, 60, 61, 62, 63,
+  64, 65, 67, 68, 69, 70, 71, 72,
+  73, 74, 76, 77, 78, 79, 80, 81,
+  82, 84, 85, 86, 87, 88, 89, 90,
+  92, 93, 94, 95, 96, 97, 98, 100,
+  101, 102, 103, 104, 105, 106, 108, 109,
+  110, 111, 112, 113, 114, 115, 117, 118,
+  119, 120, 121, 122, 123, 125, 126, 127,
+  128, 129, 130, 131, 133, 134, 135, 136,
+  137, 138, 139, 141, 142, 143, 144, 145,
+  146, 147, 148, 150, 151, 152, 153, 154,
+  155, 156, 158, 159, 160, 161, 162, 163,
+  164, 166, 167, 168, 169, 170, 171, 172,
+  174, 175, 176, 177, 178, 179, 180, 182,
+  183, 184, 185, 186, 187, 188, 189, 191,
+  192, 193, 194, 195, 196, 197, 199, 200,
+  201, 202, 203, 204, 205, 207, 208, 209,
+  210, 211, 212, 213, 215, 216, 217, 218,
+  219, 220, 221, 222, 224, 225, 226, 227,
+  228, 229, 230, 232, 233, 234, 235, 236,
+  237, 238, 240, 241, 242, 243, 244, 245,
+  246, 248, 249, 250, 251, 252, 253, 254,
+  255, 255, 255, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+// ---------------- Private Initializer Prototypes
+
+// ---------------- Private Function Prototypes
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_huffman_groups(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_n_huffman_groups);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_huffman_tree(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_hg,
+    uint32_t a_ht);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_code_lengths(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_hg,
+    uint32_t a_ht,
+    uint32_t a_alphabet_size);
+
+static wuffs_base__status
+wuffs_webp__decoder__build_huffman_table(
+    wuffs_webp__decoder* self,
+    uint32_t a_hg,
+    uint32_t a_ht,
+    uint32_t a_n_symbols);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_pixels(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_dst,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_width,
+    uint32_t a_height,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_tile_size_log2);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_pixels_fast(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_dst,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_width,
+    uint32_t a_height,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_tile_size_log2);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_pixels_slow(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_dst,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_width,
+    uint32_t a_height,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_tile_size_log2);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_predictor(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_width,
+    uint32_t a_tile_size_log2);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment_no_left(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment_no_left__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_left,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode);
+
+static uint32_t
+wuffs_webp__decoder__predict(
+    const wuffs_webp__decoder* self,
+    uint32_t a_mode,
+    uint32_t a_l,
+    uint32_t a_t,
+    uint32_t a_tl,
+    uint32_t a_tr);
+
+static uint32_t
+wuffs_webp__decoder__add_pixels(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b);
+
+static uint32_t
+wuffs_webp__decoder__average2(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b);
+
+static uint32_t
+wuffs_webp__decoder__select(
+    const wuffs_webp__decoder* self,
+    uint32_t a_l,
+    uint32_t a_t,
+    uint32_t a_tl);
+
+static uint32_t
+wuffs_webp__decoder__clamp_add_subtract_full(
+    const wuffs_webp__decoder* self,
+    uint32_t a_l,
+    uint32_t a_t,
+    uint32_t a_tl);
+
+static uint32_t
+wuffs_webp__decoder__clamp_add_subtract_half(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_tl);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_cross_color(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_width,
+    uint32_t a_tile_size_log2);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__cross_color_segment(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_t);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__cross_color_segment__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_t);
+
+static uint32_t
+wuffs_webp__decoder__cross_color_pixel(
+    const wuffs_webp__decoder* self,
+    uint32_t a_c,
+    uint32_t a_t);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_subtract_green(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_subtract_green__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_color_indexing(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_width,
+    uint32_t a_tile_size_log2);
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment_no_left_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_webp__decoder__cross_color_segment_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_t);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_subtract_green_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_image_config_vp8(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_chunk_length);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_vp8(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_vp8_macroblocks(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_webp__decoder__vp8_parse_header(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data);
+
+static uint32_t
+wuffs_webp__decoder__vp8_clamp(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_max);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_init_bool_decoder(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_p,
+    uint64_t a_start,
+    uint64_t a_end);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_load_bool_decoder(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_p);
+
+static uint32_t
+wuffs_webp__decoder__vp8_read_bool(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_prob);
+
+static uint32_t
+wuffs_webp__decoder__vp8_read_literal(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_n);
+
+static uint32_t
+wuffs_webp__decoder__vp8_read_signed(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_n);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_parse_modes(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_mb_x);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_parse_residuals(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_p,
+    uint32_t a_mb_x);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_inverse_wht(
+    wuffs_webp__decoder* self,
+    uint32_t a_n);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_idct_add(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_b);
+
+static uint32_t
+wuffs_webp__decoder__vp8_mul1(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a);
+
+static uint32_t
+wuffs_webp__decoder__vp8_mul2(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_cols(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_rows,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_cols__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_rows,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_rows(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_cols,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_rows__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_cols,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+
+static uint64_t
+wuffs_webp__decoder__vp8_filter_pixels(
+    const wuffs_webp__decoder* self,
+    uint64_t a_x,
+    uint32_t a_kind,
+    uint32_t a_thresh2,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+
+static uint32_t
+wuffs_webp__decoder__vp8_abs_diff(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b);
+
+static uint32_t
+wuffs_webp__decoder__vp8_clamp_biased(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_min,
+    uint32_t a_max);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_reconstruct_macroblock(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_load_edges(
+    wuffs_webp__decoder* self,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_predict_4x4(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_mode);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_predict_16x16(
+    wuffs_webp__decoder* self,
+    uint32_t a_mode,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_predict_8x8(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_mode,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y);
+
+static uint8_t
+wuffs_webp__decoder__vp8_avg2(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b);
+
+static uint8_t
+wuffs_webp__decoder__vp8_avg3(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b,
+    uint32_t a_c);
+
+static uint8_t
+wuffs_webp__decoder__vp8_true_motion(
+    const wuffs_webp__decoder* self,
+    uint32_t a_t,
+    uint32_t a_l,
+    uint32_t a_tl);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_add_residual(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_b);
+
+static uint8_t
+wuffs_webp__decoder__vp8_clamp_add(
+    const wuffs_webp__decoder* self,
+    uint8_t a_a,
+    uint32_t a_b);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_store_macroblock(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y);
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_macroblock_row(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf,
+    uint32_t a_mb_y);
+
+static wuffs_base__status
+wuffs_webp__decoder__swizzle_vp8(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__slice_u8 a_workbuf);
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_cols_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_rows,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_rows_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_cols,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev);
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_image_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_frame_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_frame(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_transform(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_color_cache_parameters(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_huffman_image(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_sub_image(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf,
+    uint64_t a_offset,
+    uint32_t a_width,
+    uint32_t a_height);
+
+static wuffs_base__status
+wuffs_webp__decoder__apply_transforms(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf);
+
+static wuffs_base__status
+wuffs_webp__decoder__swizzle(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__slice_u8 a_src);
+
+static wuffs_base__status
+wuffs_webp__decoder__do_tell_me_more(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_dst,
+    wuffs_base__more_information* a_minfo,
+    wuffs_base__io_buffer* a_src);
+
+// ---------------- VTables
+
+const wuffs_base__image_decoder__func_ptrs
+wuffs_webp__decoder__func_ptrs_for__wuffs_base__image_decoder = {
+  (wuffs_base__status(*)(void*,
+      wuffs_base__pixel_buffer*,
+      wuffs_base__io_buffer*,
+      wuffs_base__pixel_blend,
+      wuffs_base__slice_u8,
+      wuffs_base__decode_frame_options*))(&wuffs_webp__decoder__decode_frame),
+  (wuffs_base__status(*)(void*,
+      wuffs_base__frame_config*,
+      wuffs_base__io_buffer*))(&wuffs_webp__decoder__decode_frame_config),
+  (wuffs_base__status(*)(void*,
+      wuffs_base__image_config*,
+      wuffs_base__io_buffer*))(&wuffs_webp__decoder__decode_image_config),
+  (wuffs_base__rect_ie_u32(*)(const void*))(&wuffs_webp__decoder__frame_dirty_rect),
+  (uint32_t(*)(const void*))(&wuffs_webp__decoder__num_animation_loops),
+  (uint64_t(*)(const void*))(&wuffs_webp__decoder__num_decoded_frame_configs),
+  (uint64_t(*)(const void*))(&wuffs_webp__decoder__num_decoded_frames),
+  (wuffs_base__status(*)(void*,
+      uint64_t,
+      uint64_t))(&wuffs_webp__decoder__restart_frame),
+  (wuffs_base__status(*)(void*,
+      uint32_t,
+      uint64_t))(&wuffs_webp__decoder__set_quirk),
+  (wuffs_base__empty_struct(*)(void*,
+      uint32_t,
+      bool))(&wuffs_webp__decoder__set_report_metadata),
+  (wuffs_base__status(*)(void*,
+      wuffs_base__io_buffer*,
+      wuffs_base__more_information*,
+      wuffs_base__io_buffer*))(&wuffs_webp__decoder__tell_me_more),
+  (wuffs_base__range_ii_u64(*)(const void*))(&wuffs_webp__decoder__workbuf_len),
+};
+
+// ---------------- Initializer Implementations
+
+wuffs_base__status WUFFS_BASE__WARN_UNUSED_RESULT
+wuffs_webp__decoder__initialize(
+    wuffs_webp__decoder* self,
+    size_t sizeof_star_self,
+    uint64_t wuffs_version,
+    uint32_t options){
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (sizeof(*self) != sizeof_star_self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_sizeof_receiver);
+  }
+  if (((wuffs_version >> 32) != WUFFS_VERSION_MAJOR) ||
+      (((wuffs_version >> 16) & 0xFFFF) > WUFFS_VERSION_MINOR)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_wuffs_version);
+  }
+
+  if ((options & WUFFS_INITIALIZE__ALREADY_ZEROED) != 0) {
+    // The whole point of this if-check is to detect an uninitialized *self.
+    // We disable the warning on GCC. Clang-5.0 does not have this warning.
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    if (self->private_impl.magic != 0) {
+      return wuffs_base__make_status(wuffs_base__error__initialize_falsely_claimed_already_zeroed);
+    }
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+  } else {
+    if ((options & WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED) == 0) {
+      memset(self, 0, sizeof(*self));
+      options |= WUFFS_INITIALIZE__ALREADY_ZEROED;
+    } else {
+      memset(&(self->private_impl), 0, sizeof(self->private_impl));
+    }
+  }
+
+  self->private_impl.choosy_predict_segment_no_left = &wuffs_webp__decoder__predict_segment_no_left__choosy_default;
+  self->private_impl.choosy_cross_color_segment = &wuffs_webp__decoder__cross_color_segment__choosy_default;
+  self->private_impl.choosy_apply_transform_subtract_green = &wuffs_webp__decoder__apply_transform_subtract_green__choosy_default;
+  self->private_impl.choosy_vp8_filter_across_cols = &wuffs_webp__decoder__vp8_filter_across_cols__choosy_default;
+  self->private_impl.choosy_vp8_filter_across_rows = &wuffs_webp__decoder__vp8_filter_across_rows__choosy_default;
+
+  self->private_impl.magic = WUFFS_BASE__MAGIC;
+  self->private_impl.vtable_for__wuffs_base__image_decoder.vtable_name =
+      wuffs_base__image_decoder__vtable_name;
+  self->private_impl.vtable_for__wuffs_base__image_decoder.function_pointers =
+      (const void*)(&wuffs_webp__decoder__func_ptrs_for__wuffs_base__image_decoder);
+  return wuffs_base__make_status(NULL);
+}
+
+wuffs_webp__decoder*
+wuffs_webp__decoder__alloc() {
+  wuffs_webp__decoder* x =
+      (wuffs_webp__decoder*)(calloc(sizeof(wuffs_webp__decoder), 1));
+  if (!x) {
+    return NULL;
+  }
+  if (wuffs_webp__decoder__initialize(
+      x, sizeof(wuffs_webp__decoder), WUFFS_VERSION, WUFFS_INITIALIZE__ALREADY_ZEROED).repr) {
+    free(x);
+    return NULL;
+  }
+  return x;
+}
+
+size_t
+sizeof__wuffs_webp__decoder() {
+  return sizeof(wuffs_webp__decoder);
+}
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+static const char* const wuffs_webp__decoder__stats_func_names[60] = {
+  "webp.decoder.decode_huffman_groups",
+  "webp.decoder.decode_huffman_tree",
+  "webp.decoder.decode_code_lengths",
+  "webp.decoder.build_huffman_table",
+  "webp.decoder.decode_pixels",
+  "webp.decoder.decode_pixels_fast",
+  "webp.decoder.decode_pixels_slow",
+  "webp.decoder.apply_transform_predictor",
+  "webp.decoder.predict_segment_no_left",
+  "webp.decoder.predict_segment",
+  "webp.decoder.apply_transform_cross_color",
+  "webp.decoder.cross_color_segment",
+  "webp.decoder.apply_transform_subtract_green",
+  "webp.decoder.apply_transform_color_indexing",
+  "webp.decoder.predict_segment_no_left_x86_sse42",
+  "webp.decoder.cross_color_segment_x86_sse42",
+  "webp.decoder.apply_transform_subtract_green_x86_sse42",
+  "webp.decoder.do_decode_image_config_vp8",
+  "webp.decoder.decode_vp8",
+  "webp.decoder.decode_vp8_macroblocks",
+  "webp.decoder.vp8_parse_header",
+  "webp.decoder.vp8_init_bool_decoder",
+  "webp.decoder.vp8_load_bool_decoder",
+  "webp.decoder.vp8_read_bool",
+  "webp.decoder.vp8_read_literal",
+  "webp.decoder.vp8_read_signed",
+  "webp.decoder.vp8_parse_modes",
+  "webp.decoder.vp8_parse_residuals",
+  "webp.decoder.vp8_inverse_wht",
+  "webp.decoder.vp8_idct_add",
+  "webp.decoder.vp8_filter_across_cols",
+  "webp.decoder.vp8_filter_across_rows",
+  "webp.decoder.vp8_reconstruct_macroblock",
+  "webp.decoder.vp8_load_edges",
+  "webp.decoder.vp8_predict_4x4",
+  "webp.decoder.vp8_predict_16x16",
+  "webp.decoder.vp8_predict_8x8",
+  "webp.decoder.vp8_add_residual",
+  "webp.decoder.vp8_store_macroblock",
+  "webp.decoder.vp8_filter_macroblock_row",
+  "webp.decoder.swizzle_vp8",
+  "webp.decoder.vp8_filter_across_cols_x86_sse42",
+  "webp.decoder.vp8_filter_across_rows_x86_sse42",
+  "webp.decoder.set_quirk",
+  "webp.decoder.decode_image_config",
+  "webp.decoder.do_decode_image_config",
+  "webp.decoder.decode_frame_config",
+  "webp.decoder.do_decode_frame_config",
+  "webp.decoder.decode_frame",
+  "webp.decoder.do_decode_frame",
+  "webp.decoder.decode_transform",
+  "webp.decoder.decode_color_cache_parameters",
+  "webp.decoder.decode_huffman_image",
+  "webp.decoder.decode_sub_image",
+  "webp.decoder.apply_transforms",
+  "webp.decoder.swizzle",
+  "webp.decoder.restart_frame",
+  "webp.decoder.set_report_metadata",
+  "webp.decoder.tell_me_more",
+  "webp.decoder.do_tell_me_more",
+};
+
+size_t
+wuffs_webp__decoder__stats(
+    const wuffs_webp__decoder* self,
+    wuffs_base__stats* dst_ptr,
+    size_t dst_len) {
+  if (!self) {
+    return 0;
+  }
+  size_t n = 1;
+  if (dst_len > 0) {
+    dst_ptr->struct_name = "webp.decoder";
+    dst_ptr->num_src_bytes = self->private_impl.stats_num_src_bytes;
+    dst_ptr->num_dst_bytes = self->private_impl.stats_num_dst_bytes;
+    dst_ptr->num_funcs = 60;
+    dst_ptr->func_names = wuffs_webp__decoder__stats_func_names;
+    dst_ptr->func_counters = self->private_impl.stats_funcs;
+  }
+  return n;
+}
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+// ---------------- Function Implementations
+
+// -------- func webp.decoder.decode_huffman_groups
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_huffman_groups(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_n_huffman_groups) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_hg = 0;
+  uint32_t v_ht = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[0].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_huffman_groups[0];
+  if (coro_susp_point) {
+    v_hg = self->private_data.s_decode_huffman_groups[0].v_hg;
+    v_ht = self->private_data.s_decode_huffman_groups[0].v_ht;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_hg = 0;
+    while (v_hg < a_n_huffman_groups) {
+      v_ht = 0;
+      while (v_ht < 5) {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        status = wuffs_webp__decoder__decode_huffman_tree(self, a_src, v_hg, v_ht);
+        if (status.repr) {
+          goto suspend;
+        }
+        v_ht += 1;
+      }
+      v_hg += 1;
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_hg = 0;
+    while (v_hg < a_n_huffman_groups) {
+      v_ht = 0;
+      while (v_ht < 5) {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        status = wuffs_webp__decoder__decode_huffman_tree(self, a_src, v_hg, v_ht);
+        if (status.repr) {
+          goto suspend;
+        }
+        v_ht += 1;
+      }
+      v_hg += 1;
+    }
+
+    goto ok;
+    ok:
+    self->private_impl.p_decode_huffman_groups[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_huffman_groups[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_huffman_groups[0].v_hg = v_hg;
+  self->private_data.s_decode_huffman_groups[0].v_ht = v_ht;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[0].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[0].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_huffman_tree
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_huffman_tree(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_hg,
+    uint32_t a_ht) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_alphabet_size = 0;
+  uint32_t v_use_simple = 0;
+  uint32_t v_n_symbols = 0;
+  uint32_t v_n = 0;
+  uint32_t v_symbol = 0;
+  uint32_t v_i = 0;
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[1].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_huffman_tree[0];
+  if (coro_susp_point) {
+    v_bits = self->private_data.s_decode_huffman_tree[0].v_bits;
+    v_n_bits = self->private_data.s_decode_huffman_tree[0].v_n_bits;
+    v_alphabet_size = self->private_data.s_decode_huffman_tree[0].v_alphabet_size;
+    v_n_symbols = self->private_data.s_decode_huffman_tree[0].v_n_symbols;
+    v_n = self->private_data.s_decode_huffman_tree[0].v_n;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (a_ht >= 4) {
+      v_alphabet_size = 40;
+    } else if (a_ht > 0) {
+      v_alphabet_size = 256;
+    } else if (self->private_impl.f_color_cache_bits == 0) {
+      v_alphabet_size = 280;
+    } else {
+      v_alphabet_size = (280 + (((uint32_t)(1)) << self->private_impl.f_color_cache_bits));
+    }
+    v_i = 0;
+    while (v_i < v_alphabet_size) {
+      self->private_data.f_code_lengths[v_i] = 0;
+      v_i += 1;
+    }
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_use_simple = (v_bits & 1);
+    v_bits >>= 1;
+    v_n_bits -= 1;
+    if (v_use_simple != 0) {
+      while (v_n_bits < 2) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_1 = *iop_a_src++;
+          v_c8 = t_1;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_n_symbols = ((v_bits & 1) + 1);
+      v_n = 1;
+      if ((v_bits & 2) != 0) {
+        v_n = 8;
+      }
+      v_bits >>= 2;
+      v_n_bits -= 2;
+      while (v_n_bits < v_n) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_2 = *iop_a_src++;
+          v_c8 = t_2;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_symbol = (v_bits & ((((uint32_t)(1)) << v_n) - 1));
+      v_bits >>= v_n;
+      v_n_bits -= v_n;
+      if (v_symbol < v_alphabet_size) {
+        self->private_data.f_code_lengths[v_symbol] = 1;
+      }
+      if (v_n_symbols > 1) {
+        while (v_n_bits < 8) {
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint8_t t_3 = *iop_a_src++;
+            v_c8 = t_3;
+          }
+          v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+          v_n_bits += 8;
+        }
+        v_symbol = (v_bits & 255);
+        v_bits >>= 8;
+        v_n_bits -= 8;
+        if (v_symbol < v_alphabet_size) {
+          self->private_data.f_code_lengths[v_symbol] = 1;
+        }
+      }
+      self->private_impl.f_bits = v_bits;
+      self->private_impl.f_n_bits = v_n_bits;
+    } else {
+      self->private_impl.f_bits = v_bits;
+      self->private_impl.f_n_bits = v_n_bits;
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+      status = wuffs_webp__decoder__decode_code_lengths(self,
+          a_src,
+          a_hg,
+          a_ht,
+          v_alphabet_size);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    }
+    v_status = wuffs_webp__decoder__build_huffman_table(self, a_hg, a_ht, v_alphabet_size);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (a_ht >= 4) {
+      v_alphabet_size = 40;
+    } else if (a_ht > 0) {
+      v_alphabet_size = 256;
+    } else if (self->private_impl.f_color_cache_bits == 0) {
+      v_alphabet_size = 280;
+    } else {
+      v_alphabet_size = (280 + (((uint32_t)(1)) << self->private_impl.f_color_cache_bits));
+    }
+    v_i = 0;
+    while (v_i < v_alphabet_size) {
+      self->private_data.f_code_lengths[v_i] = 0;
+      v_i += 1;
+    }
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_use_simple = (v_bits & 1);
+    v_bits >>= 1;
+    v_n_bits -= 1;
+    if (v_use_simple != 0) {
+      while (v_n_bits < 2) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_1 = *iop_a_src++;
+          v_c8 = t_1;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_n_symbols = ((v_bits & 1) + 1);
+      v_n = 1;
+      if ((v_bits & 2) != 0) {
+        v_n = 8;
+      }
+      v_bits >>= 2;
+      v_n_bits -= 2;
+      while (v_n_bits < v_n) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_2 = *iop_a_src++;
+          v_c8 = t_2;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_symbol = (v_bits & ((((uint32_t)(1)) << v_n) - 1));
+      v_bits >>= v_n;
+      v_n_bits -= v_n;
+      if (v_symbol < v_alphabet_size) {
+        self->private_data.f_code_lengths[v_symbol] = 1;
+      }
+      if (v_n_symbols > 1) {
+        while (v_n_bits < 8) {
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint8_t t_3 = *iop_a_src++;
+            v_c8 = t_3;
+          }
+          v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+          v_n_bits += 8;
+        }
+        v_symbol = (v_bits & 255);
+        v_bits >>= 8;
+        v_n_bits -= 8;
+        if (v_symbol < v_alphabet_size) {
+          self->private_data.f_code_lengths[v_symbol] = 1;
+        }
+      }
+      self->private_impl.f_bits = v_bits;
+      self->private_impl.f_n_bits = v_n_bits;
+    } else {
+      self->private_impl.f_bits = v_bits;
+      self->private_impl.f_n_bits = v_n_bits;
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+      status = wuffs_webp__decoder__decode_code_lengths(self,
+          a_src,
+          a_hg,
+          a_ht,
+          v_alphabet_size);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    }
+    v_status = wuffs_webp__decoder__build_huffman_table(self, a_hg, a_ht, v_alphabet_size);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+
+    ok:
+    self->private_impl.p_decode_huffman_tree[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_huffman_tree[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_huffman_tree[0].v_bits = v_bits;
+  self->private_data.s_decode_huffman_tree[0].v_n_bits = v_n_bits;
+  self->private_data.s_decode_huffman_tree[0].v_alphabet_size = v_alphabet_size;
+  self->private_data.s_decode_huffman_tree[0].v_n_symbols = v_n_symbols;
+  self->private_data.s_decode_huffman_tree[0].v_n = v_n;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[1].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[1].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_code_lengths
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_code_lengths(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_hg,
+    uint32_t a_ht,
+    uint32_t a_alphabet_size) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_n_codes = 0;
+  uint32_t v_i = 0;
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  uint32_t v_table_base = 0;
+  uint32_t v_max_symbol = 0;
+  uint32_t v_n = 0;
+  uint32_t v_symbol = 0;
+  uint8_t v_prev_code_length = 0;
+  uint32_t v_table_entry = 0;
+  uint32_t v_table_entry_n_bits = 0;
+  uint32_t v_code_length = 0;
+  uint32_t v_repeat_index = 0;
+  uint8_t v_repeat_value = 0;
+  uint32_t v_repeat_count = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[2].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_code_lengths[0];
+  if (coro_susp_point) {
+    v_bits = self->private_data.s_decode_code_lengths[0].v_bits;
+    v_n_bits = self->private_data.s_decode_code_lengths[0].v_n_bits;
+    v_n_codes = self->private_data.s_decode_code_lengths[0].v_n_codes;
+    v_i = self->private_data.s_decode_code_lengths[0].v_i;
+    v_table_base = self->private_data.s_decode_code_lengths[0].v_table_base;
+    v_max_symbol = self->private_data.s_decode_code_lengths[0].v_max_symbol;
+    v_n = self->private_data.s_decode_code_lengths[0].v_n;
+    v_symbol = self->private_data.s_decode_code_lengths[0].v_symbol;
+    v_prev_code_length = self->private_data.s_decode_code_lengths[0].v_prev_code_length;
+    v_code_length = self->private_data.s_decode_code_lengths[0].v_code_length;
+    v_repeat_index = self->private_data.s_decode_code_lengths[0].v_repeat_index;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 4) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_n_codes = ((v_bits & 15) + 4);
+    v_bits >>= 4;
+    v_n_bits -= 4;
+    v_i = 0;
+    while (v_i < v_n_codes) {
+      while (v_n_bits < 3) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_1 = *iop_a_src++;
+          v_c8 = t_1;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      self->private_data.f_code_lengths[WUFFS_WEBP__CODE_LENGTH_CODE_ORDER[v_i]] = ((uint8_t)((v_bits & 7)));
+      v_bits >>= 3;
+      v_n_bits -= 3;
+      v_i += 1;
+    }
+    while (v_i < 19) {
+      self->private_data.f_code_lengths[WUFFS_WEBP__CODE_LENGTH_CODE_ORDER[v_i]] = 0;
+      v_i += 1;
+    }
+    v_status = wuffs_webp__decoder__build_huffman_table(self, a_hg, a_ht, 19);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_2 = *iop_a_src++;
+        v_c8 = t_2;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_max_symbol = a_alphabet_size;
+    if ((v_bits & 1) != 0) {
+      v_bits >>= 1;
+      v_n_bits -= 1;
+      while (v_n_bits < 3) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_3 = *iop_a_src++;
+          v_c8 = t_3;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_n = (((v_bits & 7) * 2) + 2);
+      v_bits >>= 3;
+      v_n_bits -= 3;
+      while (v_n_bits < v_n) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_4 = *iop_a_src++;
+          v_c8 = t_4;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_max_symbol = ((v_bits & ((((uint32_t)(1)) << v_n) - 1)) + 2);
+      v_bits >>= v_n;
+      v_n_bits -= v_n;
+      if (v_max_symbol > a_alphabet_size) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      }
+    } else {
+      v_bits >>= 1;
+      v_n_bits -= 1;
+    }
+    v_i = 0;
+    while (v_i < 19) {
+      self->private_data.f_code_lengths[v_i] = 0;
+      v_i += 1;
+    }
+    v_table_base = ((uint32_t)(WUFFS_WEBP__HUFFMAN_TABLE_BASE_OFFSETS[a_ht]));
+    v_prev_code_length = 8;
+    v_symbol = 0;
+    label__fast__0__continue:;
+    while (v_symbol < a_alphabet_size) {
+      if (v_max_symbol == 0) {
+        goto label__fast__0__break;
+      }
+      v_max_symbol -= 1;
+      while (true) {
+        v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[a_hg][(v_table_base + (v_bits & 255))]));
+        v_table_entry_n_bits = (v_table_entry >> 12);
+        if (v_n_bits >= v_table_entry_n_bits) {
+          v_bits >>= v_table_entry_n_bits;
+          v_n_bits -= v_table_entry_n_bits;
+          goto label__fast__1__break;
+        }
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_5 = *iop_a_src++;
+          v_c8 = t_5;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      label__fast__1__break:;
+      v_code_length = (v_table_entry & 4095);
+      if (v_code_length < 16) {
+        if (v_symbol >= a_alphabet_size) {
+          goto label__fast__0__break;
+        }
+        self->private_data.f_code_lengths[v_symbol] = ((uint8_t)(v_code_length));
+        v_symbol += 1;
+        if (v_code_length != 0) {
+          v_prev_code_length = ((uint8_t)(v_code_length));
+        }
+        goto label__fast__0__continue;
+      } else if (v_code_length > 18) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      }
+      v_repeat_index = ((v_code_length - 16) & 3);
+      v_n = ((uint32_t)(WUFFS_WEBP__REPEAT_N_BITS[v_repeat_index]));
+      while (v_n_bits < v_n) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(7);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_6 = *iop_a_src++;
+          v_c8 = t_6;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_repeat_count = (((uint32_t)(WUFFS_WEBP__REPEAT_OFFSETS[v_repeat_index])) + (v_bits & ((((uint32_t)(1)) << v_n) - 1)));
+      v_bits >>= v_n;
+      v_n_bits -= v_n;
+      v_repeat_value = 0;
+      if (v_code_length == 16) {
+        v_repeat_value = v_prev_code_length;
+      }
+      if (a_alphabet_size < v_symbol) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      } else if (v_repeat_count > (a_alphabet_size - v_symbol)) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      }
+      while (v_repeat_count > 0) {
+        v_repeat_count -= 1;
+        if (v_symbol < a_alphabet_size) {
+          self->private_data.f_code_lengths[v_symbol] = v_repeat_value;
+          v_symbol += 1;
+        }
+      }
+    }
+    label__fast__0__break:;
+    self->private_impl.f_bits = v_bits;
+    self->private_impl.f_n_bits = v_n_bits;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 4) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_n_codes = ((v_bits & 15) + 4);
+    v_bits >>= 4;
+    v_n_bits -= 4;
+    v_i = 0;
+    while (v_i < v_n_codes) {
+      while (v_n_bits < 3) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_1 = *iop_a_src++;
+          v_c8 = t_1;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      self->private_data.f_code_lengths[WUFFS_WEBP__CODE_LENGTH_CODE_ORDER[v_i]] = ((uint8_t)((v_bits & 7)));
+      v_bits >>= 3;
+      v_n_bits -= 3;
+      v_i += 1;
+    }
+    while (v_i < 19) {
+      self->private_data.f_code_lengths[WUFFS_WEBP__CODE_LENGTH_CODE_ORDER[v_i]] = 0;
+      v_i += 1;
+    }
+    v_status = wuffs_webp__decoder__build_huffman_table(self, a_hg, a_ht, 19);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_2 = *iop_a_src++;
+        v_c8 = t_2;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_max_symbol = a_alphabet_size;
+    if ((v_bits & 1) != 0) {
+      v_bits >>= 1;
+      v_n_bits -= 1;
+      while (v_n_bits < 3) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_3 = *iop_a_src++;
+          v_c8 = t_3;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_n = (((v_bits & 7) * 2) + 2);
+      v_bits >>= 3;
+      v_n_bits -= 3;
+      while (v_n_bits < v_n) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_4 = *iop_a_src++;
+          v_c8 = t_4;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_max_symbol = ((v_bits & ((((uint32_t)(1)) << v_n) - 1)) + 2);
+      v_bits >>= v_n;
+      v_n_bits -= v_n;
+      if (v_max_symbol > a_alphabet_size) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      }
+    } else {
+      v_bits >>= 1;
+      v_n_bits -= 1;
+    }
+    v_i = 0;
+    while (v_i < 19) {
+      self->private_data.f_code_lengths[v_i] = 0;
+      v_i += 1;
+    }
+    v_table_base = ((uint32_t)(WUFFS_WEBP__HUFFMAN_TABLE_BASE_OFFSETS[a_ht]));
+    v_prev_code_length = 8;
+    v_symbol = 0;
+    label__0__continue:;
+    while (v_symbol < a_alphabet_size) {
+      if (v_max_symbol == 0) {
+        goto label__0__break;
+      }
+      v_max_symbol -= 1;
+      while (true) {
+        v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[a_hg][(v_table_base + (v_bits & 255))]));
+        v_table_entry_n_bits = (v_table_entry >> 12);
+        if (v_n_bits >= v_table_entry_n_bits) {
+          v_bits >>= v_table_entry_n_bits;
+          v_n_bits -= v_table_entry_n_bits;
+          goto label__1__break;
+        }
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_5 = *iop_a_src++;
+          v_c8 = t_5;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      label__1__break:;
+      v_code_length = (v_table_entry & 4095);
+      if (v_code_length < 16) {
+        if (v_symbol >= a_alphabet_size) {
+          goto label__0__break;
+        }
+        self->private_data.f_code_lengths[v_symbol] = ((uint8_t)(v_code_length));
+        v_symbol += 1;
+        if (v_code_length != 0) {
+          v_prev_code_length = ((uint8_t)(v_code_length));
+        }
+        goto label__0__continue;
+      } else if (v_code_length > 18) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      }
+      v_repeat_index = ((v_code_length - 16) & 3);
+      v_n = ((uint32_t)(WUFFS_WEBP__REPEAT_N_BITS[v_repeat_index]));
+      while (v_n_bits < v_n) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_6 = *iop_a_src++;
+          v_c8 = t_6;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_repeat_count = (((uint32_t)(WUFFS_WEBP__REPEAT_OFFSETS[v_repeat_index])) + (v_bits & ((((uint32_t)(1)) << v_n) - 1)));
+      v_bits >>= v_n;
+      v_n_bits -= v_n;
+      v_repeat_value = 0;
+      if (v_code_length == 16) {
+        v_repeat_value = v_prev_code_length;
+      }
+      if (a_alphabet_size < v_symbol) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      } else if (v_repeat_count > (a_alphabet_size - v_symbol)) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      }
+      while (v_repeat_count > 0) {
+        v_repeat_count -= 1;
+        if (v_symbol < a_alphabet_size) {
+          self->private_data.f_code_lengths[v_symbol] = v_repeat_value;
+          v_symbol += 1;
+        }
+      }
+    }
+    label__0__break:;
+    self->private_impl.f_bits = v_bits;
+    self->private_impl.f_n_bits = v_n_bits;
+
+    ok:
+    self->private_impl.p_decode_code_lengths[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_code_lengths[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_code_lengths[0].v_bits = v_bits;
+  self->private_data.s_decode_code_lengths[0].v_n_bits = v_n_bits;
+  self->private_data.s_decode_code_lengths[0].v_n_codes = v_n_codes;
+  self->private_data.s_decode_code_lengths[0].v_i = v_i;
+  self->private_data.s_decode_code_lengths[0].v_table_base = v_table_base;
+  self->private_data.s_decode_code_lengths[0].v_max_symbol = v_max_symbol;
+  self->private_data.s_decode_code_lengths[0].v_n = v_n;
+  self->private_data.s_decode_code_lengths[0].v_symbol = v_symbol;
+  self->private_data.s_decode_code_lengths[0].v_prev_code_length = v_prev_code_length;
+  self->private_data.s_decode_code_lengths[0].v_code_length = v_code_length;
+  self->private_data.s_decode_code_lengths[0].v_repeat_index = v_repeat_index;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[2].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[2].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.build_huffman_table
+
+static wuffs_base__status
+wuffs_webp__decoder__build_huffman_table(
+    wuffs_webp__decoder* self,
+    uint32_t a_hg,
+    uint32_t a_ht,
+    uint32_t a_n_symbols) {
+  uint32_t v_table_base = 0;
+  uint32_t v_table_end = 0;
+  uint32_t v_counts[16] = {0};
+  uint32_t v_offsets[16] = {0};
+  uint32_t v_i = 0;
+  uint32_t v_cl = 0;
+  uint32_t v_n_non_zero = 0;
+  uint32_t v_remaining = 0;
+  uint32_t v_symbol = 0;
+  uint32_t v_code = 0;
+  uint32_t v_reversed = 0;
+  uint32_t v_j = 0;
+  uint32_t v_step = 0;
+  uint32_t v_idx = 0;
+  uint32_t v_root = 0;
+  uint32_t v_sub_start = 0;
+  uint32_t v_sub_bits = 0;
+  uint32_t v_sub_end = 0;
+  uint32_t v_k = 0;
+  uint32_t v_left = 0;
+  uint32_t v_len = 0;
+  uint32_t v_n = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[3].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_table_base = ((uint32_t)(WUFFS_WEBP__HUFFMAN_TABLE_BASE_OFFSETS[a_ht]));
+  v_table_end = ((uint32_t)(WUFFS_WEBP__HUFFMAN_TABLE_END_OFFSETS[a_ht]));
+  v_i = 0;
+  while (v_i < a_n_symbols) {
+    v_cl = ((uint32_t)((self->private_data.f_code_lengths[v_i] & 15)));
+    if (v_counts[v_cl] < 2328) {
+      v_counts[v_cl] += 1;
+    }
+    v_i += 1;
+  }
+  if (a_n_symbols <= v_counts[0]) {
+    return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+  }
+  v_n_non_zero = (a_n_symbols - v_counts[0]);
+  v_remaining = 1;
+  v_cl = 1;
+  while (true) {
+    v_remaining = ((uint32_t)(v_remaining << 1));
+    if (v_remaining < v_counts[v_cl]) {
+      return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code_over_subscribed);
+    }
+    v_remaining -= v_counts[v_cl];
+    if (v_cl >= 15) {
+      goto label__0__break;
+    }
+    v_cl += 1;
+  }
+  label__0__break:;
+  if ((v_remaining != 0) && (v_n_non_zero != 1)) {
+    return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code_under_subscribed);
+  }
+  v_n = 0;
+  v_cl = 1;
+  while (true) {
+    v_offsets[v_cl] = wuffs_base__u32__min(v_n, 2328);
+    v_n += v_counts[v_cl];
+    if (v_cl >= 15) {
+      goto label__1__break;
+    }
+    v_cl += 1;
+  }
+  label__1__break:;
+  v_i = 0;
+  while (v_i < a_n_symbols) {
+    v_cl = ((uint32_t)((self->private_data.f_code_lengths[v_i] & 15)));
+    if (v_cl > 0) {
+      v_j = v_offsets[v_cl];
+      if (v_j < 2328) {
+        self->private_data.f_sorted_symbols[v_j] = ((uint16_t)(v_i));
+        v_offsets[v_cl] = (v_j + 1);
+      }
+    }
+    v_i += 1;
+  }
+  if (v_n_non_zero == 1) {
+    v_j = 0;
+    while (v_j < 256) {
+      self->private_data.f_huffman_tables[a_hg][(v_table_base + v_j)] = (self->private_data.f_sorted_symbols[0] & 4095);
+      v_j += 1;
+    }
+    return wuffs_base__make_status(NULL);
+  }
+  v_code = 0;
+  v_k = 0;
+  v_root = 256;
+  v_sub_start = 0;
+  v_sub_bits = 0;
+  v_sub_end = 256;
+  v_cl = 1;
+  while (true) {
+    v_n = v_counts[v_cl];
+    while (v_n > 0) {
+      if (v_k >= 2328) {
+        return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+      }
+      v_symbol = ((uint32_t)((self->private_data.f_sorted_symbols[v_k] & 4095)));
+      v_k += 1;
+      v_reversed = 0;
+      v_j = 0;
+      while (v_j < v_cl) {
+        v_reversed |= ((uint32_t)(((v_code >> v_j) & 1) << (((uint32_t)(((uint32_t)(v_cl - 1)) - v_j)) & 15)));
+        v_j += 1;
+      }
+      if (v_cl <= 8) {
+        v_step = (((uint32_t)(1)) << v_cl);
+        v_j = (v_reversed & 255);
+        while (v_j < 256) {
+          self->private_data.f_huffman_tables[a_hg][(v_table_base + v_j)] = ((uint16_t)(((v_cl << 12) | v_symbol)));
+          v_j += v_step;
+        }
+      } else {
+        if (v_root != (v_reversed & 255)) {
+          v_root = (v_reversed & 255);
+          v_len = v_cl;
+          v_left = (((uint32_t)(1)) << (v_cl - 8));
+          while (v_len < 15) {
+            if (v_left <= v_counts[v_len]) {
+              goto label__2__break;
+            }
+            v_left = ((uint32_t)((v_left - v_counts[v_len]) << 1));
+            v_len += 1;
+          }
+          label__2__break:;
+          v_sub_bits = (((uint32_t)(v_len - 8)) & 7);
+          if (v_sub_end > 4095) {
+            return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+          }
+          v_sub_start = v_sub_end;
+          v_sub_end = (v_sub_start + (((uint32_t)(1)) << v_sub_bits));
+          if ((v_sub_end > 4095) || ((v_table_base + v_sub_end) > v_table_end)) {
+            return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+          }
+          self->private_data.f_huffman_tables[a_hg][(v_table_base + v_root)] = ((uint16_t)((((8 + v_sub_bits) << 12) | v_sub_start)));
+        }
+        v_step = (((uint32_t)(1)) << (((uint32_t)(v_cl - 8)) & 7));
+        v_j = (v_reversed >> 8);
+        while (v_j < (((uint32_t)(1)) << v_sub_bits)) {
+          v_idx = (v_table_base + v_sub_start + v_j);
+          if (v_idx >= v_table_end) {
+            return wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+          }
+          self->private_data.f_huffman_tables[a_hg][v_idx] = ((uint16_t)(((v_cl << 12) | v_symbol)));
+          v_j += v_step;
+        }
+      }
+      v_code += 1;
+      v_n -= 1;
+      if (v_counts[v_cl] > 0) {
+        v_counts[v_cl] -= 1;
+      }
+    }
+    if (v_cl >= 15) {
+      goto label__3__break;
+    }
+    v_code = ((uint32_t)(v_code << 1));
+    v_cl += 1;
+  }
+  label__3__break:;
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func webp.decoder.decode_pixels
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_pixels(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_dst,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_width,
+    uint32_t a_height,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_tile_size_log2) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_i = 0;
+  uint32_t v_n = 0;
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[4].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_pixels[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_n = (((uint32_t)(1)) << self->private_impl.f_color_cache_bits);
+    v_i = 0;
+    while (v_i < v_n) {
+      self->private_data.f_color_cache[v_i] = 0;
+      v_i += 1;
+    }
+    self->private_impl.f_pixel_x = 0;
+    self->private_impl.f_pixel_y = 0;
+    while (true) {
+      v_status = wuffs_webp__decoder__decode_pixels_fast(self,
+          a_dst,
+          a_src,
+          a_width,
+          a_height,
+          a_tile_data,
+          a_tile_size_log2);
+      if ( ! wuffs_base__status__is_ok(&v_status)) {
+        status = v_status;
+        if (wuffs_base__status__is_error(&status)) {
+          goto exit;
+        } else if (wuffs_base__status__is_suspension(&status)) {
+          status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+          goto exit;
+        }
+        goto ok;
+      }
+      if (self->private_impl.f_pixel_y >= a_height) {
+        goto label__fast__0__break;
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      status = wuffs_webp__decoder__decode_pixels_slow(self,
+          a_dst,
+          a_src,
+          a_width,
+          a_height,
+          a_tile_data,
+          a_tile_size_log2);
+      if (status.repr) {
+        goto suspend;
+      }
+      if (self->private_impl.f_pixel_y >= a_height) {
+        goto label__fast__0__break;
+      }
+    }
+    label__fast__0__break:;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_n = (((uint32_t)(1)) << self->private_impl.f_color_cache_bits);
+    v_i = 0;
+    while (v_i < v_n) {
+      self->private_data.f_color_cache[v_i] = 0;
+      v_i += 1;
+    }
+    self->private_impl.f_pixel_x = 0;
+    self->private_impl.f_pixel_y = 0;
+    while (true) {
+      v_status = wuffs_webp__decoder__decode_pixels_fast(self,
+          a_dst,
+          a_src,
+          a_width,
+          a_height,
+          a_tile_data,
+          a_tile_size_log2);
+      if ( ! wuffs_base__status__is_ok(&v_status)) {
+        status = v_status;
+        if (wuffs_base__status__is_error(&status)) {
+          goto exit;
+        } else if (wuffs_base__status__is_suspension(&status)) {
+          status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+          goto exit;
+        }
+        goto ok;
+      }
+      if (self->private_impl.f_pixel_y >= a_height) {
+        goto label__0__break;
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      status = wuffs_webp__decoder__decode_pixels_slow(self,
+          a_dst,
+          a_src,
+          a_width,
+          a_height,
+          a_tile_data,
+          a_tile_size_log2);
+      if (status.repr) {
+        goto suspend;
+      }
+      if (self->private_impl.f_pixel_y >= a_height) {
+        goto label__0__break;
+      }
+    }
+    label__0__break:;
+
+    ok:
+    self->private_impl.p_decode_pixels[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_pixels[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[4].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[4].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_pixels_fast
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_pixels_fast(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_dst,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_width,
+    uint32_t a_height,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_tile_size_log2) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint64_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint64_t v_p = 0;
+  uint64_t v_p_max = 0;
+  uint32_t v_x = 0;
+  uint32_t v_y = 0;
+  uint64_t v_width_in_tiles = 0;
+  uint64_t v_i = 0;
+  uint32_t v_hg = 0;
+  uint32_t v_table_entry = 0;
+  uint32_t v_table_entry_n_bits = 0;
+  uint32_t v_sub_mask = 0;
+  uint32_t v_sub_index = 0;
+  uint32_t v_g = 0;
+  uint32_t v_r = 0;
+  uint32_t v_b = 0;
+  uint32_t v_a = 0;
+  uint32_t v_color = 0;
+  uint32_t v_prefix = 0;
+  uint32_t v_n_extra = 0;
+  uint32_t v_length = 0;
+  uint32_t v_dist = 0;
+  uint32_t v_dist_map = 0;
+  uint64_t v_q = 0;
+  uint64_t v_n = 0;
+  uint64_t v_m = 0;
+  uint64_t v_s = 0;
+  uint32_t v_cache_shift = 0;
+  wuffs_base__slice_u8 v_pix = {0};
+  wuffs_base__slice_u8 v_run = {0};
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[5].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (self->private_impl.f_n_bits > 32) {
+    status = wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_n_bits);
+    goto exit;
+  }
+  v_bits = ((uint64_t)(self->private_impl.f_bits));
+  v_n_bits = self->private_impl.f_n_bits;
+  v_x = self->private_impl.f_pixel_x;
+  v_y = self->private_impl.f_pixel_y;
+  v_p_max = (((uint64_t)(a_width)) * ((uint64_t)(a_height)) * 4);
+  if (v_p_max > ((uint64_t)(a_dst.len))) {
+    status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+    goto exit;
+  }
+  v_p = (((((uint64_t)(v_y)) * ((uint64_t)(a_width))) + ((uint64_t)(v_x))) * 4);
+  v_width_in_tiles = ((uint64_t)((((a_width + (((uint32_t)(1)) << a_tile_size_log2)) - 1) >> a_tile_size_log2)));
+  v_cache_shift = ((32 - self->private_impl.f_color_cache_bits) & 31);
+  label__loop__continue:;
+  while ((v_p < v_p_max) && (((uint64_t)(io2_a_src - iop_a_src)) >= 16)) {
+    if (a_tile_size_log2 > 0) {
+      v_i = (((((uint64_t)((v_y >> a_tile_size_log2))) * v_width_in_tiles) + ((uint64_t)((v_x >> a_tile_size_log2)))) * 4);
+      if (v_i < ((uint64_t)(a_tile_data.len))) {
+        if ((v_i + 1) < ((uint64_t)(a_tile_data.len))) {
+          v_hg = ((uint32_t)(a_tile_data.ptr[(v_i + 1)]));
+        }
+      }
+    }
+    v_bits |= ((uint64_t)(wuffs_base__peek_u64le__no_bounds_check(iop_a_src) << (v_n_bits & 63)));
+    iop_a_src += ((63 - (v_n_bits & 63)) >> 3);
+    v_n_bits |= 56;
+    v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(v_bits & 255)]));
+    if (v_table_entry >= 36864) {
+      v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+      v_sub_index = ((v_table_entry & 4095) + (((uint32_t)(((v_bits >> 8) & 127))) & v_sub_mask));
+      v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 2703)]));
+    }
+    v_table_entry_n_bits = (v_table_entry >> 12);
+    v_bits >>= v_table_entry_n_bits;
+    v_n_bits -= v_table_entry_n_bits;
+    v_g = (v_table_entry & 4095);
+    if (v_g < 256) {
+      v_bits |= ((uint64_t)(wuffs_base__peek_u64le__no_bounds_check(iop_a_src) << (v_n_bits & 63)));
+      iop_a_src += ((63 - (v_n_bits & 63)) >> 3);
+      v_n_bits |= 56;
+      v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(2704 + (v_bits & 255))]));
+      if (v_table_entry >= 36864) {
+        v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+        v_sub_index = (2704 + (v_table_entry & 4095) + (((uint32_t)(((v_bits >> 8) & 127))) & v_sub_mask));
+        v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 3333)]));
+      }
+      v_table_entry_n_bits = (v_table_entry >> 12);
+      v_bits >>= v_table_entry_n_bits;
+      v_n_bits -= v_table_entry_n_bits;
+      v_r = (v_table_entry & 4095);
+      v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(3334 + (v_bits & 255))]));
+      if (v_table_entry >= 36864) {
+        v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+        v_sub_index = (3334 + (v_table_entry & 4095) + (((uint32_t)(((v_bits >> 8) & 127))) & v_sub_mask));
+        v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 3963)]));
+      }
+      v_table_entry_n_bits = (v_table_entry >> 12);
+      v_bits >>= v_table_entry_n_bits;
+      v_n_bits -= v_table_entry_n_bits;
+      v_b = (v_table_entry & 4095);
+      v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(3964 + (v_bits & 255))]));
+      if (v_table_entry >= 36864) {
+        v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+        v_sub_index = (3964 + (v_table_entry & 4095) + (((uint32_t)(((v_bits >> 8) & 127))) & v_sub_mask));
+        v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 4593)]));
+      }
+      v_table_entry_n_bits = (v_table_entry >> 12);
+      v_bits >>= v_table_entry_n_bits;
+      v_n_bits -= v_table_entry_n_bits;
+      v_a = (v_table_entry & 4095);
+      v_color = (((v_a & 255) << 24) |
+          ((v_r & 255) << 16) |
+          ((v_g & 255) << 8) |
+          (v_b & 255));
+    } else if (v_g < 280) {
+      v_prefix = (v_g - 256);
+      if (v_prefix < 4) {
+        v_length = (v_prefix + 1);
+      } else {
+        v_n_extra = ((v_prefix - 2) >> 1);
+        v_length = (((((2 + (v_prefix & 1)) << v_n_extra) + ((uint32_t)(((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U64(v_n_extra))))) & 4095) + 1);
+        v_bits >>= v_n_extra;
+        v_n_bits -= v_n_extra;
+      }
+      v_bits |= ((uint64_t)(wuffs_base__peek_u64le__no_bounds_check(iop_a_src) << (v_n_bits & 63)));
+      iop_a_src += ((63 - (v_n_bits & 63)) >> 3);
+      v_n_bits |= 56;
+      v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(4594 + (v_bits & 255))]));
+      if (v_table_entry >= 36864) {
+        v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+        v_sub_index = (4594 + (v_table_entry & 4095) + (((uint32_t)(((v_bits >> 8) & 127))) & v_sub_mask));
+        v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 5003)]));
+      }
+      v_table_entry_n_bits = (v_table_entry >> 12);
+      v_bits >>= v_table_entry_n_bits;
+      v_n_bits -= v_table_entry_n_bits;
+      v_prefix = (v_table_entry & 4095);
+      if (v_prefix >= 40) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+        goto exit;
+      } else if (v_prefix < 4) {
+        v_dist = (v_prefix + 1);
+      } else {
+        v_n_extra = ((v_prefix - 2) >> 1);
+        v_dist = ((((2 + (v_prefix & 1)) << v_n_extra) + ((uint32_t)(((v_bits) & WUFFS_BASE__LOW_BITS_MASK__U64(v_n_extra))))) + 1);
+        v_bits >>= v_n_extra;
+        v_n_bits -= v_n_extra;
+      }
+      if (v_dist > 120) {
+        v_dist -= 120;
+      } else {
+        v_dist_map = ((uint32_t)(WUFFS_WEBP__DISTANCE_MAP[(((uint32_t)(v_dist - 1)) & 127)]));
+        v_dist = (((v_dist_map >> 4) * a_width) + 8);
+        if (v_dist > (v_dist_map & 15)) {
+          v_dist -= (v_dist_map & 15);
+        } else {
+          v_dist = 1;
+        }
+      }
+      v_q = (((uint64_t)(v_dist)) * 4);
+      v_n = (((uint64_t)(v_length)) * 4);
+      if ((v_p < v_q) || (v_n > (v_p_max - v_p))) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+        goto exit;
+      }
+      v_s = (v_p - v_q);
+      while (v_n > 0) {
+        if ((v_s > v_p) || (v_p > ((uint64_t)(a_dst.len)))) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+          goto exit;
+        }
+        v_m = wuffs_base__u64__min(v_n, (v_p - v_s));
+        v_n -= v_m;
+        v_pix = wuffs_base__slice_u8__subslice_i(a_dst, v_p);
+        if (v_m > ((uint64_t)(v_pix.len))) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+          goto exit;
+        }
+        v_pix = wuffs_base__slice_u8__subslice_j(v_pix, v_m);
+        wuffs_base__slice_u8__copy_from_slice(v_pix, wuffs_base__slice_u8__subslice_ij(a_dst, v_s, v_p));
+        if (self->private_impl.f_color_cache_bits > 0) {
+          v_run = v_pix;
+          while (((uint64_t)(v_run.len)) >= 4) {
+            v_color = wuffs_base__peek_u32le__no_bounds_check(v_run.ptr);
+            self->private_data.f_color_cache[((((uint32_t)(506832829 * v_color)) >> v_cache_shift) & 2047)] = v_color;
+            v_run = wuffs_base__slice_u8__subslice_i(v_run, 4);
+          }
+        }
+        v_p += v_m;
+      }
+      v_x += v_length;
+      while ((v_x >= a_width) && (a_width > 0)) {
+        v_x -= a_width;
+        v_y += 1;
+      }
+      goto label__loop__continue;
+    } else {
+      v_color = self->private_data.f_color_cache[((v_g - 280) & 2047)];
+    }
+    v_pix = wuffs_base__slice_u8__subslice_i(a_dst, v_p);
+    if (((uint64_t)(v_pix.len)) >= 4) {
+      wuffs_base__poke_u32le__no_bounds_check(v_pix.ptr, v_color);
+    }
+    if (self->private_impl.f_color_cache_bits > 0) {
+      self->private_data.f_color_cache[((((uint32_t)(506832829 * v_color)) >> v_cache_shift) & 2047)] = v_color;
+    }
+    v_p += 4;
+    v_x += 1;
+    if (v_x >= a_width) {
+      v_x = 0;
+      v_y += 1;
+    }
+  }
+  self->private_impl.f_pixel_x = v_x;
+  self->private_impl.f_pixel_y = v_y;
+  while (v_n_bits >= 8) {
+    v_n_bits -= 8;
+    if (iop_a_src > io1_a_src) {
+      iop_a_src--;
+    } else {
+      status = wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_i_o);
+      goto exit;
+    }
+  }
+  self->private_impl.f_bits = ((uint32_t)((v_bits & ((((uint64_t)(1)) << v_n_bits) - 1))));
+  self->private_impl.f_n_bits = v_n_bits;
+  status = wuffs_base__make_status(NULL);
+  goto ok;
+
+  ok:
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_pixels_slow
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_pixels_slow(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_dst,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_width,
+    uint32_t a_height,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_tile_size_log2) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint64_t v_p = 0;
+  uint64_t v_p_max = 0;
+  uint32_t v_x = 0;
+  uint32_t v_y = 0;
+  uint64_t v_width_in_tiles = 0;
+  uint64_t v_i = 0;
+  uint32_t v_hg = 0;
+  uint32_t v_ht = 0;
+  uint32_t v_table_base = 0;
+  uint32_t v_table_entry = 0;
+  uint32_t v_table_entry_n_bits = 0;
+  uint32_t v_sub_mask = 0;
+  uint32_t v_sub_index = 0;
+  uint32_t v_sub_entry = 0;
+  uint32_t v_symbol = 0;
+  uint32_t v_argb[4] = {0};
+  uint32_t v_color = 0;
+  uint32_t v_prefix = 0;
+  uint32_t v_n_extra = 0;
+  uint32_t v_length = 0;
+  uint32_t v_dist = 0;
+  uint32_t v_dist_map = 0;
+  uint64_t v_q = 0;
+  uint64_t v_n = 0;
+  uint64_t v_m = 0;
+  uint64_t v_s = 0;
+  uint32_t v_cache_shift = 0;
+  wuffs_base__slice_u8 v_pix = {0};
+  wuffs_base__slice_u8 v_run = {0};
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[6].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_pixels_slow[0];
+  if (coro_susp_point) {
+    v_bits = self->private_data.s_decode_pixels_slow[0].v_bits;
+    v_n_bits = self->private_data.s_decode_pixels_slow[0].v_n_bits;
+    v_p = self->private_data.s_decode_pixels_slow[0].v_p;
+    v_p_max = self->private_data.s_decode_pixels_slow[0].v_p_max;
+    v_x = self->private_data.s_decode_pixels_slow[0].v_x;
+    v_y = self->private_data.s_decode_pixels_slow[0].v_y;
+    v_width_in_tiles = self->private_data.s_decode_pixels_slow[0].v_width_in_tiles;
+    v_hg = self->private_data.s_decode_pixels_slow[0].v_hg;
+    v_ht = self->private_data.s_decode_pixels_slow[0].v_ht;
+    v_table_base = self->private_data.s_decode_pixels_slow[0].v_table_base;
+    memcpy(v_argb, self->private_data.s_decode_pixels_slow[0].v_argb, sizeof(v_argb));
+    v_color = self->private_data.s_decode_pixels_slow[0].v_color;
+    v_prefix = self->private_data.s_decode_pixels_slow[0].v_prefix;
+    v_n_extra = self->private_data.s_decode_pixels_slow[0].v_n_extra;
+    v_length = self->private_data.s_decode_pixels_slow[0].v_length;
+    v_dist = self->private_data.s_decode_pixels_slow[0].v_dist;
+    v_cache_shift = self->private_data.s_decode_pixels_slow[0].v_cache_shift;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_n_bits >= 32) {
+      status = wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_n_bits);
+      goto exit;
+    }
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    v_x = self->private_impl.f_pixel_x;
+    v_y = self->private_impl.f_pixel_y;
+    v_p_max = (((uint64_t)(a_width)) * ((uint64_t)(a_height)) * 4);
+    if (v_p_max > ((uint64_t)(a_dst.len))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_p = (((((uint64_t)(v_y)) * ((uint64_t)(a_width))) + ((uint64_t)(v_x))) * 4);
+    v_width_in_tiles = ((uint64_t)((((a_width + (((uint32_t)(1)) << a_tile_size_log2)) - 1) >> a_tile_size_log2)));
+    v_cache_shift = ((32 - self->private_impl.f_color_cache_bits) & 31);
+    label__fast__loop__continue:;
+    while ((v_p < v_p_max) && (((uint64_t)(io2_a_src - iop_a_src)) < 16)) {
+      if (a_tile_size_log2 > 0) {
+        v_i = (((((uint64_t)((v_y >> a_tile_size_log2))) * v_width_in_tiles) + ((uint64_t)((v_x >> a_tile_size_log2)))) * 4);
+        if (v_i < ((uint64_t)(a_tile_data.len))) {
+          if ((v_i + 1) < ((uint64_t)(a_tile_data.len))) {
+            v_hg = ((uint32_t)(a_tile_data.ptr[(v_i + 1)]));
+          }
+        }
+      }
+      v_length = 0;
+      v_ht = 0;
+      label__fast__0__continue:;
+      while (true) {
+        v_table_base = ((uint32_t)(WUFFS_WEBP__HUFFMAN_TABLE_BASE_OFFSETS[v_ht]));
+        while (true) {
+          v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(v_table_base + (v_bits & 255))]));
+          if (v_table_entry >= 36864) {
+            v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+            v_sub_index = (v_table_base + (v_table_entry & 4095) + ((v_bits >> 8) & v_sub_mask));
+            v_sub_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 5003)]));
+            if ((v_sub_entry >> 12) <= v_n_bits) {
+              v_table_entry = v_sub_entry;
+              goto label__fast__1__break;
+            }
+          } else if ((v_table_entry >> 12) <= v_n_bits) {
+            goto label__fast__1__break;
+          }
+          if (v_n_bits >= 24) {
+            status = wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_n_bits);
+            goto exit;
+          }
+          {
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint8_t t_0 = *iop_a_src++;
+            v_c8 = t_0;
+          }
+          v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+          v_n_bits += 8;
+        }
+        label__fast__1__break:;
+        v_table_entry_n_bits = (v_table_entry >> 12);
+        v_bits >>= v_table_entry_n_bits;
+        v_n_bits -= v_table_entry_n_bits;
+        v_symbol = (v_table_entry & 4095);
+        if (v_ht == 0) {
+          if (v_symbol < 256) {
+            v_argb[0] = v_symbol;
+            v_ht = 1;
+            goto label__fast__0__continue;
+          } else if (v_symbol < 280) {
+            v_prefix = (v_symbol - 256);
+            if (v_prefix < 4) {
+              v_length = (v_prefix + 1);
+            } else {
+              v_n_extra = ((v_prefix - 2) >> 1);
+              while (v_n_bits < v_n_extra) {
+                {
+                  WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint8_t t_1 = *iop_a_src++;
+                  v_c8 = t_1;
+                }
+                v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+                v_n_bits += 8;
+              }
+              v_length = (((((2 + (v_prefix & 1)) << v_n_extra) + (v_bits & ((((uint32_t)(1)) << v_n_extra) - 1))) & 4095) + 1);
+              v_bits >>= v_n_extra;
+              v_n_bits -= v_n_extra;
+            }
+            v_ht = 4;
+            goto label__fast__0__continue;
+          }
+          v_color = self->private_data.f_color_cache[((v_symbol - 280) & 2047)];
+          goto label__fast__0__break;
+        } else if (v_ht < 4) {
+          v_argb[v_ht] = (v_symbol & 255);
+          if (v_ht < 3) {
+            v_ht += 1;
+            goto label__fast__0__continue;
+          }
+          v_color = ((v_argb[3] << 24) |
+              (v_argb[1] << 16) |
+              (v_argb[0] << 8) |
+              v_argb[2]);
+          goto label__fast__0__break;
+        }
+        if (v_symbol >= 40) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+          goto exit;
+        }
+        v_prefix = v_symbol;
+        if (v_prefix < 4) {
+          v_dist = (v_prefix + 1);
+        } else {
+          v_n_extra = ((v_prefix - 2) >> 1);
+          while (v_n_bits < v_n_extra) {
+            {
+              WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint8_t t_2 = *iop_a_src++;
+              v_c8 = t_2;
+            }
+            v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+            v_n_bits += 8;
+          }
+          v_dist = ((((2 + (v_prefix & 1)) << v_n_extra) + (v_bits & ((((uint32_t)(1)) << v_n_extra) - 1))) + 1);
+          v_bits >>= v_n_extra;
+          v_n_bits -= v_n_extra;
+        }
+        goto label__fast__0__break;
+      }
+      label__fast__0__break:;
+      if (v_length > 0) {
+        if (v_dist > 120) {
+          v_dist -= 120;
+        } else {
+          v_dist_map = ((uint32_t)(WUFFS_WEBP__DISTANCE_MAP[(((uint32_t)(v_dist - 1)) & 127)]));
+          v_dist = (((v_dist_map >> 4) * a_width) + 8);
+          if (v_dist > (v_dist_map & 15)) {
+            v_dist -= (v_dist_map & 15);
+          } else {
+            v_dist = 1;
+          }
+        }
+        v_q = (((uint64_t)(v_dist)) * 4);
+        v_n = (((uint64_t)(v_length)) * 4);
+        if ((v_p < v_q) || (v_n > (v_p_max - v_p))) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+          goto exit;
+        }
+        v_s = (v_p - v_q);
+        while (v_n > 0) {
+          if ((v_s > v_p) || (v_p > ((uint64_t)(a_dst.len)))) {
+            status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+            goto exit;
+          }
+          v_m = wuffs_base__u64__min(v_n, (v_p - v_s));
+          v_n -= v_m;
+          v_pix = wuffs_base__slice_u8__subslice_i(a_dst, v_p);
+          if (v_m > ((uint64_t)(v_pix.len))) {
+            status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+            goto exit;
+          }
+          v_pix = wuffs_base__slice_u8__subslice_j(v_pix, v_m);
+          wuffs_base__slice_u8__copy_from_slice(v_pix, wuffs_base__slice_u8__subslice_ij(a_dst, v_s, v_p));
+          if (self->private_impl.f_color_cache_bits > 0) {
+            v_run = v_pix;
+            while (((uint64_t)(v_run.len)) >= 4) {
+              v_color = wuffs_base__peek_u32le__no_bounds_check(v_run.ptr);
+              self->private_data.f_color_cache[((((uint32_t)(506832829 * v_color)) >> v_cache_shift) & 2047)] = v_color;
+              v_run = wuffs_base__slice_u8__subslice_i(v_run, 4);
+            }
+          }
+          v_p += v_m;
+        }
+        v_x += v_length;
+        while ((v_x >= a_width) && (a_width > 0)) {
+          v_x -= a_width;
+          v_y += 1;
+        }
+        goto label__fast__loop__continue;
+      }
+      if (v_p > ((uint64_t)(a_dst.len))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      v_pix = wuffs_base__slice_u8__subslice_i(a_dst, v_p);
+      if (((uint64_t)(v_pix.len)) >= 4) {
+        wuffs_base__poke_u32le__no_bounds_check(v_pix.ptr, v_color);
+      }
+      if (self->private_impl.f_color_cache_bits > 0) {
+        self->private_data.f_color_cache[((((uint32_t)(506832829 * v_color)) >> v_cache_shift) & 2047)] = v_color;
+      }
+      v_p += 4;
+      v_x += 1;
+      if (v_x >= a_width) {
+        v_x = 0;
+        v_y += 1;
+      }
+    }
+    self->private_impl.f_pixel_x = v_x;
+    self->private_impl.f_pixel_y = v_y;
+    self->private_impl.f_bits = v_bits;
+    self->private_impl.f_n_bits = v_n_bits;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_n_bits >= 32) {
+      status = wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_n_bits);
+      goto exit;
+    }
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    v_x = self->private_impl.f_pixel_x;
+    v_y = self->private_impl.f_pixel_y;
+    v_p_max = (((uint64_t)(a_width)) * ((uint64_t)(a_height)) * 4);
+    if (v_p_max > ((uint64_t)(a_dst.len))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_p = (((((uint64_t)(v_y)) * ((uint64_t)(a_width))) + ((uint64_t)(v_x))) * 4);
+    v_width_in_tiles = ((uint64_t)((((a_width + (((uint32_t)(1)) << a_tile_size_log2)) - 1) >> a_tile_size_log2)));
+    v_cache_shift = ((32 - self->private_impl.f_color_cache_bits) & 31);
+    label__loop__continue:;
+    while ((v_p < v_p_max) && (((uint64_t)(io2_a_src - iop_a_src)) < 16)) {
+      if (a_tile_size_log2 > 0) {
+        v_i = (((((uint64_t)((v_y >> a_tile_size_log2))) * v_width_in_tiles) + ((uint64_t)((v_x >> a_tile_size_log2)))) * 4);
+        if (v_i < ((uint64_t)(a_tile_data.len))) {
+          if ((v_i + 1) < ((uint64_t)(a_tile_data.len))) {
+            v_hg = ((uint32_t)(a_tile_data.ptr[(v_i + 1)]));
+          }
+        }
+      }
+      v_length = 0;
+      v_ht = 0;
+      label__0__continue:;
+      while (true) {
+        v_table_base = ((uint32_t)(WUFFS_WEBP__HUFFMAN_TABLE_BASE_OFFSETS[v_ht]));
+        while (true) {
+          v_table_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][(v_table_base + (v_bits & 255))]));
+          if (v_table_entry >= 36864) {
+            v_sub_mask = ((((uint32_t)(1)) << (((uint32_t)((v_table_entry >> 12) - 8)) & 7)) - 1);
+            v_sub_index = (v_table_base + (v_table_entry & 4095) + ((v_bits >> 8) & v_sub_mask));
+            v_sub_entry = ((uint32_t)(self->private_data.f_huffman_tables[v_hg][wuffs_base__u32__min(v_sub_index, 5003)]));
+            if ((v_sub_entry >> 12) <= v_n_bits) {
+              v_table_entry = v_sub_entry;
+              goto label__1__break;
+            }
+          } else if ((v_table_entry >> 12) <= v_n_bits) {
+            goto label__1__break;
+          }
+          if (v_n_bits >= 24) {
+            status = wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_n_bits);
+            goto exit;
+          }
+          {
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint8_t t_0 = *iop_a_src++;
+            v_c8 = t_0;
+          }
+          v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+          v_n_bits += 8;
+        }
+        label__1__break:;
+        v_table_entry_n_bits = (v_table_entry >> 12);
+        v_bits >>= v_table_entry_n_bits;
+        v_n_bits -= v_table_entry_n_bits;
+        v_symbol = (v_table_entry & 4095);
+        if (v_ht == 0) {
+          if (v_symbol < 256) {
+            v_argb[0] = v_symbol;
+            v_ht = 1;
+            goto label__0__continue;
+          } else if (v_symbol < 280) {
+            v_prefix = (v_symbol - 256);
+            if (v_prefix < 4) {
+              v_length = (v_prefix + 1);
+            } else {
+              v_n_extra = ((v_prefix - 2) >> 1);
+              while (v_n_bits < v_n_extra) {
+                {
+                  WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+                  if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                    status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                    goto suspend;
+                  }
+                  uint8_t t_1 = *iop_a_src++;
+                  v_c8 = t_1;
+                }
+                v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+                v_n_bits += 8;
+              }
+              v_length = (((((2 + (v_prefix & 1)) << v_n_extra) + (v_bits & ((((uint32_t)(1)) << v_n_extra) - 1))) & 4095) + 1);
+              v_bits >>= v_n_extra;
+              v_n_bits -= v_n_extra;
+            }
+            v_ht = 4;
+            goto label__0__continue;
+          }
+          v_color = self->private_data.f_color_cache[((v_symbol - 280) & 2047)];
+          goto label__0__break;
+        } else if (v_ht < 4) {
+          v_argb[v_ht] = (v_symbol & 255);
+          if (v_ht < 3) {
+            v_ht += 1;
+            goto label__0__continue;
+          }
+          v_color = ((v_argb[3] << 24) |
+              (v_argb[1] << 16) |
+              (v_argb[0] << 8) |
+              v_argb[2]);
+          goto label__0__break;
+        }
+        if (v_symbol >= 40) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_huffman_code);
+          goto exit;
+        }
+        v_prefix = v_symbol;
+        if (v_prefix < 4) {
+          v_dist = (v_prefix + 1);
+        } else {
+          v_n_extra = ((v_prefix - 2) >> 1);
+          while (v_n_bits < v_n_extra) {
+            {
+              WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint8_t t_2 = *iop_a_src++;
+              v_c8 = t_2;
+            }
+            v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+            v_n_bits += 8;
+          }
+          v_dist = ((((2 + (v_prefix & 1)) << v_n_extra) + (v_bits & ((((uint32_t)(1)) << v_n_extra) - 1))) + 1);
+          v_bits >>= v_n_extra;
+          v_n_bits -= v_n_extra;
+        }
+        goto label__0__break;
+      }
+      label__0__break:;
+      if (v_length > 0) {
+        if (v_dist > 120) {
+          v_dist -= 120;
+        } else {
+          v_dist_map = ((uint32_t)(WUFFS_WEBP__DISTANCE_MAP[(((uint32_t)(v_dist - 1)) & 127)]));
+          v_dist = (((v_dist_map >> 4) * a_width) + 8);
+          if (v_dist > (v_dist_map & 15)) {
+            v_dist -= (v_dist_map & 15);
+          } else {
+            v_dist = 1;
+          }
+        }
+        v_q = (((uint64_t)(v_dist)) * 4);
+        v_n = (((uint64_t)(v_length)) * 4);
+        if ((v_p < v_q) || (v_n > (v_p_max - v_p))) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+          goto exit;
+        }
+        v_s = (v_p - v_q);
+        while (v_n > 0) {
+          if ((v_s > v_p) || (v_p > ((uint64_t)(a_dst.len)))) {
+            status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+            goto exit;
+          }
+          v_m = wuffs_base__u64__min(v_n, (v_p - v_s));
+          v_n -= v_m;
+          v_pix = wuffs_base__slice_u8__subslice_i(a_dst, v_p);
+          if (v_m > ((uint64_t)(v_pix.len))) {
+            status = wuffs_base__make_status(wuffs_webp__error__bad_back_reference);
+            goto exit;
+          }
+          v_pix = wuffs_base__slice_u8__subslice_j(v_pix, v_m);
+          wuffs_base__slice_u8__copy_from_slice(v_pix, wuffs_base__slice_u8__subslice_ij(a_dst, v_s, v_p));
+          if (self->private_impl.f_color_cache_bits > 0) {
+            v_run = v_pix;
+            while (((uint64_t)(v_run.len)) >= 4) {
+              v_color = wuffs_base__peek_u32le__no_bounds_check(v_run.ptr);
+              self->private_data.f_color_cache[((((uint32_t)(506832829 * v_color)) >> v_cache_shift) & 2047)] = v_color;
+              v_run = wuffs_base__slice_u8__subslice_i(v_run, 4);
+            }
+          }
+          v_p += v_m;
+        }
+        v_x += v_length;
+        while ((v_x >= a_width) && (a_width > 0)) {
+          v_x -= a_width;
+          v_y += 1;
+        }
+        goto label__loop__continue;
+      }
+      if (v_p > ((uint64_t)(a_dst.len))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      v_pix = wuffs_base__slice_u8__subslice_i(a_dst, v_p);
+      if (((uint64_t)(v_pix.len)) >= 4) {
+        wuffs_base__poke_u32le__no_bounds_check(v_pix.ptr, v_color);
+      }
+      if (self->private_impl.f_color_cache_bits > 0) {
+        self->private_data.f_color_cache[((((uint32_t)(506832829 * v_color)) >> v_cache_shift) & 2047)] = v_color;
+      }
+      v_p += 4;
+      v_x += 1;
+      if (v_x >= a_width) {
+        v_x = 0;
+        v_y += 1;
+      }
+    }
+    self->private_impl.f_pixel_x = v_x;
+    self->private_impl.f_pixel_y = v_y;
+    self->private_impl.f_bits = v_bits;
+    self->private_impl.f_n_bits = v_n_bits;
+
+    goto ok;
+    ok:
+    self->private_impl.p_decode_pixels_slow[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_pixels_slow[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_pixels_slow[0].v_bits = v_bits;
+  self->private_data.s_decode_pixels_slow[0].v_n_bits = v_n_bits;
+  self->private_data.s_decode_pixels_slow[0].v_p = v_p;
+  self->private_data.s_decode_pixels_slow[0].v_p_max = v_p_max;
+  self->private_data.s_decode_pixels_slow[0].v_x = v_x;
+  self->private_data.s_decode_pixels_slow[0].v_y = v_y;
+  self->private_data.s_decode_pixels_slow[0].v_width_in_tiles = v_width_in_tiles;
+  self->private_data.s_decode_pixels_slow[0].v_hg = v_hg;
+  self->private_data.s_decode_pixels_slow[0].v_ht = v_ht;
+  self->private_data.s_decode_pixels_slow[0].v_table_base = v_table_base;
+  memcpy(self->private_data.s_decode_pixels_slow[0].v_argb, v_argb, sizeof(v_argb));
+  self->private_data.s_decode_pixels_slow[0].v_color = v_color;
+  self->private_data.s_decode_pixels_slow[0].v_prefix = v_prefix;
+  self->private_data.s_decode_pixels_slow[0].v_n_extra = v_n_extra;
+  self->private_data.s_decode_pixels_slow[0].v_length = v_length;
+  self->private_data.s_decode_pixels_slow[0].v_dist = v_dist;
+  self->private_data.s_decode_pixels_slow[0].v_cache_shift = v_cache_shift;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[6].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[6].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.apply_transform_predictor
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_predictor(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_width,
+    uint32_t a_tile_size_log2) {
+  uint64_t v_w4 = 0;
+  uint64_t v_prev_start = 0;
+  uint64_t v_curr_start = 0;
+  uint64_t v_curr_end = 0;
+  wuffs_base__slice_u8 v_curr_row = {0};
+  wuffs_base__slice_u8 v_prev_row = {0};
+  uint32_t v_height = 0;
+  uint32_t v_y = 0;
+  uint64_t v_tiles_per_row = 0;
+  uint64_t v_tile_start = 0;
+  uint32_t v_x0 = 0;
+  uint32_t v_x1 = 0;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  uint32_t v_mode = 0;
+  uint32_t v_left = 0;
+  uint32_t v_top = 0;
+  uint32_t v_top_left = 0;
+  wuffs_base__slice_u8 v_curr = {0};
+  wuffs_base__slice_u8 v_prev = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[7].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_w4 = (((uint64_t)(a_width)) * 4);
+  if (v_w4 > ((uint64_t)(a_pix.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_tiles_per_row = ((uint64_t)((((a_width + (((uint32_t)(1)) << a_tile_size_log2)) - 1) >> a_tile_size_log2)));
+  v_curr_row = wuffs_base__slice_u8__subslice_j(a_pix, v_w4);
+  if (3 >= ((uint64_t)(v_curr_row.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_curr_row.ptr[3] += 255;
+  {
+    wuffs_base__slice_u8 i_slice_curr = wuffs_base__slice_u8__subslice_i(v_curr_row, 4);
+    v_curr.ptr = i_slice_curr.ptr;
+    wuffs_base__slice_u8 i_slice_prev = v_curr_row;
+    v_prev.ptr = i_slice_prev.ptr;
+    i_slice_curr.len = ((size_t)(wuffs_base__u64__min(i_slice_curr.len, i_slice_prev.len)));
+    v_curr.len = 4;
+    v_prev.len = 4;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 4) * 4);
+    while (v_curr.ptr < i_end0_curr) {
+      v_curr.ptr[0] += v_prev.ptr[0];
+      v_curr.ptr[1] += v_prev.ptr[1];
+      v_curr.ptr[2] += v_prev.ptr[2];
+      v_curr.ptr[3] += v_prev.ptr[3];
+      v_curr.ptr += 4;
+      v_prev.ptr += 4;
+    }
+    v_curr.len = 0;
+    v_prev.len = 0;
+  }
+  v_height = self->private_impl.f_height;
+  v_prev_start = 0;
+  v_y = 1;
+  while (v_y < v_height) {
+    v_curr_start = ((uint64_t)(v_prev_start + v_w4));
+    v_curr_end = ((uint64_t)(v_curr_start + v_w4));
+    if ((v_prev_start > v_curr_start) || (v_curr_start > v_curr_end) || (v_curr_end > ((uint64_t)(a_pix.len)))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_prev_row = wuffs_base__slice_u8__subslice_ij(a_pix, v_prev_start, v_curr_end);
+    v_curr_row = wuffs_base__slice_u8__subslice_ij(a_pix, v_curr_start, v_curr_end);
+    if ((3 >= ((uint64_t)(v_curr_row.len))) || (3 >= ((uint64_t)(v_prev_row.len)))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_curr_row.ptr[0] += v_prev_row.ptr[0];
+    v_curr_row.ptr[1] += v_prev_row.ptr[1];
+    v_curr_row.ptr[2] += v_prev_row.ptr[2];
+    v_curr_row.ptr[3] += v_prev_row.ptr[3];
+    v_tile_start = (((uint64_t)((v_y >> a_tile_size_log2))) * v_tiles_per_row * 4);
+    v_x0 = 1;
+    while ((v_x0 > 0) && (v_x0 < a_width)) {
+      v_x1 = ((((v_x0 >> a_tile_size_log2) + 1) << a_tile_size_log2) & 32767);
+      v_x1 = wuffs_base__u32__min(v_x1, a_width);
+      v_q = (v_tile_start + (((uint64_t)((v_x0 >> a_tile_size_log2))) * 4) + 1);
+      if (v_q >= ((uint64_t)(a_tile_data.len))) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_mode = ((uint32_t)((a_tile_data.ptr[v_q] & 15)));
+      v_q = (((uint64_t)((v_x0 - 1))) * 4);
+      v_q_end = (((uint64_t)((v_x1 + 1))) * 4);
+      if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(v_prev_row.len)))) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_prev = wuffs_base__slice_u8__subslice_ij(v_prev_row, v_q, v_q_end);
+      if (((uint64_t)(v_prev.len)) < 8) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_top_left = wuffs_base__peek_u32le__no_bounds_check(v_prev.ptr);
+      v_prev = wuffs_base__slice_u8__subslice_i(v_prev, 4);
+      if (((uint64_t)(v_prev.len)) < 4) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_top = wuffs_base__peek_u32le__no_bounds_check(v_prev.ptr);
+      v_prev = wuffs_base__slice_u8__subslice_i(v_prev, 4);
+      v_q = (((uint64_t)((v_x0 - 1))) * 4);
+      v_q_end = (((uint64_t)(v_x1)) * 4);
+      if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(v_curr_row.len)))) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_curr = wuffs_base__slice_u8__subslice_ij(v_curr_row, v_q, v_q_end);
+      if (((uint64_t)(v_curr.len)) < 4) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_left = wuffs_base__peek_u32le__no_bounds_check(v_curr.ptr);
+      v_curr = wuffs_base__slice_u8__subslice_i(v_curr, 4);
+      if ((v_mode == 0) ||
+          (v_mode == 2) ||
+          (v_mode == 3) ||
+          (v_mode == 4) ||
+          (v_mode == 8) ||
+          (v_mode == 9) ||
+          (v_mode >= 14)) {
+        wuffs_webp__decoder__predict_segment_no_left(self,
+            v_curr,
+            v_prev,
+            v_top,
+            v_top_left,
+            v_mode);
+      } else {
+        wuffs_webp__decoder__predict_segment(self,
+            v_curr,
+            v_prev,
+            v_left,
+            v_top,
+            v_top_left,
+            v_mode);
+      }
+      v_x0 = v_x1;
+    }
+    v_prev_start = v_curr_start;
+    v_y += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.predict_segment_no_left
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment_no_left(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode) {
+  return (*self->private_impl.choosy_predict_segment_no_left)(self, a_curr, a_prev, a_top, a_top_left, a_mode);
+}
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment_no_left__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode) {
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[8].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  wuffs_webp__decoder__predict_segment(self,
+      a_curr,
+      a_prev,
+      0,
+      a_top,
+      a_top_left,
+      a_mode);
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.predict_segment
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_left,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode) {
+  wuffs_base__slice_u8 v_curr = {0};
+  wuffs_base__slice_u8 v_prev = {0};
+  uint32_t v_l = 0;
+  uint32_t v_t = 0;
+  uint32_t v_tl = 0;
+  uint32_t v_tr = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[9].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_l = a_left;
+  v_t = a_top;
+  v_tl = a_top_left;
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    wuffs_base__slice_u8 i_slice_prev = a_prev;
+    v_prev.ptr = i_slice_prev.ptr;
+    i_slice_curr.len = ((size_t)(wuffs_base__u64__min(i_slice_curr.len, i_slice_prev.len)));
+    v_curr.len = 4;
+    v_prev.len = 4;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 4) * 4);
+    while (v_curr.ptr < i_end0_curr) {
+      v_tr = wuffs_base__peek_u32le__no_bounds_check(v_prev.ptr);
+      v_l = wuffs_webp__decoder__add_pixels(self, wuffs_base__peek_u32le__no_bounds_check(v_curr.ptr), wuffs_webp__decoder__predict(self,
+          a_mode,
+          v_l,
+          v_t,
+          v_tl,
+          v_tr));
+      wuffs_base__poke_u32le__no_bounds_check(v_curr.ptr, v_l);
+      v_tl = v_t;
+      v_t = v_tr;
+      v_curr.ptr += 4;
+      v_prev.ptr += 4;
+    }
+    v_curr.len = 0;
+    v_prev.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.predict
+
+static uint32_t
+wuffs_webp__decoder__predict(
+    const wuffs_webp__decoder* self,
+    uint32_t a_mode,
+    uint32_t a_l,
+    uint32_t a_t,
+    uint32_t a_tl,
+    uint32_t a_tr) {
+  if (a_mode == 1) {
+    return a_l;
+  } else if (a_mode == 2) {
+    return a_t;
+  } else if (a_mode == 3) {
+    return a_tr;
+  } else if (a_mode == 4) {
+    return a_tl;
+  } else if (a_mode == 5) {
+    return wuffs_webp__decoder__average2(self, wuffs_webp__decoder__average2(self, a_l, a_tr), a_t);
+  } else if (a_mode == 6) {
+    return wuffs_webp__decoder__average2(self, a_l, a_tl);
+  } else if (a_mode == 7) {
+    return wuffs_webp__decoder__average2(self, a_l, a_t);
+  } else if (a_mode == 8) {
+    return wuffs_webp__decoder__average2(self, a_tl, a_t);
+  } else if (a_mode == 9) {
+    return wuffs_webp__decoder__average2(self, a_t, a_tr);
+  } else if (a_mode == 10) {
+    return wuffs_webp__decoder__average2(self, wuffs_webp__decoder__average2(self, a_l, a_tl), wuffs_webp__decoder__average2(self, a_t, a_tr));
+  } else if (a_mode == 11) {
+    return wuffs_webp__decoder__select(self, a_l, a_t, a_tl);
+  } else if (a_mode == 12) {
+    return wuffs_webp__decoder__clamp_add_subtract_full(self, a_l, a_t, a_tl);
+  } else if (a_mode == 13) {
+    return wuffs_webp__decoder__clamp_add_subtract_half(self, wuffs_webp__decoder__average2(self, a_l, a_t), a_tl);
+  }
+  return 4278190080;
+}
+
+// -------- func webp.decoder.add_pixels
+
+static uint32_t
+wuffs_webp__decoder__add_pixels(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b) {
+  return ((((uint32_t)((a_a & 16711935) + (a_b & 16711935))) & 16711935) | (((uint32_t)((a_a & 4278255360) + (a_b & 4278255360))) & 4278255360));
+}
+
+// -------- func webp.decoder.average2
+
+static uint32_t
+wuffs_webp__decoder__average2(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b) {
+  return ((uint32_t)((((a_a ^ a_b) & 4278124286) >> 1) + (a_a & a_b)));
+}
+
+// -------- func webp.decoder.select
+
+static uint32_t
+wuffs_webp__decoder__select(
+    const wuffs_webp__decoder* self,
+    uint32_t a_l,
+    uint32_t a_t,
+    uint32_t a_tl) {
+  uint32_t v_shift = 0;
+  uint32_t v_l8 = 0;
+  uint32_t v_t8 = 0;
+  uint32_t v_tl8 = 0;
+  uint32_t v_pl = 0;
+  uint32_t v_pt = 0;
+
+  while (v_shift < 32) {
+    v_l8 = ((a_l >> v_shift) & 255);
+    v_t8 = ((a_t >> v_shift) & 255);
+    v_tl8 = ((a_tl >> v_shift) & 255);
+    if (v_t8 > v_tl8) {
+      v_pl += (v_t8 - v_tl8);
+    } else {
+      v_pl += (v_tl8 - v_t8);
+    }
+    if (v_l8 > v_tl8) {
+      v_pt += (v_l8 - v_tl8);
+    } else {
+      v_pt += (v_tl8 - v_l8);
+    }
+    v_shift += 8;
+  }
+  if (v_pl < v_pt) {
+    return a_l;
+  }
+  return a_t;
+}
+
+// -------- func webp.decoder.clamp_add_subtract_full
+
+static uint32_t
+wuffs_webp__decoder__clamp_add_subtract_full(
+    const wuffs_webp__decoder* self,
+    uint32_t a_l,
+    uint32_t a_t,
+    uint32_t a_tl) {
+  uint32_t v_shift = 0;
+  uint32_t v_c = 0;
+  uint32_t v_tl8 = 0;
+  uint32_t v_ret = 0;
+
+  while (v_shift < 32) {
+    v_c = (((a_l >> v_shift) & 255) + ((a_t >> v_shift) & 255));
+    v_tl8 = ((a_tl >> v_shift) & 255);
+    if (v_c > v_tl8) {
+      v_c = (v_c - v_tl8);
+      v_c = wuffs_base__u32__min(v_c, 255);
+      v_ret |= ((uint32_t)(v_c << v_shift));
+    }
+    v_shift += 8;
+  }
+  return v_ret;
+}
+
+// -------- func webp.decoder.clamp_add_subtract_half
+
+static uint32_t
+wuffs_webp__decoder__clamp_add_subtract_half(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_tl) {
+  uint32_t v_shift = 0;
+  uint32_t v_a8 = 0;
+  uint32_t v_tl8 = 0;
+  uint32_t v_d = 0;
+  uint32_t v_c = 0;
+  uint32_t v_ret = 0;
+
+  while (v_shift < 32) {
+    v_a8 = ((a_a >> v_shift) & 255);
+    v_tl8 = ((a_tl >> v_shift) & 255);
+    if (v_a8 >= v_tl8) {
+      v_d = ((v_a8 - v_tl8) / 2);
+      v_c = (v_a8 + v_d);
+      v_c = wuffs_base__u32__min(v_c, 255);
+      v_ret |= ((uint32_t)(v_c << v_shift));
+    } else {
+      v_d = ((v_tl8 - v_a8) / 2);
+      if (v_a8 > v_d) {
+        v_ret |= ((uint32_t)((v_a8 - v_d) << v_shift));
+      }
+    }
+    v_shift += 8;
+  }
+  return v_ret;
+}
+
+// -------- func webp.decoder.apply_transform_cross_color
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_cross_color(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    wuffs_base__slice_u8 a_tile_data,
+    uint32_t a_width,
+    uint32_t a_tile_size_log2) {
+  uint64_t v_w4 = 0;
+  uint64_t v_curr_start = 0;
+  uint64_t v_curr_end = 0;
+  wuffs_base__slice_u8 v_curr_row = {0};
+  uint32_t v_height = 0;
+  uint32_t v_y = 0;
+  uint64_t v_tiles_per_row = 0;
+  uint64_t v_tile_start = 0;
+  uint32_t v_x0 = 0;
+  uint32_t v_x1 = 0;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  wuffs_base__slice_u8 v_s = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[10].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_w4 = (((uint64_t)(a_width)) * 4);
+  v_tiles_per_row = ((uint64_t)((((a_width + (((uint32_t)(1)) << a_tile_size_log2)) - 1) >> a_tile_size_log2)));
+  v_height = self->private_impl.f_height;
+  while (v_y < v_height) {
+    v_curr_end = ((uint64_t)(v_curr_start + v_w4));
+    if ((v_curr_start > v_curr_end) || (v_curr_end > ((uint64_t)(a_pix.len)))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_curr_row = wuffs_base__slice_u8__subslice_ij(a_pix, v_curr_start, v_curr_end);
+    v_tile_start = (((uint64_t)((v_y >> a_tile_size_log2))) * v_tiles_per_row * 4);
+    v_x0 = 0;
+    while (v_x0 < a_width) {
+      v_x1 = ((((v_x0 >> a_tile_size_log2) + 1) << a_tile_size_log2) & 32767);
+      v_x1 = wuffs_base__u32__min(v_x1, a_width);
+      v_q = (v_tile_start + (((uint64_t)((v_x0 >> a_tile_size_log2))) * 4));
+      if (v_q > ((uint64_t)(a_tile_data.len))) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_s = wuffs_base__slice_u8__subslice_i(a_tile_data, v_q);
+      if (((uint64_t)(v_s.len)) < 4) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_q = (((uint64_t)(v_x0)) * 4);
+      v_q_end = (((uint64_t)(v_x1)) * 4);
+      if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(v_curr_row.len)))) {
+        return wuffs_base__make_empty_struct();
+      }
+      wuffs_webp__decoder__cross_color_segment(self, wuffs_base__slice_u8__subslice_ij(v_curr_row, v_q, v_q_end), wuffs_base__peek_u32le__no_bounds_check(v_s.ptr));
+      v_x0 = v_x1;
+    }
+    v_curr_start = v_curr_end;
+    v_y += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.cross_color_segment
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__cross_color_segment(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_t) {
+  return (*self->private_impl.choosy_cross_color_segment)(self, a_pix, a_t);
+}
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__cross_color_segment__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_t) {
+  wuffs_base__slice_u8 v_pix = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[11].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_pix = a_pix;
+    v_pix.ptr = i_slice_pix.ptr;
+    v_pix.len = 4;
+    uint8_t* i_end0_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 4) * 4);
+    while (v_pix.ptr < i_end0_pix) {
+      wuffs_base__poke_u32le__no_bounds_check(v_pix.ptr, wuffs_webp__decoder__cross_color_pixel(self, wuffs_base__peek_u32le__no_bounds_check(v_pix.ptr), a_t));
+      v_pix.ptr += 4;
+    }
+    v_pix.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.cross_color_pixel
+
+static uint32_t
+wuffs_webp__decoder__cross_color_pixel(
+    const wuffs_webp__decoder* self,
+    uint32_t a_c,
+    uint32_t a_t) {
+  uint32_t v_g = 0;
+  uint32_t v_r = 0;
+  uint32_t v_b = 0;
+  uint32_t v_g2r = 0;
+  uint32_t v_g2b = 0;
+  uint32_t v_r2b = 0;
+
+  v_g = ((uint32_t)((((a_c >> 8) & 255) ^ 128) - 128));
+  v_g2r = ((uint32_t)(((a_t & 255) ^ 128) - 128));
+  v_g2b = ((uint32_t)((((a_t >> 8) & 255) ^ 128) - 128));
+  v_r2b = ((uint32_t)((((a_t >> 16) & 255) ^ 128) - 128));
+  v_r = (((uint32_t)((a_c >> 16) + ((uint32_t)((((uint32_t)(((uint32_t)(v_g2r * v_g)) + 32768)) >> 5) - 1024)))) & 255);
+  v_b = ((uint32_t)(a_c + ((uint32_t)((((uint32_t)(((uint32_t)(v_g2b * v_g)) + 32768)) >> 5) - 1024))));
+  v_b = (((uint32_t)(v_b + ((uint32_t)((((uint32_t)(((uint32_t)(v_r2b * ((uint32_t)((v_r ^ 128) - 128)))) + 32768)) >> 5) - 1024)))) & 255);
+  return ((a_c & 4278255360) | (v_r << 16) | v_b);
+}
+
+// -------- func webp.decoder.apply_transform_subtract_green
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_subtract_green(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix) {
+  return (*self->private_impl.choosy_apply_transform_subtract_green)(self, a_pix);
+}
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_subtract_green__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix) {
+  wuffs_base__slice_u8 v_pix = {0};
+  uint8_t v_g = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[12].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  {
+    wuffs_base__slice_u8 i_slice_pix = a_pix;
+    v_pix.ptr = i_slice_pix.ptr;
+    v_pix.len = 4;
+    uint8_t* i_end0_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 8) * 8);
+    while (v_pix.ptr < i_end0_pix) {
+      v_g = v_pix.ptr[1];
+      v_pix.ptr[0] += v_g;
+      v_pix.ptr[2] += v_g;
+      v_pix.ptr += 4;
+      v_g = v_pix.ptr[1];
+      v_pix.ptr[0] += v_g;
+      v_pix.ptr[2] += v_g;
+      v_pix.ptr += 4;
+    }
+    v_pix.len = 4;
+    uint8_t* i_end1_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 4) * 4);
+    while (v_pix.ptr < i_end1_pix) {
+      v_g = v_pix.ptr[1];
+      v_pix.ptr[0] += v_g;
+      v_pix.ptr[2] += v_g;
+      v_pix.ptr += 4;
+    }
+    v_pix.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.apply_transform_color_indexing
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_color_indexing(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_width,
+    uint32_t a_tile_size_log2) {
+  uint32_t v_tile_size_log2 = 0;
+  uint32_t v_bits_per_pixel = 0;
+  uint32_t v_x_mask = 0;
+  uint64_t v_packed_width = 0;
+  uint64_t v_y = 0;
+  uint32_t v_x = 0;
+  uint64_t v_src_row = 0;
+  uint64_t v_dst_row = 0;
+  uint64_t v_p = 0;
+  uint32_t v_c = 0;
+  uint32_t v_index = 0;
+  wuffs_base__slice_u8 v_s = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[13].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_tile_size_log2 = wuffs_base__u32__min(a_tile_size_log2, 3);
+  v_bits_per_pixel = (((uint32_t)(8)) >> v_tile_size_log2);
+  v_x_mask = ((((uint32_t)(1)) << v_tile_size_log2) - 1);
+  v_packed_width = ((((uint64_t)(a_width)) + ((uint64_t)(v_x_mask))) >> v_tile_size_log2);
+  v_y = ((uint64_t)(self->private_impl.f_height));
+  while (v_y > 0) {
+    v_y -= 1;
+    v_src_row = (v_y * v_packed_width * 4);
+    v_dst_row = (v_y * ((uint64_t)(a_width)) * 4);
+    v_x = a_width;
+    while (v_x > 0) {
+      v_x -= 1;
+      v_p = (v_src_row + (((uint64_t)((v_x >> v_tile_size_log2))) * 4) + 1);
+      if (v_p >= ((uint64_t)(a_pix.len))) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_c = ((uint32_t)(a_pix.ptr[v_p]));
+      v_index = ((v_c >> (((v_x & v_x_mask) * v_bits_per_pixel) & 7)) & ((((uint32_t)(1)) << v_bits_per_pixel) - 1) & 255);
+      v_p = (v_dst_row + (((uint64_t)(v_x)) * 4));
+      if (v_p > ((uint64_t)(a_pix.len))) {
+        return wuffs_base__make_empty_struct();
+      }
+      v_s = wuffs_base__slice_u8__subslice_i(a_pix, v_p);
+      if (((uint64_t)(v_s.len)) < 4) {
+        return wuffs_base__make_empty_struct();
+      }
+      wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_j(v_s, 4), wuffs_base__make_slice_u8_ij(self->private_data.f_palette, (v_index * 4), 1024));
+    }
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func webp.decoder.predict_segment_no_left_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_webp__decoder__predict_segment_no_left_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_curr,
+    wuffs_base__slice_u8 a_prev,
+    uint32_t a_top,
+    uint32_t a_top_left,
+    uint32_t a_mode) {
+  wuffs_base__slice_u8 v_curr = {0};
+  wuffs_base__slice_u8 v_prev = {0};
+  __m128i v_x128 = {0};
+  __m128i v_p128 = {0};
+  __m128i v_t128 = {0};
+  __m128i v_tl128 = {0};
+  __m128i v_tr128 = {0};
+  __m128i v_k128 = {0};
+  uint32_t v_t = 0;
+  uint32_t v_tl = 0;
+  uint32_t v_tr = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[14].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_t = a_top;
+  v_tl = a_top_left;
+  v_k128 = _mm_set1_epi8((int8_t)(1));
+  {
+    wuffs_base__slice_u8 i_slice_curr = a_curr;
+    v_curr.ptr = i_slice_curr.ptr;
+    wuffs_base__slice_u8 i_slice_prev = a_prev;
+    v_prev.ptr = i_slice_prev.ptr;
+    i_slice_curr.len = ((size_t)(wuffs_base__u64__min(i_slice_curr.len, i_slice_prev.len)));
+    v_curr.len = 16;
+    v_prev.len = 16;
+    uint8_t* i_end0_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 16) * 16);
+    while (v_curr.ptr < i_end0_curr) {
+      v_tr128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_prev.ptr));
+      v_t128 = _mm_or_si128(_mm_slli_si128(v_tr128, (int32_t)(4)), _mm_cvtsi32_si128((int32_t)(v_t)));
+      v_tl128 = _mm_or_si128(_mm_slli_si128(v_tr128, (int32_t)(8)), _mm_cvtsi64x_si128((int64_t)(((((uint64_t)(v_t)) << 32) | ((uint64_t)(v_tl))))));
+      if (a_mode == 2) {
+        v_p128 = v_t128;
+      } else if (a_mode == 3) {
+        v_p128 = v_tr128;
+      } else if (a_mode == 4) {
+        v_p128 = v_tl128;
+      } else if (a_mode == 8) {
+        v_p128 = _mm_sub_epi8(_mm_avg_epu8(v_tl128, v_t128), _mm_and_si128(v_k128, _mm_xor_si128(v_tl128, v_t128)));
+      } else if (a_mode == 9) {
+        v_p128 = _mm_sub_epi8(_mm_avg_epu8(v_t128, v_tr128), _mm_and_si128(v_k128, _mm_xor_si128(v_t128, v_tr128)));
+      } else {
+        v_p128 = _mm_set1_epi32((int32_t)(4278190080));
+      }
+      v_x128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_curr.ptr));
+      v_x128 = _mm_add_epi8(v_x128, v_p128);
+      _mm_storeu_si128((__m128i*)(void*)(v_curr.ptr), v_x128);
+      v_tl = ((uint32_t)(_mm_extract_epi32(v_tr128, (int32_t)(2))));
+      v_t = ((uint32_t)(_mm_extract_epi32(v_tr128, (int32_t)(3))));
+      v_curr.ptr += 16;
+      v_prev.ptr += 16;
+    }
+    v_curr.len = 4;
+    v_prev.len = 4;
+    uint8_t* i_end1_curr = v_curr.ptr + (((i_slice_curr.len - (size_t)(v_curr.ptr - i_slice_curr.ptr)) / 4) * 4);
+    while (v_curr.ptr < i_end1_curr) {
+      v_tr = wuffs_base__peek_u32le__no_bounds_check(v_prev.ptr);
+      wuffs_base__poke_u32le__no_bounds_check(v_curr.ptr, wuffs_webp__decoder__add_pixels(self, wuffs_base__peek_u32le__no_bounds_check(v_curr.ptr), wuffs_webp__decoder__predict(self,
+          a_mode,
+          0,
+          v_t,
+          v_tl,
+          v_tr)));
+      v_tl = v_t;
+      v_t = v_tr;
+      v_curr.ptr += 4;
+      v_prev.ptr += 4;
+    }
+    v_curr.len = 0;
+    v_prev.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func webp.decoder.cross_color_segment_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_webp__decoder__cross_color_segment_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint32_t a_t) {
+  wuffs_base__slice_u8 v_pix = {0};
+  __m128i v_x128 = {0};
+  __m128i v_y128 = {0};
+  __m128i v_z128 = {0};
+  __m128i v_g128 = {0};
+  __m128i v_m0128 = {0};
+  __m128i v_m1128 = {0};
+  __m128i v_klo128 = {0};
+  __m128i v_khi128 = {0};
+  uint32_t v_g2r = 0;
+  uint32_t v_g2b = 0;
+  uint32_t v_r2b = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[15].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_g2r = (((uint32_t)(((uint32_t)(((a_t & 255) ^ 128) - 128)) << 3)) & 65535);
+  v_g2b = (((uint32_t)(((uint32_t)((((a_t >> 8) & 255) ^ 128) - 128)) << 3)) & 65535);
+  v_r2b = (((uint32_t)(((uint32_t)((((a_t >> 16) & 255) ^ 128) - 128)) << 3)) & 65535);
+  v_m0128 = _mm_set1_epi32((int32_t)(((v_g2r << 16) | v_g2b)));
+  v_m1128 = _mm_set1_epi32((int32_t)(v_r2b));
+  v_g128 = _mm_set_epi8((int8_t)(13), (int8_t)(128), (int8_t)(13), (int8_t)(128), (int8_t)(9), (int8_t)(128), (int8_t)(9), (int8_t)(128), (int8_t)(5), (int8_t)(128), (int8_t)(5), (int8_t)(128), (int8_t)(1), (int8_t)(128), (int8_t)(1), (int8_t)(128));
+  v_klo128 = _mm_set1_epi32((int32_t)(16711935));
+  v_khi128 = _mm_set1_epi32((int32_t)(4278255360));
+  {
+    wuffs_base__slice_u8 i_slice_pix = a_pix;
+    v_pix.ptr = i_slice_pix.ptr;
+    v_pix.len = 16;
+    uint8_t* i_end0_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 16) * 16);
+    while (v_pix.ptr < i_end0_pix) {
+      v_x128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_pix.ptr));
+      v_y128 = _mm_mulhi_epi16(_mm_shuffle_epi8(v_x128, v_g128), v_m0128);
+      v_y128 = _mm_add_epi8(v_x128, v_y128);
+      v_z128 = _mm_mulhi_epi16(_mm_slli_epi16(_mm_srli_epi32(v_y128, (int32_t)(16)), (int32_t)(8)), v_m1128);
+      v_y128 = _mm_add_epi8(v_y128, v_z128);
+      v_x128 = _mm_or_si128(_mm_and_si128(v_x128, v_khi128), _mm_and_si128(v_y128, v_klo128));
+      _mm_storeu_si128((__m128i*)(void*)(v_pix.ptr), v_x128);
+      v_pix.ptr += 16;
+    }
+    v_pix.len = 4;
+    uint8_t* i_end1_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 4) * 4);
+    while (v_pix.ptr < i_end1_pix) {
+      wuffs_base__poke_u32le__no_bounds_check(v_pix.ptr, wuffs_webp__decoder__cross_color_pixel(self, wuffs_base__peek_u32le__no_bounds_check(v_pix.ptr), a_t));
+      v_pix.ptr += 4;
+    }
+    v_pix.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func webp.decoder.apply_transform_subtract_green_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_webp__decoder__apply_transform_subtract_green_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix) {
+  wuffs_base__slice_u8 v_pix = {0};
+  __m128i v_x128 = {0};
+  __m128i v_g128 = {0};
+  uint8_t v_g = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[16].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_g128 = _mm_set_epi8((int8_t)(128), (int8_t)(13), (int8_t)(128), (int8_t)(13), (int8_t)(128), (int8_t)(9), (int8_t)(128), (int8_t)(9), (int8_t)(128), (int8_t)(5), (int8_t)(128), (int8_t)(5), (int8_t)(128), (int8_t)(1), (int8_t)(128), (int8_t)(1));
+  {
+    wuffs_base__slice_u8 i_slice_pix = a_pix;
+    v_pix.ptr = i_slice_pix.ptr;
+    v_pix.len = 16;
+    uint8_t* i_end0_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 16) * 16);
+    while (v_pix.ptr < i_end0_pix) {
+      v_x128 = _mm_lddqu_si128((const __m128i*)(const void*)(v_pix.ptr));
+      v_x128 = _mm_add_epi8(v_x128, _mm_shuffle_epi8(v_x128, v_g128));
+      _mm_storeu_si128((__m128i*)(void*)(v_pix.ptr), v_x128);
+      v_pix.ptr += 16;
+    }
+    v_pix.len = 4;
+    uint8_t* i_end1_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 4) * 4);
+    while (v_pix.ptr < i_end1_pix) {
+      v_g = v_pix.ptr[1];
+      v_pix.ptr[0] += v_g;
+      v_pix.ptr[2] += v_g;
+      v_pix.ptr += 4;
+    }
+    v_pix.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// -------- func webp.decoder.do_decode_image_config_vp8
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_image_config_vp8(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    uint32_t a_chunk_length) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_c32 = 0;
+  uint32_t v_w = 0;
+  uint32_t v_h = 0;
+  uint64_t v_y_length = 0;
+  uint64_t v_c_length = 0;
+  uint64_t v_offset = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[17].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_image_config_vp8[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (a_chunk_length < 10) {
+      status = wuffs_base__make_status(wuffs_webp__error__short_chunk);
+      goto exit;
+    }
+    self->private_impl.f_vp8_data_length = (a_chunk_length - 10);
+    {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      uint32_t t_0;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {
+        t_0 = ((uint32_t)(wuffs_base__peek_u24le__no_bounds_check(iop_a_src)));
+        iop_a_src += 3;
+      } else {
+        self->private_data.s_do_decode_image_config_vp8[0].scratch = 0;
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config_vp8[0].scratch;
+          uint32_t num_bits_0 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;
+          if (num_bits_0 == 16) {
+            t_0 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_0 += 8;
+          *scratch |= ((uint64_t)(num_bits_0)) << 56;
+        }
+      }
+      v_c32 = t_0;
+    }
+    if (((v_c32 & 1) != 0) || (((v_c32 >> 1) & 7) > 3) || ((v_c32 & 16) == 0)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    self->private_impl.f_vp8_first_partition_length = (v_c32 >> 5);
+    {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+      uint32_t t_1;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {
+        t_1 = ((uint32_t)(wuffs_base__peek_u24le__no_bounds_check(iop_a_src)));
+        iop_a_src += 3;
+      } else {
+        self->private_data.s_do_decode_image_config_vp8[0].scratch = 0;
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config_vp8[0].scratch;
+          uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+          if (num_bits_1 == 16) {
+            t_1 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_1 += 8;
+          *scratch |= ((uint64_t)(num_bits_1)) << 56;
+        }
+      }
+      v_c32 = t_1;
+    }
+    if (v_c32 != 2752925) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+      uint32_t t_2;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+        t_2 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+        iop_a_src += 4;
+      } else {
+        self->private_data.s_do_decode_image_config_vp8[0].scratch = 0;
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config_vp8[0].scratch;
+          uint32_t num_bits_2 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;
+          if (num_bits_2 == 24) {
+            t_2 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_2 += 8;
+          *scratch |= ((uint64_t)(num_bits_2)) << 56;
+        }
+      }
+      v_c32 = t_2;
+    }
+    v_w = (v_c32 & 16383);
+    v_h = ((v_c32 >> 16) & 16383);
+    if ((v_w == 0) || (v_h == 0)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    if (self->private_impl.f_vp8_first_partition_length > self->private_impl.f_vp8_data_length) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_partition);
+      goto exit;
+    }
+    self->private_impl.f_is_vp8 = true;
+    self->private_impl.f_width = v_w;
+    self->private_impl.f_height = v_h;
+    self->private_impl.f_pixfmt = 2415954056;
+    self->private_impl.f_vp8_mb_width = ((v_w + 15) >> 4);
+    self->private_impl.f_vp8_mb_height = ((v_h + 15) >> 4);
+    v_y_length = (((uint64_t)((((v_w + 15) >> 4) * 16))) * ((uint64_t)((((v_h + 15) >> 4) * 16))));
+    v_c_length = (v_y_length >> 2);
+    v_offset = ((uint64_t)(self->private_impl.f_vp8_data_length));
+    self->private_impl.f_vp8_plane_offsets[0] = v_offset;
+    v_offset += v_y_length;
+    self->private_impl.f_vp8_plane_offsets[1] = v_offset;
+    v_offset += v_c_length;
+    self->private_impl.f_vp8_plane_offsets[2] = v_offset;
+    v_offset += v_c_length;
+    self->private_impl.f_vp8_plane_offsets[3] = v_offset;
+    if (v_offset > 1275069440) {
+      status = wuffs_base__make_status(wuffs_base__error__too_much_data);
+      goto exit;
+    }
+    self->private_impl.f_overall_workbuf_length = v_offset;
+    self->private_impl.choosy_vp8_filter_across_cols = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__vp8_filter_across_cols_x86_sse42 :
+#endif
+        self->private_impl.choosy_vp8_filter_across_cols);
+    self->private_impl.choosy_vp8_filter_across_rows = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__vp8_filter_across_rows_x86_sse42 :
+#endif
+        self->private_impl.choosy_vp8_filter_across_rows);
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (a_chunk_length < 10) {
+      status = wuffs_base__make_status(wuffs_webp__error__short_chunk);
+      goto exit;
+    }
+    self->private_impl.f_vp8_data_length = (a_chunk_length - 10);
+    {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      uint32_t t_0;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {
+        t_0 = ((uint32_t)(wuffs_base__peek_u24le__no_bounds_check(iop_a_src)));
+        iop_a_src += 3;
+      } else {
+        self->private_data.s_do_decode_image_config_vp8[0].scratch = 0;
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config_vp8[0].scratch;
+          uint32_t num_bits_0 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;
+          if (num_bits_0 == 16) {
+            t_0 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_0 += 8;
+          *scratch |= ((uint64_t)(num_bits_0)) << 56;
+        }
+      }
+      v_c32 = t_0;
+    }
+    if (((v_c32 & 1) != 0) || (((v_c32 >> 1) & 7) > 3) || ((v_c32 & 16) == 0)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    self->private_impl.f_vp8_first_partition_length = (v_c32 >> 5);
+    {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+      uint32_t t_1;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 3)) {
+        t_1 = ((uint32_t)(wuffs_base__peek_u24le__no_bounds_check(iop_a_src)));
+        iop_a_src += 3;
+      } else {
+        self->private_data.s_do_decode_image_config_vp8[0].scratch = 0;
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config_vp8[0].scratch;
+          uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+          if (num_bits_1 == 16) {
+            t_1 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_1 += 8;
+          *scratch |= ((uint64_t)(num_bits_1)) << 56;
+        }
+      }
+      v_c32 = t_1;
+    }
+    if (v_c32 != 2752925) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+      uint32_t t_2;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+        t_2 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+        iop_a_src += 4;
+      } else {
+        self->private_data.s_do_decode_image_config_vp8[0].scratch = 0;
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config_vp8[0].scratch;
+          uint32_t num_bits_2 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;
+          if (num_bits_2 == 24) {
+            t_2 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_2 += 8;
+          *scratch |= ((uint64_t)(num_bits_2)) << 56;
+        }
+      }
+      v_c32 = t_2;
+    }
+    v_w = (v_c32 & 16383);
+    v_h = ((v_c32 >> 16) & 16383);
+    if ((v_w == 0) || (v_h == 0)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    if (self->private_impl.f_vp8_first_partition_length > self->private_impl.f_vp8_data_length) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_partition);
+      goto exit;
+    }
+    self->private_impl.f_is_vp8 = true;
+    self->private_impl.f_width = v_w;
+    self->private_impl.f_height = v_h;
+    self->private_impl.f_pixfmt = 2415954056;
+    self->private_impl.f_vp8_mb_width = ((v_w + 15) >> 4);
+    self->private_impl.f_vp8_mb_height = ((v_h + 15) >> 4);
+    v_y_length = (((uint64_t)((((v_w + 15) >> 4) * 16))) * ((uint64_t)((((v_h + 15) >> 4) * 16))));
+    v_c_length = (v_y_length >> 2);
+    v_offset = ((uint64_t)(self->private_impl.f_vp8_data_length));
+    self->private_impl.f_vp8_plane_offsets[0] = v_offset;
+    v_offset += v_y_length;
+    self->private_impl.f_vp8_plane_offsets[1] = v_offset;
+    v_offset += v_c_length;
+    self->private_impl.f_vp8_plane_offsets[2] = v_offset;
+    v_offset += v_c_length;
+    self->private_impl.f_vp8_plane_offsets[3] = v_offset;
+    if (v_offset > 1275069440) {
+      status = wuffs_base__make_status(wuffs_base__error__too_much_data);
+      goto exit;
+    }
+    self->private_impl.f_overall_workbuf_length = v_offset;
+    self->private_impl.choosy_vp8_filter_across_cols = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__vp8_filter_across_cols_x86_sse42 :
+#endif
+        self->private_impl.choosy_vp8_filter_across_cols);
+    self->private_impl.choosy_vp8_filter_across_rows = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__vp8_filter_across_rows_x86_sse42 :
+#endif
+        self->private_impl.choosy_vp8_filter_across_rows);
+
+    goto ok;
+    ok:
+    self->private_impl.p_do_decode_image_config_vp8[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_image_config_vp8[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[17].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[17].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_vp8
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_vp8(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  uint64_t v_n = 0;
+  uint64_t v_copied = 0;
+  uint32_t v_n_copied = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[18].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_vp8[0];
+  if (coro_susp_point) {
+    v_n = self->private_data.s_decode_vp8[0].v_n;
+    v_copied = self->private_data.s_decode_vp8[0].v_copied;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_n = ((uint64_t)(self->private_impl.f_vp8_data_length));
+    while (v_copied < v_n) {
+      if (v_n > ((uint64_t)(a_workbuf.len))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      v_n_copied = wuffs_base__io_reader__limited_copy_u32_to_slice(
+          &iop_a_src, io2_a_src,4294967295, wuffs_base__slice_u8__subslice_ij(a_workbuf, v_copied, v_n));
+      wuffs_base__u64__sat_add_indirect(&v_copied, ((uint64_t)(v_n_copied)));
+      if (v_copied >= v_n) {
+        goto label__fast__0__break;
+      }
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    label__fast__0__break:;
+    v_status = wuffs_webp__decoder__decode_vp8_macroblocks(self, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    v_status = wuffs_webp__decoder__swizzle_vp8(self, a_dst, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_n = ((uint64_t)(self->private_impl.f_vp8_data_length));
+    while (v_copied < v_n) {
+      if (v_n > ((uint64_t)(a_workbuf.len))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      v_n_copied = wuffs_base__io_reader__limited_copy_u32_to_slice(
+          &iop_a_src, io2_a_src,4294967295, wuffs_base__slice_u8__subslice_ij(a_workbuf, v_copied, v_n));
+      wuffs_base__u64__sat_add_indirect(&v_copied, ((uint64_t)(v_n_copied)));
+      if (v_copied >= v_n) {
+        goto label__0__break;
+      }
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    label__0__break:;
+    v_status = wuffs_webp__decoder__decode_vp8_macroblocks(self, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    v_status = wuffs_webp__decoder__swizzle_vp8(self, a_dst, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+
+    ok:
+    self->private_impl.p_decode_vp8[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_vp8[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_vp8[0].v_n = v_n;
+  self->private_data.s_decode_vp8[0].v_copied = v_copied;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[18].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[18].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_vp8_macroblocks
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_vp8_macroblocks(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  wuffs_base__slice_u8 v_data = {0};
+  uint32_t v_mb_x = 0;
+  uint32_t v_mb_y = 0;
+  uint32_t v_p = 0;
+  uint32_t v_f = 0;
+  uint32_t v_i = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[19].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (((uint64_t)(self->private_impl.f_vp8_data_length)) > ((uint64_t)(a_workbuf.len))) {
+    return wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+  }
+  v_data = wuffs_base__slice_u8__subslice_j(a_workbuf, ((uint64_t)(self->private_impl.f_vp8_data_length)));
+  v_status = wuffs_webp__decoder__vp8_parse_header(self, v_data);
+  if ( ! wuffs_base__status__is_ok(&v_status)) {
+    return wuffs_base__status__ensure_not_a_suspension(v_status);
+  }
+  v_i = 0;
+  while (v_i < 4096) {
+    self->private_data.f_vp8_intra_top[v_i] = 0;
+    v_i += 1;
+  }
+  v_i = 0;
+  while (v_i < 1024) {
+    self->private_data.f_vp8_nz_top[v_i] = 0;
+    self->private_data.f_vp8_nz_dc_top[v_i] = 0;
+    v_i += 1;
+  }
+  v_mb_y = 0;
+  while (v_mb_y < self->private_impl.f_vp8_mb_height) {
+    self->private_impl.f_vp8_intra_left[0] = 0;
+    self->private_impl.f_vp8_intra_left[1] = 0;
+    self->private_impl.f_vp8_intra_left[2] = 0;
+    self->private_impl.f_vp8_intra_left[3] = 0;
+    self->private_impl.f_vp8_nz_left = 0;
+    self->private_impl.f_vp8_nz_dc_left = 0;
+    v_p = (1 + (v_mb_y & (((uint32_t)(self->private_impl.f_vp8_n_partitions - 1)) & 7)));
+    if (v_p > self->private_impl.f_vp8_n_partitions) {
+      return wuffs_base__make_status(wuffs_webp__error__internal_error_inconsistent_i_o);
+    }
+    v_mb_x = 0;
+    while (v_mb_x < self->private_impl.f_vp8_mb_width) {
+      wuffs_webp__decoder__vp8_parse_modes(self, v_data, v_mb_x);
+      if (self->private_impl.f_vp8_bd_eofs[0]) {
+        return wuffs_base__make_status(wuffs_webp__error__bad_partition);
+      }
+      wuffs_webp__decoder__vp8_parse_residuals(self, v_data, v_p, v_mb_x);
+      if (self->private_impl.f_vp8_bd_eofs[v_p]) {
+        return wuffs_base__make_status(wuffs_webp__error__bad_partition);
+      }
+      if (self->private_impl.f_vp8_filter_type > 0) {
+        v_f = (2 * self->private_impl.f_vp8_mb_segment);
+        if (self->private_impl.f_vp8_mb_is_i4x4) {
+          v_f |= 9;
+        } else if ( ! self->private_impl.f_vp8_mb_skip) {
+          v_f |= 8;
+        }
+        self->private_data.f_vp8_mb_filters[v_mb_x] = ((uint8_t)(v_f));
+      }
+      wuffs_webp__decoder__vp8_reconstruct_macroblock(self, a_workbuf, v_mb_x, v_mb_y);
+      v_mb_x += 1;
+    }
+    if (self->private_impl.f_vp8_filter_type > 0) {
+      wuffs_webp__decoder__vp8_filter_macroblock_row(self, a_workbuf, v_mb_y);
+    }
+    v_mb_y += 1;
+  }
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func webp.decoder.vp8_parse_header
+
+static wuffs_base__status
+wuffs_webp__decoder__vp8_parse_header(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data) {
+  uint32_t v_c32 = 0;
+  uint32_t v_bit = 0;
+  bool v_absolute_delta = false;
+  uint32_t v_quantizers[4] = {0};
+  uint32_t v_filter_levels[4] = {0};
+  bool v_simple = false;
+  uint32_t v_level = 0;
+  uint32_t v_sharpness = 0;
+  bool v_use_lf_delta = false;
+  uint32_t v_ref_lf_delta = 0;
+  uint32_t v_mode_lf_delta = 0;
+  uint32_t v_s = 0;
+  uint32_t v_i = 0;
+  uint64_t v_n = 0;
+  wuffs_base__slice_u8 v_sizes = {0};
+  uint64_t v_psize = 0;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  uint32_t v_base_q = 0;
+  uint32_t v_deltas[5] = {0};
+  uint32_t v_quant = 0;
+  uint32_t v_fl = 0;
+  uint32_t v_flc = 0;
+  uint32_t v_ilevel = 0;
+  uint32_t v_prob = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[20].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  wuffs_webp__decoder__vp8_init_bool_decoder(self,
+      a_data,
+      0,
+      0,
+      ((uint64_t)(self->private_impl.f_vp8_first_partition_length)));
+  v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 2);
+  v_absolute_delta = true;
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  self->private_impl.f_vp8_use_segment = (v_bit != 0);
+  self->private_impl.f_vp8_update_segment_map = false;
+  if (self->private_impl.f_vp8_use_segment) {
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+    self->private_impl.f_vp8_update_segment_map = (v_bit != 0);
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+    if (v_bit != 0) {
+      v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+      v_absolute_delta = (v_bit != 0);
+      v_s = 0;
+      while (v_s < 4) {
+        v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+        if (v_bit != 0) {
+          v_quantizers[v_s] = wuffs_webp__decoder__vp8_read_signed(self, a_data, 7);
+        }
+        v_s += 1;
+      }
+      v_s = 0;
+      while (v_s < 4) {
+        v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+        if (v_bit != 0) {
+          v_filter_levels[v_s] = wuffs_webp__decoder__vp8_read_signed(self, a_data, 6);
+        }
+        v_s += 1;
+      }
+    }
+    if (self->private_impl.f_vp8_update_segment_map) {
+      v_s = 0;
+      while (v_s < 3) {
+        self->private_impl.f_vp8_segment_probs[v_s] = 255;
+        v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+        if (v_bit != 0) {
+          v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 8);
+          self->private_impl.f_vp8_segment_probs[v_s] = (v_c32 & 255);
+        }
+        v_s += 1;
+      }
+    }
+  }
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  v_simple = (v_bit != 0);
+  v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 6);
+  v_level = (v_c32 & 63);
+  v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 3);
+  v_sharpness = (v_c32 & 7);
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  v_use_lf_delta = (v_bit != 0);
+  v_bit = 0;
+  if (v_use_lf_delta) {
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  }
+  if (v_bit != 0) {
+    v_i = 0;
+    while (v_i < 8) {
+      v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+      if (v_bit != 0) {
+        v_c32 = wuffs_webp__decoder__vp8_read_signed(self, a_data, 6);
+        if (v_i == 0) {
+          v_ref_lf_delta = v_c32;
+        } else if (v_i == 4) {
+          v_mode_lf_delta = v_c32;
+        }
+      }
+      v_i += 1;
+    }
+  }
+  if (self->private_impl.f_vp8_bd_eofs[0]) {
+    return wuffs_base__make_status(wuffs_webp__error__bad_header);
+  }
+  if (v_level == 0) {
+    self->private_impl.f_vp8_filter_type = 0;
+  } else if (v_simple) {
+    self->private_impl.f_vp8_filter_type = 1;
+  } else {
+    self->private_impl.f_vp8_filter_type = 2;
+  }
+  v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 2);
+  self->private_impl.f_vp8_n_partitions = (((uint32_t)(1)) << wuffs_base__u32__min(v_c32, 3));
+  v_q = ((uint64_t)(self->private_impl.f_vp8_first_partition_length));
+  v_n = (3 * ((uint64_t)(((uint32_t)(self->private_impl.f_vp8_n_partitions - 1)))));
+  if (v_q > ((uint64_t)(a_data.len))) {
+    return wuffs_base__make_status(wuffs_webp__error__bad_partition);
+  }
+  v_sizes = wuffs_base__slice_u8__subslice_i(a_data, v_q);
+  if (v_n > ((uint64_t)(v_sizes.len))) {
+    return wuffs_base__make_status(wuffs_webp__error__bad_partition);
+  }
+  v_sizes = wuffs_base__slice_u8__subslice_j(v_sizes, v_n);
+  wuffs_base__u64__sat_add_indirect(&v_q, v_n);
+  v_i = 1;
+  while (v_i < self->private_impl.f_vp8_n_partitions) {
+    v_psize = 0;
+    if (((uint64_t)(v_sizes.len)) >= 3) {
+      v_psize = ((uint64_t)(wuffs_base__peek_u24le__no_bounds_check(v_sizes.ptr)));
+      v_sizes = wuffs_base__slice_u8__subslice_i(v_sizes, 3);
+    }
+    v_q_end = wuffs_base__u64__sat_add(v_q, v_psize);
+    if (v_q_end > ((uint64_t)(a_data.len))) {
+      v_q_end = ((uint64_t)(a_data.len));
+    }
+    wuffs_webp__decoder__vp8_init_bool_decoder(self,
+        a_data,
+        v_i,
+        v_q,
+        v_q_end);
+    v_q = v_q_end;
+    v_i += 1;
+  }
+  if (v_q >= ((uint64_t)(a_data.len))) {
+    return wuffs_base__make_status(wuffs_webp__error__bad_partition);
+  }
+  wuffs_webp__decoder__vp8_init_bool_decoder(self,
+      a_data,
+      self->private_impl.f_vp8_n_partitions,
+      v_q,
+      ((uint64_t)(a_data.len)));
+  v_base_q = wuffs_webp__decoder__vp8_read_literal(self, a_data, 7);
+  v_i = 0;
+  while (v_i < 5) {
+    v_deltas[v_i] = 0;
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+    if (v_bit != 0) {
+      v_deltas[v_i] = wuffs_webp__decoder__vp8_read_signed(self, a_data, 4);
+    }
+    v_i += 1;
+  }
+  v_s = 0;
+  while (v_s < 4) {
+    v_quant = v_base_q;
+    if (self->private_impl.f_vp8_use_segment) {
+      v_quant = v_quantizers[v_s];
+      if ( ! v_absolute_delta) {
+        v_quant += v_base_q;
+      }
+    }
+    self->private_impl.f_vp8_dequant[((6 * v_s) + 0)] = ((uint32_t)(WUFFS_WEBP__VP8_DC_QUANT[wuffs_webp__decoder__vp8_clamp(self, ((uint32_t)(v_quant + v_deltas[0])), 127)]));
+    self->private_impl.f_vp8_dequant[((6 * v_s) + 1)] = ((uint32_t)(WUFFS_WEBP__VP8_AC_QUANT[wuffs_webp__decoder__vp8_clamp(self, v_quant, 127)]));
+    self->private_impl.f_vp8_dequant[((6 * v_s) + 2)] = (((uint32_t)(WUFFS_WEBP__VP8_DC_QUANT[wuffs_webp__decoder__vp8_clamp(self, ((uint32_t)(v_quant + v_deltas[1])), 127)])) * 2);
+    self->private_impl.f_vp8_dequant[((6 * v_s) + 3)] = ((((uint32_t)(WUFFS_WEBP__VP8_AC_QUANT[wuffs_webp__decoder__vp8_clamp(self, ((uint32_t)(v_quant + v_deltas[2])), 127)])) * 101581) >> 16);
+    if (self->private_impl.f_vp8_dequant[((6 * v_s) + 3)] < 8) {
+      self->private_impl.f_vp8_dequant[((6 * v_s) + 3)] = 8;
+    }
+    self->private_impl.f_vp8_dequant[((6 * v_s) + 4)] = ((uint32_t)(WUFFS_WEBP__VP8_DC_QUANT[wuffs_webp__decoder__vp8_clamp(self, ((uint32_t)(v_quant + v_deltas[3])), 117)]));
+    self->private_impl.f_vp8_dequant[((6 * v_s) + 5)] = ((uint32_t)(WUFFS_WEBP__VP8_AC_QUANT[wuffs_webp__decoder__vp8_clamp(self, ((uint32_t)(v_quant + v_deltas[4])), 127)]));
+    v_s += 1;
+  }
+  v_i = 0;
+  while (v_i < 8) {
+    v_fl = v_level;
+    if (self->private_impl.f_vp8_use_segment) {
+      v_fl = v_filter_levels[(v_i >> 1)];
+      if ( ! v_absolute_delta) {
+        v_fl += v_level;
+      }
+    }
+    if (v_use_lf_delta) {
+      v_fl += v_ref_lf_delta;
+      if ((v_i & 1) != 0) {
+        v_fl += v_mode_lf_delta;
+      }
+    }
+    v_fl = wuffs_webp__decoder__vp8_clamp(self, v_fl, 63);
+    v_flc = wuffs_base__u32__min(v_fl, 63);
+    self->private_impl.f_vp8_filter_limits[v_i] = 0;
+    self->private_impl.f_vp8_filter_ilevels[v_i] = 0;
+    self->private_impl.f_vp8_filter_hev_thresholds[v_i] = 0;
+    if (v_flc > 0) {
+      v_ilevel = v_flc;
+      if (v_sharpness > 4) {
+        v_ilevel >>= 2;
+      } else if (v_sharpness > 0) {
+        v_ilevel >>= 1;
+      }
+      if ((v_sharpness > 0) && (v_ilevel > (9 - v_sharpness))) {
+        v_ilevel = (9 - v_sharpness);
+      }
+      if (v_ilevel < 1) {
+        v_ilevel = 1;
+      }
+      self->private_impl.f_vp8_filter_limits[v_i] = ((2 * v_flc) + v_ilevel);
+      self->private_impl.f_vp8_filter_ilevels[v_i] = v_ilevel;
+      if (v_flc >= 40) {
+        self->private_impl.f_vp8_filter_hev_thresholds[v_i] = 2;
+      } else if (v_flc >= 15) {
+        self->private_impl.f_vp8_filter_hev_thresholds[v_i] = 1;
+      }
+    }
+    v_i += 1;
+  }
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  v_i = 0;
+  while (v_i < 1056) {
+    v_prob = ((uint32_t)(WUFFS_WEBP__VP8_COEFF_PROBS_DEFAULT[v_i]));
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, ((uint32_t)(WUFFS_WEBP__VP8_COEFF_UPDATE_PROBS[v_i])));
+    if (v_bit != 0) {
+      v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 8);
+      v_prob = (v_c32 & 255);
+    }
+    self->private_data.f_vp8_coeff_probs[v_i] = ((uint8_t)(v_prob));
+    v_i += 1;
+  }
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  self->private_impl.f_vp8_use_skip = (v_bit != 0);
+  self->private_impl.f_vp8_skip_prob = 0;
+  if (self->private_impl.f_vp8_use_skip) {
+    v_c32 = wuffs_webp__decoder__vp8_read_literal(self, a_data, 8);
+    self->private_impl.f_vp8_skip_prob = (v_c32 & 255);
+  }
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func webp.decoder.vp8_clamp
+
+static uint32_t
+wuffs_webp__decoder__vp8_clamp(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_max) {
+  if (a_a >= 2147483648) {
+    return 0;
+  } else if (a_a > a_max) {
+    return a_max;
+  }
+  return wuffs_base__u32__min(a_a, 127);
+}
+
+// -------- func webp.decoder.vp8_init_bool_decoder
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_init_bool_decoder(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_p,
+    uint64_t a_start,
+    uint64_t a_end) {
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[21].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  self->private_impl.f_vp8_bd_values[a_p] = 0;
+  self->private_impl.f_vp8_bd_n_bits[a_p] = 0;
+  self->private_impl.f_vp8_bd_ranges[a_p] = 254;
+  self->private_impl.f_vp8_bd_positions[a_p] = a_start;
+  self->private_impl.f_vp8_bd_ends[a_p] = a_end;
+  self->private_impl.f_vp8_bd_eofs[a_p] = false;
+  wuffs_webp__decoder__vp8_load_bool_decoder(self, a_data, a_p);
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_load_bool_decoder
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_load_bool_decoder(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_p) {
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  wuffs_base__slice_u8 v_s = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[22].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_q = self->private_impl.f_vp8_bd_positions[a_p];
+  v_q_end = self->private_impl.f_vp8_bd_ends[a_p];
+  if ((v_q < v_q_end) && (v_q_end <= ((uint64_t)(a_data.len)))) {
+    v_s = wuffs_base__slice_u8__subslice_ij(a_data, v_q, v_q_end);
+    if (((uint64_t)(v_s.len)) >= 8) {
+      self->private_impl.f_vp8_bd_values[a_p] = (((uint64_t)(self->private_impl.f_vp8_bd_values[a_p] << 56)) | (wuffs_base__peek_u64be__no_bounds_check(v_s.ptr) >> 8));
+      self->private_impl.f_vp8_bd_n_bits[a_p] += 56;
+      self->private_impl.f_vp8_bd_positions[a_p] = ((uint64_t)(v_q + 7));
+    } else if (((uint64_t)(v_s.len)) > 0) {
+      self->private_impl.f_vp8_bd_values[a_p] = (((uint64_t)(self->private_impl.f_vp8_bd_values[a_p] << 8)) | ((uint64_t)(v_s.ptr[0])));
+      self->private_impl.f_vp8_bd_n_bits[a_p] += 8;
+      self->private_impl.f_vp8_bd_positions[a_p] = ((uint64_t)(v_q + 1));
+    }
+  } else if ( ! self->private_impl.f_vp8_bd_eofs[a_p]) {
+    self->private_impl.f_vp8_bd_values[a_p] = ((uint64_t)(self->private_impl.f_vp8_bd_values[a_p] << 8));
+    self->private_impl.f_vp8_bd_n_bits[a_p] += 8;
+    self->private_impl.f_vp8_bd_eofs[a_p] = true;
+  } else {
+    self->private_impl.f_vp8_bd_n_bits[a_p] = 8;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_read_bool
+
+static uint32_t
+wuffs_webp__decoder__vp8_read_bool(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_prob) {
+  uint64_t v_value = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_range = 0;
+  uint32_t v_pos = 0;
+  uint32_t v_split = 0;
+  uint32_t v_r = 0;
+  uint32_t v_shift = 0;
+  uint32_t v_bit = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[23].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (self->private_impl.f_vp8_bd_n_bits[0] < 8) {
+    wuffs_webp__decoder__vp8_load_bool_decoder(self, a_data, 0);
+  }
+  v_value = self->private_impl.f_vp8_bd_values[0];
+  v_n_bits = self->private_impl.f_vp8_bd_n_bits[0];
+  v_range = self->private_impl.f_vp8_bd_ranges[0];
+  v_pos = (((uint32_t)(v_n_bits - 8)) & 63);
+  v_split = ((v_range * a_prob) >> 8);
+  if ((v_value >> v_pos) > ((uint64_t)(v_split))) {
+    v_r = (((uint32_t)(v_range - v_split)) & 255);
+    v_value -= ((uint64_t)(((uint64_t)((v_split + 1))) << v_pos));
+    v_bit = 1;
+  } else {
+    v_r = (v_split + 1);
+    v_bit = 0;
+  }
+  v_shift = ((uint32_t)(WUFFS_WEBP__VP8_NORM_SHIFTS[v_r]));
+  self->private_impl.f_vp8_bd_ranges[0] = (((uint32_t)((v_r << v_shift) - 1)) & 255);
+  self->private_impl.f_vp8_bd_n_bits[0] = ((uint32_t)(v_n_bits - v_shift));
+  self->private_impl.f_vp8_bd_values[0] = v_value;
+  return v_bit;
+}
+
+// -------- func webp.decoder.vp8_read_literal
+
+static uint32_t
+wuffs_webp__decoder__vp8_read_literal(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_n) {
+  uint32_t v_ret = 0;
+  uint32_t v_n = 0;
+  uint32_t v_bit = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[24].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_n = a_n;
+  while (v_n > 0) {
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+    v_ret = (((uint32_t)(v_ret << 1)) | v_bit);
+    v_n -= 1;
+  }
+  return v_ret;
+}
+
+// -------- func webp.decoder.vp8_read_signed
+
+static uint32_t
+wuffs_webp__decoder__vp8_read_signed(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_n) {
+  uint32_t v_ret = 0;
+  uint32_t v_bit = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[25].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_ret = wuffs_webp__decoder__vp8_read_literal(self, a_data, a_n);
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+  if (v_bit != 0) {
+    v_ret = ((uint32_t)(0 - v_ret));
+  }
+  return v_ret;
+}
+
+// -------- func webp.decoder.vp8_parse_modes
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_parse_modes(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_mb_x) {
+  uint32_t v_bit = 0;
+  uint32_t v_mode = 0;
+  uint32_t v_top = 0;
+  uint32_t v_x = 0;
+  uint32_t v_y = 0;
+  uint32_t v_t = 0;
+  uint32_t v_bi = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[26].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  self->private_impl.f_vp8_mb_segment = 0;
+  if (self->private_impl.f_vp8_update_segment_map) {
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, self->private_impl.f_vp8_segment_probs[0]);
+    if (v_bit == 0) {
+      self->private_impl.f_vp8_mb_segment = wuffs_webp__decoder__vp8_read_bool(self, a_data, self->private_impl.f_vp8_segment_probs[1]);
+    } else {
+      v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, self->private_impl.f_vp8_segment_probs[2]);
+      self->private_impl.f_vp8_mb_segment = (2 + v_bit);
+    }
+  }
+  self->private_impl.f_vp8_mb_skip = false;
+  if (self->private_impl.f_vp8_use_skip) {
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, self->private_impl.f_vp8_skip_prob);
+    self->private_impl.f_vp8_mb_skip = (v_bit != 0);
+  }
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 145);
+  self->private_impl.f_vp8_mb_is_i4x4 = (v_bit == 0);
+  if ( ! self->private_impl.f_vp8_mb_is_i4x4) {
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 156);
+    if (v_bit != 0) {
+      v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 128);
+      if (v_bit != 0) {
+        self->private_impl.f_vp8_mb_ymode = 1;
+      } else {
+        self->private_impl.f_vp8_mb_ymode = 3;
+      }
+    } else {
+      v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 163);
+      self->private_impl.f_vp8_mb_ymode = (2 * v_bit);
+    }
+    v_mode = self->private_impl.f_vp8_mb_ymode;
+    v_x = 0;
+    while (v_x < 4) {
+      self->private_data.f_vp8_intra_top[((4 * a_mb_x) + v_x)] = ((uint8_t)(v_mode));
+      self->private_impl.f_vp8_intra_left[v_x] = v_mode;
+      v_x += 1;
+    }
+  } else {
+    v_y = 0;
+    while (v_y < 4) {
+      v_mode = self->private_impl.f_vp8_intra_left[v_y];
+      v_x = 0;
+      while (v_x < 4) {
+        v_top = ((uint32_t)(self->private_data.f_vp8_intra_top[((4 * a_mb_x) + v_x)]));
+        v_bi = ((wuffs_base__u32__min(v_top, 9) * 90) + (v_mode * 9));
+        v_t = 0;
+        while (true) {
+          v_t = wuffs_base__u32__min(v_t, 8);
+          v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, ((uint32_t)(WUFFS_WEBP__VP8_BMODE_PROBS[(v_bi + v_t)])));
+          v_t = ((uint32_t)(WUFFS_WEBP__VP8_BMODE_TREE[((2 * v_t) + v_bit)]));
+          if (v_t >= 128) {
+            goto label__0__break;
+          }
+        }
+        label__0__break:;
+        v_t &= 15;
+        v_mode = wuffs_base__u32__min(v_t, 9);
+        self->private_data.f_vp8_intra_top[((4 * a_mb_x) + v_x)] = ((uint8_t)(v_mode));
+        self->private_impl.f_vp8_mb_bmodes[((4 * v_y) + v_x)] = v_mode;
+        v_x += 1;
+      }
+      self->private_impl.f_vp8_intra_left[v_y] = v_mode;
+      v_y += 1;
+    }
+  }
+  self->private_impl.f_vp8_mb_uvmode = 0;
+  v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 142);
+  if (v_bit != 0) {
+    self->private_impl.f_vp8_mb_uvmode = 2;
+    v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 114);
+    if (v_bit != 0) {
+      self->private_impl.f_vp8_mb_uvmode = 3;
+      v_bit = wuffs_webp__decoder__vp8_read_bool(self, a_data, 183);
+      if (v_bit != 0) {
+        self->private_impl.f_vp8_mb_uvmode = 1;
+      }
+    }
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_parse_residuals
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_parse_residuals(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_data,
+    uint32_t a_p,
+    uint32_t a_mb_x) {
+  uint64_t v_value = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_range = 0;
+  bool v_eof = false;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  wuffs_base__slice_u8 v_s = {0};
+  uint32_t v_pos = 0;
+  uint32_t v_prob = 0;
+  uint32_t v_split = 0;
+  uint32_t v_r = 0;
+  uint32_t v_shift = 0;
+  uint32_t v_bit = 0;
+  uint32_t v_tnz = 0;
+  uint32_t v_lnz = 0;
+  uint32_t v_b = 0;
+  uint32_t v_t_base = 0;
+  uint32_t v_first = 0;
+  uint32_t v_dq_base = 0;
+  uint32_t v_dq = 0;
+  uint32_t v_o_base = 0;
+  uint32_t v_ctx_x11 = 0;
+  uint32_t v_shifts = 0;
+  uint32_t v_n = 0;
+  uint32_t v_pi = 0;
+  uint32_t v_pj = 0;
+  uint32_t v_node = 0;
+  uint32_t v_token = 0;
+  uint32_t v_v = 0;
+  uint32_t v_j = 0;
+  uint32_t v_j_end = 0;
+  uint32_t v_c = 0;
+  uint32_t v_l = 0;
+  uint32_t v_k = 0;
+  bool v_nonzero = false;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[27].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_k = 0;
+  while (v_k < 24) {
+    self->private_impl.f_vp8_mb_block_kinds[v_k] = 0;
+    v_k += 1;
+  }
+  if (self->private_impl.f_vp8_use_skip && self->private_impl.f_vp8_mb_skip) {
+    self->private_data.f_vp8_nz_top[a_mb_x] = 0;
+    self->private_impl.f_vp8_nz_left = 0;
+    if ( ! self->private_impl.f_vp8_mb_is_i4x4) {
+      self->private_data.f_vp8_nz_dc_top[a_mb_x] = 0;
+      self->private_impl.f_vp8_nz_dc_left = 0;
+    }
+    return wuffs_base__make_empty_struct();
+  }
+  v_value = self->private_impl.f_vp8_bd_values[a_p];
+  v_n_bits = self->private_impl.f_vp8_bd_n_bits[a_p];
+  v_range = self->private_impl.f_vp8_bd_ranges[a_p];
+  v_eof = self->private_impl.f_vp8_bd_eofs[a_p];
+  v_q = self->private_impl.f_vp8_bd_positions[a_p];
+  v_q_end = self->private_impl.f_vp8_bd_ends[a_p];
+  if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(a_data.len)))) {
+    self->private_impl.f_vp8_bd_eofs[a_p] = true;
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_ij(a_data, v_q, v_q_end);
+  v_tnz = ((uint32_t)(self->private_data.f_vp8_nz_top[a_mb_x]));
+  v_lnz = self->private_impl.f_vp8_nz_left;
+  v_dq_base = (6 * self->private_impl.f_vp8_mb_segment);
+  v_b = 24;
+  if (self->private_impl.f_vp8_mb_is_i4x4) {
+    v_b = 0;
+  }
+  label__0__continue:;
+  while (v_b < 25) {
+    if (v_b >= 24) {
+      v_t_base = 264;
+      v_first = 0;
+      v_dq = (v_dq_base + 2);
+      v_o_base = 384;
+      v_ctx_x11 = ((11 * (((uint32_t)(self->private_data.f_vp8_nz_dc_top[a_mb_x])) & 1)) + (11 * (self->private_impl.f_vp8_nz_dc_left & 1)));
+    } else {
+      if (v_b < 16) {
+        if (self->private_impl.f_vp8_mb_is_i4x4) {
+          v_t_base = 792;
+          v_first = 0;
+        } else {
+          v_t_base = 0;
+          v_first = 1;
+        }
+        v_dq = v_dq_base;
+      } else {
+        v_t_base = 528;
+        v_first = 0;
+        v_dq = (v_dq_base + 4);
+      }
+      v_o_base = (16 * v_b);
+      v_shifts = ((uint32_t)(WUFFS_WEBP__VP8_NZ_SHIFTS[v_b]));
+      v_ctx_x11 = ((11 * ((v_tnz >> (v_shifts & 15)) & 1)) + (11 * ((v_lnz >> (v_shifts >> 4)) & 1)));
+    }
+    v_n = v_first;
+    v_pi = (v_t_base + ((uint32_t)(WUFFS_WEBP__VP8_BANDS_X33[v_n])) + v_ctx_x11);
+    while (v_n < 16) {
+      v_prob = ((uint32_t)(self->private_data.f_vp8_coeff_probs[v_pi]));
+      if (v_n_bits < 8) {
+        if (((uint64_t)(v_s.len)) >= 8) {
+          v_value = (((uint64_t)(v_value << 56)) | (wuffs_base__peek_u64be__no_bounds_check(v_s.ptr) >> 8));
+          v_s = wuffs_base__slice_u8__subslice_i(v_s, 7);
+          v_n_bits += 56;
+        } else if (((uint64_t)(v_s.len)) > 0) {
+          v_value = (((uint64_t)(v_value << 8)) | ((uint64_t)(v_s.ptr[0])));
+          v_s = wuffs_base__slice_u8__subslice_i(v_s, 1);
+          v_n_bits += 8;
+        } else if ( ! v_eof) {
+          v_value <<= 8;
+          v_n_bits += 8;
+          v_eof = true;
+        } else {
+          v_n_bits = 8;
+        }
+      }
+      v_pos = (((uint32_t)(v_n_bits - 8)) & 63);
+      v_split = ((v_range * v_prob) >> 8);
+      if ((v_value >> v_pos) > ((uint64_t)(v_split))) {
+        v_r = (((uint32_t)(v_range - v_split)) & 255);
+        v_value -= ((uint64_t)(((uint64_t)((v_split + 1))) << v_pos));
+        v_bit = 1;
+      } else {
+        v_r = (v_split + 1);
+        v_bit = 0;
+      }
+      v_shift = ((uint32_t)(WUFFS_WEBP__VP8_NORM_SHIFTS[v_r]));
+      v_range = (((uint32_t)((v_r << v_shift) - 1)) & 255);
+      v_n_bits -= v_shift;
+      if (v_bit == 0) {
+        goto label__coeffs__break;
+      }
+      while (true) {
+        v_pj = (v_pi + 1);
+        v_prob = ((uint32_t)(self->private_data.f_vp8_coeff_probs[wuffs_base__u32__min(v_pj, 1055)]));
+        if (v_n_bits < 8) {
+          if (((uint64_t)(v_s.len)) >= 8) {
+            v_value = (((uint64_t)(v_value << 56)) | (wuffs_base__peek_u64be__no_bounds_check(v_s.ptr) >> 8));
+            v_s = wuffs_base__slice_u8__subslice_i(v_s, 7);
+            v_n_bits += 56;
+          } else if (((uint64_t)(v_s.len)) > 0) {
+            v_value = (((uint64_t)(v_value << 8)) | ((uint64_t)(v_s.ptr[0])));
+            v_s = wuffs_base__slice_u8__subslice_i(v_s, 1);
+            v_n_bits += 8;
+          } else if ( ! v_eof) {
+            v_value <<= 8;
+            v_n_bits += 8;
+            v_eof = true;
+          } else {
+            v_n_bits = 8;
+          }
+        }
+        v_pos = (((uint32_t)(v_n_bits - 8)) & 63);
+        v_split = ((v_range * v_prob) >> 8);
+        if ((v_value >> v_pos) > ((uint64_t)(v_split))) {
+          v_r = (((uint32_t)(v_range - v_split)) & 255);
+          v_value -= ((uint64_t)(((uint64_t)((v_split + 1))) << v_pos));
+          v_bit = 1;
+        } else {
+          v_r = (v_split + 1);
+          v_bit = 0;
+        }
+        v_shift = ((uint32_t)(WUFFS_WEBP__VP8_NORM_SHIFTS[v_r]));
+        v_range = (((uint32_t)((v_r << v_shift) - 1)) & 255);
+        v_n_bits -= v_shift;
+        if (v_bit != 0) {
+          goto label__1__break;
+        }
+        v_n += 1;
+        if (v_n >= 16) {
+          goto label__coeffs__break;
+        }
+        v_pi = (v_t_base + ((uint32_t)(WUFFS_WEBP__VP8_BANDS_X33[v_n])));
+      }
+      label__1__break:;
+      v_node = 4;
+      while (true) {
+        v_pj = (v_pi + (v_node >> 1));
+        v_prob = ((uint32_t)(self->private_data.f_vp8_coeff_probs[wuffs_base__u32__min(v_pj, 1055)]));
+        if (v_n_bits < 8) {
+          if (((uint64_t)(v_s.len)) >= 8) {
+            v_value = (((uint64_t)(v_value << 56)) | (wuffs_base__peek_u64be__no_bounds_check(v_s.ptr) >> 8));
+            v_s = wuffs_base__slice_u8__subslice_i(v_s, 7);
+            v_n_bits += 56;
+          } else if (((uint64_t)(v_s.len)) > 0) {
+            v_value = (((uint64_t)(v_value << 8)) | ((uint64_t)(v_s.ptr[0])));
+            v_s = wuffs_base__slice_u8__subslice_i(v_s, 1);
+            v_n_bits += 8;
+          } else if ( ! v_eof) {
+            v_value <<= 8;
+            v_n_bits += 8;
+            v_eof = true;
+          } else {
+            v_n_bits = 8;
+          }
+        }
+        v_pos = (((uint32_t)(v_n_bits - 8)) & 63);
+        v_split = ((v_range * v_prob) >> 8);
+        if ((v_value >> v_pos) > ((uint64_t)(v_split))) {
+          v_r = (((uint32_t)(v_range - v_split)) & 255);
+          v_value -= ((uint64_t)(((uint64_t)((v_split + 1))) << v_pos));
+          v_bit = 1;
+        } else {
+          v_r = (v_split + 1);
+          v_bit = 0;
+        }
+        v_shift = ((uint32_t)(WUFFS_WEBP__VP8_NORM_SHIFTS[v_r]));
+        v_range = (((uint32_t)((v_r << v_shift) - 1)) & 255);
+        v_n_bits -= v_shift;
+        v_node = ((uint32_t)(WUFFS_WEBP__VP8_COEFF_TREE[(wuffs_base__u32__min(v_node, 20) + v_bit)]));
+        if (v_node >= 128) {
+          goto label__2__break;
+        }
+      }
+      label__2__break:;
+      v_node &= 15;
+      v_token = wuffs_base__u32__min(v_node, 10);
+      v_v = ((uint32_t)(WUFFS_WEBP__VP8_TOKEN_BASES[v_token]));
+      v_j = ((uint32_t)(WUFFS_WEBP__VP8_TOKEN_EXTRA_PROBS_OFFSETS[v_token]));
+      v_j_end = ((uint32_t)(WUFFS_WEBP__VP8_TOKEN_EXTRA_PROBS_OFFSETS[(v_token + 1)]));
+      if (v_j < v_j_end) {
+        v_c = 0;
+        while (v_j < v_j_end) {
+          v_prob = ((uint32_t)(WUFFS_WEBP__VP8_TOKEN_EXTRA_PROBS[v_j]));
+          if (v_n_bits < 8) {
+            if (((uint64_t)(v_s.len)) >= 8) {
+              v_value = (((uint64_t)(v_value << 56)) | (wuffs_base__peek_u64be__no_bounds_check(v_s.ptr) >> 8));
+              v_s = wuffs_base__slice_u8__subslice_i(v_s, 7);
+              v_n_bits += 56;
+            } else if (((uint64_t)(v_s.len)) > 0) {
+              v_value = (((uint64_t)(v_value << 8)) | ((uint64_t)(v_s.ptr[0])));
+              v_s = wuffs_base__slice_u8__subslice_i(v_s, 1);
+              v_n_bits += 8;
+            } else if ( ! v_eof) {
+              v_value <<= 8;
+              v_n_bits += 8;
+              v_eof = true;
+            } else {
+              v_n_bits = 8;
+            }
+          }
+          v_pos = (((uint32_t)(v_n_bits - 8)) & 63);
+          v_split = ((v_range * v_prob) >> 8);
+          if ((v_value >> v_pos) > ((uint64_t)(v_split))) {
+            v_r = (((uint32_t)(v_range - v_split)) & 255);
+            v_value -= ((uint64_t)(((uint64_t)((v_split + 1))) << v_pos));
+            v_bit = 1;
+          } else {
+            v_r = (v_split + 1);
+            v_bit = 0;
+          }
+          v_shift = ((uint32_t)(WUFFS_WEBP__VP8_NORM_SHIFTS[v_r]));
+          v_range = (((uint32_t)((v_r << v_shift) - 1)) & 255);
+          v_n_bits -= v_shift;
+          v_c = (((uint32_t)(v_c << 1)) | v_bit);
+          v_j += 1;
+        }
+        v_v += v_c;
+      }
+      if (v_n_bits < 8) {
+        if (((uint64_t)(v_s.len)) >= 8) {
+          v_value = (((uint64_t)(v_value << 56)) | (wuffs_base__peek_u64be__no_bounds_check(v_s.ptr) >> 8));
+          v_s = wuffs_base__slice_u8__subslice_i(v_s, 7);
+          v_n_bits += 56;
+        } else if (((uint64_t)(v_s.len)) > 0) {
+          v_value = (((uint64_t)(v_value << 8)) | ((uint64_t)(v_s.ptr[0])));
+          v_s = wuffs_base__slice_u8__subslice_i(v_s, 1);
+          v_n_bits += 8;
+        } else if ( ! v_eof) {
+          v_value <<= 8;
+          v_n_bits += 8;
+          v_eof = true;
+        } else {
+          v_n_bits = 8;
+        }
+      }
+      v_pos = (((uint32_t)(v_n_bits - 8)) & 63);
+      v_split = (v_range >> 1);
+      if ((v_value >> v_pos) > ((uint64_t)(v_split))) {
+        v_r = (((uint32_t)(v_range - v_split)) & 255);
+        v_value -= ((uint64_t)(((uint64_t)((v_split + 1))) << v_pos));
+        v_bit = 1;
+      } else {
+        v_r = (v_split + 1);
+        v_bit = 0;
+      }
+      v_shift = ((uint32_t)(WUFFS_WEBP__VP8_NORM_SHIFTS[v_r]));
+      v_range = (((uint32_t)((v_r << v_shift) - 1)) & 255);
+      v_n_bits -= v_shift;
+      if (v_n > 0) {
+        v_c = ((uint32_t)(v_v * self->private_impl.f_vp8_dequant[(v_dq + 1)]));
+      } else {
+        v_c = ((uint32_t)(v_v * self->private_impl.f_vp8_dequant[v_dq]));
+      }
+      if (v_bit != 0) {
+        v_c = ((uint32_t)(0 - v_c));
+      }
+      self->private_data.f_vp8_coeffs[(v_o_base + ((uint32_t)(WUFFS_WEBP__VP8_ZIGZAG[v_n])))] = ((uint16_t)((v_c & 65535)));
+      if (v_token == 1) {
+        v_ctx_x11 = 11;
+      } else {
+        v_ctx_x11 = 22;
+      }
+      v_n += 1;
+      v_pi = (v_t_base + ((uint32_t)(WUFFS_WEBP__VP8_BANDS_X33[v_n])) + v_ctx_x11);
+    }
+    label__coeffs__break:;
+    if (v_b >= 24) {
+      if (v_n > 0) {
+        self->private_data.f_vp8_nz_dc_top[a_mb_x] = 1;
+        self->private_impl.f_vp8_nz_dc_left = 1;
+      } else {
+        self->private_data.f_vp8_nz_dc_top[a_mb_x] = 0;
+        self->private_impl.f_vp8_nz_dc_left = 0;
+      }
+      wuffs_webp__decoder__vp8_inverse_wht(self, v_n);
+      v_b = 0;
+      goto label__0__continue;
+    }
+    if (v_n > v_first) {
+      v_l = 1;
+    } else {
+      v_l = 0;
+    }
+    v_tnz = ((v_tnz & (4294967295 ^ (((uint32_t)(1)) << (v_shifts & 15)))) | (v_l << (v_shifts & 15)));
+    v_lnz = ((v_lnz & (4294967295 ^ (((uint32_t)(1)) << (v_shifts >> 4)))) | (v_l << (v_shifts >> 4)));
+    if (v_n > 1) {
+      self->private_impl.f_vp8_mb_block_kinds[v_b] = 2;
+      v_nonzero = true;
+    } else if (self->private_data.f_vp8_coeffs[v_o_base] != 0) {
+      self->private_impl.f_vp8_mb_block_kinds[v_b] = 1;
+      v_nonzero = true;
+    }
+    v_b += 1;
+    if (v_b == 24) {
+      goto label__0__break;
+    }
+  }
+  label__0__break:;
+  self->private_impl.f_vp8_mb_skip =  ! v_nonzero;
+  self->private_data.f_vp8_nz_top[a_mb_x] = ((uint8_t)((v_tnz & 255)));
+  self->private_impl.f_vp8_nz_left = v_lnz;
+  self->private_impl.f_vp8_bd_values[a_p] = v_value;
+  self->private_impl.f_vp8_bd_n_bits[a_p] = v_n_bits;
+  self->private_impl.f_vp8_bd_ranges[a_p] = v_range;
+  self->private_impl.f_vp8_bd_eofs[a_p] = v_eof;
+  self->private_impl.f_vp8_bd_positions[a_p] = ((uint64_t)(v_q_end - ((uint64_t)(v_s.len))));
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_inverse_wht
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_inverse_wht(
+    wuffs_webp__decoder* self,
+    uint32_t a_n) {
+  uint32_t v_tmp[16] = {0};
+  uint32_t v_i = 0;
+  uint32_t v_a0 = 0;
+  uint32_t v_a1 = 0;
+  uint32_t v_a2 = 0;
+  uint32_t v_a3 = 0;
+  uint32_t v_dc = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[28].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (a_n > 1) {
+    v_i = 0;
+    while (v_i < 4) {
+      v_a0 = ((uint32_t)(wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(384 + v_i)]) + wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(396 + v_i)])));
+      v_a1 = ((uint32_t)(wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(388 + v_i)]) + wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(392 + v_i)])));
+      v_a2 = ((uint32_t)(wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(388 + v_i)]) - wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(392 + v_i)])));
+      v_a3 = ((uint32_t)(wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(384 + v_i)]) - wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(396 + v_i)])));
+      v_tmp[(0 + v_i)] = ((uint32_t)(v_a0 + v_a1));
+      v_tmp[(8 + v_i)] = ((uint32_t)(v_a0 - v_a1));
+      v_tmp[(4 + v_i)] = ((uint32_t)(v_a3 + v_a2));
+      v_tmp[(12 + v_i)] = ((uint32_t)(v_a3 - v_a2));
+      v_i += 1;
+    }
+    v_i = 0;
+    while (v_i < 4) {
+      v_dc = ((uint32_t)(v_tmp[((4 * v_i) + 0)] + 3));
+      v_a0 = ((uint32_t)(v_dc + v_tmp[((4 * v_i) + 3)]));
+      v_a1 = ((uint32_t)(v_tmp[((4 * v_i) + 1)] + v_tmp[((4 * v_i) + 2)]));
+      v_a2 = ((uint32_t)(v_tmp[((4 * v_i) + 1)] - v_tmp[((4 * v_i) + 2)]));
+      v_a3 = ((uint32_t)(v_dc - v_tmp[((4 * v_i) + 3)]));
+      self->private_data.f_vp8_coeffs[((64 * v_i) + 0)] = ((uint16_t)((wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_a0 + v_a1)), 3) & 65535)));
+      self->private_data.f_vp8_coeffs[((64 * v_i) + 16)] = ((uint16_t)((wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_a3 + v_a2)), 3) & 65535)));
+      self->private_data.f_vp8_coeffs[((64 * v_i) + 32)] = ((uint16_t)((wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_a0 - v_a1)), 3) & 65535)));
+      self->private_data.f_vp8_coeffs[((64 * v_i) + 48)] = ((uint16_t)((wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_a3 - v_a2)), 3) & 65535)));
+      v_i += 1;
+    }
+  } else {
+    v_dc = wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[384]) + 3)), 3);
+    v_i = 0;
+    while (v_i < 16) {
+      self->private_data.f_vp8_coeffs[(16 * v_i)] = ((uint16_t)((v_dc & 65535)));
+      v_i += 1;
+    }
+  }
+  v_i = 384;
+  while (v_i < 400) {
+    self->private_data.f_vp8_coeffs[v_i] = 0;
+    v_i += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_idct_add
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_idct_add(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_b) {
+  uint32_t v_tmp[16] = {0};
+  uint32_t v_o = 0;
+  uint32_t v_i = 0;
+  uint32_t v_i0 = 0;
+  uint32_t v_i4 = 0;
+  uint32_t v_i8 = 0;
+  uint32_t v_i12 = 0;
+  uint32_t v_a = 0;
+  uint32_t v_b = 0;
+  uint32_t v_c = 0;
+  uint32_t v_d = 0;
+  uint32_t v_row = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[29].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_o = (16 * a_b);
+  v_i = 0;
+  while (v_i < 4) {
+    v_i0 = wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(v_o + v_i + 0)]);
+    v_i4 = wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(v_o + v_i + 4)]);
+    v_i8 = wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(v_o + v_i + 8)]);
+    v_i12 = wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(v_o + v_i + 12)]);
+    v_a = ((uint32_t)(v_i0 + v_i8));
+    v_b = ((uint32_t)(v_i0 - v_i8));
+    v_c = ((uint32_t)(wuffs_webp__decoder__vp8_mul2(self, v_i4) - wuffs_webp__decoder__vp8_mul1(self, v_i12)));
+    v_d = ((uint32_t)(wuffs_webp__decoder__vp8_mul1(self, v_i4) + wuffs_webp__decoder__vp8_mul2(self, v_i12)));
+    v_tmp[((4 * v_i) + 0)] = ((uint32_t)(v_a + v_d));
+    v_tmp[((4 * v_i) + 1)] = ((uint32_t)(v_b + v_c));
+    v_tmp[((4 * v_i) + 2)] = ((uint32_t)(v_b - v_c));
+    v_tmp[((4 * v_i) + 3)] = ((uint32_t)(v_a - v_d));
+    v_i += 1;
+  }
+  v_i = 0;
+  while (v_i < 16) {
+    self->private_data.f_vp8_coeffs[(v_o + v_i)] = 0;
+    v_i += 1;
+  }
+  v_i = 0;
+  while (v_i < 4) {
+    v_i0 = ((uint32_t)(v_tmp[(v_i + 0)] + 4));
+    v_a = ((uint32_t)(v_i0 + v_tmp[(v_i + 8)]));
+    v_b = ((uint32_t)(v_i0 - v_tmp[(v_i + 8)]));
+    v_c = ((uint32_t)(wuffs_webp__decoder__vp8_mul2(self, v_tmp[(v_i + 4)]) - wuffs_webp__decoder__vp8_mul1(self, v_tmp[(v_i + 12)])));
+    v_d = ((uint32_t)(wuffs_webp__decoder__vp8_mul1(self, v_tmp[(v_i + 4)]) + wuffs_webp__decoder__vp8_mul2(self, v_tmp[(v_i + 12)])));
+    v_row = (a_tl + 33 + (32 * v_i));
+    self->private_data.f_vp8_mb[(v_row + 0)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 0)], wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_a + v_d)), 3));
+    self->private_data.f_vp8_mb[(v_row + 1)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 1)], wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_b + v_c)), 3));
+    self->private_data.f_vp8_mb[(v_row + 2)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 2)], wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_b - v_c)), 3));
+    self->private_data.f_vp8_mb[(v_row + 3)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 3)], wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(v_a - v_d)), 3));
+    v_i += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_mul1
+
+static uint32_t
+wuffs_webp__decoder__vp8_mul1(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a) {
+  return ((uint32_t)(wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(a_a * 20091)), 16) + a_a));
+}
+
+// -------- func webp.decoder.vp8_mul2
+
+static uint32_t
+wuffs_webp__decoder__vp8_mul2(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a) {
+  return wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(a_a * 35468)), 16);
+}
+
+// -------- func webp.decoder.vp8_filter_across_cols
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_cols(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_rows,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  return (*self->private_impl.choosy_vp8_filter_across_cols)(self, a_pix, a_stride, a_n_rows, a_kind, a_limit, a_ilevel, a_hev);
+}
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_cols__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_rows,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  wuffs_base__slice_u8 v_s = {0};
+  uint32_t v_n = 0;
+  uint64_t v_x = 0;
+  uint64_t v_y = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[30].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_s = a_pix;
+  v_n = a_n_rows;
+  while (v_n > 0) {
+    if (((uint64_t)(v_s.len)) < 8) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_x = wuffs_base__peek_u64le__no_bounds_check(v_s.ptr);
+    v_y = wuffs_webp__decoder__vp8_filter_pixels(self,
+        v_x,
+        a_kind,
+        ((2 * a_limit) + 1),
+        a_ilevel,
+        a_hev);
+    if (v_x != v_y) {
+      wuffs_base__poke_u64le__no_bounds_check(v_s.ptr, v_y);
+    }
+    v_n -= 1;
+    if (a_stride > ((uint64_t)(v_s.len))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_filter_across_rows
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_rows(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_cols,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  return (*self->private_impl.choosy_vp8_filter_across_rows)(self, a_pix, a_stride, a_n_cols, a_kind, a_limit, a_ilevel, a_hev);
+}
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_rows__choosy_default(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_cols,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  wuffs_base__slice_u8 v_s = {0};
+  wuffs_base__slice_u8 v_s0 = {0};
+  wuffs_base__slice_u8 v_s1 = {0};
+  wuffs_base__slice_u8 v_s2 = {0};
+  wuffs_base__slice_u8 v_s3 = {0};
+  wuffs_base__slice_u8 v_s4 = {0};
+  wuffs_base__slice_u8 v_s5 = {0};
+  wuffs_base__slice_u8 v_s6 = {0};
+  wuffs_base__slice_u8 v_s7 = {0};
+  wuffs_base__slice_u8 v_r0 = {0};
+  wuffs_base__slice_u8 v_r1 = {0};
+  wuffs_base__slice_u8 v_r2 = {0};
+  wuffs_base__slice_u8 v_r3 = {0};
+  wuffs_base__slice_u8 v_r4 = {0};
+  wuffs_base__slice_u8 v_r5 = {0};
+  wuffs_base__slice_u8 v_r6 = {0};
+  wuffs_base__slice_u8 v_r7 = {0};
+  uint64_t v_n = 0;
+  uint64_t v_x = 0;
+  uint64_t v_y = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[31].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_n = ((uint64_t)(a_n_cols));
+  v_s = a_pix;
+  if (v_n > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s0 = wuffs_base__slice_u8__subslice_j(v_s, v_n);
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s1 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s2 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s3 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s4 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s5 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s6 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s7 = v_s;
+  {
+    wuffs_base__slice_u8 i_slice_r0 = v_s0;
+    v_r0.ptr = i_slice_r0.ptr;
+    wuffs_base__slice_u8 i_slice_r1 = v_s1;
+    v_r1.ptr = i_slice_r1.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r1.len)));
+    wuffs_base__slice_u8 i_slice_r2 = v_s2;
+    v_r2.ptr = i_slice_r2.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r2.len)));
+    wuffs_base__slice_u8 i_slice_r3 = v_s3;
+    v_r3.ptr = i_slice_r3.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r3.len)));
+    wuffs_base__slice_u8 i_slice_r4 = v_s4;
+    v_r4.ptr = i_slice_r4.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r4.len)));
+    wuffs_base__slice_u8 i_slice_r5 = v_s5;
+    v_r5.ptr = i_slice_r5.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r5.len)));
+    wuffs_base__slice_u8 i_slice_r6 = v_s6;
+    v_r6.ptr = i_slice_r6.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r6.len)));
+    wuffs_base__slice_u8 i_slice_r7 = v_s7;
+    v_r7.ptr = i_slice_r7.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r7.len)));
+    v_r0.len = 1;
+    v_r1.len = 1;
+    v_r2.len = 1;
+    v_r3.len = 1;
+    v_r4.len = 1;
+    v_r5.len = 1;
+    v_r6.len = 1;
+    v_r7.len = 1;
+    uint8_t* i_end0_r0 = i_slice_r0.ptr + i_slice_r0.len;
+    while (v_r0.ptr < i_end0_r0) {
+      v_x = ((((uint64_t)(v_r0.ptr[0])) << 0) |
+          (((uint64_t)(v_r1.ptr[0])) << 8) |
+          (((uint64_t)(v_r2.ptr[0])) << 16) |
+          (((uint64_t)(v_r3.ptr[0])) << 24) |
+          (((uint64_t)(v_r4.ptr[0])) << 32) |
+          (((uint64_t)(v_r5.ptr[0])) << 40) |
+          (((uint64_t)(v_r6.ptr[0])) << 48) |
+          (((uint64_t)(v_r7.ptr[0])) << 56));
+      v_y = wuffs_webp__decoder__vp8_filter_pixels(self,
+          v_x,
+          a_kind,
+          ((2 * a_limit) + 1),
+          a_ilevel,
+          a_hev);
+      if (v_x != v_y) {
+        v_r1.ptr[0] = ((uint8_t)(((v_y >> 8) & 255)));
+        v_r2.ptr[0] = ((uint8_t)(((v_y >> 16) & 255)));
+        v_r3.ptr[0] = ((uint8_t)(((v_y >> 24) & 255)));
+        v_r4.ptr[0] = ((uint8_t)(((v_y >> 32) & 255)));
+        v_r5.ptr[0] = ((uint8_t)(((v_y >> 40) & 255)));
+        v_r6.ptr[0] = ((uint8_t)(((v_y >> 48) & 255)));
+      }
+      v_r0.ptr += 1;
+      v_r1.ptr += 1;
+      v_r2.ptr += 1;
+      v_r3.ptr += 1;
+      v_r4.ptr += 1;
+      v_r5.ptr += 1;
+      v_r6.ptr += 1;
+      v_r7.ptr += 1;
+    }
+    v_r0.len = 0;
+    v_r1.len = 0;
+    v_r2.len = 0;
+    v_r3.len = 0;
+    v_r4.len = 0;
+    v_r5.len = 0;
+    v_r6.len = 0;
+    v_r7.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_filter_pixels
+
+static uint64_t
+wuffs_webp__decoder__vp8_filter_pixels(
+    const wuffs_webp__decoder* self,
+    uint64_t a_x,
+    uint32_t a_kind,
+    uint32_t a_thresh2,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  uint32_t v_p3 = 0;
+  uint32_t v_p2 = 0;
+  uint32_t v_p1 = 0;
+  uint32_t v_p0 = 0;
+  uint32_t v_q0 = 0;
+  uint32_t v_q1 = 0;
+  uint32_t v_q2 = 0;
+  uint32_t v_q3 = 0;
+  uint32_t v_s1b = 0;
+  uint32_t v_ab = 0;
+  uint32_t v_a1b = 0;
+  uint32_t v_a2b = 0;
+  uint32_t v_a3b = 0;
+
+  v_p3 = ((uint32_t)(((a_x >> 0) & 255)));
+  v_p2 = ((uint32_t)(((a_x >> 8) & 255)));
+  v_p1 = ((uint32_t)(((a_x >> 16) & 255)));
+  v_p0 = ((uint32_t)(((a_x >> 24) & 255)));
+  v_q0 = ((uint32_t)(((a_x >> 32) & 255)));
+  v_q1 = ((uint32_t)(((a_x >> 40) & 255)));
+  v_q2 = ((uint32_t)(((a_x >> 48) & 255)));
+  v_q3 = ((uint32_t)(((a_x >> 56) & 255)));
+  if (((4 * wuffs_webp__decoder__vp8_abs_diff(self, v_p0, v_q0)) + wuffs_webp__decoder__vp8_abs_diff(self, v_p1, v_q1)) > a_thresh2) {
+    return a_x;
+  }
+  if (a_kind > 0) {
+    if ((wuffs_webp__decoder__vp8_abs_diff(self, v_p3, v_p2) > a_ilevel) ||
+        (wuffs_webp__decoder__vp8_abs_diff(self, v_p2, v_p1) > a_ilevel) ||
+        (wuffs_webp__decoder__vp8_abs_diff(self, v_p1, v_p0) > a_ilevel) ||
+        (wuffs_webp__decoder__vp8_abs_diff(self, v_q3, v_q2) > a_ilevel) ||
+        (wuffs_webp__decoder__vp8_abs_diff(self, v_q2, v_q1) > a_ilevel) ||
+        (wuffs_webp__decoder__vp8_abs_diff(self, v_q1, v_q0) > a_ilevel)) {
+      return a_x;
+    }
+    if ((wuffs_webp__decoder__vp8_abs_diff(self, v_p1, v_p0) <= a_hev) && (wuffs_webp__decoder__vp8_abs_diff(self, v_q1, v_q0) <= a_hev)) {
+      if (a_kind == 1) {
+        v_ab = (((3 * v_q0) + 1024) - (3 * v_p0));
+        v_a1b = wuffs_webp__decoder__vp8_clamp_biased(self, ((v_ab + 4) >> 3), 112, 143);
+        v_a2b = wuffs_webp__decoder__vp8_clamp_biased(self, ((v_ab + 3) >> 3), 112, 143);
+        v_a3b = ((v_a1b + 1) >> 1);
+        v_p1 = (wuffs_webp__decoder__vp8_clamp_biased(self, (v_p1 + v_a3b + 192), 256, 511) & 255);
+        v_p0 = (wuffs_webp__decoder__vp8_clamp_biased(self, (v_p0 + v_a2b + 128), 256, 511) & 255);
+        v_q0 = (wuffs_webp__decoder__vp8_clamp_biased(self, ((uint32_t)((v_q0 + 384) - v_a1b)), 256, 511) & 255);
+        v_q1 = (wuffs_webp__decoder__vp8_clamp_biased(self, ((uint32_t)((v_q1 + 320) - v_a3b)), 256, 511) & 255);
+      } else {
+        v_s1b = wuffs_webp__decoder__vp8_clamp_biased(self, ((v_p1 + 256) - v_q1), 128, 383);
+        v_ab = wuffs_webp__decoder__vp8_clamp_biased(self, ((((3 * v_q0) + v_s1b) + 768) - (3 * v_p0)), 896, 1151);
+        v_a1b = (((27 * v_ab) + 63) >> 7);
+        v_a2b = (((18 * v_ab) + 63) >> 7);
+        v_a3b = (((9 * v_ab) + 63) >> 7);
+        v_p2 = (wuffs_webp__decoder__vp8_clamp_biased(self, (v_p2 + v_a3b + 184), 256, 511) & 255);
+        v_p1 = (wuffs_webp__decoder__vp8_clamp_biased(self, (v_p1 + v_a2b + 112), 256, 511) & 255);
+        v_p0 = (wuffs_webp__decoder__vp8_clamp_biased(self, (v_p0 + v_a1b + 40), 256, 511) & 255);
+        v_q0 = (wuffs_webp__decoder__vp8_clamp_biased(self, ((uint32_t)((v_q0 + 472) - v_a1b)), 256, 511) & 255);
+        v_q1 = (wuffs_webp__decoder__vp8_clamp_biased(self, ((uint32_t)((v_q1 + 400) - v_a2b)), 256, 511) & 255);
+        v_q2 = (wuffs_webp__decoder__vp8_clamp_biased(self, ((uint32_t)((v_q2 + 328) - v_a3b)), 256, 511) & 255);
+      }
+      return (((uint64_t)(v_p3)) |
+          (((uint64_t)(v_p2)) << 8) |
+          (((uint64_t)(v_p1)) << 16) |
+          (((uint64_t)(v_p0)) << 24) |
+          (((uint64_t)(v_q0)) << 32) |
+          (((uint64_t)(v_q1)) << 40) |
+          (((uint64_t)(v_q2)) << 48) |
+          (((uint64_t)(v_q3)) << 56));
+    }
+  }
+  v_s1b = wuffs_webp__decoder__vp8_clamp_biased(self, ((v_p1 + 256) - v_q1), 128, 383);
+  v_ab = ((((3 * v_q0) + v_s1b) + 768) - (3 * v_p0));
+  v_a1b = wuffs_webp__decoder__vp8_clamp_biased(self, ((v_ab + 4) >> 3), 112, 143);
+  v_a2b = wuffs_webp__decoder__vp8_clamp_biased(self, ((v_ab + 3) >> 3), 112, 143);
+  v_p0 = (wuffs_webp__decoder__vp8_clamp_biased(self, (v_p0 + v_a2b + 128), 256, 511) & 255);
+  v_q0 = (wuffs_webp__decoder__vp8_clamp_biased(self, ((uint32_t)((v_q0 + 384) - v_a1b)), 256, 511) & 255);
+  return ((a_x & 18446742974214701055u) | (((uint64_t)(v_p0)) << 24) | (((uint64_t)(v_q0)) << 32));
+}
+
+// -------- func webp.decoder.vp8_abs_diff
+
+static uint32_t
+wuffs_webp__decoder__vp8_abs_diff(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b) {
+  if (a_a > a_b) {
+    return (a_a - a_b);
+  } else if (a_b > a_a) {
+    return (a_b - a_a);
+  }
+  return 0;
+}
+
+// -------- func webp.decoder.vp8_clamp_biased
+
+static uint32_t
+wuffs_webp__decoder__vp8_clamp_biased(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_min,
+    uint32_t a_max) {
+  if (a_a < a_min) {
+    return a_min;
+  } else if (a_a > a_max) {
+    return a_max;
+  }
+  return wuffs_base__u32__min(a_a, 1151);
+}
+
+// -------- func webp.decoder.vp8_reconstruct_macroblock
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_reconstruct_macroblock(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y) {
+  uint32_t v_k = 0;
+  uint32_t v_tl = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[32].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  wuffs_webp__decoder__vp8_load_edges(self, a_mb_x, a_mb_y);
+  if (self->private_impl.f_vp8_mb_is_i4x4) {
+    v_k = 0;
+    while (v_k < 16) {
+      v_tl = (7 + ((v_k & 3) * 4) + ((v_k >> 2) * 128));
+      wuffs_webp__decoder__vp8_predict_4x4(self, v_tl, self->private_impl.f_vp8_mb_bmodes[v_k]);
+      wuffs_webp__decoder__vp8_add_residual(self, v_tl, v_k);
+      v_k += 1;
+    }
+  } else {
+    wuffs_webp__decoder__vp8_predict_16x16(self, self->private_impl.f_vp8_mb_ymode, a_mb_x, a_mb_y);
+    v_k = 0;
+    while (v_k < 16) {
+      v_tl = (7 + ((v_k & 3) * 4) + ((v_k >> 2) * 128));
+      wuffs_webp__decoder__vp8_add_residual(self, v_tl, v_k);
+      v_k += 1;
+    }
+  }
+  wuffs_webp__decoder__vp8_predict_8x8(self,
+      551,
+      self->private_impl.f_vp8_mb_uvmode,
+      a_mb_x,
+      a_mb_y);
+  wuffs_webp__decoder__vp8_predict_8x8(self,
+      567,
+      self->private_impl.f_vp8_mb_uvmode,
+      a_mb_x,
+      a_mb_y);
+  v_k = 16;
+  while (v_k < 24) {
+    v_tl = (551 +
+        ((v_k & 1) * 4) +
+        (((v_k >> 1) & 1) * 128) +
+        (((v_k >> 2) & 1) * 16));
+    wuffs_webp__decoder__vp8_add_residual(self, v_tl, v_k);
+    v_k += 1;
+  }
+  wuffs_webp__decoder__vp8_store_macroblock(self, a_workbuf, a_mb_x, a_mb_y);
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_load_edges
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_load_edges(
+    wuffs_webp__decoder* self,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y) {
+  uint32_t v_j = 0;
+  uint32_t v_x0 = 0;
+  uint32_t v_x1 = 0;
+  uint8_t v_c = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[33].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (a_mb_x > 0) {
+    v_j = 0;
+    while (v_j < 17) {
+      self->private_data.f_vp8_mb[(7 + (32 * v_j))] = self->private_data.f_vp8_mb[(23 + (32 * v_j))];
+      v_j += 1;
+    }
+    v_j = 0;
+    while (v_j < 9) {
+      self->private_data.f_vp8_mb[(551 + (32 * v_j))] = self->private_data.f_vp8_mb[(559 + (32 * v_j))];
+      self->private_data.f_vp8_mb[(567 + (32 * v_j))] = self->private_data.f_vp8_mb[(575 + (32 * v_j))];
+      v_j += 1;
+    }
+  } else {
+    v_c = 127;
+    if (a_mb_y > 0) {
+      v_c = 129;
+    }
+    self->private_data.f_vp8_mb[7] = v_c;
+    self->private_data.f_vp8_mb[551] = v_c;
+    self->private_data.f_vp8_mb[567] = v_c;
+    v_j = 1;
+    while (v_j < 17) {
+      self->private_data.f_vp8_mb[(7 + (32 * v_j))] = 129;
+      v_j += 1;
+    }
+    v_j = 1;
+    while (v_j < 9) {
+      self->private_data.f_vp8_mb[(551 + (32 * v_j))] = 129;
+      self->private_data.f_vp8_mb[(567 + (32 * v_j))] = 129;
+      v_j += 1;
+    }
+  }
+  if (a_mb_y > 0) {
+    v_x0 = (16 * a_mb_x);
+    v_x1 = (8 * a_mb_x);
+    wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 8, 24), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_y, v_x0, 16384));
+    wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 552, 560), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_u, v_x1, 8192));
+    wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 568, 576), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_v, v_x1, 8192));
+    if ((a_mb_x + 1) < self->private_impl.f_vp8_mb_width) {
+      wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 24, 28), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_y, (v_x0 + 16), 16384));
+    } else {
+      v_c = self->private_data.f_vp8_top_y[(v_x0 + 15)];
+      self->private_data.f_vp8_mb[24] = v_c;
+      self->private_data.f_vp8_mb[25] = v_c;
+      self->private_data.f_vp8_mb[26] = v_c;
+      self->private_data.f_vp8_mb[27] = v_c;
+    }
+  } else {
+    v_j = 8;
+    while (v_j < 28) {
+      self->private_data.f_vp8_mb[v_j] = 127;
+      v_j += 1;
+    }
+    v_j = 552;
+    while (v_j < 560) {
+      self->private_data.f_vp8_mb[v_j] = 127;
+      self->private_data.f_vp8_mb[(v_j + 16)] = 127;
+      v_j += 1;
+    }
+  }
+  v_j = 24;
+  while (v_j < 28) {
+    self->private_data.f_vp8_mb[(v_j + 128)] = self->private_data.f_vp8_mb[v_j];
+    self->private_data.f_vp8_mb[(v_j + 256)] = self->private_data.f_vp8_mb[v_j];
+    self->private_data.f_vp8_mb[(v_j + 384)] = self->private_data.f_vp8_mb[v_j];
+    v_j += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_predict_4x4
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_predict_4x4(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_mode) {
+  uint32_t v_x = 0;
+  uint32_t v_a = 0;
+  uint32_t v_b = 0;
+  uint32_t v_c = 0;
+  uint32_t v_d = 0;
+  uint32_t v_e = 0;
+  uint32_t v_f = 0;
+  uint32_t v_g = 0;
+  uint32_t v_h = 0;
+  uint32_t v_i = 0;
+  uint32_t v_j = 0;
+  uint32_t v_k = 0;
+  uint32_t v_l = 0;
+  uint32_t v_v = 0;
+  uint8_t v_o[16] = {0};
+  uint32_t v_y = 0;
+  uint32_t v_row = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[34].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_x = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 0)]));
+  v_a = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 1)]));
+  v_b = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 2)]));
+  v_c = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 3)]));
+  v_d = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 4)]));
+  v_e = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 5)]));
+  v_f = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 6)]));
+  v_g = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 7)]));
+  v_h = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 8)]));
+  v_i = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 32)]));
+  v_j = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 64)]));
+  v_k = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 96)]));
+  v_l = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 128)]));
+  if (a_mode == 0) {
+    v_v = ((v_a +
+        v_b +
+        v_c +
+        v_d +
+        v_i +
+        v_j +
+        v_k +
+        v_l +
+        4) >> 3);
+    v_o[0] = ((uint8_t)((v_v & 255)));
+    v_o[1] = v_o[0];
+    v_o[2] = v_o[0];
+    v_o[3] = v_o[0];
+    v_o[4] = v_o[0];
+    v_o[5] = v_o[0];
+    v_o[6] = v_o[0];
+    v_o[7] = v_o[0];
+    v_o[8] = v_o[0];
+    v_o[9] = v_o[0];
+    v_o[10] = v_o[0];
+    v_o[11] = v_o[0];
+    v_o[12] = v_o[0];
+    v_o[13] = v_o[0];
+    v_o[14] = v_o[0];
+    v_o[15] = v_o[0];
+  } else if (a_mode == 1) {
+    v_o[0] = wuffs_webp__decoder__vp8_true_motion(self, v_a, v_i, v_x);
+    v_o[1] = wuffs_webp__decoder__vp8_true_motion(self, v_b, v_i, v_x);
+    v_o[2] = wuffs_webp__decoder__vp8_true_motion(self, v_c, v_i, v_x);
+    v_o[3] = wuffs_webp__decoder__vp8_true_motion(self, v_d, v_i, v_x);
+    v_o[4] = wuffs_webp__decoder__vp8_true_motion(self, v_a, v_j, v_x);
+    v_o[5] = wuffs_webp__decoder__vp8_true_motion(self, v_b, v_j, v_x);
+    v_o[6] = wuffs_webp__decoder__vp8_true_motion(self, v_c, v_j, v_x);
+    v_o[7] = wuffs_webp__decoder__vp8_true_motion(self, v_d, v_j, v_x);
+    v_o[8] = wuffs_webp__decoder__vp8_true_motion(self, v_a, v_k, v_x);
+    v_o[9] = wuffs_webp__decoder__vp8_true_motion(self, v_b, v_k, v_x);
+    v_o[10] = wuffs_webp__decoder__vp8_true_motion(self, v_c, v_k, v_x);
+    v_o[11] = wuffs_webp__decoder__vp8_true_motion(self, v_d, v_k, v_x);
+    v_o[12] = wuffs_webp__decoder__vp8_true_motion(self, v_a, v_l, v_x);
+    v_o[13] = wuffs_webp__decoder__vp8_true_motion(self, v_b, v_l, v_x);
+    v_o[14] = wuffs_webp__decoder__vp8_true_motion(self, v_c, v_l, v_x);
+    v_o[15] = wuffs_webp__decoder__vp8_true_motion(self, v_d, v_l, v_x);
+  } else if (a_mode == 2) {
+    v_o[0] = wuffs_webp__decoder__vp8_avg3(self, v_x, v_a, v_b);
+    v_o[1] = wuffs_webp__decoder__vp8_avg3(self, v_a, v_b, v_c);
+    v_o[2] = wuffs_webp__decoder__vp8_avg3(self, v_b, v_c, v_d);
+    v_o[3] = wuffs_webp__decoder__vp8_avg3(self, v_c, v_d, v_e);
+    v_o[4] = v_o[0];
+    v_o[5] = v_o[1];
+    v_o[6] = v_o[2];
+    v_o[7] = v_o[3];
+    v_o[8] = v_o[0];
+    v_o[9] = v_o[1];
+    v_o[10] = v_o[2];
+    v_o[11] = v_o[3];
+    v_o[12] = v_o[0];
+    v_o[13] = v_o[1];
+    v_o[14] = v_o[2];
+    v_o[15] = v_o[3];
+  } else if (a_mode == 3) {
+    v_o[0] = wuffs_webp__decoder__vp8_avg3(self, v_x, v_i, v_j);
+    v_o[4] = wuffs_webp__decoder__vp8_avg3(self, v_i, v_j, v_k);
+    v_o[8] = wuffs_webp__decoder__vp8_avg3(self, v_j, v_k, v_l);
+    v_o[12] = wuffs_webp__decoder__vp8_avg3(self, v_k, v_l, v_l);
+    v_o[1] = v_o[0];
+    v_o[2] = v_o[0];
+    v_o[3] = v_o[0];
+    v_o[5] = v_o[4];
+    v_o[6] = v_o[4];
+    v_o[7] = v_o[4];
+    v_o[9] = v_o[8];
+    v_o[10] = v_o[8];
+    v_o[11] = v_o[8];
+    v_o[13] = v_o[12];
+    v_o[14] = v_o[12];
+    v_o[15] = v_o[12];
+  } else if (a_mode == 4) {
+    v_o[12] = wuffs_webp__decoder__vp8_avg3(self, v_j, v_k, v_l);
+    v_o[13] = wuffs_webp__decoder__vp8_avg3(self, v_i, v_j, v_k);
+    v_o[8] = v_o[13];
+    v_o[14] = wuffs_webp__decoder__vp8_avg3(self, v_x, v_i, v_j);
+    v_o[9] = v_o[14];
+    v_o[4] = v_o[14];
+    v_o[15] = wuffs_webp__decoder__vp8_avg3(self, v_a, v_x, v_i);
+    v_o[10] = v_o[15];
+    v_o[5] = v_o[15];
+    v_o[0] = v_o[15];
+    v_o[11] = wuffs_webp__decoder__vp8_avg3(self, v_b, v_a, v_x);
+    v_o[6] = v_o[11];
+    v_o[1] = v_o[11];
+    v_o[7] = wuffs_webp__decoder__vp8_avg3(self, v_c, v_b, v_a);
+    v_o[2] = v_o[7];
+    v_o[3] = wuffs_webp__decoder__vp8_avg3(self, v_d, v_c, v_b);
+  } else if (a_mode == 5) {
+    v_o[0] = wuffs_webp__decoder__vp8_avg2(self, v_x, v_a);
+    v_o[9] = v_o[0];
+    v_o[1] = wuffs_webp__decoder__vp8_avg2(self, v_a, v_b);
+    v_o[10] = v_o[1];
+    v_o[2] = wuffs_webp__decoder__vp8_avg2(self, v_b, v_c);
+    v_o[11] = v_o[2];
+    v_o[3] = wuffs_webp__decoder__vp8_avg2(self, v_c, v_d);
+    v_o[12] = wuffs_webp__decoder__vp8_avg3(self, v_k, v_j, v_i);
+    v_o[8] = wuffs_webp__decoder__vp8_avg3(self, v_j, v_i, v_x);
+    v_o[4] = wuffs_webp__decoder__vp8_avg3(self, v_i, v_x, v_a);
+    v_o[13] = v_o[4];
+    v_o[5] = wuffs_webp__decoder__vp8_avg3(self, v_x, v_a, v_b);
+    v_o[14] = v_o[5];
+    v_o[6] = wuffs_webp__decoder__vp8_avg3(self, v_a, v_b, v_c);
+    v_o[15] = v_o[6];
+    v_o[7] = wuffs_webp__decoder__vp8_avg3(self, v_b, v_c, v_d);
+  } else if (a_mode == 6) {
+    v_o[0] = wuffs_webp__decoder__vp8_avg3(self, v_a, v_b, v_c);
+    v_o[1] = wuffs_webp__decoder__vp8_avg3(self, v_b, v_c, v_d);
+    v_o[4] = v_o[1];
+    v_o[2] = wuffs_webp__decoder__vp8_avg3(self, v_c, v_d, v_e);
+    v_o[5] = v_o[2];
+    v_o[8] = v_o[2];
+    v_o[3] = wuffs_webp__decoder__vp8_avg3(self, v_d, v_e, v_f);
+    v_o[6] = v_o[3];
+    v_o[9] = v_o[3];
+    v_o[12] = v_o[3];
+    v_o[7] = wuffs_webp__decoder__vp8_avg3(self, v_e, v_f, v_g);
+    v_o[10] = v_o[7];
+    v_o[13] = v_o[7];
+    v_o[11] = wuffs_webp__decoder__vp8_avg3(self, v_f, v_g, v_h);
+    v_o[14] = v_o[11];
+    v_o[15] = wuffs_webp__decoder__vp8_avg3(self, v_g, v_h, v_h);
+  } else if (a_mode == 7) {
+    v_o[0] = wuffs_webp__decoder__vp8_avg2(self, v_a, v_b);
+    v_o[1] = wuffs_webp__decoder__vp8_avg2(self, v_b, v_c);
+    v_o[8] = v_o[1];
+    v_o[2] = wuffs_webp__decoder__vp8_avg2(self, v_c, v_d);
+    v_o[9] = v_o[2];
+    v_o[3] = wuffs_webp__decoder__vp8_avg2(self, v_d, v_e);
+    v_o[10] = v_o[3];
+    v_o[4] = wuffs_webp__decoder__vp8_avg3(self, v_a, v_b, v_c);
+    v_o[5] = wuffs_webp__decoder__vp8_avg3(self, v_b, v_c, v_d);
+    v_o[12] = v_o[5];
+    v_o[6] = wuffs_webp__decoder__vp8_avg3(self, v_c, v_d, v_e);
+    v_o[13] = v_o[6];
+    v_o[7] = wuffs_webp__decoder__vp8_avg3(self, v_d, v_e, v_f);
+    v_o[14] = v_o[7];
+    v_o[11] = wuffs_webp__decoder__vp8_avg3(self, v_e, v_f, v_g);
+    v_o[15] = wuffs_webp__decoder__vp8_avg3(self, v_f, v_g, v_h);
+  } else if (a_mode == 8) {
+    v_o[0] = wuffs_webp__decoder__vp8_avg2(self, v_i, v_x);
+    v_o[6] = v_o[0];
+    v_o[4] = wuffs_webp__decoder__vp8_avg2(self, v_j, v_i);
+    v_o[10] = v_o[4];
+    v_o[8] = wuffs_webp__decoder__vp8_avg2(self, v_k, v_j);
+    v_o[14] = v_o[8];
+    v_o[12] = wuffs_webp__decoder__vp8_avg2(self, v_l, v_k);
+    v_o[3] = wuffs_webp__decoder__vp8_avg3(self, v_a, v_b, v_c);
+    v_o[2] = wuffs_webp__decoder__vp8_avg3(self, v_x, v_a, v_b);
+    v_o[1] = wuffs_webp__decoder__vp8_avg3(self, v_i, v_x, v_a);
+    v_o[7] = v_o[1];
+    v_o[5] = wuffs_webp__decoder__vp8_avg3(self, v_j, v_i, v_x);
+    v_o[11] = v_o[5];
+    v_o[9] = wuffs_webp__decoder__vp8_avg3(self, v_k, v_j, v_i);
+    v_o[15] = v_o[9];
+    v_o[13] = wuffs_webp__decoder__vp8_avg3(self, v_l, v_k, v_j);
+  } else {
+    v_o[0] = wuffs_webp__decoder__vp8_avg2(self, v_i, v_j);
+    v_o[2] = wuffs_webp__decoder__vp8_avg2(self, v_j, v_k);
+    v_o[4] = v_o[2];
+    v_o[6] = wuffs_webp__decoder__vp8_avg2(self, v_k, v_l);
+    v_o[8] = v_o[6];
+    v_o[1] = wuffs_webp__decoder__vp8_avg3(self, v_i, v_j, v_k);
+    v_o[3] = wuffs_webp__decoder__vp8_avg3(self, v_j, v_k, v_l);
+    v_o[5] = v_o[3];
+    v_o[7] = wuffs_webp__decoder__vp8_avg3(self, v_k, v_l, v_l);
+    v_o[9] = v_o[7];
+    v_o[10] = ((uint8_t)(v_l));
+    v_o[11] = v_o[10];
+    v_o[12] = v_o[10];
+    v_o[13] = v_o[10];
+    v_o[14] = v_o[10];
+    v_o[15] = v_o[10];
+  }
+  v_y = 0;
+  while (v_y < 4) {
+    v_row = (a_tl + 33 + (32 * v_y));
+    self->private_data.f_vp8_mb[(v_row + 0)] = v_o[((4 * v_y) + 0)];
+    self->private_data.f_vp8_mb[(v_row + 1)] = v_o[((4 * v_y) + 1)];
+    self->private_data.f_vp8_mb[(v_row + 2)] = v_o[((4 * v_y) + 2)];
+    self->private_data.f_vp8_mb[(v_row + 3)] = v_o[((4 * v_y) + 3)];
+    v_y += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_predict_16x16
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_predict_16x16(
+    wuffs_webp__decoder* self,
+    uint32_t a_mode,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y) {
+  uint32_t v_x = 0;
+  uint32_t v_y = 0;
+  uint32_t v_v = 0;
+  uint32_t v_tl = 0;
+  uint32_t v_l = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[35].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (a_mode == 0) {
+    v_v = 0;
+    v_x = 0;
+    while (v_x < 16) {
+      if (a_mb_y > 0) {
+        v_v += ((uint32_t)(self->private_data.f_vp8_mb[(8 + v_x)]));
+      }
+      if (a_mb_x > 0) {
+        v_v += ((uint32_t)(self->private_data.f_vp8_mb[(39 + (32 * v_x))]));
+      }
+      v_x += 1;
+    }
+    if ((a_mb_x > 0) && (a_mb_y > 0)) {
+      v_v = (((uint32_t)(v_v + 16)) >> 5);
+    } else if ((a_mb_x > 0) || (a_mb_y > 0)) {
+      v_v = (((uint32_t)(v_v + 8)) >> 4);
+    } else {
+      v_v = 128;
+    }
+    v_y = 0;
+    while (v_y < 16) {
+      v_x = 0;
+      while (v_x < 16) {
+        self->private_data.f_vp8_mb[(40 + v_x + (32 * v_y))] = ((uint8_t)((v_v & 255)));
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  } else if (a_mode == 1) {
+    v_tl = ((uint32_t)(self->private_data.f_vp8_mb[7]));
+    v_y = 0;
+    while (v_y < 16) {
+      v_l = ((uint32_t)(self->private_data.f_vp8_mb[(39 + (32 * v_y))]));
+      v_x = 0;
+      while (v_x < 16) {
+        self->private_data.f_vp8_mb[(40 + v_x + (32 * v_y))] = wuffs_webp__decoder__vp8_true_motion(self, ((uint32_t)(self->private_data.f_vp8_mb[(8 + v_x)])), v_l, v_tl);
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  } else if (a_mode == 2) {
+    v_y = 0;
+    while (v_y < 16) {
+      v_x = 0;
+      while (v_x < 16) {
+        self->private_data.f_vp8_mb[(40 + v_x + (32 * v_y))] = self->private_data.f_vp8_mb[(8 + v_x)];
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  } else {
+    v_y = 0;
+    while (v_y < 16) {
+      v_x = 0;
+      while (v_x < 16) {
+        self->private_data.f_vp8_mb[(40 + v_x + (32 * v_y))] = self->private_data.f_vp8_mb[(39 + (32 * v_y))];
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_predict_8x8
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_predict_8x8(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_mode,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y) {
+  uint32_t v_x = 0;
+  uint32_t v_y = 0;
+  uint32_t v_v = 0;
+  uint32_t v_tlv = 0;
+  uint32_t v_l = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[36].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (a_mode == 0) {
+    v_v = 0;
+    v_x = 0;
+    while (v_x < 8) {
+      if (a_mb_y > 0) {
+        v_v += ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 1 + v_x)]));
+      }
+      if (a_mb_x > 0) {
+        v_v += ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 32 + (32 * v_x))]));
+      }
+      v_x += 1;
+    }
+    if ((a_mb_x > 0) && (a_mb_y > 0)) {
+      v_v = (((uint32_t)(v_v + 8)) >> 4);
+    } else if ((a_mb_x > 0) || (a_mb_y > 0)) {
+      v_v = (((uint32_t)(v_v + 4)) >> 3);
+    } else {
+      v_v = 128;
+    }
+    v_y = 0;
+    while (v_y < 8) {
+      v_x = 0;
+      while (v_x < 8) {
+        self->private_data.f_vp8_mb[(a_tl +
+            33 +
+            v_x +
+            (32 * v_y))] = ((uint8_t)((v_v & 255)));
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  } else if (a_mode == 1) {
+    v_tlv = ((uint32_t)(self->private_data.f_vp8_mb[a_tl]));
+    v_y = 0;
+    while (v_y < 8) {
+      v_l = ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 32 + (32 * v_y))]));
+      v_x = 0;
+      while (v_x < 8) {
+        self->private_data.f_vp8_mb[(a_tl +
+            33 +
+            v_x +
+            (32 * v_y))] = wuffs_webp__decoder__vp8_true_motion(self, ((uint32_t)(self->private_data.f_vp8_mb[(a_tl + 1 + v_x)])), v_l, v_tlv);
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  } else if (a_mode == 2) {
+    v_y = 0;
+    while (v_y < 8) {
+      v_x = 0;
+      while (v_x < 8) {
+        self->private_data.f_vp8_mb[(a_tl +
+            33 +
+            v_x +
+            (32 * v_y))] = self->private_data.f_vp8_mb[(a_tl + 1 + v_x)];
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  } else {
+    v_y = 0;
+    while (v_y < 8) {
+      v_x = 0;
+      while (v_x < 8) {
+        self->private_data.f_vp8_mb[(a_tl +
+            33 +
+            v_x +
+            (32 * v_y))] = self->private_data.f_vp8_mb[(a_tl + 32 + (32 * v_y))];
+        v_x += 1;
+      }
+      v_y += 1;
+    }
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_avg2
+
+static uint8_t
+wuffs_webp__decoder__vp8_avg2(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b) {
+  return ((uint8_t)(((a_a + a_b + 1) / 2)));
+}
+
+// -------- func webp.decoder.vp8_avg3
+
+static uint8_t
+wuffs_webp__decoder__vp8_avg3(
+    const wuffs_webp__decoder* self,
+    uint32_t a_a,
+    uint32_t a_b,
+    uint32_t a_c) {
+  return ((uint8_t)(((a_a +
+      (2 * a_b) +
+      a_c +
+      2) / 4)));
+}
+
+// -------- func webp.decoder.vp8_true_motion
+
+static uint8_t
+wuffs_webp__decoder__vp8_true_motion(
+    const wuffs_webp__decoder* self,
+    uint32_t a_t,
+    uint32_t a_l,
+    uint32_t a_tl) {
+  uint32_t v_v = 0;
+
+  v_v = (a_t + a_l);
+  if (v_v <= a_tl) {
+    return 0;
+  }
+  v_v -= a_tl;
+  if (v_v >= 255) {
+    return 255;
+  }
+  return ((uint8_t)(v_v));
+}
+
+// -------- func webp.decoder.vp8_add_residual
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_add_residual(
+    wuffs_webp__decoder* self,
+    uint32_t a_tl,
+    uint32_t a_b) {
+  uint32_t v_dc = 0;
+  uint32_t v_y = 0;
+  uint32_t v_row = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[37].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (self->private_impl.f_vp8_mb_block_kinds[a_b] == 2) {
+    wuffs_webp__decoder__vp8_idct_add(self, a_tl, a_b);
+  } else if (self->private_impl.f_vp8_mb_block_kinds[a_b] == 1) {
+    v_dc = wuffs_base__utility__sign_extend_rshift_u32(((uint32_t)(wuffs_base__utility__sign_extend_convert_u16_u32(self->private_data.f_vp8_coeffs[(16 * a_b)]) + 4)), 3);
+    self->private_data.f_vp8_coeffs[(16 * a_b)] = 0;
+    v_y = 0;
+    while (v_y < 4) {
+      v_row = (a_tl + 33 + (32 * v_y));
+      self->private_data.f_vp8_mb[(v_row + 0)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 0)], v_dc);
+      self->private_data.f_vp8_mb[(v_row + 1)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 1)], v_dc);
+      self->private_data.f_vp8_mb[(v_row + 2)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 2)], v_dc);
+      self->private_data.f_vp8_mb[(v_row + 3)] = wuffs_webp__decoder__vp8_clamp_add(self, self->private_data.f_vp8_mb[(v_row + 3)], v_dc);
+      v_y += 1;
+    }
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_clamp_add
+
+static uint8_t
+wuffs_webp__decoder__vp8_clamp_add(
+    const wuffs_webp__decoder* self,
+    uint8_t a_a,
+    uint32_t a_b) {
+  uint32_t v_v = 0;
+
+  v_v = ((uint32_t)(((uint32_t)(a_a)) + a_b));
+  if (v_v >= 2147483648) {
+    return 0;
+  } else if (v_v >= 255) {
+    return 255;
+  }
+  return ((uint8_t)(v_v));
+}
+
+// -------- func webp.decoder.vp8_store_macroblock
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_store_macroblock(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf,
+    uint32_t a_mb_x,
+    uint32_t a_mb_y) {
+  uint64_t v_stride = 0;
+  uint64_t v_o = 0;
+  uint32_t v_y = 0;
+  uint32_t v_r = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[38].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_stride = ((uint64_t)((self->private_impl.f_vp8_mb_width * 16)));
+  v_o = ((uint64_t)(self->private_impl.f_vp8_plane_offsets[0] + ((((uint64_t)((a_mb_y * 16))) * v_stride) + ((uint64_t)((a_mb_x * 16))))));
+  v_y = 0;
+  while (v_y < 16) {
+    if (v_o > ((uint64_t)(a_workbuf.len))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_r = (40 + (32 * v_y));
+    wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(a_workbuf, v_o), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, v_r, (v_r + 16)));
+    v_o += v_stride;
+    v_y += 1;
+  }
+  v_stride = ((uint64_t)((self->private_impl.f_vp8_mb_width * 8)));
+  v_o = ((uint64_t)(self->private_impl.f_vp8_plane_offsets[1] + ((((uint64_t)((a_mb_y * 8))) * v_stride) + ((uint64_t)((a_mb_x * 8))))));
+  v_y = 0;
+  while (v_y < 8) {
+    if (v_o > ((uint64_t)(a_workbuf.len))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_r = (584 + (32 * v_y));
+    wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(a_workbuf, v_o), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, v_r, (v_r + 8)));
+    v_o += v_stride;
+    v_y += 1;
+  }
+  v_o = ((uint64_t)(self->private_impl.f_vp8_plane_offsets[2] + ((((uint64_t)((a_mb_y * 8))) * v_stride) + ((uint64_t)((a_mb_x * 8))))));
+  v_y = 0;
+  while (v_y < 8) {
+    if (v_o > ((uint64_t)(a_workbuf.len))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_r = (600 + (32 * v_y));
+    wuffs_base__slice_u8__copy_from_slice(wuffs_base__slice_u8__subslice_i(a_workbuf, v_o), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, v_r, (v_r + 8)));
+    v_o += v_stride;
+    v_y += 1;
+  }
+  wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_y, (16 * a_mb_x), 16384), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 520, 536));
+  wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_u, (8 * a_mb_x), 8192), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 808, 816));
+  wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_top_v, (8 * a_mb_x), 8192), wuffs_base__make_slice_u8_ij(self->private_data.f_vp8_mb, 824, 832));
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.vp8_filter_macroblock_row
+
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_macroblock_row(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf,
+    uint32_t a_mb_y) {
+  uint32_t v_mb_x = 0;
+  uint32_t v_f = 0;
+  uint32_t v_fi = 0;
+  uint32_t v_limit = 0;
+  uint32_t v_ilevel = 0;
+  uint32_t v_hev = 0;
+  bool v_inner = false;
+  bool v_simple = false;
+  uint32_t v_kind = 0;
+  uint32_t v_p = 0;
+  uint64_t v_stride = 0;
+  uint64_t v_o = 0;
+  uint32_t v_plane = 0;
+  uint32_t v_size = 0;
+  uint64_t v_e = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[39].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_simple = (self->private_impl.f_vp8_filter_type == 1);
+  v_mb_x = 0;
+  while (v_mb_x < self->private_impl.f_vp8_mb_width) {
+    v_f = ((uint32_t)(self->private_data.f_vp8_mb_filters[v_mb_x]));
+    v_fi = (v_f & 7);
+    v_limit = self->private_impl.f_vp8_filter_limits[v_fi];
+    v_ilevel = self->private_impl.f_vp8_filter_ilevels[v_fi];
+    v_hev = self->private_impl.f_vp8_filter_hev_thresholds[v_fi];
+    v_inner = ((v_f & 8) != 0);
+    if (v_limit > 0) {
+      v_plane = 0;
+      while (v_plane < 3) {
+        if (v_plane == 0) {
+          v_size = 16;
+          v_stride = ((uint64_t)((self->private_impl.f_vp8_mb_width * 16)));
+          v_o = ((uint64_t)(self->private_impl.f_vp8_plane_offsets[0] + ((((uint64_t)((a_mb_y * 16))) * v_stride) + ((uint64_t)((v_mb_x * 16))))));
+        } else {
+          if (v_simple) {
+            goto label__0__break;
+          }
+          v_size = 8;
+          v_stride = ((uint64_t)((self->private_impl.f_vp8_mb_width * 8)));
+          v_o = ((uint64_t)(self->private_impl.f_vp8_plane_offsets[(v_plane & 3)] + ((((uint64_t)((a_mb_y * 8))) * v_stride) + ((uint64_t)((v_mb_x * 8))))));
+        }
+        if (v_o > ((uint64_t)(a_workbuf.len))) {
+          return wuffs_base__make_empty_struct();
+        }
+        v_kind = 0;
+        if ( ! v_simple) {
+          v_kind = 2;
+        }
+        if ((v_mb_x > 0) && (v_o >= 4)) {
+          v_e = (v_o - 4);
+          if (v_e <= ((uint64_t)(a_workbuf.len))) {
+            wuffs_webp__decoder__vp8_filter_across_cols(self,
+                wuffs_base__slice_u8__subslice_i(a_workbuf, v_e),
+                v_stride,
+                v_size,
+                v_kind,
+                (v_limit + 4),
+                v_ilevel,
+                v_hev);
+          }
+        }
+        if (v_inner) {
+          if ( ! v_simple) {
+            v_kind = 1;
+          }
+          v_e = v_o;
+          v_p = v_size;
+          while (v_p > 4) {
+            if (v_e <= ((uint64_t)(a_workbuf.len))) {
+              wuffs_webp__decoder__vp8_filter_across_cols(self,
+                  wuffs_base__slice_u8__subslice_i(a_workbuf, v_e),
+                  v_stride,
+                  v_size,
+                  v_kind,
+                  v_limit,
+                  v_ilevel,
+                  v_hev);
+            }
+            v_e += 4;
+            v_p -= 4;
+          }
+        }
+        v_kind = 0;
+        if ( ! v_simple) {
+          v_kind = 2;
+        }
+        if ((a_mb_y > 0) && (v_o >= (4 * v_stride))) {
+          v_e = (v_o - (4 * v_stride));
+          if (v_e <= ((uint64_t)(a_workbuf.len))) {
+            wuffs_webp__decoder__vp8_filter_across_rows(self,
+                wuffs_base__slice_u8__subslice_i(a_workbuf, v_e),
+                v_stride,
+                v_size,
+                v_kind,
+                (v_limit + 4),
+                v_ilevel,
+                v_hev);
+          }
+        }
+        if (v_inner) {
+          if ( ! v_simple) {
+            v_kind = 1;
+          }
+          v_e = v_o;
+          v_p = v_size;
+          while (v_p > 4) {
+            if (v_e <= ((uint64_t)(a_workbuf.len))) {
+              wuffs_webp__decoder__vp8_filter_across_rows(self,
+                  wuffs_base__slice_u8__subslice_i(a_workbuf, v_e),
+                  v_stride,
+                  v_size,
+                  v_kind,
+                  v_limit,
+                  v_ilevel,
+                  v_hev);
+            }
+            v_e += (4 * v_stride);
+            v_p -= 4;
+          }
+        }
+        v_plane += 1;
+      }
+      label__0__break:;
+    }
+    v_mb_x += 1;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.swizzle_vp8
+
+static wuffs_base__status
+wuffs_webp__decoder__swizzle_vp8(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__slice_u8 a_workbuf) {
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  wuffs_base__slice_u8 v_src0 = {0};
+  wuffs_base__slice_u8 v_src1 = {0};
+  wuffs_base__slice_u8 v_src2 = {0};
+  wuffs_base__slice_u8 v_s = {0};
+  wuffs_base__slice_u8 v_pix = {0};
+  uint32_t v_width = 0;
+  uint32_t v_cwidth = 0;
+  uint32_t v_height = 0;
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[40].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_q = self->private_impl.f_vp8_plane_offsets[0];
+  v_q_end = self->private_impl.f_vp8_plane_offsets[1];
+  if ((v_q <= v_q_end) && (v_q_end <= ((uint64_t)(a_workbuf.len)))) {
+    v_s = wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end);
+    {
+      wuffs_base__slice_u8 i_slice_pix = v_s;
+      v_pix.ptr = i_slice_pix.ptr;
+      v_pix.len = 1;
+      uint8_t* i_end0_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 4) * 4);
+      while (v_pix.ptr < i_end0_pix) {
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_Y_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_Y_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_Y_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_Y_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+      }
+      v_pix.len = 1;
+      uint8_t* i_end1_pix = i_slice_pix.ptr + i_slice_pix.len;
+      while (v_pix.ptr < i_end1_pix) {
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_Y_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+      }
+      v_pix.len = 0;
+    }
+  }
+  v_q = self->private_impl.f_vp8_plane_offsets[1];
+  v_q_end = self->private_impl.f_vp8_plane_offsets[3];
+  if ((v_q <= v_q_end) && (v_q_end <= ((uint64_t)(a_workbuf.len)))) {
+    v_s = wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end);
+    {
+      wuffs_base__slice_u8 i_slice_pix = v_s;
+      v_pix.ptr = i_slice_pix.ptr;
+      v_pix.len = 1;
+      uint8_t* i_end0_pix = v_pix.ptr + (((i_slice_pix.len - (size_t)(v_pix.ptr - i_slice_pix.ptr)) / 4) * 4);
+      while (v_pix.ptr < i_end0_pix) {
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_C_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_C_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_C_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_C_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+      }
+      v_pix.len = 1;
+      uint8_t* i_end1_pix = i_slice_pix.ptr + i_slice_pix.len;
+      while (v_pix.ptr < i_end1_pix) {
+        v_pix.ptr[0] = WUFFS_WEBP__VP8_C_REMAP[v_pix.ptr[0]];
+        v_pix.ptr += 1;
+      }
+      v_pix.len = 0;
+    }
+  }
+  if ((self->private_impl.f_vp8_plane_offsets[0] <= self->private_impl.f_vp8_plane_offsets[1]) && (self->private_impl.f_vp8_plane_offsets[1] <= ((uint64_t)(a_workbuf.len)))) {
+    v_src0 = wuffs_base__slice_u8__subslice_ij(a_workbuf,
+        self->private_impl.f_vp8_plane_offsets[0],
+        self->private_impl.f_vp8_plane_offsets[1]);
+  }
+  if ((self->private_impl.f_vp8_plane_offsets[1] <= self->private_impl.f_vp8_plane_offsets[2]) && (self->private_impl.f_vp8_plane_offsets[2] <= ((uint64_t)(a_workbuf.len)))) {
+    v_src1 = wuffs_base__slice_u8__subslice_ij(a_workbuf,
+        self->private_impl.f_vp8_plane_offsets[1],
+        self->private_impl.f_vp8_plane_offsets[2]);
+  }
+  if ((self->private_impl.f_vp8_plane_offsets[2] <= self->private_impl.f_vp8_plane_offsets[3]) && (self->private_impl.f_vp8_plane_offsets[3] <= ((uint64_t)(a_workbuf.len)))) {
+    v_src2 = wuffs_base__slice_u8__subslice_ij(a_workbuf,
+        self->private_impl.f_vp8_plane_offsets[2],
+        self->private_impl.f_vp8_plane_offsets[3]);
+  }
+  v_width = (self->private_impl.f_vp8_mb_width * 16);
+  v_cwidth = (self->private_impl.f_vp8_mb_width * 8);
+  v_height = (self->private_impl.f_vp8_mb_height * 16);
+  v_status = wuffs_base__pixel_swizzler__swizzle_ycck(&self->private_impl.f_swizzler,
+      a_dst,
+      wuffs_base__pixel_buffer__palette_or_else(a_dst, wuffs_base__make_slice_u8(self->private_data.f_palette, 1024)),
+      self->private_impl.f_width,
+      self->private_impl.f_height,
+      v_src0,
+      v_src1,
+      v_src2,
+      wuffs_base__utility__empty_slice_u8(),
+      v_width,
+      v_cwidth,
+      v_cwidth,
+      0,
+      v_height,
+      (v_height / 2),
+      (v_height / 2),
+      0,
+      v_width,
+      v_cwidth,
+      v_cwidth,
+      0,
+      2,
+      1,
+      1,
+      0,
+      2,
+      1,
+      1,
+      0,
+      true,
+      wuffs_base__make_slice_u8(self->private_data.f_code_lengths, 2328));
+  return wuffs_base__status__ensure_not_a_suspension(v_status);
+}
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func webp.decoder.vp8_filter_across_cols_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_cols_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_rows,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  wuffs_base__slice_u8 v_s = {0};
+  uint64_t v_rows[16] = {0};
+  uint32_t v_n = 0;
+  uint32_t v_i = 0;
+  __m128i v_p3128 = {0};
+  __m128i v_p2128 = {0};
+  __m128i v_p1128 = {0};
+  __m128i v_p0128 = {0};
+  __m128i v_q0128 = {0};
+  __m128i v_q1128 = {0};
+  __m128i v_q2128 = {0};
+  __m128i v_q3128 = {0};
+  __m128i v_mask128 = {0};
+  __m128i v_nothev128 = {0};
+  __m128i v_a128 = {0};
+  __m128i v_f128 = {0};
+  __m128i v_x128 = {0};
+  __m128i v_y128 = {0};
+  __m128i v_lo128 = {0};
+  __m128i v_hi128 = {0};
+  __m128i v_sign128 = {0};
+  __m128i v_z128 = {0};
+  __m128i v_x0128 = {0};
+  __m128i v_x1128 = {0};
+  __m128i v_x2128 = {0};
+  __m128i v_x3128 = {0};
+  __m128i v_x4128 = {0};
+  __m128i v_x5128 = {0};
+  __m128i v_x6128 = {0};
+  __m128i v_x7128 = {0};
+  __m128i v_t0128 = {0};
+  __m128i v_t1128 = {0};
+  __m128i v_t2128 = {0};
+  __m128i v_t3128 = {0};
+  __m128i v_t4128 = {0};
+  __m128i v_t5128 = {0};
+  __m128i v_t6128 = {0};
+  __m128i v_t7128 = {0};
+  __m128i v_u0128 = {0};
+  __m128i v_u1128 = {0};
+  __m128i v_u2128 = {0};
+  __m128i v_u3128 = {0};
+  __m128i v_u4128 = {0};
+  __m128i v_u5128 = {0};
+  __m128i v_u6128 = {0};
+  __m128i v_u7128 = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[41].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_s = a_pix;
+  while (v_n < a_n_rows) {
+    if (((uint64_t)(v_s.len)) < 8) {
+      goto label__0__break;
+    }
+    v_rows[v_n] = wuffs_base__peek_u64le__no_bounds_check(v_s.ptr);
+    v_n += 1;
+    if (a_stride > ((uint64_t)(v_s.len))) {
+      goto label__0__break;
+    }
+    v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  }
+  label__0__break:;
+  v_x0128 = _mm_set_epi64x((int64_t)(v_rows[8]), (int64_t)(v_rows[0]));
+  v_x1128 = _mm_set_epi64x((int64_t)(v_rows[9]), (int64_t)(v_rows[1]));
+  v_x2128 = _mm_set_epi64x((int64_t)(v_rows[10]), (int64_t)(v_rows[2]));
+  v_x3128 = _mm_set_epi64x((int64_t)(v_rows[11]), (int64_t)(v_rows[3]));
+  v_x4128 = _mm_set_epi64x((int64_t)(v_rows[12]), (int64_t)(v_rows[4]));
+  v_x5128 = _mm_set_epi64x((int64_t)(v_rows[13]), (int64_t)(v_rows[5]));
+  v_x6128 = _mm_set_epi64x((int64_t)(v_rows[14]), (int64_t)(v_rows[6]));
+  v_x7128 = _mm_set_epi64x((int64_t)(v_rows[15]), (int64_t)(v_rows[7]));
+  v_t0128 = _mm_unpacklo_epi8(v_x0128, v_x1128);
+  v_t1128 = _mm_unpackhi_epi8(v_x0128, v_x1128);
+  v_t2128 = _mm_unpacklo_epi8(v_x2128, v_x3128);
+  v_t3128 = _mm_unpackhi_epi8(v_x2128, v_x3128);
+  v_t4128 = _mm_unpacklo_epi8(v_x4128, v_x5128);
+  v_t5128 = _mm_unpackhi_epi8(v_x4128, v_x5128);
+  v_t6128 = _mm_unpacklo_epi8(v_x6128, v_x7128);
+  v_t7128 = _mm_unpackhi_epi8(v_x6128, v_x7128);
+  v_u0128 = _mm_unpacklo_epi16(v_t0128, v_t2128);
+  v_u1128 = _mm_unpackhi_epi16(v_t0128, v_t2128);
+  v_u2128 = _mm_unpacklo_epi16(v_t4128, v_t6128);
+  v_u3128 = _mm_unpackhi_epi16(v_t4128, v_t6128);
+  v_u4128 = _mm_unpacklo_epi16(v_t1128, v_t3128);
+  v_u5128 = _mm_unpackhi_epi16(v_t1128, v_t3128);
+  v_u6128 = _mm_unpacklo_epi16(v_t5128, v_t7128);
+  v_u7128 = _mm_unpackhi_epi16(v_t5128, v_t7128);
+  v_t0128 = _mm_unpacklo_epi32(v_u0128, v_u2128);
+  v_t1128 = _mm_unpackhi_epi32(v_u0128, v_u2128);
+  v_t2128 = _mm_unpacklo_epi32(v_u1128, v_u3128);
+  v_t3128 = _mm_unpackhi_epi32(v_u1128, v_u3128);
+  v_t4128 = _mm_unpacklo_epi32(v_u4128, v_u6128);
+  v_t5128 = _mm_unpackhi_epi32(v_u4128, v_u6128);
+  v_t6128 = _mm_unpacklo_epi32(v_u5128, v_u7128);
+  v_t7128 = _mm_unpackhi_epi32(v_u5128, v_u7128);
+  v_p3128 = _mm_unpacklo_epi64(v_t0128, v_t4128);
+  v_p2128 = _mm_unpackhi_epi64(v_t0128, v_t4128);
+  v_p1128 = _mm_unpacklo_epi64(v_t1128, v_t5128);
+  v_p0128 = _mm_unpackhi_epi64(v_t1128, v_t5128);
+  v_q0128 = _mm_unpacklo_epi64(v_t2128, v_t6128);
+  v_q1128 = _mm_unpackhi_epi64(v_t2128, v_t6128);
+  v_q2128 = _mm_unpacklo_epi64(v_t3128, v_t7128);
+  v_q3128 = _mm_unpackhi_epi64(v_t3128, v_t7128);
+  v_x128 = _mm_or_si128(_mm_subs_epu8(v_p1128, v_q1128), _mm_subs_epu8(v_q1128, v_p1128));
+  v_x128 = _mm_srli_epi16(_mm_and_si128(v_x128, _mm_set1_epi8((int8_t)(254))), (int32_t)(1));
+  v_y128 = _mm_or_si128(_mm_subs_epu8(v_p0128, v_q0128), _mm_subs_epu8(v_q0128, v_p0128));
+  v_y128 = _mm_adds_epu8(_mm_adds_epu8(v_y128, v_y128), v_x128);
+  v_mask128 = _mm_cmpeq_epi8(_mm_subs_epu8(v_y128, _mm_set1_epi8((int8_t)(((uint8_t)(a_limit))))), v_z128);
+  if (a_kind > 0) {
+    v_x128 = _mm_or_si128(_mm_subs_epu8(v_p1128, v_p0128), _mm_subs_epu8(v_p0128, v_p1128));
+    v_y128 = _mm_or_si128(_mm_subs_epu8(v_q1128, v_q0128), _mm_subs_epu8(v_q0128, v_q1128));
+    v_x128 = _mm_max_epu8(v_x128, v_y128);
+    v_nothev128 = _mm_cmpeq_epi8(_mm_subs_epu8(v_x128, _mm_set1_epi8((int8_t)(((uint8_t)(a_hev))))), v_z128);
+    v_y128 = _mm_or_si128(_mm_subs_epu8(v_p3128, v_p2128), _mm_subs_epu8(v_p2128, v_p3128));
+    v_x128 = _mm_max_epu8(v_x128, v_y128);
+    v_y128 = _mm_or_si128(_mm_subs_epu8(v_p2128, v_p1128), _mm_subs_epu8(v_p1128, v_p2128));
+    v_x128 = _mm_max_epu8(v_x128, v_y128);
+    v_y128 = _mm_or_si128(_mm_subs_epu8(v_q3128, v_q2128), _mm_subs_epu8(v_q2128, v_q3128));
+    v_x128 = _mm_max_epu8(v_x128, v_y128);
+    v_y128 = _mm_or_si128(_mm_subs_epu8(v_q2128, v_q1128), _mm_subs_epu8(v_q1128, v_q2128));
+    v_x128 = _mm_max_epu8(v_x128, v_y128);
+    v_mask128 = _mm_and_si128(v_mask128, _mm_cmpeq_epi8(_mm_subs_epu8(v_x128, _mm_set1_epi8((int8_t)(((uint8_t)(a_ilevel))))), v_z128));
+  }
+  v_sign128 = _mm_set1_epi8((int8_t)(128));
+  v_p2128 = _mm_xor_si128(v_p2128, v_sign128);
+  v_p1128 = _mm_xor_si128(v_p1128, v_sign128);
+  v_p0128 = _mm_xor_si128(v_p0128, v_sign128);
+  v_q0128 = _mm_xor_si128(v_q0128, v_sign128);
+  v_q1128 = _mm_xor_si128(v_q1128, v_sign128);
+  v_q2128 = _mm_xor_si128(v_q2128, v_sign128);
+  v_a128 = _mm_subs_epi8(v_p1128, v_q1128);
+  if (a_kind == 1) {
+    v_a128 = _mm_andnot_si128(v_nothev128, v_a128);
+  }
+  v_x128 = _mm_subs_epi8(v_q0128, v_p0128);
+  v_a128 = _mm_adds_epi8(_mm_adds_epi8(_mm_adds_epi8(v_a128, v_x128), v_x128), v_x128);
+  if (a_kind < 2) {
+    v_f128 = _mm_and_si128(v_a128, v_mask128);
+    v_x128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(3)));
+    v_x128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_x128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_x128), (int32_t)(11)));
+    v_y128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(4)));
+    v_y128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_y128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_y128), (int32_t)(11)));
+    v_p0128 = _mm_adds_epi8(v_p0128, v_x128);
+    v_q0128 = _mm_subs_epi8(v_q0128, v_y128);
+    if (a_kind == 1) {
+      v_y128 = _mm_and_si128(_mm_sub_epi8(_mm_avg_epu8(_mm_add_epi8(v_y128, v_sign128), v_z128), _mm_set1_epi8((int8_t)(64))), v_nothev128);
+      v_p1128 = _mm_adds_epi8(v_p1128, v_y128);
+      v_q1128 = _mm_subs_epi8(v_q1128, v_y128);
+    }
+  } else {
+    v_f128 = _mm_and_si128(_mm_andnot_si128(v_nothev128, v_mask128), v_a128);
+    v_x128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(3)));
+    v_x128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_x128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_x128), (int32_t)(11)));
+    v_y128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(4)));
+    v_y128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_y128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_y128), (int32_t)(11)));
+    v_p0128 = _mm_adds_epi8(v_p0128, v_x128);
+    v_q0128 = _mm_subs_epi8(v_q0128, v_y128);
+    v_f128 = _mm_and_si128(_mm_and_si128(v_nothev128, v_mask128), v_a128);
+    v_lo128 = _mm_mulhi_epi16(_mm_unpacklo_epi8(v_z128, v_f128), _mm_set1_epi16((int16_t)(2304)));
+    v_hi128 = _mm_mulhi_epi16(_mm_unpackhi_epi8(v_z128, v_f128), _mm_set1_epi16((int16_t)(2304)));
+    v_x128 = _mm_add_epi16(v_lo128, _mm_set1_epi16((int16_t)(63)));
+    v_y128 = _mm_add_epi16(v_hi128, _mm_set1_epi16((int16_t)(63)));
+    v_f128 = _mm_packs_epi16(_mm_srai_epi16(v_x128, (int32_t)(7)), _mm_srai_epi16(v_y128, (int32_t)(7)));
+    v_p2128 = _mm_adds_epi8(v_p2128, v_f128);
+    v_q2128 = _mm_subs_epi8(v_q2128, v_f128);
+    v_x128 = _mm_add_epi16(v_x128, v_lo128);
+    v_y128 = _mm_add_epi16(v_y128, v_hi128);
+    v_f128 = _mm_packs_epi16(_mm_srai_epi16(v_x128, (int32_t)(7)), _mm_srai_epi16(v_y128, (int32_t)(7)));
+    v_p1128 = _mm_adds_epi8(v_p1128, v_f128);
+    v_q1128 = _mm_subs_epi8(v_q1128, v_f128);
+    v_x128 = _mm_add_epi16(v_x128, v_lo128);
+    v_y128 = _mm_add_epi16(v_y128, v_hi128);
+    v_f128 = _mm_packs_epi16(_mm_srai_epi16(v_x128, (int32_t)(7)), _mm_srai_epi16(v_y128, (int32_t)(7)));
+    v_p0128 = _mm_adds_epi8(v_p0128, v_f128);
+    v_q0128 = _mm_subs_epi8(v_q0128, v_f128);
+  }
+  v_p2128 = _mm_xor_si128(v_p2128, v_sign128);
+  v_p1128 = _mm_xor_si128(v_p1128, v_sign128);
+  v_p0128 = _mm_xor_si128(v_p0128, v_sign128);
+  v_q0128 = _mm_xor_si128(v_q0128, v_sign128);
+  v_q1128 = _mm_xor_si128(v_q1128, v_sign128);
+  v_q2128 = _mm_xor_si128(v_q2128, v_sign128);
+  v_t0128 = _mm_unpacklo_epi8(v_p3128, v_p2128);
+  v_t1128 = _mm_unpackhi_epi8(v_p3128, v_p2128);
+  v_t2128 = _mm_unpacklo_epi8(v_p1128, v_p0128);
+  v_t3128 = _mm_unpackhi_epi8(v_p1128, v_p0128);
+  v_t4128 = _mm_unpacklo_epi8(v_q0128, v_q1128);
+  v_t5128 = _mm_unpackhi_epi8(v_q0128, v_q1128);
+  v_t6128 = _mm_unpacklo_epi8(v_q2128, v_q3128);
+  v_t7128 = _mm_unpackhi_epi8(v_q2128, v_q3128);
+  v_u0128 = _mm_unpacklo_epi16(v_t0128, v_t2128);
+  v_u1128 = _mm_unpackhi_epi16(v_t0128, v_t2128);
+  v_u2128 = _mm_unpacklo_epi16(v_t4128, v_t6128);
+  v_u3128 = _mm_unpackhi_epi16(v_t4128, v_t6128);
+  v_u4128 = _mm_unpacklo_epi16(v_t1128, v_t3128);
+  v_u5128 = _mm_unpackhi_epi16(v_t1128, v_t3128);
+  v_u6128 = _mm_unpacklo_epi16(v_t5128, v_t7128);
+  v_u7128 = _mm_unpackhi_epi16(v_t5128, v_t7128);
+  v_t0128 = _mm_unpacklo_epi32(v_u0128, v_u2128);
+  v_t1128 = _mm_unpackhi_epi32(v_u0128, v_u2128);
+  v_t2128 = _mm_unpacklo_epi32(v_u1128, v_u3128);
+  v_t3128 = _mm_unpackhi_epi32(v_u1128, v_u3128);
+  v_t4128 = _mm_unpacklo_epi32(v_u4128, v_u6128);
+  v_t5128 = _mm_unpackhi_epi32(v_u4128, v_u6128);
+  v_t6128 = _mm_unpacklo_epi32(v_u5128, v_u7128);
+  v_t7128 = _mm_unpackhi_epi32(v_u5128, v_u7128);
+  v_x0128 = _mm_unpacklo_epi64(v_t0128, v_t4128);
+  v_x1128 = _mm_unpackhi_epi64(v_t0128, v_t4128);
+  v_x2128 = _mm_unpacklo_epi64(v_t1128, v_t5128);
+  v_x3128 = _mm_unpackhi_epi64(v_t1128, v_t5128);
+  v_x4128 = _mm_unpacklo_epi64(v_t2128, v_t6128);
+  v_x5128 = _mm_unpackhi_epi64(v_t2128, v_t6128);
+  v_x6128 = _mm_unpacklo_epi64(v_t3128, v_t7128);
+  v_x7128 = _mm_unpackhi_epi64(v_t3128, v_t7128);
+  v_rows[0] = ((uint64_t)(_mm_cvtsi128_si64(v_x0128)));
+  v_rows[8] = ((uint64_t)(_mm_extract_epi64(v_x0128, (int32_t)(1))));
+  v_rows[1] = ((uint64_t)(_mm_cvtsi128_si64(v_x1128)));
+  v_rows[9] = ((uint64_t)(_mm_extract_epi64(v_x1128, (int32_t)(1))));
+  v_rows[2] = ((uint64_t)(_mm_cvtsi128_si64(v_x2128)));
+  v_rows[10] = ((uint64_t)(_mm_extract_epi64(v_x2128, (int32_t)(1))));
+  v_rows[3] = ((uint64_t)(_mm_cvtsi128_si64(v_x3128)));
+  v_rows[11] = ((uint64_t)(_mm_extract_epi64(v_x3128, (int32_t)(1))));
+  v_rows[4] = ((uint64_t)(_mm_cvtsi128_si64(v_x4128)));
+  v_rows[12] = ((uint64_t)(_mm_extract_epi64(v_x4128, (int32_t)(1))));
+  v_rows[5] = ((uint64_t)(_mm_cvtsi128_si64(v_x5128)));
+  v_rows[13] = ((uint64_t)(_mm_extract_epi64(v_x5128, (int32_t)(1))));
+  v_rows[6] = ((uint64_t)(_mm_cvtsi128_si64(v_x6128)));
+  v_rows[14] = ((uint64_t)(_mm_extract_epi64(v_x6128, (int32_t)(1))));
+  v_rows[7] = ((uint64_t)(_mm_cvtsi128_si64(v_x7128)));
+  v_rows[15] = ((uint64_t)(_mm_extract_epi64(v_x7128, (int32_t)(1))));
+  v_s = a_pix;
+  while (v_i < v_n) {
+    if (((uint64_t)(v_s.len)) < 8) {
+      return wuffs_base__make_empty_struct();
+    }
+    wuffs_base__poke_u64le__no_bounds_check(v_s.ptr, v_rows[v_i]);
+    v_i += 1;
+    if (a_stride > ((uint64_t)(v_s.len))) {
+      return wuffs_base__make_empty_struct();
+    }
+    v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+// -------- func webp.decoder.vp8_filter_across_rows_x86_sse42
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static wuffs_base__empty_struct
+wuffs_webp__decoder__vp8_filter_across_rows_x86_sse42(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_pix,
+    uint64_t a_stride,
+    uint32_t a_n_cols,
+    uint32_t a_kind,
+    uint32_t a_limit,
+    uint32_t a_ilevel,
+    uint32_t a_hev) {
+  wuffs_base__slice_u8 v_s = {0};
+  wuffs_base__slice_u8 v_s0 = {0};
+  wuffs_base__slice_u8 v_s1 = {0};
+  wuffs_base__slice_u8 v_s2 = {0};
+  wuffs_base__slice_u8 v_s3 = {0};
+  wuffs_base__slice_u8 v_s4 = {0};
+  wuffs_base__slice_u8 v_s5 = {0};
+  wuffs_base__slice_u8 v_s6 = {0};
+  wuffs_base__slice_u8 v_s7 = {0};
+  wuffs_base__slice_u8 v_r0 = {0};
+  wuffs_base__slice_u8 v_r1 = {0};
+  wuffs_base__slice_u8 v_r2 = {0};
+  wuffs_base__slice_u8 v_r3 = {0};
+  wuffs_base__slice_u8 v_r4 = {0};
+  wuffs_base__slice_u8 v_r5 = {0};
+  wuffs_base__slice_u8 v_r6 = {0};
+  wuffs_base__slice_u8 v_r7 = {0};
+  uint64_t v_n = 0;
+  __m128i v_p3128 = {0};
+  __m128i v_p2128 = {0};
+  __m128i v_p1128 = {0};
+  __m128i v_p0128 = {0};
+  __m128i v_q0128 = {0};
+  __m128i v_q1128 = {0};
+  __m128i v_q2128 = {0};
+  __m128i v_q3128 = {0};
+  __m128i v_mask128 = {0};
+  __m128i v_nothev128 = {0};
+  __m128i v_a128 = {0};
+  __m128i v_f128 = {0};
+  __m128i v_x128 = {0};
+  __m128i v_y128 = {0};
+  __m128i v_lo128 = {0};
+  __m128i v_hi128 = {0};
+  __m128i v_sign128 = {0};
+  __m128i v_z128 = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[42].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_n = ((uint64_t)(a_n_cols));
+  v_s = a_pix;
+  if (v_n > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s0 = wuffs_base__slice_u8__subslice_j(v_s, v_n);
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s1 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s2 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s3 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s4 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s5 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s6 = v_s;
+  if (a_stride > ((uint64_t)(v_s.len))) {
+    return wuffs_base__make_empty_struct();
+  }
+  v_s = wuffs_base__slice_u8__subslice_i(v_s, a_stride);
+  v_s7 = v_s;
+  {
+    wuffs_base__slice_u8 i_slice_r0 = v_s0;
+    v_r0.ptr = i_slice_r0.ptr;
+    wuffs_base__slice_u8 i_slice_r1 = v_s1;
+    v_r1.ptr = i_slice_r1.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r1.len)));
+    wuffs_base__slice_u8 i_slice_r2 = v_s2;
+    v_r2.ptr = i_slice_r2.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r2.len)));
+    wuffs_base__slice_u8 i_slice_r3 = v_s3;
+    v_r3.ptr = i_slice_r3.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r3.len)));
+    wuffs_base__slice_u8 i_slice_r4 = v_s4;
+    v_r4.ptr = i_slice_r4.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r4.len)));
+    wuffs_base__slice_u8 i_slice_r5 = v_s5;
+    v_r5.ptr = i_slice_r5.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r5.len)));
+    wuffs_base__slice_u8 i_slice_r6 = v_s6;
+    v_r6.ptr = i_slice_r6.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r6.len)));
+    wuffs_base__slice_u8 i_slice_r7 = v_s7;
+    v_r7.ptr = i_slice_r7.ptr;
+    i_slice_r0.len = ((size_t)(wuffs_base__u64__min(i_slice_r0.len, i_slice_r7.len)));
+    v_r0.len = 8;
+    v_r1.len = 8;
+    v_r2.len = 8;
+    v_r3.len = 8;
+    v_r4.len = 8;
+    v_r5.len = 8;
+    v_r6.len = 8;
+    v_r7.len = 8;
+    uint8_t* i_end0_r0 = v_r0.ptr + (((i_slice_r0.len - (size_t)(v_r0.ptr - i_slice_r0.ptr)) / 8) * 8);
+    while (v_r0.ptr < i_end0_r0) {
+      v_p3128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r0.ptr)));
+      v_p2128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r1.ptr)));
+      v_p1128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r2.ptr)));
+      v_p0128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r3.ptr)));
+      v_q0128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r4.ptr)));
+      v_q1128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r5.ptr)));
+      v_q2128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r6.ptr)));
+      v_q3128 = _mm_cvtsi64x_si128((int64_t)(wuffs_base__peek_u64le__no_bounds_check(v_r7.ptr)));
+      v_x128 = _mm_or_si128(_mm_subs_epu8(v_p1128, v_q1128), _mm_subs_epu8(v_q1128, v_p1128));
+      v_x128 = _mm_srli_epi16(_mm_and_si128(v_x128, _mm_set1_epi8((int8_t)(254))), (int32_t)(1));
+      v_y128 = _mm_or_si128(_mm_subs_epu8(v_p0128, v_q0128), _mm_subs_epu8(v_q0128, v_p0128));
+      v_y128 = _mm_adds_epu8(_mm_adds_epu8(v_y128, v_y128), v_x128);
+      v_mask128 = _mm_cmpeq_epi8(_mm_subs_epu8(v_y128, _mm_set1_epi8((int8_t)(((uint8_t)(a_limit))))), v_z128);
+      if (a_kind > 0) {
+        v_x128 = _mm_or_si128(_mm_subs_epu8(v_p1128, v_p0128), _mm_subs_epu8(v_p0128, v_p1128));
+        v_y128 = _mm_or_si128(_mm_subs_epu8(v_q1128, v_q0128), _mm_subs_epu8(v_q0128, v_q1128));
+        v_x128 = _mm_max_epu8(v_x128, v_y128);
+        v_nothev128 = _mm_cmpeq_epi8(_mm_subs_epu8(v_x128, _mm_set1_epi8((int8_t)(((uint8_t)(a_hev))))), v_z128);
+        v_y128 = _mm_or_si128(_mm_subs_epu8(v_p3128, v_p2128), _mm_subs_epu8(v_p2128, v_p3128));
+        v_x128 = _mm_max_epu8(v_x128, v_y128);
+        v_y128 = _mm_or_si128(_mm_subs_epu8(v_p2128, v_p1128), _mm_subs_epu8(v_p1128, v_p2128));
+        v_x128 = _mm_max_epu8(v_x128, v_y128);
+        v_y128 = _mm_or_si128(_mm_subs_epu8(v_q3128, v_q2128), _mm_subs_epu8(v_q2128, v_q3128));
+        v_x128 = _mm_max_epu8(v_x128, v_y128);
+        v_y128 = _mm_or_si128(_mm_subs_epu8(v_q2128, v_q1128), _mm_subs_epu8(v_q1128, v_q2128));
+        v_x128 = _mm_max_epu8(v_x128, v_y128);
+        v_mask128 = _mm_and_si128(v_mask128, _mm_cmpeq_epi8(_mm_subs_epu8(v_x128, _mm_set1_epi8((int8_t)(((uint8_t)(a_ilevel))))), v_z128));
+      }
+      v_sign128 = _mm_set1_epi8((int8_t)(128));
+      v_p2128 = _mm_xor_si128(v_p2128, v_sign128);
+      v_p1128 = _mm_xor_si128(v_p1128, v_sign128);
+      v_p0128 = _mm_xor_si128(v_p0128, v_sign128);
+      v_q0128 = _mm_xor_si128(v_q0128, v_sign128);
+      v_q1128 = _mm_xor_si128(v_q1128, v_sign128);
+      v_q2128 = _mm_xor_si128(v_q2128, v_sign128);
+      v_a128 = _mm_subs_epi8(v_p1128, v_q1128);
+      if (a_kind == 1) {
+        v_a128 = _mm_andnot_si128(v_nothev128, v_a128);
+      }
+      v_x128 = _mm_subs_epi8(v_q0128, v_p0128);
+      v_a128 = _mm_adds_epi8(_mm_adds_epi8(_mm_adds_epi8(v_a128, v_x128), v_x128), v_x128);
+      if (a_kind < 2) {
+        v_f128 = _mm_and_si128(v_a128, v_mask128);
+        v_x128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(3)));
+        v_x128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_x128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_x128), (int32_t)(11)));
+        v_y128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(4)));
+        v_y128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_y128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_y128), (int32_t)(11)));
+        v_p0128 = _mm_adds_epi8(v_p0128, v_x128);
+        v_q0128 = _mm_subs_epi8(v_q0128, v_y128);
+        if (a_kind == 1) {
+          v_y128 = _mm_and_si128(_mm_sub_epi8(_mm_avg_epu8(_mm_add_epi8(v_y128, v_sign128), v_z128), _mm_set1_epi8((int8_t)(64))), v_nothev128);
+          v_p1128 = _mm_adds_epi8(v_p1128, v_y128);
+          v_q1128 = _mm_subs_epi8(v_q1128, v_y128);
+        }
+      } else {
+        v_f128 = _mm_and_si128(_mm_andnot_si128(v_nothev128, v_mask128), v_a128);
+        v_x128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(3)));
+        v_x128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_x128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_x128), (int32_t)(11)));
+        v_y128 = _mm_adds_epi8(v_f128, _mm_set1_epi8((int8_t)(4)));
+        v_y128 = _mm_packs_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(v_z128, v_y128), (int32_t)(11)), _mm_srai_epi16(_mm_unpackhi_epi8(v_z128, v_y128), (int32_t)(11)));
+        v_p0128 = _mm_adds_epi8(v_p0128, v_x128);
+        v_q0128 = _mm_subs_epi8(v_q0128, v_y128);
+        v_f128 = _mm_and_si128(_mm_and_si128(v_nothev128, v_mask128), v_a128);
+        v_lo128 = _mm_mulhi_epi16(_mm_unpacklo_epi8(v_z128, v_f128), _mm_set1_epi16((int16_t)(2304)));
+        v_hi128 = _mm_mulhi_epi16(_mm_unpackhi_epi8(v_z128, v_f128), _mm_set1_epi16((int16_t)(2304)));
+        v_x128 = _mm_add_epi16(v_lo128, _mm_set1_epi16((int16_t)(63)));
+        v_y128 = _mm_add_epi16(v_hi128, _mm_set1_epi16((int16_t)(63)));
+        v_f128 = _mm_packs_epi16(_mm_srai_epi16(v_x128, (int32_t)(7)), _mm_srai_epi16(v_y128, (int32_t)(7)));
+        v_p2128 = _mm_adds_epi8(v_p2128, v_f128);
+        v_q2128 = _mm_subs_epi8(v_q2128, v_f128);
+        v_x128 = _mm_add_epi16(v_x128, v_lo128);
+        v_y128 = _mm_add_epi16(v_y128, v_hi128);
+        v_f128 = _mm_packs_epi16(_mm_srai_epi16(v_x128, (int32_t)(7)), _mm_srai_epi16(v_y128, (int32_t)(7)));
+        v_p1128 = _mm_adds_epi8(v_p1128, v_f128);
+        v_q1128 = _mm_subs_epi8(v_q1128, v_f128);
+        v_x128 = _mm_add_epi16(v_x128, v_lo128);
+        v_y128 = _mm_add_epi16(v_y128, v_hi128);
+        v_f128 = _mm_packs_epi16(_mm_srai_epi16(v_x128, (int32_t)(7)), _mm_srai_epi16(v_y128, (int32_t)(7)));
+        v_p0128 = _mm_adds_epi8(v_p0128, v_f128);
+        v_q0128 = _mm_subs_epi8(v_q0128, v_f128);
+      }
+      v_p2128 = _mm_xor_si128(v_p2128, v_sign128);
+      v_p1128 = _mm_xor_si128(v_p1128, v_sign128);
+      v_p0128 = _mm_xor_si128(v_p0128, v_sign128);
+      v_q0128 = _mm_xor_si128(v_q0128, v_sign128);
+      v_q1128 = _mm_xor_si128(v_q1128, v_sign128);
+      v_q2128 = _mm_xor_si128(v_q2128, v_sign128);
+      _mm_storeu_si64((void*)(v_r1.ptr), v_p2128);
+      _mm_storeu_si64((void*)(v_r2.ptr), v_p1128);
+      _mm_storeu_si64((void*)(v_r3.ptr), v_p0128);
+      _mm_storeu_si64((void*)(v_r4.ptr), v_q0128);
+      _mm_storeu_si64((void*)(v_r5.ptr), v_q1128);
+      _mm_storeu_si64((void*)(v_r6.ptr), v_q2128);
+      v_r0.ptr += 8;
+      v_r1.ptr += 8;
+      v_r2.ptr += 8;
+      v_r3.ptr += 8;
+      v_r4.ptr += 8;
+      v_r5.ptr += 8;
+      v_r6.ptr += 8;
+      v_r7.ptr += 8;
+    }
+    v_r0.len = 0;
+    v_r1.len = 0;
+    v_r2.len = 0;
+    v_r3.len = 0;
+    v_r4.len = 0;
+    v_r5.len = 0;
+    v_r6.len = 0;
+    v_r7.len = 0;
+  }
+  return wuffs_base__make_empty_struct();
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+// -------- func webp.decoder.set_quirk
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__set_quirk(
+    wuffs_webp__decoder* self,
+    uint32_t a_key,
+    uint64_t a_value) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[43].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+}
+
+// -------- func webp.decoder.decode_image_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__decode_image_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 1)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[44].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_image_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_decode_image_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_decode_image_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_decode_image_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 1 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[44].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[44].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func webp.decoder.do_decode_image_config
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_image_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__image_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint32_t v_c32 = 0;
+  uint32_t v_chunk_length = 0;
+  uint64_t v_w4 = 0;
+  uint64_t v_h4 = 0;
+  uint64_t v_m = 0;
+  uint64_t v_s = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[45].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_image_config[0];
+  if (coro_susp_point) {
+    v_c32 = self->private_data.s_do_decode_image_config[0].v_c32;
+    v_chunk_length = self->private_data.s_do_decode_image_config[0].v_chunk_length;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_call_sequence != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    } else if ( ! self->private_impl.f_seen_vp8x) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        uint32_t t_0;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_0 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_0 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;
+            if (num_bits_0 == 24) {
+              t_0 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_0 += 8;
+            *scratch |= ((uint64_t)(num_bits_0)) << 56;
+          }
+        }
+        v_c32 = t_0;
+      }
+      if (v_c32 != 1179011410) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+        goto exit;
+      }
+      self->private_data.s_do_decode_image_config[0].scratch = 4;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+      if (self->private_data.s_do_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+        self->private_data.s_do_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+        iop_a_src = io2_a_src;
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        goto suspend;
+      }
+      iop_a_src += self->private_data.s_do_decode_image_config[0].scratch;
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+        uint32_t t_1;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_1 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+            if (num_bits_1 == 24) {
+              t_1 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_1 += 8;
+            *scratch |= ((uint64_t)(num_bits_1)) << 56;
+          }
+        }
+        v_c32 = t_1;
+      }
+      if (v_c32 != 1346520407) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+        goto exit;
+      }
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+        uint32_t t_2;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_2 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(7);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_2 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;
+            if (num_bits_2 == 24) {
+              t_2 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_2 += 8;
+            *scratch |= ((uint64_t)(num_bits_2)) << 56;
+          }
+        }
+        v_c32 = t_2;
+      }
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(8);
+        uint32_t t_3;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_3 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(9);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_3 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;
+            if (num_bits_3 == 24) {
+              t_3 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_3 += 8;
+            *scratch |= ((uint64_t)(num_bits_3)) << 56;
+          }
+        }
+        v_chunk_length = t_3;
+      }
+      if (v_c32 == 1480085590) {
+        if (v_chunk_length < 10) {
+          status = wuffs_base__make_status(wuffs_webp__error__short_chunk);
+          goto exit;
+        }
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(10);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint32_t t_4 = *iop_a_src++;
+          v_c32 = t_4;
+        }
+        if ((v_c32 & 2) != 0) {
+          status = wuffs_base__make_status(wuffs_webp__error__unsupported_webp_file);
+          goto exit;
+        }
+        self->private_data.s_do_decode_image_config[0].scratch = ((v_chunk_length - 1) + (v_chunk_length & 1));
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(11);
+        if (self->private_data.s_do_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+          self->private_data.s_do_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+          iop_a_src = io2_a_src;
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        iop_a_src += self->private_data.s_do_decode_image_config[0].scratch;
+        self->private_impl.f_seen_vp8x = true;
+      }
+    }
+    if (self->private_impl.f_seen_vp8x) {
+      while (true) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(12);
+          uint32_t t_5;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_5 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(13);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_5 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_5;
+              if (num_bits_5 == 24) {
+                t_5 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_5 += 8;
+              *scratch |= ((uint64_t)(num_bits_5)) << 56;
+            }
+          }
+          v_c32 = t_5;
+        }
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(14);
+          uint32_t t_6;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_6 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(15);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_6 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;
+              if (num_bits_6 == 24) {
+                t_6 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_6 += 8;
+              *scratch |= ((uint64_t)(num_bits_6)) << 56;
+            }
+          }
+          v_chunk_length = t_6;
+        }
+        if ((v_c32 == 1278758998) || (v_c32 == 540561494)) {
+          goto label__fast__0__break;
+        } else if (v_c32 == 1213221953) {
+          status = wuffs_base__make_status(wuffs_webp__error__unsupported_webp_file);
+          goto exit;
+        } else if (v_chunk_length > 4294967294) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+          goto exit;
+        }
+        if (((v_c32 == 1179211845) && self->private_impl.f_report_metadata_exif) || ((v_c32 == 1346585417) && self->private_impl.f_report_metadata_iccp) || ((v_c32 == 542133592) && self->private_impl.f_report_metadata_xmp)) {
+          self->private_impl.f_metadata_fourcc = (((v_c32 & 255) << 24) |
+              ((v_c32 & 65280) << 8) |
+              ((v_c32 >> 8) & 65280) |
+              (v_c32 >> 24));
+          self->private_impl.f_metadata_padding = (v_chunk_length & 1);
+          self->private_impl.f_metadata_y = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+          self->private_impl.f_metadata_z = wuffs_base__u64__sat_add(self->private_impl.f_metadata_y, ((uint64_t)(v_chunk_length)));
+          self->private_impl.f_call_sequence = 16;
+          status = wuffs_base__make_status(wuffs_base__note__metadata_reported);
+          goto ok;
+        }
+        self->private_data.s_do_decode_image_config[0].scratch = (v_chunk_length + (v_chunk_length & 1));
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(16);
+        if (self->private_data.s_do_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+          self->private_data.s_do_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+          iop_a_src = io2_a_src;
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        iop_a_src += self->private_data.s_do_decode_image_config[0].scratch;
+      }
+      label__fast__0__break:;
+    }
+    if (v_c32 == 540561494) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(17);
+      status = wuffs_webp__decoder__do_decode_image_config_vp8(self, a_src, v_chunk_length);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+      if (a_dst != NULL) {
+        wuffs_base__image_config__set(
+            a_dst,
+            self->private_impl.f_pixfmt,
+            0,
+            self->private_impl.f_width,
+            self->private_impl.f_height,
+            self->private_impl.f_frame_config_io_position,
+            true);
+      }
+      self->private_impl.f_call_sequence = 32;
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    } else if (v_c32 != 1278758998) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    } else if (v_chunk_length < 5) {
+      status = wuffs_base__make_status(wuffs_webp__error__short_chunk);
+      goto exit;
+    }
+    {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(18);
+      if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        goto suspend;
+      }
+      uint32_t t_7 = *iop_a_src++;
+      v_c32 = t_7;
+    }
+    if (v_c32 != 47) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    {
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(19);
+      uint32_t t_8;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+        t_8 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+        iop_a_src += 4;
+      } else {
+        self->private_data.s_do_decode_image_config[0].scratch = 0;
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(20);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+          uint32_t num_bits_8 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_8;
+          if (num_bits_8 == 24) {
+            t_8 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_8 += 8;
+          *scratch |= ((uint64_t)(num_bits_8)) << 56;
+        }
+      }
+      v_c32 = t_8;
+    }
+    if ((v_c32 >> 29) != 0) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    self->private_impl.f_width = ((v_c32 & 16383) + 1);
+    self->private_impl.f_height = (((v_c32 >> 14) & 16383) + 1);
+    self->private_impl.f_pixfmt = 2164295816;
+    v_w4 = ((uint64_t)(((self->private_impl.f_width + 3) >> 2)));
+    v_h4 = ((uint64_t)(((self->private_impl.f_height + 3) >> 2)));
+    v_m = (((uint64_t)(self->private_impl.f_width)) * ((uint64_t)(self->private_impl.f_height)) * 4);
+    v_s = (v_w4 * v_h4 * 4);
+    self->private_impl.f_workbuf_offset_for_transform[0] = v_m;
+    self->private_impl.f_workbuf_offset_for_transform[1] = (v_m + v_s);
+    self->private_impl.f_workbuf_offset_for_transform[2] = (v_m + v_s + v_s);
+    self->private_impl.f_workbuf_offset_for_transform[3] = (v_m +
+        v_s +
+        v_s +
+        v_s);
+    self->private_impl.f_overall_workbuf_length = (v_m +
+        v_s +
+        v_s +
+        v_s +
+        1024);
+    self->private_impl.choosy_apply_transform_subtract_green = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__apply_transform_subtract_green_x86_sse42 :
+#endif
+        self->private_impl.choosy_apply_transform_subtract_green);
+    self->private_impl.choosy_cross_color_segment = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__cross_color_segment_x86_sse42 :
+#endif
+        self->private_impl.choosy_cross_color_segment);
+    self->private_impl.choosy_predict_segment_no_left = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__predict_segment_no_left_x86_sse42 :
+#endif
+        self->private_impl.choosy_predict_segment_no_left);
+    self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+    if (a_dst != NULL) {
+      wuffs_base__image_config__set(
+          a_dst,
+          self->private_impl.f_pixfmt,
+          0,
+          self->private_impl.f_width,
+          self->private_impl.f_height,
+          self->private_impl.f_frame_config_io_position,
+          false);
+    }
+    self->private_impl.f_call_sequence = 32;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_call_sequence != 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    } else if ( ! self->private_impl.f_seen_vp8x) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        uint32_t t_0;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_0 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_0 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_0;
+            if (num_bits_0 == 24) {
+              t_0 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_0 += 8;
+            *scratch |= ((uint64_t)(num_bits_0)) << 56;
+          }
+        }
+        v_c32 = t_0;
+      }
+      if (v_c32 != 1179011410) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+        goto exit;
+      }
+      self->private_data.s_do_decode_image_config[0].scratch = 4;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+      if (self->private_data.s_do_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+        self->private_data.s_do_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+        iop_a_src = io2_a_src;
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        goto suspend;
+      }
+      iop_a_src += self->private_data.s_do_decode_image_config[0].scratch;
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+        uint32_t t_1;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_1 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_1 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_1;
+            if (num_bits_1 == 24) {
+              t_1 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_1 += 8;
+            *scratch |= ((uint64_t)(num_bits_1)) << 56;
+          }
+        }
+        v_c32 = t_1;
+      }
+      if (v_c32 != 1346520407) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+        goto exit;
+      }
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+        uint32_t t_2;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_2 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_2 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_2;
+            if (num_bits_2 == 24) {
+              t_2 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_2 += 8;
+            *scratch |= ((uint64_t)(num_bits_2)) << 56;
+          }
+        }
+        v_c32 = t_2;
+      }
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+        uint32_t t_3;
+        if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+          t_3 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+          iop_a_src += 4;
+        } else {
+          self->private_data.s_do_decode_image_config[0].scratch = 0;
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(9);
+          while (true) {
+            if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+              status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+              goto suspend;
+            }
+            uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+            uint32_t num_bits_3 = ((uint32_t)(*scratch >> 56));
+            *scratch <<= 8;
+            *scratch >>= 8;
+            *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_3;
+            if (num_bits_3 == 24) {
+              t_3 = ((uint32_t)(*scratch));
+              break;
+            }
+            num_bits_3 += 8;
+            *scratch |= ((uint64_t)(num_bits_3)) << 56;
+          }
+        }
+        v_chunk_length = t_3;
+      }
+      if (v_c32 == 1480085590) {
+        if (v_chunk_length < 10) {
+          status = wuffs_base__make_status(wuffs_webp__error__short_chunk);
+          goto exit;
+        }
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(10);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint32_t t_4 = *iop_a_src++;
+          v_c32 = t_4;
+        }
+        if ((v_c32 & 2) != 0) {
+          status = wuffs_base__make_status(wuffs_webp__error__unsupported_webp_file);
+          goto exit;
+        }
+        self->private_data.s_do_decode_image_config[0].scratch = ((v_chunk_length - 1) + (v_chunk_length & 1));
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(11);
+        if (self->private_data.s_do_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+          self->private_data.s_do_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+          iop_a_src = io2_a_src;
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        iop_a_src += self->private_data.s_do_decode_image_config[0].scratch;
+        self->private_impl.f_seen_vp8x = true;
+      }
+    }
+    if (self->private_impl.f_seen_vp8x) {
+      while (true) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(12);
+          uint32_t t_5;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_5 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(13);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_5 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_5;
+              if (num_bits_5 == 24) {
+                t_5 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_5 += 8;
+              *scratch |= ((uint64_t)(num_bits_5)) << 56;
+            }
+          }
+          v_c32 = t_5;
+        }
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(14);
+          uint32_t t_6;
+          if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+            t_6 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+            iop_a_src += 4;
+          } else {
+            self->private_data.s_do_decode_image_config[0].scratch = 0;
+            WUFFS_BASE__COROUTINE_SUSPENSION_POINT(15);
+            while (true) {
+              if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+                status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+                goto suspend;
+              }
+              uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+              uint32_t num_bits_6 = ((uint32_t)(*scratch >> 56));
+              *scratch <<= 8;
+              *scratch >>= 8;
+              *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_6;
+              if (num_bits_6 == 24) {
+                t_6 = ((uint32_t)(*scratch));
+                break;
+              }
+              num_bits_6 += 8;
+              *scratch |= ((uint64_t)(num_bits_6)) << 56;
+            }
+          }
+          v_chunk_length = t_6;
+        }
+        if ((v_c32 == 1278758998) || (v_c32 == 540561494)) {
+          goto label__0__break;
+        } else if (v_c32 == 1213221953) {
+          status = wuffs_base__make_status(wuffs_webp__error__unsupported_webp_file);
+          goto exit;
+        } else if (v_chunk_length > 4294967294) {
+          status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+          goto exit;
+        }
+        if (((v_c32 == 1179211845) && self->private_impl.f_report_metadata_exif) || ((v_c32 == 1346585417) && self->private_impl.f_report_metadata_iccp) || ((v_c32 == 542133592) && self->private_impl.f_report_metadata_xmp)) {
+          self->private_impl.f_metadata_fourcc = (((v_c32 & 255) << 24) |
+              ((v_c32 & 65280) << 8) |
+              ((v_c32 >> 8) & 65280) |
+              (v_c32 >> 24));
+          self->private_impl.f_metadata_padding = (v_chunk_length & 1);
+          self->private_impl.f_metadata_y = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+          self->private_impl.f_metadata_z = wuffs_base__u64__sat_add(self->private_impl.f_metadata_y, ((uint64_t)(v_chunk_length)));
+          self->private_impl.f_call_sequence = 16;
+          status = wuffs_base__make_status(wuffs_base__note__metadata_reported);
+          goto ok;
+        }
+        self->private_data.s_do_decode_image_config[0].scratch = (v_chunk_length + (v_chunk_length & 1));
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(16);
+        if (self->private_data.s_do_decode_image_config[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+          self->private_data.s_do_decode_image_config[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+          iop_a_src = io2_a_src;
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        iop_a_src += self->private_data.s_do_decode_image_config[0].scratch;
+      }
+      label__0__break:;
+    }
+    if (v_c32 == 540561494) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(17);
+      status = wuffs_webp__decoder__do_decode_image_config_vp8(self, a_src, v_chunk_length);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+      if (a_dst != NULL) {
+        wuffs_base__image_config__set(
+            a_dst,
+            self->private_impl.f_pixfmt,
+            0,
+            self->private_impl.f_width,
+            self->private_impl.f_height,
+            self->private_impl.f_frame_config_io_position,
+            true);
+      }
+      self->private_impl.f_call_sequence = 32;
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    } else if (v_c32 != 1278758998) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    } else if (v_chunk_length < 5) {
+      status = wuffs_base__make_status(wuffs_webp__error__short_chunk);
+      goto exit;
+    }
+    {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(18);
+      if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+        status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+        goto suspend;
+      }
+      uint32_t t_7 = *iop_a_src++;
+      v_c32 = t_7;
+    }
+    if (v_c32 != 47) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    {
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(19);
+      uint32_t t_8;
+      if (WUFFS_BASE__LIKELY(io2_a_src - iop_a_src >= 4)) {
+        t_8 = wuffs_base__peek_u32le__no_bounds_check(iop_a_src);
+        iop_a_src += 4;
+      } else {
+        self->private_data.s_do_decode_image_config[0].scratch = 0;
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(20);
+        while (true) {
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint64_t* scratch = &self->private_data.s_do_decode_image_config[0].scratch;
+          uint32_t num_bits_8 = ((uint32_t)(*scratch >> 56));
+          *scratch <<= 8;
+          *scratch >>= 8;
+          *scratch |= ((uint64_t)(*iop_a_src++)) << num_bits_8;
+          if (num_bits_8 == 24) {
+            t_8 = ((uint32_t)(*scratch));
+            break;
+          }
+          num_bits_8 += 8;
+          *scratch |= ((uint64_t)(num_bits_8)) << 56;
+        }
+      }
+      v_c32 = t_8;
+    }
+    if ((v_c32 >> 29) != 0) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_header);
+      goto exit;
+    }
+    self->private_impl.f_width = ((v_c32 & 16383) + 1);
+    self->private_impl.f_height = (((v_c32 >> 14) & 16383) + 1);
+    self->private_impl.f_pixfmt = 2164295816;
+    v_w4 = ((uint64_t)(((self->private_impl.f_width + 3) >> 2)));
+    v_h4 = ((uint64_t)(((self->private_impl.f_height + 3) >> 2)));
+    v_m = (((uint64_t)(self->private_impl.f_width)) * ((uint64_t)(self->private_impl.f_height)) * 4);
+    v_s = (v_w4 * v_h4 * 4);
+    self->private_impl.f_workbuf_offset_for_transform[0] = v_m;
+    self->private_impl.f_workbuf_offset_for_transform[1] = (v_m + v_s);
+    self->private_impl.f_workbuf_offset_for_transform[2] = (v_m + v_s + v_s);
+    self->private_impl.f_workbuf_offset_for_transform[3] = (v_m +
+        v_s +
+        v_s +
+        v_s);
+    self->private_impl.f_overall_workbuf_length = (v_m +
+        v_s +
+        v_s +
+        v_s +
+        1024);
+    self->private_impl.choosy_apply_transform_subtract_green = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__apply_transform_subtract_green_x86_sse42 :
+#endif
+        self->private_impl.choosy_apply_transform_subtract_green);
+    self->private_impl.choosy_cross_color_segment = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__cross_color_segment_x86_sse42 :
+#endif
+        self->private_impl.choosy_cross_color_segment);
+    self->private_impl.choosy_predict_segment_no_left = (
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        wuffs_base__cpu_arch__have_x86_sse42() ? &wuffs_webp__decoder__predict_segment_no_left_x86_sse42 :
+#endif
+        self->private_impl.choosy_predict_segment_no_left);
+    self->private_impl.f_frame_config_io_position = wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)));
+    if (a_dst != NULL) {
+      wuffs_base__image_config__set(
+          a_dst,
+          self->private_impl.f_pixfmt,
+          0,
+          self->private_impl.f_width,
+          self->private_impl.f_height,
+          self->private_impl.f_frame_config_io_position,
+          false);
+    }
+    self->private_impl.f_call_sequence = 32;
+
+    ok:
+    self->private_impl.p_do_decode_image_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_image_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_do_decode_image_config[0].v_c32 = v_c32;
+  self->private_data.s_do_decode_image_config[0].v_chunk_length = v_chunk_length;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[45].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[45].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_frame_config
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__decode_frame_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 2)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[46].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_frame_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_decode_frame_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_decode_frame_config(self, a_dst, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_decode_frame_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 2 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[46].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[46].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func webp.decoder.do_decode_frame_config
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_frame_config(
+    wuffs_webp__decoder* self,
+    wuffs_base__frame_config* a_dst,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[47].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_frame_config[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_call_sequence == 32) {
+    } else if (self->private_impl.f_call_sequence < 32) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      status = wuffs_webp__decoder__do_decode_image_config(self, NULL, a_src);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    } else if (self->private_impl.f_call_sequence == 40) {
+      if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_restart);
+        goto exit;
+      }
+    } else if (self->private_impl.f_call_sequence == 64) {
+      self->private_impl.f_call_sequence = 96;
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    } else {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    }
+    if (a_dst != NULL) {
+      wuffs_base__frame_config__set(
+          a_dst,
+          wuffs_base__utility__make_rect_ie_u32(
+          0,
+          0,
+          self->private_impl.f_width,
+          self->private_impl.f_height),
+          ((wuffs_base__flicks)(0)),
+          0,
+          self->private_impl.f_frame_config_io_position,
+          0,
+          self->private_impl.f_is_vp8,
+          false,
+          0);
+    }
+    self->private_impl.f_call_sequence = 64;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_call_sequence == 32) {
+    } else if (self->private_impl.f_call_sequence < 32) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      status = wuffs_webp__decoder__do_decode_image_config(self, NULL, a_src);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    } else if (self->private_impl.f_call_sequence == 40) {
+      if (self->private_impl.f_frame_config_io_position != wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src)))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_restart);
+        goto exit;
+      }
+    } else if (self->private_impl.f_call_sequence == 64) {
+      self->private_impl.f_call_sequence = 96;
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    } else {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    }
+    if (a_dst != NULL) {
+      wuffs_base__frame_config__set(
+          a_dst,
+          wuffs_base__utility__make_rect_ie_u32(
+          0,
+          0,
+          self->private_impl.f_width,
+          self->private_impl.f_height),
+          ((wuffs_base__flicks)(0)),
+          0,
+          self->private_impl.f_frame_config_io_position,
+          0,
+          self->private_impl.f_is_vp8,
+          false,
+          0);
+    }
+    self->private_impl.f_call_sequence = 64;
+
+    ok:
+    self->private_impl.p_do_decode_frame_config[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_frame_config[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[47].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[47].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__decode_frame(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_dst || !a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 3)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[48].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_frame[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_decode_frame(self,
+            a_dst,
+            a_src,
+            a_blend,
+            a_workbuf,
+            a_opts);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_decode_frame(self,
+            a_dst,
+            a_src,
+            a_blend,
+            a_workbuf,
+            a_opts);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_decode_frame[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 3 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[48].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[48].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func webp.decoder.do_decode_frame
+
+static wuffs_base__status
+wuffs_webp__decoder__do_decode_frame(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__pixel_blend a_blend,
+    wuffs_base__slice_u8 a_workbuf,
+    wuffs_base__decode_frame_options* a_opts) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_color_cache_bits = 0;
+  uint64_t v_main_length = 0;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[49].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_decode_frame[0];
+  if (coro_susp_point) {
+    v_color_cache_bits = self->private_data.s_do_decode_frame[0].v_color_cache_bits;
+    v_main_length = self->private_data.s_do_decode_frame[0].v_main_length;
+    v_q = self->private_data.s_do_decode_frame[0].v_q;
+    v_q_end = self->private_data.s_do_decode_frame[0].v_q_end;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_call_sequence == 64) {
+    } else if (self->private_impl.f_call_sequence < 64) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+      status = wuffs_webp__decoder__do_decode_frame_config(self, NULL, a_src);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    } else {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    }
+    if (((uint64_t)(a_workbuf.len)) < self->private_impl.f_overall_workbuf_length) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    if (self->private_impl.f_is_vp8) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+      status = wuffs_webp__decoder__decode_vp8(self, a_dst, a_src, a_workbuf);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_call_sequence = 96;
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,
+        wuffs_base__pixel_buffer__pixel_format(a_dst),
+        wuffs_base__pixel_buffer__palette(a_dst),
+        wuffs_base__utility__make_pixel_format(self->private_impl.f_pixfmt),
+        wuffs_base__utility__empty_slice_u8(),
+        a_blend);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    self->private_impl.f_bits = 0;
+    self->private_impl.f_n_bits = 0;
+    self->private_impl.f_pixel_width = self->private_impl.f_width;
+    self->private_impl.f_n_transforms = 0;
+    self->private_impl.f_seen_transform[0] = false;
+    self->private_impl.f_seen_transform[1] = false;
+    self->private_impl.f_seen_transform[2] = false;
+    self->private_impl.f_seen_transform[3] = false;
+    while (true) {
+      v_bits = self->private_impl.f_bits;
+      v_n_bits = self->private_impl.f_n_bits;
+      if (v_n_bits < 1) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_0 = *iop_a_src++;
+          v_c8 = t_0;
+        }
+        v_bits = ((uint32_t)(v_c8));
+        v_n_bits = 8;
+      }
+      self->private_impl.f_bits = (v_bits >> 1);
+      self->private_impl.f_n_bits = ((uint32_t)(v_n_bits - 1));
+      if ((v_bits & 1) == 0) {
+        goto label__fast__0__break;
+      }
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+      status = wuffs_webp__decoder__decode_transform(self, a_src, a_workbuf);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    }
+    label__fast__0__break:;
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+    status = wuffs_webp__decoder__decode_color_cache_parameters(self, a_src);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    v_color_cache_bits = self->private_impl.f_color_cache_bits;
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(6);
+    status = wuffs_webp__decoder__decode_huffman_image(self, a_src, a_workbuf);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    self->private_impl.f_color_cache_bits = v_color_cache_bits;
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(7);
+    status = wuffs_webp__decoder__decode_huffman_groups(self, a_src, self->private_impl.f_n_huffman_groups);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    v_main_length = (((uint64_t)(self->private_impl.f_pixel_width)) * ((uint64_t)(self->private_impl.f_height)) * 4);
+    v_q = self->private_impl.f_workbuf_offset_for_transform[2];
+    v_q_end = self->private_impl.f_workbuf_offset_for_transform[3];
+    if ((v_main_length > v_q) || (v_q > v_q_end) || (v_q_end > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(8);
+    status = wuffs_webp__decoder__decode_pixels(self,
+        wuffs_base__slice_u8__subslice_j(a_workbuf, v_main_length),
+        a_src,
+        self->private_impl.f_pixel_width,
+        self->private_impl.f_height,
+        wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end),
+        self->private_impl.f_huffman_image_bits);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    v_status = wuffs_webp__decoder__apply_transforms(self, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    v_status = wuffs_webp__decoder__swizzle(self, a_dst, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    self->private_impl.f_call_sequence = 96;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_call_sequence == 64) {
+    } else if (self->private_impl.f_call_sequence < 64) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+      status = wuffs_webp__decoder__do_decode_frame_config(self, NULL, a_src);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    } else {
+      status = wuffs_base__make_status(wuffs_base__note__end_of_data);
+      goto ok;
+    }
+    if (((uint64_t)(a_workbuf.len)) < self->private_impl.f_overall_workbuf_length) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    if (self->private_impl.f_is_vp8) {
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+      status = wuffs_webp__decoder__decode_vp8(self, a_dst, a_src, a_workbuf);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      self->private_impl.f_call_sequence = 96;
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    v_status = wuffs_base__pixel_swizzler__prepare(&self->private_impl.f_swizzler,
+        wuffs_base__pixel_buffer__pixel_format(a_dst),
+        wuffs_base__pixel_buffer__palette(a_dst),
+        wuffs_base__utility__make_pixel_format(self->private_impl.f_pixfmt),
+        wuffs_base__utility__empty_slice_u8(),
+        a_blend);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    self->private_impl.f_bits = 0;
+    self->private_impl.f_n_bits = 0;
+    self->private_impl.f_pixel_width = self->private_impl.f_width;
+    self->private_impl.f_n_transforms = 0;
+    self->private_impl.f_seen_transform[0] = false;
+    self->private_impl.f_seen_transform[1] = false;
+    self->private_impl.f_seen_transform[2] = false;
+    self->private_impl.f_seen_transform[3] = false;
+    while (true) {
+      v_bits = self->private_impl.f_bits;
+      v_n_bits = self->private_impl.f_n_bits;
+      if (v_n_bits < 1) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_0 = *iop_a_src++;
+          v_c8 = t_0;
+        }
+        v_bits = ((uint32_t)(v_c8));
+        v_n_bits = 8;
+      }
+      self->private_impl.f_bits = (v_bits >> 1);
+      self->private_impl.f_n_bits = ((uint32_t)(v_n_bits - 1));
+      if ((v_bits & 1) == 0) {
+        goto label__0__break;
+      }
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+      status = wuffs_webp__decoder__decode_transform(self, a_src, a_workbuf);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    }
+    label__0__break:;
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+    status = wuffs_webp__decoder__decode_color_cache_parameters(self, a_src);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    v_color_cache_bits = self->private_impl.f_color_cache_bits;
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(6);
+    status = wuffs_webp__decoder__decode_huffman_image(self, a_src, a_workbuf);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    self->private_impl.f_color_cache_bits = v_color_cache_bits;
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(7);
+    status = wuffs_webp__decoder__decode_huffman_groups(self, a_src, self->private_impl.f_n_huffman_groups);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    v_main_length = (((uint64_t)(self->private_impl.f_pixel_width)) * ((uint64_t)(self->private_impl.f_height)) * 4);
+    v_q = self->private_impl.f_workbuf_offset_for_transform[2];
+    v_q_end = self->private_impl.f_workbuf_offset_for_transform[3];
+    if ((v_main_length > v_q) || (v_q > v_q_end) || (v_q_end > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(8);
+    status = wuffs_webp__decoder__decode_pixels(self,
+        wuffs_base__slice_u8__subslice_j(a_workbuf, v_main_length),
+        a_src,
+        self->private_impl.f_pixel_width,
+        self->private_impl.f_height,
+        wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end),
+        self->private_impl.f_huffman_image_bits);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    v_status = wuffs_webp__decoder__apply_transforms(self, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    v_status = wuffs_webp__decoder__swizzle(self, a_dst, a_workbuf);
+    if ( ! wuffs_base__status__is_ok(&v_status)) {
+      status = v_status;
+      if (wuffs_base__status__is_error(&status)) {
+        goto exit;
+      } else if (wuffs_base__status__is_suspension(&status)) {
+        status = wuffs_base__make_status(wuffs_base__error__cannot_return_a_suspension);
+        goto exit;
+      }
+      goto ok;
+    }
+    self->private_impl.f_call_sequence = 96;
+
+    ok:
+    self->private_impl.p_do_decode_frame[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_decode_frame[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_do_decode_frame[0].v_color_cache_bits = v_color_cache_bits;
+  self->private_data.s_do_decode_frame[0].v_main_length = v_main_length;
+  self->private_data.s_do_decode_frame[0].v_q = v_q;
+  self->private_data.s_do_decode_frame[0].v_q_end = v_q_end;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[49].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[49].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_transform
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_transform(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_transform_type = 0;
+  uint32_t v_tile_size_log2 = 0;
+  uint32_t v_n_colors = 0;
+  uint32_t v_n_deltas = 0;
+  uint32_t v_p = 0;
+  uint32_t v_n = 0;
+  uint64_t v_q = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[50].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_transform[0];
+  if (coro_susp_point) {
+    v_bits = self->private_data.s_decode_transform[0].v_bits;
+    v_n_bits = self->private_data.s_decode_transform[0].v_n_bits;
+    v_transform_type = self->private_data.s_decode_transform[0].v_transform_type;
+    v_tile_size_log2 = self->private_data.s_decode_transform[0].v_tile_size_log2;
+    v_n_colors = self->private_data.s_decode_transform[0].v_n_colors;
+    v_n_deltas = self->private_data.s_decode_transform[0].v_n_deltas;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if (self->private_impl.f_n_transforms >= 4) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+      goto exit;
+    }
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 2) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_transform_type = (v_bits & 3);
+    v_bits >>= 2;
+    v_n_bits -= 2;
+    if (self->private_impl.f_seen_transform[v_transform_type] || (self->private_impl.f_n_transforms >= 4)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+      goto exit;
+    }
+    self->private_impl.f_seen_transform[v_transform_type] = true;
+    self->private_impl.f_transform_type[self->private_impl.f_n_transforms] = v_transform_type;
+    self->private_impl.f_transform_tile_size_log2[self->private_impl.f_n_transforms] = 0;
+    self->private_impl.f_transform_width[self->private_impl.f_n_transforms] = self->private_impl.f_pixel_width;
+    if (v_transform_type < 2) {
+      while (v_n_bits < 3) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_1 = *iop_a_src++;
+          v_c8 = t_1;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_tile_size_log2 = ((v_bits & 7) + 2);
+      self->private_impl.f_bits = (v_bits >> 3);
+      self->private_impl.f_n_bits = (v_n_bits - 3);
+      if (self->private_impl.f_n_transforms >= 4) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+        goto exit;
+      }
+      self->private_impl.f_transform_tile_size_log2[self->private_impl.f_n_transforms] = v_tile_size_log2;
+      self->private_impl.f_n_transforms += 1;
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+      status = wuffs_webp__decoder__decode_sub_image(self,
+          a_src,
+          a_workbuf,
+          self->private_impl.f_workbuf_offset_for_transform[v_transform_type],
+          (((self->private_impl.f_pixel_width + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2),
+          (((self->private_impl.f_height + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2));
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    } else if (v_transform_type == 2) {
+      self->private_impl.f_bits = v_bits;
+      self->private_impl.f_n_bits = v_n_bits;
+      self->private_impl.f_n_transforms += 1;
+    } else {
+      while (v_n_bits < 8) {
+        {
+          WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(4);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_2 = *iop_a_src++;
+          v_c8 = t_2;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_n_colors = ((v_bits & 255) + 1);
+      v_n_deltas = ((v_bits & 255) * 4);
+      self->private_impl.f_bits = (v_bits >> 8);
+      self->private_impl.f_n_bits = (v_n_bits - 8);
+      if (v_n_colors > 16) {
+        v_tile_size_log2 = 0;
+      } else if (v_n_colors > 4) {
+        v_tile_size_log2 = 1;
+      } else if (v_n_colors > 2) {
+        v_tile_size_log2 = 2;
+      } else {
+        v_tile_size_log2 = 3;
+      }
+      if (self->private_impl.f_n_transforms >= 4) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+        goto exit;
+      }
+      self->private_impl.f_transform_tile_size_log2[self->private_impl.f_n_transforms] = v_tile_size_log2;
+      self->private_impl.f_n_transforms += 1;
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(5);
+      status = wuffs_webp__decoder__decode_sub_image(self,
+          a_src,
+          a_workbuf,
+          self->private_impl.f_workbuf_offset_for_transform[3],
+          v_n_colors,
+          1);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      v_q = self->private_impl.f_workbuf_offset_for_transform[3];
+      if (v_q > ((uint64_t)(a_workbuf.len))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_data.f_palette, 1024), wuffs_base__slice_u8__subslice_i(a_workbuf, v_q));
+      v_p = (v_n_colors * 4);
+      while (v_p < 1024) {
+        self->private_data.f_palette[v_p] = 0;
+        v_p += 1;
+      }
+      v_p = 0;
+      while (v_p < v_n_deltas) {
+        self->private_data.f_palette[(v_p + 4)] += self->private_data.f_palette[v_p];
+        v_p += 1;
+      }
+      v_n = (((self->private_impl.f_pixel_width + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2);
+      self->private_impl.f_pixel_width = wuffs_base__u32__min(v_n, 16384);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if (self->private_impl.f_n_transforms >= 4) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+      goto exit;
+    }
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 2) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_transform_type = (v_bits & 3);
+    v_bits >>= 2;
+    v_n_bits -= 2;
+    if (self->private_impl.f_seen_transform[v_transform_type] || (self->private_impl.f_n_transforms >= 4)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+      goto exit;
+    }
+    self->private_impl.f_seen_transform[v_transform_type] = true;
+    self->private_impl.f_transform_type[self->private_impl.f_n_transforms] = v_transform_type;
+    self->private_impl.f_transform_tile_size_log2[self->private_impl.f_n_transforms] = 0;
+    self->private_impl.f_transform_width[self->private_impl.f_n_transforms] = self->private_impl.f_pixel_width;
+    if (v_transform_type < 2) {
+      while (v_n_bits < 3) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_1 = *iop_a_src++;
+          v_c8 = t_1;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_tile_size_log2 = ((v_bits & 7) + 2);
+      self->private_impl.f_bits = (v_bits >> 3);
+      self->private_impl.f_n_bits = (v_n_bits - 3);
+      if (self->private_impl.f_n_transforms >= 4) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+        goto exit;
+      }
+      self->private_impl.f_transform_tile_size_log2[self->private_impl.f_n_transforms] = v_tile_size_log2;
+      self->private_impl.f_n_transforms += 1;
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+      status = wuffs_webp__decoder__decode_sub_image(self,
+          a_src,
+          a_workbuf,
+          self->private_impl.f_workbuf_offset_for_transform[v_transform_type],
+          (((self->private_impl.f_pixel_width + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2),
+          (((self->private_impl.f_height + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2));
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+    } else if (v_transform_type == 2) {
+      self->private_impl.f_bits = v_bits;
+      self->private_impl.f_n_bits = v_n_bits;
+      self->private_impl.f_n_transforms += 1;
+    } else {
+      while (v_n_bits < 8) {
+        {
+          WUFFS_BASE__COROUTINE_SUSPENSION_POINT(4);
+          if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+            status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+            goto suspend;
+          }
+          uint8_t t_2 = *iop_a_src++;
+          v_c8 = t_2;
+        }
+        v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+        v_n_bits += 8;
+      }
+      v_n_colors = ((v_bits & 255) + 1);
+      v_n_deltas = ((v_bits & 255) * 4);
+      self->private_impl.f_bits = (v_bits >> 8);
+      self->private_impl.f_n_bits = (v_n_bits - 8);
+      if (v_n_colors > 16) {
+        v_tile_size_log2 = 0;
+      } else if (v_n_colors > 4) {
+        v_tile_size_log2 = 1;
+      } else if (v_n_colors > 2) {
+        v_tile_size_log2 = 2;
+      } else {
+        v_tile_size_log2 = 3;
+      }
+      if (self->private_impl.f_n_transforms >= 4) {
+        status = wuffs_base__make_status(wuffs_webp__error__bad_transform);
+        goto exit;
+      }
+      self->private_impl.f_transform_tile_size_log2[self->private_impl.f_n_transforms] = v_tile_size_log2;
+      self->private_impl.f_n_transforms += 1;
+      if (a_src) {
+        a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+      }
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT(5);
+      status = wuffs_webp__decoder__decode_sub_image(self,
+          a_src,
+          a_workbuf,
+          self->private_impl.f_workbuf_offset_for_transform[3],
+          v_n_colors,
+          1);
+      if (a_src) {
+        iop_a_src = a_src->data.ptr + a_src->meta.ri;
+      }
+      if (status.repr) {
+        goto suspend;
+      }
+      v_q = self->private_impl.f_workbuf_offset_for_transform[3];
+      if (v_q > ((uint64_t)(a_workbuf.len))) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+        goto exit;
+      }
+      wuffs_base__slice_u8__copy_from_slice(wuffs_base__make_slice_u8(self->private_data.f_palette, 1024), wuffs_base__slice_u8__subslice_i(a_workbuf, v_q));
+      v_p = (v_n_colors * 4);
+      while (v_p < 1024) {
+        self->private_data.f_palette[v_p] = 0;
+        v_p += 1;
+      }
+      v_p = 0;
+      while (v_p < v_n_deltas) {
+        self->private_data.f_palette[(v_p + 4)] += self->private_data.f_palette[v_p];
+        v_p += 1;
+      }
+      v_n = (((self->private_impl.f_pixel_width + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2);
+      self->private_impl.f_pixel_width = wuffs_base__u32__min(v_n, 16384);
+    }
+
+    goto ok;
+    ok:
+    self->private_impl.p_decode_transform[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_transform[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_transform[0].v_bits = v_bits;
+  self->private_data.s_decode_transform[0].v_n_bits = v_n_bits;
+  self->private_data.s_decode_transform[0].v_transform_type = v_transform_type;
+  self->private_data.s_decode_transform[0].v_tile_size_log2 = v_tile_size_log2;
+  self->private_data.s_decode_transform[0].v_n_colors = v_n_colors;
+  self->private_data.s_decode_transform[0].v_n_deltas = v_n_deltas;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[50].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[50].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_color_cache_parameters
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_color_cache_parameters(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_cache_bits = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[51].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_color_cache_parameters[0];
+  if (coro_susp_point) {
+    v_bits = self->private_data.s_decode_color_cache_parameters[0].v_bits;
+    v_n_bits = self->private_data.s_decode_color_cache_parameters[0].v_n_bits;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    self->private_impl.f_color_cache_bits = 0;
+    if ((v_bits & 1) == 0) {
+      self->private_impl.f_bits = (v_bits >> 1);
+      self->private_impl.f_n_bits = (v_n_bits - 1);
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    v_bits >>= 1;
+    v_n_bits -= 1;
+    while (v_n_bits < 4) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_1 = *iop_a_src++;
+        v_c8 = t_1;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_cache_bits = (v_bits & 15);
+    self->private_impl.f_bits = (v_bits >> 4);
+    self->private_impl.f_n_bits = (v_n_bits - 4);
+    if ((v_cache_bits < 1) || (11 < v_cache_bits)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_color_cache);
+      goto exit;
+    }
+    self->private_impl.f_color_cache_bits = v_cache_bits;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    self->private_impl.f_color_cache_bits = 0;
+    if ((v_bits & 1) == 0) {
+      self->private_impl.f_bits = (v_bits >> 1);
+      self->private_impl.f_n_bits = (v_n_bits - 1);
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    v_bits >>= 1;
+    v_n_bits -= 1;
+    while (v_n_bits < 4) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_1 = *iop_a_src++;
+        v_c8 = t_1;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_cache_bits = (v_bits & 15);
+    self->private_impl.f_bits = (v_bits >> 4);
+    self->private_impl.f_n_bits = (v_n_bits - 4);
+    if ((v_cache_bits < 1) || (11 < v_cache_bits)) {
+      status = wuffs_base__make_status(wuffs_webp__error__bad_color_cache);
+      goto exit;
+    }
+    self->private_impl.f_color_cache_bits = v_cache_bits;
+
+    ok:
+    self->private_impl.p_decode_color_cache_parameters[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_color_cache_parameters[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_color_cache_parameters[0].v_bits = v_bits;
+  self->private_data.s_decode_color_cache_parameters[0].v_n_bits = v_n_bits;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[51].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[51].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_huffman_image
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_huffman_image(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint8_t v_c8 = 0;
+  uint32_t v_bits = 0;
+  uint32_t v_n_bits = 0;
+  uint32_t v_tile_size_log2 = 0;
+  uint32_t v_w = 0;
+  uint32_t v_h = 0;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+  wuffs_base__slice_u8 v_data = {0};
+  uint32_t v_pixel = 0;
+  uint32_t v_n = 0;
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[52].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_huffman_image[0];
+  if (coro_susp_point) {
+    v_bits = self->private_data.s_decode_huffman_image[0].v_bits;
+    v_n_bits = self->private_data.s_decode_huffman_image[0].v_n_bits;
+    v_tile_size_log2 = self->private_data.s_decode_huffman_image[0].v_tile_size_log2;
+    v_w = self->private_data.s_decode_huffman_image[0].v_w;
+    v_h = self->private_data.s_decode_huffman_image[0].v_h;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    self->private_impl.f_n_huffman_groups = 1;
+    self->private_impl.f_huffman_image_bits = 0;
+    self->private_impl.f_huffman_image_width = 0;
+    if ((v_bits & 1) == 0) {
+      self->private_impl.f_bits = (v_bits >> 1);
+      self->private_impl.f_n_bits = (v_n_bits - 1);
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    v_bits >>= 1;
+    v_n_bits -= 1;
+    while (v_n_bits < 3) {
+      {
+        WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_1 = *iop_a_src++;
+        v_c8 = t_1;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_tile_size_log2 = ((v_bits & 7) + 2);
+    self->private_impl.f_bits = (v_bits >> 3);
+    self->private_impl.f_n_bits = (v_n_bits - 3);
+    v_w = (((self->private_impl.f_pixel_width + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2);
+    v_h = (((self->private_impl.f_height + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2);
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+    status = wuffs_webp__decoder__decode_sub_image(self,
+        a_src,
+        a_workbuf,
+        self->private_impl.f_workbuf_offset_for_transform[2],
+        v_w,
+        v_h);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    self->private_impl.f_huffman_image_bits = v_tile_size_log2;
+    self->private_impl.f_huffman_image_width = v_w;
+    v_q = self->private_impl.f_workbuf_offset_for_transform[2];
+    v_q_end = ((uint64_t)(v_q + (((uint64_t)(v_w)) * ((uint64_t)(v_h)) * 4)));
+    if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_n = 0;
+    v_data = wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end);
+    while (((uint64_t)(v_data.len)) >= 4) {
+      v_pixel = wuffs_base__peek_u32le__no_bounds_check(v_data.ptr);
+      if (((v_pixel >> 16) & 255) != 0) {
+        status = wuffs_base__make_status(wuffs_webp__error__unsupported_number_of_huffman_groups);
+        goto exit;
+      }
+      v_n = wuffs_base__u32__max(v_n, ((v_pixel >> 8) & 255));
+      v_data = wuffs_base__slice_u8__subslice_i(v_data, 4);
+    }
+    self->private_impl.f_n_huffman_groups = ((v_n & 255) + 1);
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    v_bits = self->private_impl.f_bits;
+    v_n_bits = self->private_impl.f_n_bits;
+    while (v_n_bits < 1) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_0 = *iop_a_src++;
+        v_c8 = t_0;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    self->private_impl.f_n_huffman_groups = 1;
+    self->private_impl.f_huffman_image_bits = 0;
+    self->private_impl.f_huffman_image_width = 0;
+    if ((v_bits & 1) == 0) {
+      self->private_impl.f_bits = (v_bits >> 1);
+      self->private_impl.f_n_bits = (v_n_bits - 1);
+      status = wuffs_base__make_status(NULL);
+      goto ok;
+    }
+    v_bits >>= 1;
+    v_n_bits -= 1;
+    while (v_n_bits < 3) {
+      {
+        WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+        if (WUFFS_BASE__UNLIKELY(iop_a_src == io2_a_src)) {
+          status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+          goto suspend;
+        }
+        uint8_t t_1 = *iop_a_src++;
+        v_c8 = t_1;
+      }
+      v_bits |= (((uint32_t)(v_c8)) << v_n_bits);
+      v_n_bits += 8;
+    }
+    v_tile_size_log2 = ((v_bits & 7) + 2);
+    self->private_impl.f_bits = (v_bits >> 3);
+    self->private_impl.f_n_bits = (v_n_bits - 3);
+    v_w = (((self->private_impl.f_pixel_width + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2);
+    v_h = (((self->private_impl.f_height + (((uint32_t)(1)) << v_tile_size_log2)) - 1) >> v_tile_size_log2);
+    if (a_src) {
+      a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+    status = wuffs_webp__decoder__decode_sub_image(self,
+        a_src,
+        a_workbuf,
+        self->private_impl.f_workbuf_offset_for_transform[2],
+        v_w,
+        v_h);
+    if (a_src) {
+      iop_a_src = a_src->data.ptr + a_src->meta.ri;
+    }
+    if (status.repr) {
+      goto suspend;
+    }
+    self->private_impl.f_huffman_image_bits = v_tile_size_log2;
+    self->private_impl.f_huffman_image_width = v_w;
+    v_q = self->private_impl.f_workbuf_offset_for_transform[2];
+    v_q_end = ((uint64_t)(v_q + (((uint64_t)(v_w)) * ((uint64_t)(v_h)) * 4)));
+    if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    v_n = 0;
+    v_data = wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end);
+    while (((uint64_t)(v_data.len)) >= 4) {
+      v_pixel = wuffs_base__peek_u32le__no_bounds_check(v_data.ptr);
+      if (((v_pixel >> 16) & 255) != 0) {
+        status = wuffs_base__make_status(wuffs_webp__error__unsupported_number_of_huffman_groups);
+        goto exit;
+      }
+      v_n = wuffs_base__u32__max(v_n, ((v_pixel >> 8) & 255));
+      v_data = wuffs_base__slice_u8__subslice_i(v_data, 4);
+    }
+    self->private_impl.f_n_huffman_groups = ((v_n & 255) + 1);
+
+    ok:
+    self->private_impl.p_decode_huffman_image[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_huffman_image[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_huffman_image[0].v_bits = v_bits;
+  self->private_data.s_decode_huffman_image[0].v_n_bits = v_n_bits;
+  self->private_data.s_decode_huffman_image[0].v_tile_size_log2 = v_tile_size_log2;
+  self->private_data.s_decode_huffman_image[0].v_w = v_w;
+  self->private_data.s_decode_huffman_image[0].v_h = v_h;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[52].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[52].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.decode_sub_image
+
+static wuffs_base__status
+wuffs_webp__decoder__decode_sub_image(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_src,
+    wuffs_base__slice_u8 a_workbuf,
+    uint64_t a_offset,
+    uint32_t a_width,
+    uint32_t a_height) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  uint64_t v_offset_end = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[53].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_decode_sub_image[0];
+  if (coro_susp_point) {
+    v_offset_end = self->private_data.s_decode_sub_image[0].v_offset_end;
+  }
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(1);
+    status = wuffs_webp__decoder__decode_color_cache_parameters(self, a_src);
+    if (status.repr) {
+      goto suspend;
+    }
+    self->private_impl.f_n_huffman_groups = 1;
+    self->private_impl.f_huffman_image_bits = 0;
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+    status = wuffs_webp__decoder__decode_huffman_groups(self, a_src, 1);
+    if (status.repr) {
+      goto suspend;
+    }
+    v_offset_end = ((uint64_t)(a_offset + (((uint64_t)(a_width)) * ((uint64_t)(a_height)) * 4)));
+    if ((a_offset > v_offset_end) || (v_offset_end > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(3);
+    status = wuffs_webp__decoder__decode_pixels(self,
+        wuffs_base__slice_u8__subslice_ij(a_workbuf, a_offset, v_offset_end),
+        a_src,
+        a_width,
+        a_height,
+        wuffs_base__utility__empty_slice_u8(),
+        0);
+    if (status.repr) {
+      goto suspend;
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(1);
+    status = wuffs_webp__decoder__decode_color_cache_parameters(self, a_src);
+    if (status.repr) {
+      goto suspend;
+    }
+    self->private_impl.f_n_huffman_groups = 1;
+    self->private_impl.f_huffman_image_bits = 0;
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+    status = wuffs_webp__decoder__decode_huffman_groups(self, a_src, 1);
+    if (status.repr) {
+      goto suspend;
+    }
+    v_offset_end = ((uint64_t)(a_offset + (((uint64_t)(a_width)) * ((uint64_t)(a_height)) * 4)));
+    if ((a_offset > v_offset_end) || (v_offset_end > ((uint64_t)(a_workbuf.len)))) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      goto exit;
+    }
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(3);
+    status = wuffs_webp__decoder__decode_pixels(self,
+        wuffs_base__slice_u8__subslice_ij(a_workbuf, a_offset, v_offset_end),
+        a_src,
+        a_width,
+        a_height,
+        wuffs_base__utility__empty_slice_u8(),
+        0);
+    if (status.repr) {
+      goto suspend;
+    }
+
+    goto ok;
+    ok:
+    self->private_impl.p_decode_sub_image[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_decode_sub_image[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_data.s_decode_sub_image[0].v_offset_end = v_offset_end;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[53].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[53].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.apply_transforms
+
+static wuffs_base__status
+wuffs_webp__decoder__apply_transforms(
+    wuffs_webp__decoder* self,
+    wuffs_base__slice_u8 a_workbuf) {
+  uint32_t v_i = 0;
+  uint32_t v_transform_type = 0;
+  uint32_t v_width = 0;
+  uint32_t v_tile_size_log2 = 0;
+  uint64_t v_n = 0;
+  uint64_t v_q = 0;
+  uint64_t v_q_end = 0;
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[54].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_i = self->private_impl.f_n_transforms;
+  while (v_i > 0) {
+    v_i -= 1;
+    v_transform_type = self->private_impl.f_transform_type[v_i];
+    v_width = self->private_impl.f_transform_width[v_i];
+    v_tile_size_log2 = self->private_impl.f_transform_tile_size_log2[v_i];
+    v_n = (((uint64_t)(v_width)) * ((uint64_t)(self->private_impl.f_height)) * 4);
+    if (v_n > ((uint64_t)(a_workbuf.len))) {
+      return wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+    }
+    if (v_transform_type == 0) {
+      v_q = self->private_impl.f_workbuf_offset_for_transform[0];
+      v_q_end = self->private_impl.f_workbuf_offset_for_transform[1];
+      if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(a_workbuf.len)))) {
+        return wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      }
+      wuffs_webp__decoder__apply_transform_predictor(self,
+          wuffs_base__slice_u8__subslice_j(a_workbuf, v_n),
+          wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end),
+          v_width,
+          v_tile_size_log2);
+    } else if (v_transform_type == 1) {
+      v_q = self->private_impl.f_workbuf_offset_for_transform[1];
+      v_q_end = self->private_impl.f_workbuf_offset_for_transform[2];
+      if ((v_q > v_q_end) || (v_q_end > ((uint64_t)(a_workbuf.len)))) {
+        return wuffs_base__make_status(wuffs_base__error__bad_workbuf_length);
+      }
+      wuffs_webp__decoder__apply_transform_cross_color(self,
+          wuffs_base__slice_u8__subslice_j(a_workbuf, v_n),
+          wuffs_base__slice_u8__subslice_ij(a_workbuf, v_q, v_q_end),
+          v_width,
+          v_tile_size_log2);
+    } else if (v_transform_type == 2) {
+      wuffs_webp__decoder__apply_transform_subtract_green(self, wuffs_base__slice_u8__subslice_j(a_workbuf, v_n));
+    } else {
+      wuffs_webp__decoder__apply_transform_color_indexing(self, wuffs_base__slice_u8__subslice_j(a_workbuf, v_n), v_width, v_tile_size_log2);
+    }
+  }
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func webp.decoder.swizzle
+
+static wuffs_base__status
+wuffs_webp__decoder__swizzle(
+    wuffs_webp__decoder* self,
+    wuffs_base__pixel_buffer* a_dst,
+    wuffs_base__slice_u8 a_src) {
+  wuffs_base__pixel_format v_dst_pixfmt = {0};
+  uint32_t v_dst_bits_per_pixel = 0;
+  uint64_t v_dst_bytes_per_pixel = 0;
+  uint64_t v_dst_bytes_per_row = 0;
+  wuffs_base__slice_u8 v_dst_palette = {0};
+  wuffs_base__table_u8 v_tab = {0};
+  uint64_t v_src_bytes_per_row = 0;
+  wuffs_base__slice_u8 v_dst = {0};
+  uint32_t v_y = 0;
+  wuffs_base__slice_u8 v_src = {0};
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[55].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  v_dst_pixfmt = wuffs_base__pixel_buffer__pixel_format(a_dst);
+  v_dst_bits_per_pixel = wuffs_base__pixel_format__bits_per_pixel(&v_dst_pixfmt);
+  if ((v_dst_bits_per_pixel & 7) != 0) {
+    return wuffs_base__make_status(wuffs_base__error__unsupported_option);
+  }
+  v_dst_bytes_per_pixel = ((uint64_t)((v_dst_bits_per_pixel / 8)));
+  v_dst_bytes_per_row = (((uint64_t)(self->private_impl.f_width)) * v_dst_bytes_per_pixel);
+  v_dst_palette = wuffs_base__pixel_buffer__palette_or_else(a_dst, wuffs_base__make_slice_u8(self->private_data.f_palette, 1024));
+  v_tab = wuffs_base__pixel_buffer__plane(a_dst, 0);
+  v_src_bytes_per_row = (((uint64_t)(self->private_impl.f_width)) * 4);
+  v_src = a_src;
+  while (v_src_bytes_per_row <= ((uint64_t)(v_src.len))) {
+    if (v_y >= self->private_impl.f_height) {
+      goto label__0__break;
+    }
+    v_dst = wuffs_base__table_u8__row_u32(v_tab, v_y);
+    if (v_dst_bytes_per_row < ((uint64_t)(v_dst.len))) {
+      v_dst = wuffs_base__slice_u8__subslice_j(v_dst, v_dst_bytes_per_row);
+    }
+    wuffs_base__pixel_swizzler__swizzle_interleaved_from_slice(&self->private_impl.f_swizzler, v_dst, v_dst_palette, wuffs_base__slice_u8__subslice_j(v_src, v_src_bytes_per_row));
+    v_src = wuffs_base__slice_u8__subslice_i(v_src, v_src_bytes_per_row);
+    v_y += 1;
+  }
+  label__0__break:;
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func webp.decoder.frame_dirty_rect
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__rect_ie_u32
+wuffs_webp__decoder__frame_dirty_rect(
+    const wuffs_webp__decoder* self) {
+  if (!self) {
+    return wuffs_base__utility__empty_rect_ie_u32();
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return wuffs_base__utility__empty_rect_ie_u32();
+  }
+
+  return wuffs_base__utility__make_rect_ie_u32(
+      0,
+      0,
+      self->private_impl.f_width,
+      self->private_impl.f_height);
+}
+
+// -------- func webp.decoder.num_animation_loops
+
+WUFFS_BASE__MAYBE_STATIC uint32_t
+wuffs_webp__decoder__num_animation_loops(
+    const wuffs_webp__decoder* self) {
+  if (!self) {
+    return 0;
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return 0;
+  }
+
+  return 0;
+}
+
+// -------- func webp.decoder.num_decoded_frame_configs
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_webp__decoder__num_decoded_frame_configs(
+    const wuffs_webp__decoder* self) {
+  if (!self) {
+    return 0;
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return 0;
+  }
+
+  if (self->private_impl.f_call_sequence > 32) {
+    return 1;
+  }
+  return 0;
+}
+
+// -------- func webp.decoder.num_decoded_frames
+
+WUFFS_BASE__MAYBE_STATIC uint64_t
+wuffs_webp__decoder__num_decoded_frames(
+    const wuffs_webp__decoder* self) {
+  if (!self) {
+    return 0;
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return 0;
+  }
+
+  if (self->private_impl.f_call_sequence > 64) {
+    return 1;
+  }
+  return 0;
+}
+
+// -------- func webp.decoder.restart_frame
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__restart_frame(
+    wuffs_webp__decoder* self,
+    uint64_t a_index,
+    uint64_t a_io_position) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[56].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (self->private_impl.f_call_sequence < 32) {
+    return wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+  }
+  if ((a_index != 0) || (a_io_position != self->private_impl.f_frame_config_io_position)) {
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  self->private_impl.f_call_sequence = 40;
+  return wuffs_base__make_status(NULL);
+}
+
+// -------- func webp.decoder.set_report_metadata
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__empty_struct
+wuffs_webp__decoder__set_report_metadata(
+    wuffs_webp__decoder* self,
+    uint32_t a_fourcc,
+    bool a_report) {
+  if (!self) {
+    return wuffs_base__make_empty_struct();
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_empty_struct();
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[57].num_calls++;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (a_fourcc == 1163413830) {
+    self->private_impl.f_report_metadata_exif = a_report;
+  } else if (a_fourcc == 1229144912) {
+    self->private_impl.f_report_metadata_iccp = a_report;
+  } else if (a_fourcc == 1481461792) {
+    self->private_impl.f_report_metadata_xmp = a_report;
+  }
+  return wuffs_base__make_empty_struct();
+}
+
+// -------- func webp.decoder.tell_me_more
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__status
+wuffs_webp__decoder__tell_me_more(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_dst,
+    wuffs_base__more_information* a_minfo,
+    wuffs_base__io_buffer* a_src) {
+  if (!self) {
+    return wuffs_base__make_status(wuffs_base__error__bad_receiver);
+  }
+  if (self->private_impl.magic != WUFFS_BASE__MAGIC) {
+    return wuffs_base__make_status(
+        (self->private_impl.magic == WUFFS_BASE__DISABLED)
+        ? wuffs_base__error__disabled_by_previous_error
+        : wuffs_base__error__initialize_not_called);
+  }
+  if (!a_dst || !a_src) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__bad_argument);
+  }
+  if ((self->private_impl.active_coroutine != 0) &&
+      (self->private_impl.active_coroutine != 4)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+    return wuffs_base__make_status(wuffs_base__error__interleaved_coroutine_calls);
+  }
+  self->private_impl.active_coroutine = 0;
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  wuffs_base__status v_status = wuffs_base__make_status(NULL);
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[58].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+  const uint64_t stats_a_src = a_src->meta.ri;
+  const uint64_t stats_a_dst = a_dst->meta.wi;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_tell_me_more[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_tell_me_more(self, a_dst, a_minfo, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    while (true) {
+      {
+        wuffs_base__status t_0 = wuffs_webp__decoder__do_tell_me_more(self, a_dst, a_minfo, a_src);
+        v_status = t_0;
+      }
+      if ((v_status.repr == wuffs_base__suspension__short_read) && (a_src && a_src->meta.closed)) {
+        status = wuffs_base__make_status(wuffs_webp__error__truncated_input);
+        goto exit;
+      }
+      status = v_status;
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+
+    ok:
+    self->private_impl.p_tell_me_more[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_tell_me_more[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+  self->private_impl.active_coroutine = wuffs_base__status__is_suspension(&status) ? 4 : 0;
+
+  goto exit;
+  exit:
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[58].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[58].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+  self->private_impl.stats_num_src_bytes += a_src->meta.ri - stats_a_src;
+  self->private_impl.stats_num_dst_bytes += a_dst->meta.wi - stats_a_dst;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  if (wuffs_base__status__is_error(&status)) {
+    self->private_impl.magic = WUFFS_BASE__DISABLED;
+  }
+  return status;
+}
+
+// -------- func webp.decoder.do_tell_me_more
+
+static wuffs_base__status
+wuffs_webp__decoder__do_tell_me_more(
+    wuffs_webp__decoder* self,
+    wuffs_base__io_buffer* a_dst,
+    wuffs_base__more_information* a_minfo,
+    wuffs_base__io_buffer* a_src) {
+  wuffs_base__status status = wuffs_base__make_status(NULL);
+
+  const uint8_t* iop_a_src = NULL;
+  const uint8_t* io0_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io1_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  const uint8_t* io2_a_src WUFFS_BASE__POTENTIALLY_UNUSED = NULL;
+  if (a_src && a_src->data.ptr) {
+    io0_a_src = a_src->data.ptr;
+    io1_a_src = io0_a_src + a_src->meta.ri;
+    iop_a_src = io1_a_src;
+    io2_a_src = io0_a_src + a_src->meta.wi;
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  self->private_impl.stats_funcs[59].num_calls++;
+  const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  uint32_t coro_susp_point = self->private_impl.p_do_tell_me_more[0];
+#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+  if (!coro_susp_point && a_src && a_src->meta.closed) {
+    if ((self->private_impl.f_call_sequence & 16) == 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    }
+    if (self->private_impl.f_metadata_fourcc == 0) {
+      status = wuffs_base__make_status(wuffs_base__error__no_more_information);
+      goto exit;
+    }
+    while (true) {
+      if (wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src))) != self->private_impl.f_metadata_y) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_i_o_position);
+        goto exit;
+      } else if (a_minfo != NULL) {
+        wuffs_base__more_information__set(a_minfo,
+            3,
+            self->private_impl.f_metadata_fourcc,
+            0,
+            self->private_impl.f_metadata_y,
+            self->private_impl.f_metadata_z);
+      }
+      if (self->private_impl.f_metadata_y >= self->private_impl.f_metadata_z) {
+        goto label__fast__0__break;
+      }
+      self->private_impl.f_metadata_y = self->private_impl.f_metadata_z;
+      status = wuffs_base__make_status(wuffs_base__suspension__even_more_information);
+      WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    label__fast__0__break:;
+    self->private_data.s_do_tell_me_more[0].scratch = self->private_impl.f_metadata_padding;
+    WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(2);
+    if (self->private_data.s_do_tell_me_more[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+      self->private_data.s_do_tell_me_more[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+      iop_a_src = io2_a_src;
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      goto suspend;
+    }
+    iop_a_src += self->private_data.s_do_tell_me_more[0].scratch;
+    self->private_impl.f_metadata_fourcc = 0;
+    self->private_impl.f_metadata_padding = 0;
+    self->private_impl.f_metadata_y = 0;
+    self->private_impl.f_metadata_z = 0;
+    self->private_impl.f_call_sequence &= 239;
+    status = wuffs_base__make_status(NULL);
+    goto ok;
+    goto ok;
+  }
+#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)
+
+  switch (coro_susp_point) {
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT_0;
+
+    if ((self->private_impl.f_call_sequence & 16) == 0) {
+      status = wuffs_base__make_status(wuffs_base__error__bad_call_sequence);
+      goto exit;
+    }
+    if (self->private_impl.f_metadata_fourcc == 0) {
+      status = wuffs_base__make_status(wuffs_base__error__no_more_information);
+      goto exit;
+    }
+    while (true) {
+      if (wuffs_base__u64__sat_add((a_src ? a_src->meta.pos : 0), ((uint64_t)(iop_a_src - io0_a_src))) != self->private_impl.f_metadata_y) {
+        status = wuffs_base__make_status(wuffs_base__error__bad_i_o_position);
+        goto exit;
+      } else if (a_minfo != NULL) {
+        wuffs_base__more_information__set(a_minfo,
+            3,
+            self->private_impl.f_metadata_fourcc,
+            0,
+            self->private_impl.f_metadata_y,
+            self->private_impl.f_metadata_z);
+      }
+      if (self->private_impl.f_metadata_y >= self->private_impl.f_metadata_z) {
+        goto label__0__break;
+      }
+      self->private_impl.f_metadata_y = self->private_impl.f_metadata_z;
+      status = wuffs_base__make_status(wuffs_base__suspension__even_more_information);
+      WUFFS_BASE__COROUTINE_SUSPENSION_POINT_MAYBE_SUSPEND(1);
+    }
+    label__0__break:;
+    self->private_data.s_do_tell_me_more[0].scratch = self->private_impl.f_metadata_padding;
+    WUFFS_BASE__COROUTINE_SUSPENSION_POINT(2);
+    if (self->private_data.s_do_tell_me_more[0].scratch > ((uint64_t)(io2_a_src - iop_a_src))) {
+      self->private_data.s_do_tell_me_more[0].scratch -= ((uint64_t)(io2_a_src - iop_a_src));
+      iop_a_src = io2_a_src;
+      status = wuffs_base__make_status(wuffs_base__suspension__short_read);
+      goto suspend;
+    }
+    iop_a_src += self->private_data.s_do_tell_me_more[0].scratch;
+    self->private_impl.f_metadata_fourcc = 0;
+    self->private_impl.f_metadata_padding = 0;
+    self->private_impl.f_metadata_y = 0;
+    self->private_impl.f_metadata_z = 0;
+    self->private_impl.f_call_sequence &= 239;
+    status = wuffs_base__make_status(NULL);
+    goto ok;
+
+    ok:
+    self->private_impl.p_do_tell_me_more[0] = 0;
+    goto exit;
+  }
+
+  goto suspend;
+  suspend:
+  self->private_impl.p_do_tell_me_more[0] = wuffs_base__status__is_suspension(&status) ? coro_susp_point : 0;
+
+  goto exit;
+  exit:
+  if (a_src && a_src->data.ptr) {
+    a_src->meta.ri = ((size_t)(iop_a_src - a_src->data.ptr));
+  }
+
+#if defined(WUFFS_CONFIG__ENABLE_STATS)
+  if (wuffs_base__status__is_suspension(&status)) {
+    self->private_impl.stats_funcs[59].num_suspensions++;
+  }
+  self->private_impl.stats_funcs[59].num_ticks +=
+      WUFFS_CONFIG__STATS__TICKS() - stats_ticks;
+#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)
+
+  return status;
+}
+
+// -------- func webp.decoder.workbuf_len
+
+WUFFS_BASE__MAYBE_STATIC wuffs_base__range_ii_u64
+wuffs_webp__decoder__workbuf_len(
+    const wuffs_webp__decoder* self) {
+  if (!self) {
+    return wuffs_base__utility__empty_range_ii_u64();
+  }
+  if ((self->private_impl.magic != WUFFS_BASE__MAGIC) &&
+      (self->private_impl.magic != WUFFS_BASE__DISABLED)) {
+    return wuffs_base__utility__empty_range_ii_u64();
+  }
+
+  return wuffs_base__utility__make_range_ii_u64(self->private_impl.f_overall_workbuf_length, self->private_impl.f_overall_workbuf_length);
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WEBP)
+
+#endif  // WUFFS_IMPLEMENTATION
+
+// ¡ WUFFS MONOLITHIC RELEASE DISCARDS EVERYTHING BELOW.
+
+#endif  // WUFFS_INCLUDE_GUARD__WEBP
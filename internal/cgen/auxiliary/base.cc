@@ -97,6 +97,11 @@ Input::BringsItsOwnIOBuffer() {
   return nullptr;
 }
 
+std::string  //
+Input::Seek(IOBuffer* dst, uint64_t absolute_position) {
+  return "wuffs_aux::sync_io::Input: unsupported seek";
+}
+
 // --------
 
 FileInput::FileInput(FILE* f) : m_f(f) {}
@@ -121,6 +126,23 @@ FileInput::CopyIn(IOBuffer* dst) {
   return "";
 }
 
+std::string  //
+FileInput::Seek(IOBuffer* dst, uint64_t absolute_position) {
+  if (!m_f) {
+    return "wuffs_aux::sync_io::FileInput: nullptr file";
+  } else if (!dst) {
+    return "wuffs_aux::sync_io::FileInput: nullptr IOBuffer";
+  } else if ((absolute_position > LONG_MAX) ||
+             (fseek(m_f, (long)absolute_position, SEEK_SET) != 0)) {
+    return "wuffs_aux::sync_io::FileInput: error seeking file";
+  }
+  dst->meta.wi = 0;
+  dst->meta.ri = 0;
+  dst->meta.pos = absolute_position;
+  dst->meta.closed = false;
+  return "";
+}
+
 // --------
 
 MemoryInput::MemoryInput(const char* ptr, size_t len)
@@ -160,10 +182,284 @@ MemoryInput::CopyIn(IOBuffer* dst) {
   return "";
 }
 
+std::string  //
+MemoryInput::Seek(IOBuffer* dst, uint64_t absolute_position) {
+  if (!dst) {
+    return "wuffs_aux::sync_io::MemoryInput: nullptr IOBuffer";
+  } else if (absolute_position > m_io.meta.wi) {
+    return "wuffs_aux::sync_io::MemoryInput: invalid seek";
+  }
+  m_io.meta.ri = (size_t)absolute_position;
+  if (dst != &m_io) {
+    dst->meta.wi = 0;
+    dst->meta.ri = 0;
+    dst->meta.pos = absolute_position;
+    dst->meta.closed = false;
+  }
+  return "";
+}
+
+// --------
+
+Output::~Output() {}
+
+// --------
+
+FileOutput::FileOutput(FILE* f) : m_f(f) {}
+
+std::string  //
+FileOutput::CopyOut(IOBuffer* src) {
+  if (!m_f) {
+    return "wuffs_aux::sync_io::FileOutput: nullptr file";
+  } else if (!src) {
+    return "wuffs_aux::sync_io::FileOutput: nullptr IOBuffer";
+  }
+  size_t n = src->reader_length();
+  size_t i = n ? fwrite(src->reader_pointer(), 1, n, m_f) : 0;
+  src->meta.ri += i;
+  if (i < n) {
+    return "wuffs_aux::sync_io::FileOutput: error writing file";
+  }
+  return "";
+}
+
+// --------
+
+MemoryOutput::MemoryOutput(char* ptr, size_t len)
+    : m_io(wuffs_base__ptr_u8__writer(
+          static_cast<uint8_t*>(static_cast<void*>(ptr)),
+          len)) {}
+
+MemoryOutput::MemoryOutput(uint8_t* ptr, size_t len)
+    : m_io(wuffs_base__ptr_u8__writer(ptr, len)) {}
+
+std::string  //
+MemoryOutput::CopyOut(IOBuffer* src) {
+  if (!src) {
+    return "wuffs_aux::sync_io::MemoryOutput: nullptr IOBuffer";
+  } else if (wuffs_base__slice_u8__overlaps(src->data, m_io.data)) {
+    return "wuffs_aux::sync_io::MemoryOutput: overlapping buffers";
+  }
+  size_t ns = src->reader_length();
+  if (ns > m_io.writer_length()) {
+    return "wuffs_aux::sync_io::MemoryOutput: out of space";
+  }
+  memcpy(m_io.writer_pointer(), src->reader_pointer(), ns);
+  m_io.meta.wi += ns;
+  src->meta.ri += ns;
+  return "";
+}
+
+size_t  //
+MemoryOutput::Length() const {
+  return m_io.meta.wi;
+}
+
 // --------
 
 }  // namespace sync_io
 
+#if defined(WUFFS_AUX__HAVE_COROUTINES)
+
+namespace async_io {
+
+// --------
+
+bool  //
+Task::promise_type::FinalAwaitable::await_ready() noexcept {
+  return false;
+}
+
+// await_suspend resumes whoever co_await'ed the Task, if anyone, without
+// growing the call stack (symmetric transfer).
+std::coroutine_handle<>  //
+Task::promise_type::FinalAwaitable::await_suspend(
+    std::coroutine_handle<promise_type> h) noexcept {
+  std::coroutine_handle<> continuation = h.promise().m_continuation;
+  return continuation ? continuation : std::noop_coroutine();
+}
+
+void  //
+Task::promise_type::FinalAwaitable::await_resume() noexcept {}
+
+Task  //
+Task::promise_type::get_return_object() {
+  return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+std::suspend_always  //
+Task::promise_type::initial_suspend() noexcept {
+  return std::suspend_always();
+}
+
+Task::promise_type::FinalAwaitable  //
+Task::promise_type::final_suspend() noexcept {
+  return FinalAwaitable();
+}
+
+void  //
+Task::promise_type::return_value(std::string result) {
+  m_result = std::move(result);
+}
+
+void  //
+Task::promise_type::unhandled_exception() {
+  // Wuffs code does not throw and wuffs_aux is usable without exceptions.
+  abort();
+}
+
+Task::Task(std::coroutine_handle<promise_type> h) : m_handle(h) {}
+
+Task::Task(Task&& other) : m_handle(other.m_handle) {
+  other.m_handle = nullptr;
+}
+
+Task::~Task() {
+  if (m_handle) {
+    m_handle.destroy();
+  }
+}
+
+void  //
+Task::Start() {
+  m_handle.resume();
+}
+
+bool  //
+Task::Done() const {
+  return m_handle.done();
+}
+
+const std::string&  //
+Task::Result() const {
+  return m_handle.promise().m_result;
+}
+
+bool  //
+Task::await_ready() const noexcept {
+  return m_handle.done();
+}
+
+std::coroutine_handle<>  //
+Task::await_suspend(std::coroutine_handle<> continuation) noexcept {
+  m_handle.promise().m_continuation = continuation;
+  return m_handle;
+}
+
+std::string  //
+Task::await_resume() {
+  return std::move(m_handle.promise().m_result);
+}
+
+// --------
+
+Input::CopyInAwaitable::CopyInAwaitable(Input& input, IOBuffer* dst)
+    : m_input(input), m_dst(dst), m_error_message() {}
+
+bool  //
+Input::CopyInAwaitable::await_ready() noexcept {
+  return false;
+}
+
+bool  //
+Input::CopyInAwaitable::await_suspend(std::coroutine_handle<> h) {
+  // Returning false resumes the awaiting coroutine immediately.
+  return !m_input.StartCopyIn(m_dst, h, &m_error_message);
+}
+
+std::string  //
+Input::CopyInAwaitable::await_resume() {
+  return std::move(m_error_message);
+}
+
+Input::~Input() {}
+
+Input::CopyInAwaitable  //
+Input::CopyIn(IOBuffer* dst) {
+  return CopyInAwaitable(*this, dst);
+}
+
+// --------
+
+Output::CopyOutAwaitable::CopyOutAwaitable(Output& output, IOBuffer* src)
+    : m_output(output), m_src(src), m_error_message() {}
+
+bool  //
+Output::CopyOutAwaitable::await_ready() noexcept {
+  return false;
+}
+
+bool  //
+Output::CopyOutAwaitable::await_suspend(std::coroutine_handle<> h) {
+  return !m_output.StartCopyOut(m_src, h, &m_error_message);
+}
+
+std::string  //
+Output::CopyOutAwaitable::await_resume() {
+  return std::move(m_error_message);
+}
+
+Output::~Output() {}
+
+Output::CopyOutAwaitable  //
+Output::CopyOut(IOBuffer* src) {
+  return CopyOutAwaitable(*this, src);
+}
+
+// --------
+
+Task  //
+TransformIO(wuffs_base__io_transformer* transformer,
+            Output& output,
+            Input& input,
+            IOBuffer& dst,
+            IOBuffer& src,
+            wuffs_base__slice_u8 workbuf) {
+  if (!transformer) {
+    co_return "wuffs_aux::async_io::TransformIO: nullptr transformer";
+  }
+  while (true) {
+    wuffs_base__status status = transformer->transform_io(&dst, &src, workbuf);
+    if (status.repr == wuffs_base__suspension__short_read) {
+      if (src.meta.closed) {
+        co_return "wuffs_aux::async_io::TransformIO: unexpected end of file";
+      }
+      // Flush what has been transformed so far before waiting for more
+      // input, which could take arbitrarily long.
+      if (dst.reader_length() > 0) {
+        std::string error_message = co_await output.CopyOut(&dst);
+        if (!error_message.empty()) {
+          co_return error_message;
+        }
+        dst.compact();
+      }
+      std::string error_message = co_await input.CopyIn(&src);
+      if (!error_message.empty()) {
+        co_return error_message;
+      }
+      continue;
+    }
+
+    if ((status.repr == wuffs_base__suspension__short_write) ||
+        (dst.reader_length() > 0)) {
+      std::string error_message = co_await output.CopyOut(&dst);
+      if (!error_message.empty()) {
+        co_return error_message;
+      }
+      dst.compact();
+    }
+    if (status.repr != wuffs_base__suspension__short_write) {
+      co_return (status.repr == nullptr) ? std::string() : status.message();
+    }
+  }
+}
+
+// --------
+
+}  // namespace async_io
+
+#endif  // defined(WUFFS_AUX__HAVE_COROUTINES)
+
 namespace private_impl {
 
 struct ErrorMessages {
@@ -211,6 +507,78 @@ AdvanceIOBufferTo(const ErrorMessages& error_messages,
   return "";
 }
 
+// WriteToIOBufferSlow is the slow path of WriteToIOBuffer. It alternates
+// between copying ptr[:len] into io_buf's writer slack and draining io_buf to
+// output, compacting io_buf after each drain.
+std::string  //
+WriteToIOBufferSlow(sync_io::Output& output,
+                    IOBuffer& io_buf,
+                    const uint8_t* ptr,
+                    size_t len) {
+  while (true) {
+    size_t n = io_buf.writer_length();
+    if (n > len) {
+      n = len;
+    }
+    if (n > 0) {
+      memcpy(io_buf.writer_pointer(), ptr, n);
+      io_buf.meta.wi += n;
+      ptr += n;
+      len -= n;
+    }
+    if (len == 0) {
+      return "";
+    }
+    std::string error_message = output.CopyOut(&io_buf);
+    if (!error_message.empty()) {
+      return error_message;
+    }
+    io_buf.compact();
+    if (io_buf.writer_length() == 0) {
+      return "wuffs_aux::private_impl: internal error: io_buf is full";
+    }
+  }
+}
+
+// WriteToIOBuffer appends ptr[:len] to io_buf, draining io_buf to output when
+// io_buf fills up. Call FlushIOBuffer when done.
+inline std::string  //
+WriteToIOBuffer(sync_io::Output& output,
+                IOBuffer& io_buf,
+                const uint8_t* ptr,
+                size_t len) {
+  if (len <= io_buf.writer_length()) {
+    if (len > 0) {
+      memcpy(io_buf.writer_pointer(), ptr, len);
+      io_buf.meta.wi += len;
+    }
+    return std::string();
+  }
+  return WriteToIOBufferSlow(output, io_buf, ptr, len);
+}
+
+// FlushIOBuffer drains io_buf to output.
+std::string  //
+FlushIOBuffer(sync_io::Output& output, IOBuffer& io_buf) {
+  if (io_buf.reader_length() > 0) {
+    std::string error_message = output.CopyOut(&io_buf);
+    if (!error_message.empty()) {
+      return error_message;
+    }
+  }
+  io_buf.compact();
+  return "";
+}
+
+// HostIsLittleEndian returns whether the CPU is little-endian.
+inline bool  //
+HostIsLittleEndian() {
+  const uint16_t x = 1;
+  uint8_t b = 0;
+  memcpy(&b, &x, 1);
+  return b == 1;
+}
+
 std::string  //
 HandleMetadata(
     const ErrorMessages& error_messages,
@@ -17,9 +17,20 @@
 // Auxiliary code is discussed at
 // https://github.com/google/wuffs/blob/main/doc/note/auxiliary-code.md
 
+#include <limits.h>
 #include <stdio.h>
 
 #include <string>
+#include <vector>
+
+// WUFFS_AUX__HAVE_COROUTINES is defined when the compiler and standard library
+// support C++20 coroutines, in which case the async_io namespace is available.
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#include <coroutine>
+#if defined(__cpp_lib_coroutine)
+#define WUFFS_AUX__HAVE_COROUTINES
+#endif
+#endif
 
 namespace wuffs_aux {
 
@@ -99,6 +110,12 @@ class Input {
 
   virtual IOBuffer* BringsItsOwnIOBuffer();
   virtual std::string CopyIn(IOBuffer* dst) = 0;
+
+  // Seek repositions the source so that the next CopyIn call resumes from
+  // the given absolute position, discarding dst's buffered contents. Some
+  // decoders (e.g. TIFF) need this to jump backwards. The default
+  // implementation returns an error, as not every source is seekable.
+  virtual std::string Seek(IOBuffer* dst, uint64_t absolute_position);
 };
 
 // --------
@@ -111,6 +128,7 @@ class FileInput : public Input {
   FileInput(FILE* f);
 
   virtual std::string CopyIn(IOBuffer* dst);
+  virtual std::string Seek(IOBuffer* dst, uint64_t absolute_position);
 
  private:
   FILE* m_f;
@@ -132,6 +150,7 @@ class MemoryInput : public Input {
 
   virtual IOBuffer* BringsItsOwnIOBuffer();
   virtual std::string CopyIn(IOBuffer* dst);
+  virtual std::string Seek(IOBuffer* dst, uint64_t absolute_position);
 
  private:
   IOBuffer m_io;
@@ -143,6 +162,234 @@ class MemoryInput : public Input {
 
 // --------
 
+// Output is the sink-side counterpart to Input.
+//
+// CopyOut consumes all of src's readable bytes, advancing src->meta.ri, unless
+// it returns an error.
+class Output {
+ public:
+  virtual ~Output();
+
+  virtual std::string CopyOut(IOBuffer* src) = 0;
+};
+
+// --------
+
+// FileOutput is an Output that writes to a file destination.
+//
+// It does not take responsibility for flushing or closing the file when done.
+class FileOutput : public Output {
+ public:
+  FileOutput(FILE* f);
+
+  virtual std::string CopyOut(IOBuffer* src);
+
+ private:
+  FILE* m_f;
+
+  // Delete the copy and assign constructors.
+  FileOutput(const FileOutput&) = delete;
+  FileOutput& operator=(const FileOutput&) = delete;
+};
+
+// --------
+
+// MemoryOutput is an Output that writes to a fixed-size in-memory destination.
+// Writing more than len bytes in total is an error.
+//
+// It does not take responsibility for freeing the memory when done.
+class MemoryOutput : public Output {
+ public:
+  MemoryOutput(char* ptr, size_t len);
+  MemoryOutput(uint8_t* ptr, size_t len);
+
+  virtual std::string CopyOut(IOBuffer* src);
+
+  // Length returns the number of bytes written so far.
+  size_t Length() const;
+
+ private:
+  IOBuffer m_io;
+
+  // Delete the copy and assign constructors.
+  MemoryOutput(const MemoryOutput&) = delete;
+  MemoryOutput& operator=(const MemoryOutput&) = delete;
+};
+
+// --------
+
 }  // namespace sync_io
 
+#if defined(WUFFS_AUX__HAVE_COROUTINES)
+
+// The async_io namespace is the C++20 coroutine counterpart to sync_io. Its
+// Input and Output types do not block. Instead, they suspend the awaiting
+// coroutine until their I/O completes, typically resumed by an event loop
+// (e.g. one built on epoll or io_uring). Like the rest of wuffs_aux, it does
+// not create any threads.
+namespace async_io {
+
+// --------
+
+// Task is the coroutine type returned by this namespace's coroutines, such as
+// TransformIO. Its result is an error message, empty on success.
+//
+// A Task does not run until it is either co_await'ed, from a coroutine of any
+// type (e.g. a server's own task type), or started by calling Start. It owns
+// its coroutine frame, destroying it in the Task destructor.
+//
+// Destroying a Task while its coroutine is suspended (not Done) destroys the
+// frame mid-flight, without resuming it. The caller must then guarantee that
+// nothing will resume it: any pending StartCopyIn or StartCopyOut operation
+// must have been cancelled (so that it never calls h.resume()) and nothing
+// may touch the buffers that it was given. Likewise, a Task that is
+// co_await'ed must outlive that co_await, as the awaiting coroutine is only
+// resumed from the awaited Task's frame.
+class Task {
+ public:
+  struct promise_type {
+    struct FinalAwaitable {
+      bool await_ready() noexcept;
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<promise_type> h) noexcept;
+      void await_resume() noexcept;
+    };
+
+    Task get_return_object();
+    std::suspend_always initial_suspend() noexcept;
+    FinalAwaitable final_suspend() noexcept;
+    void return_value(std::string result);
+    void unhandled_exception();
+
+    std::coroutine_handle<> m_continuation;
+    std::string m_result;
+  };
+
+  Task(Task&& other);
+  ~Task();
+
+  // Start runs the coroutine until it first suspends (or finishes). It is for
+  // top-level Tasks, e.g. those started by an event loop, that are not
+  // co_await'ed. Call it at most once.
+  void Start();
+
+  // Done returns whether the coroutine has finished, after which Result
+  // returns its error message.
+  bool Done() const;
+  const std::string& Result() const;
+
+  // These make Task awaitable.
+  bool await_ready() const noexcept;
+  std::coroutine_handle<> await_suspend(
+      std::coroutine_handle<> continuation) noexcept;
+  std::string await_resume();
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> h);
+
+  std::coroutine_handle<promise_type> m_handle;
+
+  // Delete the copy and assign constructors.
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+};
+
+// --------
+
+// Input is the asynchronous counterpart to sync_io::Input. Its CopyIn method
+// returns an awaitable, so that "co_await input.CopyIn(&buf)" yields an error
+// message (empty on success) once some bytes have been copied into buf.
+class Input {
+ public:
+  class CopyInAwaitable {
+   public:
+    CopyInAwaitable(Input& input, IOBuffer* dst);
+
+    bool await_ready() noexcept;
+    bool await_suspend(std::coroutine_handle<> h);
+    std::string await_resume();
+
+   private:
+    Input& m_input;
+    IOBuffer* m_dst;
+    std::string m_error_message;
+  };
+
+  virtual ~Input();
+
+  CopyInAwaitable CopyIn(IOBuffer* dst);
+
+  // StartCopyIn implements CopyIn. Like sync_io::Input::CopyIn, it should
+  // compact dst, copy bytes into dst's writer side and set dst->meta.closed at
+  // the end of the input.
+  //
+  // If it can finish (or fail) immediately, e.g. if bytes are already
+  // available, it should do so and return true. Otherwise, it should return
+  // false and, later, after copying or setting *error_message, call h.resume()
+  // exactly once, e.g. from an event loop callback. Until then, dst must not
+  // be modified by anyone else.
+  virtual bool StartCopyIn(IOBuffer* dst,
+                           std::coroutine_handle<> h,
+                           std::string* error_message) = 0;
+};
+
+// --------
+
+// Output is the asynchronous counterpart to sync_io::Output, the sink-side
+// counterpart to Input. Like sync_io::Output::CopyOut, the CopyOut operation
+// consumes all of src's readable bytes, unless it fails.
+class Output {
+ public:
+  class CopyOutAwaitable {
+   public:
+    CopyOutAwaitable(Output& output, IOBuffer* src);
+
+    bool await_ready() noexcept;
+    bool await_suspend(std::coroutine_handle<> h);
+    std::string await_resume();
+
+   private:
+    Output& m_output;
+    IOBuffer* m_src;
+    std::string m_error_message;
+  };
+
+  virtual ~Output();
+
+  CopyOutAwaitable CopyOut(IOBuffer* src);
+
+  // StartCopyOut implements CopyOut. Its return value and h have the same
+  // meaning as for Input::StartCopyIn.
+  virtual bool StartCopyOut(IOBuffer* src,
+                            std::coroutine_handle<> h,
+                            std::string* error_message) = 0;
+};
+
+// --------
+
+// TransformIO runs transformer (e.g. a gzip decoder) from input to output,
+// co_await'ing input.CopyIn when it suspends with a short read and
+// output.CopyOut when it suspends with a short write (and, finally, when it
+// finishes). Before each input.CopyIn, any bytes already in dst are flushed by
+// output.CopyOut, so that a slow input does not delay the output. dst and src
+// are the buffers in between them and src may start with some bytes already.
+// workbuf has the same meaning as for the transform_io method.
+//
+// The arguments must outlive the returned Task, as its coroutine frame only
+// holds references to them. dst is compacted after each CopyOut, so do not
+// use deflate.QUIRK_DST_HISTORY_IS_ADDRESSABLE.
+Task  //
+TransformIO(wuffs_base__io_transformer* transformer,
+            Output& output,
+            Input& input,
+            IOBuffer& dst,
+            IOBuffer& src,
+            wuffs_base__slice_u8 workbuf);
+
+// --------
+
+}  // namespace async_io
+
+#endif  // defined(WUFFS_AUX__HAVE_COROUTINES)
+
 }  // namespace wuffs_aux
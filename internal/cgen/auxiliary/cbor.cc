@@ -25,8 +25,79 @@ DecodeCborResult::DecodeCborResult(std::string&& error_message0,
     : error_message(std::move(error_message0)),
       cursor_position(cursor_position0) {}
 
+namespace {
+
+bool  //
+DecodeCbor_IsTypedArrayTag(uint64_t tag) {
+  return (WUFFS_CBOR__TYPED_ARRAY_TAG__MIN_INCL <= tag) &&
+         (tag <= WUFFS_CBOR__TYPED_ARRAY_TAG__MAX_INCL) && (tag != 76);
+}
+
+// DecodeCbor_AppendTypedArray calls AppendTypedArray, or AppendCborTag and
+// AppendByteString if len is not a multiple of the element size.
+std::string  //
+DecodeCbor_AppendTypedArray(DecodeCborCallbacks& callbacks,
+                            uint64_t tag,
+                            const uint8_t* ptr,
+                            size_t len) {
+  CborTypedArray val(tag, ptr, len);
+  if ((len % val.element_size) == 0) {
+    return callbacks.AppendTypedArray(val);
+  }
+  std::string ret = callbacks.AppendCborTag(tag);
+  if (!ret.empty()) {
+    return ret;
+  }
+  const char* p =  // Convert from (const uint8_t*).
+      static_cast<const char*>(static_cast<const void*>(ptr));
+  return callbacks.AppendByteString(std::string(p, len));
+}
+
+}  // namespace
+
+CborTypedArray::CborTypedArray(uint64_t tag0,
+                               const uint8_t* ptr0,
+                               size_t len0)
+    : tag(tag0),
+      ptr(ptr0),
+      len(len0),
+      element_kind((tag0 & 0x10) ? Float : (tag0 & 0x08) ? Signed : Unsigned),
+      element_size(((tag0 & 0x10) ? 2u : 1u) << (tag0 & 0x03)),
+      little_endian((tag0 & 0x04) && (tag0 != 68)),
+      clamped(tag0 == 68) {}
+
+size_t  //
+CborTypedArray::NumElements() const {
+  return len / element_size;
+}
+
+size_t  //
+CborTypedArray::CopyToNative(void* dst, size_t dst_len) const {
+  size_t n = (dst_len < len) ? dst_len : len;
+  n -= n % element_size;
+  if ((element_size == 1) ||
+      (little_endian == private_impl::HostIsLittleEndian())) {
+    memcpy(dst, ptr, n);
+    return n;
+  }
+  return wuffs_base__byte_swap__copy(
+      wuffs_base__make_slice_u8(static_cast<uint8_t*>(dst), n),
+      wuffs_base__make_slice_u8(const_cast<uint8_t*>(ptr), n), element_size);
+}
+
 DecodeCborCallbacks::~DecodeCborCallbacks() {}
 
+std::string  //
+DecodeCborCallbacks::AppendTypedArray(const CborTypedArray& val) {
+  std::string ret = AppendCborTag(val.tag);
+  if (!ret.empty()) {
+    return ret;
+  }
+  const char* ptr =  // Convert from (const uint8_t*).
+      static_cast<const char*>(static_cast<const void*>(val.ptr));
+  return AppendByteString(std::string(ptr, val.len));
+}
+
 void  //
 DecodeCborCallbacks::Done(DecodeCborResult& result,
                           sync_io::Input& input,
@@ -85,6 +156,10 @@ DecodeCbor(DecodeCborCallbacks& callbacks,
     std::string str;
     int64_t extension_category = 0;
     uint64_t extension_detail = 0;
+    // typed_array_tag is non-zero when the previous token was a typed array
+    // tag, whose callback is deferred until we see whether a byte string
+    // follows.
+    uint64_t typed_array_tag = 0;
 
     // Valid token's VBCs range in 0 ..= 15. Values over that are for tokens
     // from outside of the base package, such as the CBOR package.
@@ -160,6 +235,16 @@ DecodeCbor(DecodeCborCallbacks& callbacks,
 
       uint64_t vbd = token.value_base_detail();
 
+      if ((typed_array_tag != 0) &&
+          ((token.value_base_category() != WUFFS_BASE__TOKEN__VBC__STRING) ||
+           (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CHAIN_MUST_BE_UTF_8))) {
+        ret_error_message = callbacks.AppendCborTag(typed_array_tag);
+        typed_array_tag = 0;
+        if (!ret_error_message.empty()) {
+          goto done;
+        }
+      }
+
       if (extension_category != 0) {
         int64_t ext = token.value_extension();
         if ((ext >= 0) && !token.continued()) {
@@ -223,6 +308,15 @@ DecodeCbor(DecodeCborCallbacks& callbacks,
             // No-op.
           } else if (vbd &
                      WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {
+            if ((typed_array_tag != 0) && str.empty() && !token.continued()) {
+              // The whole typed array is in this one token, so it can be
+              // viewed in place, without copying to str.
+              ret_error_message = DecodeCbor_AppendTypedArray(
+                  callbacks, typed_array_tag, token_ptr,
+                  static_cast<size_t>(token_len));
+              typed_array_tag = 0;
+              goto parsed_a_value;
+            }
             const char* ptr =  // Convert from (uint8_t*).
                 static_cast<const char*>(static_cast<void*>(token_ptr));
             str.append(ptr, static_cast<size_t>(token_len));
@@ -232,10 +326,19 @@ DecodeCbor(DecodeCborCallbacks& callbacks,
           if (token.continued()) {
             continue;
           }
-          ret_error_message =
-              (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CHAIN_MUST_BE_UTF_8)
-                  ? callbacks.AppendTextString(std::move(str))
-                  : callbacks.AppendByteString(std::move(str));
+          if (typed_array_tag != 0) {
+            ret_error_message = DecodeCbor_AppendTypedArray(
+                callbacks, typed_array_tag,
+                static_cast<const uint8_t*>(
+                    static_cast<const void*>(str.data())),
+                str.size());
+            typed_array_tag = 0;
+          } else if (vbd &
+                     WUFFS_BASE__TOKEN__VBD__STRING__CHAIN_MUST_BE_UTF_8) {
+            ret_error_message = callbacks.AppendTextString(std::move(str));
+          } else {
+            ret_error_message = callbacks.AppendByteString(std::move(str));
+          }
           str.clear();
           goto parsed_a_value;
         }
@@ -340,8 +443,13 @@ DecodeCbor(DecodeCborCallbacks& callbacks,
                 value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__DETAIL_MASK;
             continue;
           }
-          ret_error_message = callbacks.AppendCborTag(
-              value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__DETAIL_MASK);
+          uint64_t tag =
+              value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__DETAIL_MASK;
+          if (DecodeCbor_IsTypedArrayTag(tag)) {
+            typed_array_tag = tag;
+            continue;
+          }
+          ret_error_message = callbacks.AppendCborTag(tag);
           if (!ret_error_message.empty()) {
             goto done;
           }
@@ -369,6 +477,768 @@ done:
   return result;
 }
 
+// --------
+
+CborEncoder::CborEncoder(sync_io::Output& output)
+    : m_output(output),
+      m_owned_array(new uint8_t[4096]),
+      m_buf(wuffs_base__ptr_u8__writer(m_owned_array.get(), 4096)) {}
+
+CborEncoder::CborEncoder(sync_io::Output& output, wuffs_base__slice_u8 buffer)
+    : m_output(output),
+      m_owned_array(nullptr),
+      m_buf(wuffs_base__ptr_u8__writer(buffer.ptr, buffer.len)) {}
+
+std::string  //
+CborEncoder::Flush() {
+  return private_impl::FlushIOBuffer(m_output, m_buf);
+}
+
+std::string  //
+CborEncoder::WriteNull() {
+  const uint8_t c = 0xF6;
+  return WriteRaw(&c, 1);
+}
+
+std::string  //
+CborEncoder::WriteUndefined() {
+  const uint8_t c = 0xF7;
+  return WriteRaw(&c, 1);
+}
+
+std::string  //
+CborEncoder::WriteBool(bool val) {
+  const uint8_t c = val ? 0xF5 : 0xF4;
+  return WriteRaw(&c, 1);
+}
+
+std::string  //
+CborEncoder::WriteF64(double val) {
+  uint8_t c[9];
+  wuffs_base__lossy_value_u16 lv16 =
+      wuffs_base__ieee_754_bit_representation__from_f64_to_u16_truncate(val);
+  if (!lv16.lossy) {
+    c[0] = 0xF9;
+    wuffs_base__poke_u16be__no_bounds_check(&c[1], lv16.value);
+    return WriteRaw(&c[0], 3);
+  }
+  wuffs_base__lossy_value_u32 lv32 =
+      wuffs_base__ieee_754_bit_representation__from_f64_to_u32_truncate(val);
+  if (!lv32.lossy) {
+    c[0] = 0xFA;
+    wuffs_base__poke_u32be__no_bounds_check(&c[1], lv32.value);
+    return WriteRaw(&c[0], 5);
+  }
+  c[0] = 0xFB;
+  wuffs_base__poke_u64be__no_bounds_check(
+      &c[1], wuffs_base__ieee_754_bit_representation__from_f64_to_u64(val));
+  return WriteRaw(&c[0], 9);
+}
+
+std::string  //
+CborEncoder::WriteI64(int64_t val) {
+  return (val >= 0) ? WriteHead(0, static_cast<uint64_t>(val))
+                    : WriteHead(1, static_cast<uint64_t>(-(val + 1)));
+}
+
+std::string  //
+CborEncoder::WriteU64(uint64_t val) {
+  return WriteHead(0, val);
+}
+
+std::string  //
+CborEncoder::WriteByteString(const uint8_t* ptr, size_t len) {
+  std::string z = WriteHead(2, len);
+  return z.empty() ? WriteRaw(ptr, len) : z;
+}
+
+std::string  //
+CborEncoder::WriteTextString(const char* ptr, size_t len) {
+  std::string z = WriteHead(3, len);
+  return z.empty() ? WriteRaw(static_cast<const uint8_t*>(
+                                  static_cast<const void*>(ptr)),
+                              len)
+                   : z;
+}
+
+std::string  //
+CborEncoder::WriteMinus1MinusX(uint64_t val) {
+  return WriteHead(1, val);
+}
+
+std::string  //
+CborEncoder::WriteCborSimpleValue(uint8_t val) {
+  return WriteHead(7, val);
+}
+
+std::string  //
+CborEncoder::WriteCborTag(uint64_t val) {
+  return WriteHead(6, val);
+}
+
+std::string  //
+CborEncoder::WriteHead(uint8_t major_type, uint64_t argument) {
+  uint8_t c[9];
+  uint8_t base = static_cast<uint8_t>(major_type << 5);
+  if (argument < 0x18) {
+    c[0] = base | static_cast<uint8_t>(argument);
+    return WriteRaw(&c[0], 1);
+  } else if (argument <= 0xFF) {
+    c[0] = base | 0x18;
+    c[1] = static_cast<uint8_t>(argument);
+    return WriteRaw(&c[0], 2);
+  } else if (argument <= 0xFFFF) {
+    c[0] = base | 0x19;
+    wuffs_base__poke_u16be__no_bounds_check(&c[1],
+                                            static_cast<uint16_t>(argument));
+    return WriteRaw(&c[0], 3);
+  } else if (argument <= 0xFFFFFFFF) {
+    c[0] = base | 0x1A;
+    wuffs_base__poke_u32be__no_bounds_check(&c[1],
+                                            static_cast<uint32_t>(argument));
+    return WriteRaw(&c[0], 5);
+  }
+  c[0] = base | 0x1B;
+  wuffs_base__poke_u64be__no_bounds_check(&c[1], argument);
+  return WriteRaw(&c[0], 9);
+}
+
+std::string  //
+CborEncoder::WriteIndefiniteHead(uint8_t major_type) {
+  const uint8_t c = static_cast<uint8_t>(major_type << 5) | 0x1F;
+  return WriteRaw(&c, 1);
+}
+
+std::string  //
+CborEncoder::WriteBreak() {
+  const uint8_t c = 0xFF;
+  return WriteRaw(&c, 1);
+}
+
+std::string  //
+CborEncoder::WriteRaw(const uint8_t* ptr, size_t len) {
+  return private_impl::WriteToIOBuffer(m_output, m_buf, ptr, len);
+}
+
+// --------
+
+const char TranscodeCborToJson_UnsupportedMapKey[] =  //
+    "wuffs_aux::TranscodeCborToJson: unsupported map key";
+
+namespace {
+
+// TranscodeCborToJson_Context tracks the position within the enclosing JSON
+// list or dict, which determines the punctuation before the next value.
+enum class TranscodeCborToJson_Context : uint8_t {
+  none,
+  in_list_after_bracket,
+  in_list_after_value,
+  in_dict_after_brace,
+  in_dict_after_key,
+  in_dict_after_value,
+};
+
+// TranscodeCborToJson_WritePreamble writes any ',' or ':' that precedes the
+// next value and updates ctx. It sets is_key to whether that next value is a
+// dict key.
+std::string  //
+TranscodeCborToJson_WritePreamble(sync_io::Output& output,
+                                  IOBuffer& dst,
+                                  TranscodeCborToJson_Context& ctx,
+                                  bool& is_key) {
+  const char* s = nullptr;
+  is_key = false;
+  switch (ctx) {
+    case TranscodeCborToJson_Context::none:
+      break;
+    case TranscodeCborToJson_Context::in_list_after_bracket:
+      ctx = TranscodeCborToJson_Context::in_list_after_value;
+      break;
+    case TranscodeCborToJson_Context::in_list_after_value:
+      s = ",";
+      break;
+    case TranscodeCborToJson_Context::in_dict_after_brace:
+      ctx = TranscodeCborToJson_Context::in_dict_after_key;
+      is_key = true;
+      break;
+    case TranscodeCborToJson_Context::in_dict_after_key:
+      s = ":";
+      ctx = TranscodeCborToJson_Context::in_dict_after_value;
+      break;
+    case TranscodeCborToJson_Context::in_dict_after_value:
+      s = ",";
+      ctx = TranscodeCborToJson_Context::in_dict_after_key;
+      is_key = true;
+      break;
+  }
+  if (!s) {
+    return std::string();
+  }
+  return private_impl::WriteToIOBuffer(
+      output, dst, static_cast<const uint8_t*>(static_cast<const void*>(s)),
+      1);
+}
+
+// TranscodeCborToJson_WriteEscaped writes UTF-8 text, without the enclosing
+// quotes, escaping '"', '\\' and ASCII control characters.
+std::string  //
+TranscodeCborToJson_WriteEscaped(sync_io::Output& output,
+                                 IOBuffer& dst,
+                                 const uint8_t* ptr,
+                                 size_t len) {
+  static const char hex[] = "0123456789ABCDEF";
+  while (true) {
+    size_t i = 0;
+    for (; i < len; i++) {
+      uint8_t c = ptr[i];
+      if ((c < 0x20) || (c == '"') || (c == '\\')) {
+        break;
+      }
+    }
+    std::string z = private_impl::WriteToIOBuffer(output, dst, ptr, i);
+    if (!z.empty() || (i == len)) {
+      return z;
+    }
+
+    uint8_t c = ptr[i];
+    uint8_t e[6] = {'\\', 'u', '0', '0', static_cast<uint8_t>(hex[c >> 4]),
+                    static_cast<uint8_t>(hex[c & 15])};
+    size_t n = 2;
+    switch (c) {
+      case '"':
+      case '\\':
+        e[1] = c;
+        break;
+      case '\b':
+        e[1] = 'b';
+        break;
+      case '\f':
+        e[1] = 'f';
+        break;
+      case '\n':
+        e[1] = 'n';
+        break;
+      case '\r':
+        e[1] = 'r';
+        break;
+      case '\t':
+        e[1] = 't';
+        break;
+      default:
+        n = 6;
+        break;
+    }
+    z = private_impl::WriteToIOBuffer(output, dst, &e[0], n);
+    if (!z.empty()) {
+      return z;
+    }
+    ptr += i + 1;
+    len -= i + 1;
+  }
+}
+
+// TranscodeCborToJson_EncodeBase64 base64url-encodes (without padding) as
+// much of ptr[:len] as it can: all of it if closed, otherwise a multiple of 3
+// bytes. It advances ptr and len accordingly.
+std::string  //
+TranscodeCborToJson_EncodeBase64(sync_io::Output& output,
+                                 IOBuffer& dst,
+                                 const uint8_t*& ptr,
+                                 size_t& len,
+                                 bool closed) {
+  while (true) {
+    wuffs_base__transform__output o = wuffs_base__base_64__encode(
+        dst.writer_slice(),
+        wuffs_base__make_slice_u8(const_cast<uint8_t*>(ptr), len), closed,
+        WUFFS_BASE__BASE_64__URL_ALPHABET);
+    dst.meta.wi += o.num_dst;
+    ptr += o.num_src;
+    len -= o.num_src;
+    if ((o.status.repr == nullptr) ||
+        (o.status.repr == wuffs_base__suspension__short_read)) {
+      return "";
+    } else if (o.status.repr != wuffs_base__suspension__short_write) {
+      return o.status.message();
+    }
+    std::string z = private_impl::FlushIOBuffer(output, dst);
+    if (!z.empty()) {
+      return z;
+    }
+  }
+}
+
+// TranscodeCborToJson_WriteBase64 is like TranscodeCborToJson_EncodeBase64
+// but a byte string can be split over multiple tokens. The 0, 1 or 2 bytes
+// that don't fill a 3 byte group are held in carry until the next call.
+std::string  //
+TranscodeCborToJson_WriteBase64(sync_io::Output& output,
+                                IOBuffer& dst,
+                                uint8_t* carry,
+                                size_t& carry_len,
+                                const uint8_t* ptr,
+                                size_t len,
+                                bool closed) {
+  if (carry_len > 0) {
+    while ((carry_len < 3) && (len > 0)) {
+      carry[carry_len++] = *ptr++;
+      len--;
+    }
+    if ((carry_len < 3) && !closed) {
+      return "";
+    }
+    const uint8_t* c_ptr = carry;
+    size_t c_len = carry_len;
+    std::string z =
+        TranscodeCborToJson_EncodeBase64(output, dst, c_ptr, c_len, true);
+    if (!z.empty()) {
+      return z;
+    }
+    carry_len = 0;
+  }
+  std::string z =
+      TranscodeCborToJson_EncodeBase64(output, dst, ptr, len, closed);
+  if (!z.empty()) {
+    return z;
+  }
+  memcpy(carry, ptr, len);
+  carry_len = len;
+  return "";
+}
+
+}  // namespace
+
+#define WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE(ptr, len)                    \
+  do {                                                                        \
+    ret_error_message = private_impl::WriteToIOBuffer(                        \
+        output, dst,                                                          \
+        static_cast<const uint8_t*>(static_cast<const void*>(ptr)), len);     \
+    if (!ret_error_message.empty()) {                                         \
+      goto done;                                                              \
+    }                                                                         \
+  } while (false)
+
+DecodeCborResult  //
+TranscodeCborToJson(sync_io::Output& output,
+                    sync_io::Input& input,
+                    DecodeCborArgQuirks quirks) {
+  // Prepare the wuffs_base__io_buffer and the resultant error_message.
+  wuffs_base__io_buffer* io_buf = input.BringsItsOwnIOBuffer();
+  wuffs_base__io_buffer fallback_io_buf = wuffs_base__empty_io_buffer();
+  std::unique_ptr<uint8_t[]> fallback_io_array(nullptr);
+  if (!io_buf) {
+    fallback_io_array = std::unique_ptr<uint8_t[]>(new uint8_t[4096]);
+    fallback_io_buf = wuffs_base__ptr_u8__writer(fallback_io_array.get(), 4096);
+    io_buf = &fallback_io_buf;
+  }
+  // The JSON is written to dst, which is drained to output when full.
+  uint8_t dst_array[4096];
+  wuffs_base__io_buffer dst =
+      wuffs_base__ptr_u8__writer(&dst_array[0], sizeof(dst_array));
+  // cursor_index is discussed at
+  // https://nigeltao.github.io/blog/2020/jsonptr.html#the-cursor-index
+  size_t cursor_index = 0;
+  std::string ret_error_message;
+  std::string io_error_message;
+
+  do {
+    // Prepare the low-level CBOR decoder.
+    wuffs_cbor__decoder::unique_ptr dec = wuffs_cbor__decoder::alloc();
+    if (!dec) {
+      ret_error_message = "wuffs_aux::TranscodeCborToJson: out of memory";
+      goto done;
+    } else if (WUFFS_CBOR__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE != 0) {
+      ret_error_message =
+          "wuffs_aux::TranscodeCborToJson: internal error: bad WORKBUF_LEN";
+      goto done;
+    }
+    for (size_t i = 0; i < quirks.repr.len; i++) {
+      dec->set_quirk(quirks.repr.ptr[i], 1);
+    }
+
+    // Prepare the wuffs_base__tok_buffer. 256 tokens is 2KiB.
+    wuffs_base__token tok_array[256];
+    wuffs_base__token_buffer tok_buf =
+        wuffs_base__slice_token__writer(wuffs_base__make_slice_token(
+            &tok_array[0], (sizeof(tok_array) / sizeof(tok_array[0]))));
+    wuffs_base__status tok_status = wuffs_base__make_status(nullptr);
+
+    // Prepare other state. ctx_stack[i] holds the context to return to after
+    // the container at depth i is popped.
+    int32_t depth = 0;
+    int64_t extension_category = 0;
+    uint64_t extension_detail = 0;
+    TranscodeCborToJson_Context ctx = TranscodeCborToJson_Context::none;
+    TranscodeCborToJson_Context ctx_stack[WUFFS_CBOR__DECODER_DEPTH_MAX_INCL];
+    bool is_key = false;
+    bool in_string = false;
+    bool in_byte_string = false;
+    uint8_t b64_carry[3];
+    size_t b64_carry_len = 0;
+
+    // num_buf holds a rendered number, starting at num_buf[1]. It has room
+    // to wrap that in double-quotes, for numeric dict keys.
+    uint8_t num_buf[2 + 64];
+
+    // Valid token's VBCs range in 0 ..= 15. Values over that are for tokens
+    // from outside of the base package, such as the CBOR package.
+    constexpr int64_t EXT_CAT__CBOR_TAG = 16;
+
+    // Loop, doing these two things:
+    //  1. Get the next token.
+    //  2. Process that token.
+    while (true) {
+      // 1. Get the next token.
+
+      while (tok_buf.meta.ri >= tok_buf.meta.wi) {
+        if (tok_status.repr == nullptr) {
+          // No-op.
+        } else if (tok_status.repr == wuffs_base__suspension__short_write) {
+          tok_buf.compact();
+        } else if (tok_status.repr == wuffs_base__suspension__short_read) {
+          // Read from input to io_buf.
+          if (!io_error_message.empty()) {
+            ret_error_message = std::move(io_error_message);
+            goto done;
+          } else if (cursor_index != io_buf->meta.ri) {
+            ret_error_message =
+                "wuffs_aux::TranscodeCborToJson: internal error: bad "
+                "cursor_index";
+            goto done;
+          } else if (io_buf->meta.closed) {
+            ret_error_message =
+                "wuffs_aux::TranscodeCborToJson: internal error: io_buf is "
+                "closed";
+            goto done;
+          }
+          io_buf->compact();
+          if (io_buf->meta.wi >= io_buf->data.len) {
+            ret_error_message =
+                "wuffs_aux::TranscodeCborToJson: internal error: io_buf is "
+                "full";
+            goto done;
+          }
+          cursor_index = io_buf->meta.ri;
+          io_error_message = input.CopyIn(io_buf);
+        } else {
+          ret_error_message = tok_status.message();
+          goto done;
+        }
+
+        tok_status = dec->decode_tokens(&tok_buf, io_buf,
+                                        wuffs_base__empty_slice_u8());
+        if ((tok_buf.meta.ri > tok_buf.meta.wi) ||
+            (tok_buf.meta.wi > tok_buf.data.len) ||
+            (io_buf->meta.ri > io_buf->meta.wi) ||
+            (io_buf->meta.wi > io_buf->data.len)) {
+          ret_error_message =
+              "wuffs_aux::TranscodeCborToJson: internal error: bad buffer "
+              "indexes";
+          goto done;
+        }
+      }
+
+      wuffs_base__token token = tok_buf.data.ptr[tok_buf.meta.ri++];
+      uint64_t token_len = token.length();
+      if ((io_buf->meta.ri < cursor_index) ||
+          ((io_buf->meta.ri - cursor_index) < token_len)) {
+        ret_error_message =
+            "wuffs_aux::TranscodeCborToJson: internal error: bad token "
+            "indexes";
+        goto done;
+      }
+      uint8_t* token_ptr = io_buf->data.ptr + cursor_index;
+      cursor_index += static_cast<size_t>(token_len);
+
+      // 2. Process that token. Scalar values (other than strings) set num_len
+      // and whether they can be a (quoted) dict key, then goto write_scalar.
+
+      uint64_t vbd = token.value_base_detail();
+      size_t num_len = 0;
+      bool can_be_key = false;
+
+      if (extension_category != 0) {
+        int64_t ext = token.value_extension();
+        if ((ext >= 0) && !token.continued()) {
+          extension_detail = (extension_detail
+                              << WUFFS_BASE__TOKEN__VALUE_EXTENSION__NUM_BITS) |
+                             static_cast<uint64_t>(ext);
+          switch (extension_category) {
+            case WUFFS_BASE__TOKEN__VBC__INLINE_INTEGER_SIGNED:
+              extension_category = 0;
+              num_len = wuffs_base__render_number_i64(
+                  wuffs_base__make_slice_u8(&num_buf[1], 64),
+                  static_cast<int64_t>(extension_detail),
+                  WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS);
+              can_be_key = true;
+              goto write_scalar;
+            case WUFFS_BASE__TOKEN__VBC__INLINE_INTEGER_UNSIGNED:
+              extension_category = 0;
+              num_len = wuffs_base__render_number_u64(
+                  wuffs_base__make_slice_u8(&num_buf[1], 64), extension_detail,
+                  WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS);
+              can_be_key = true;
+              goto write_scalar;
+            case EXT_CAT__CBOR_TAG:
+              extension_category = 0;
+              continue;
+          }
+        }
+        ret_error_message =
+            "wuffs_aux::TranscodeCborToJson: internal error: bad extended "
+            "token";
+        goto done;
+      }
+
+      switch (token.value_base_category()) {
+        case WUFFS_BASE__TOKEN__VBC__FILLER:
+          continue;
+
+        case WUFFS_BASE__TOKEN__VBC__STRUCTURE: {
+          if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH) {
+            ret_error_message = TranscodeCborToJson_WritePreamble(
+                output, dst, ctx, is_key);
+            if (!ret_error_message.empty()) {
+              goto done;
+            } else if (is_key) {
+              ret_error_message = TranscodeCborToJson_UnsupportedMapKey;
+              goto done;
+            } else if (depth >= WUFFS_CBOR__DECODER_DEPTH_MAX_INCL) {
+              ret_error_message =
+                  "wuffs_aux::TranscodeCborToJson: internal error: bad depth";
+              goto done;
+            }
+            ctx_stack[depth++] = ctx;
+            if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST) {
+              ctx = TranscodeCborToJson_Context::in_list_after_bracket;
+              WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE("[", 1);
+            } else {
+              ctx = TranscodeCborToJson_Context::in_dict_after_brace;
+              WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE("{", 1);
+            }
+            continue;
+          }
+          if (depth <= 0) {
+            ret_error_message =
+                "wuffs_aux::TranscodeCborToJson: internal error: bad depth";
+            goto done;
+          }
+          ctx = ctx_stack[--depth];
+          if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__FROM_LIST) {
+            WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE("]", 1);
+          } else {
+            WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE("}", 1);
+          }
+          goto parsed_a_value;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__STRING: {
+          if (!in_string) {
+            // Any string, text or bytes, can be a dict key.
+            ret_error_message = TranscodeCborToJson_WritePreamble(
+                output, dst, ctx, is_key);
+            if (!ret_error_message.empty()) {
+              goto done;
+            }
+            WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE("\"", 1);
+            in_string = true;
+            in_byte_string =
+                !(vbd & WUFFS_BASE__TOKEN__VBD__STRING__CHAIN_MUST_BE_UTF_8);
+            b64_carry_len = 0;
+          }
+          if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP) {
+            // No-op.
+          } else if (vbd &
+                     WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {
+            ret_error_message =
+                in_byte_string
+                    ? TranscodeCborToJson_WriteBase64(
+                          output, dst, &b64_carry[0], b64_carry_len, token_ptr,
+                          static_cast<size_t>(token_len), false)
+                    : TranscodeCborToJson_WriteEscaped(
+                          output, dst, token_ptr,
+                          static_cast<size_t>(token_len));
+            if (!ret_error_message.empty()) {
+              goto done;
+            }
+          } else {
+            goto fail;
+          }
+          if (token.continued()) {
+            continue;
+          }
+          if (in_byte_string) {
+            ret_error_message = TranscodeCborToJson_WriteBase64(
+                output, dst, &b64_carry[0], b64_carry_len, nullptr, 0, true);
+            if (!ret_error_message.empty()) {
+              goto done;
+            }
+          }
+          WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE("\"", 1);
+          in_string = false;
+          goto parsed_a_value;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__LITERAL: {
+          if (vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__FALSE) {
+            memcpy(&num_buf[1], "false", 5);
+            num_len = 5;
+          } else if (vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__TRUE) {
+            memcpy(&num_buf[1], "true", 4);
+            num_len = 4;
+          } else {
+            // JSON's closest approximation to "undefined" is "null".
+            memcpy(&num_buf[1], "null", 4);
+            num_len = 4;
+          }
+          goto write_scalar;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__NUMBER: {
+          const uint64_t cfp_fbbe_fifb =
+              WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_FLOATING_POINT |
+              WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_BINARY_BIG_ENDIAN |
+              WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_IGNORE_FIRST_BYTE;
+          if ((vbd & cfp_fbbe_fifb) == cfp_fbbe_fifb) {
+            double f;
+            switch (token_len) {
+              case 3:
+                f = wuffs_base__ieee_754_bit_representation__from_u16_to_f64(
+                    wuffs_base__peek_u16be__no_bounds_check(token_ptr + 1));
+                break;
+              case 5:
+                f = wuffs_base__ieee_754_bit_representation__from_u32_to_f64(
+                    wuffs_base__peek_u32be__no_bounds_check(token_ptr + 1));
+                break;
+              case 9:
+                f = wuffs_base__ieee_754_bit_representation__from_u64_to_f64(
+                    wuffs_base__peek_u64be__no_bounds_check(token_ptr + 1));
+                break;
+              default:
+                goto fail;
+            }
+            // JSON numbers don't include Infinities or NaNs. For such
+            // numbers, their IEEE 754 bit representation's 11 exponent bits
+            // are all on.
+            uint64_t u =
+                wuffs_base__ieee_754_bit_representation__from_f64_to_u64(f);
+            if (((u >> 52) & 0x7FF) == 0x7FF) {
+              memcpy(&num_buf[1], "null", 4);
+              num_len = 4;
+            } else {
+              constexpr uint32_t precision = 0;
+              num_len = wuffs_base__render_number_f64(
+                  wuffs_base__make_slice_u8(&num_buf[1], 64), f, precision,
+                  WUFFS_BASE__RENDER_NUMBER_FXX__JUST_ENOUGH_PRECISION);
+            }
+            goto write_scalar;
+          }
+          goto fail;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__INLINE_INTEGER_SIGNED: {
+          if (token.continued()) {
+            extension_category = WUFFS_BASE__TOKEN__VBC__INLINE_INTEGER_SIGNED;
+            extension_detail =
+                static_cast<uint64_t>(token.value_base_detail__sign_extended());
+            continue;
+          }
+          num_len = wuffs_base__render_number_i64(
+              wuffs_base__make_slice_u8(&num_buf[1], 64),
+              token.value_base_detail__sign_extended(),
+              WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS);
+          can_be_key = true;
+          goto write_scalar;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__INLINE_INTEGER_UNSIGNED: {
+          if (token.continued()) {
+            extension_category =
+                WUFFS_BASE__TOKEN__VBC__INLINE_INTEGER_UNSIGNED;
+            extension_detail = vbd;
+            continue;
+          }
+          num_len = wuffs_base__render_number_u64(
+              wuffs_base__make_slice_u8(&num_buf[1], 64), vbd,
+              WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS);
+          can_be_key = true;
+          goto write_scalar;
+        }
+      }
+
+      if (token.value_major() == WUFFS_CBOR__TOKEN_VALUE_MAJOR) {
+        uint64_t value_minor = token.value_minor();
+        if (value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__MINUS_1_MINUS_X) {
+          if (token_len == 9) {
+            uint64_t x =
+                wuffs_base__peek_u64be__no_bounds_check(token_ptr + 1) + 1;
+            if (x == 0) {
+              // See the cbor.TOKEN_VALUE_MINOR__MINUS_1_MINUS_X comment re
+              // overflow.
+              memcpy(&num_buf[1], "-18446744073709551616", 21);
+              num_len = 21;
+            } else {
+              num_buf[1] = '-';
+              num_len = 1 + wuffs_base__render_number_u64(
+                                wuffs_base__make_slice_u8(&num_buf[2], 63), x,
+                                WUFFS_BASE__RENDER_NUMBER_XXX__DEFAULT_OPTIONS);
+            }
+            can_be_key = true;
+            goto write_scalar;
+          }
+        } else if (value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__SIMPLE_VALUE) {
+          memcpy(&num_buf[1], "null", 4);
+          num_len = 4;
+          goto write_scalar;
+        } else if (value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__TAG) {
+          if (token.continued()) {
+            extension_category = EXT_CAT__CBOR_TAG;
+            extension_detail =
+                value_minor & WUFFS_CBOR__TOKEN_VALUE_MINOR__DETAIL_MASK;
+          }
+          continue;
+        }
+      }
+
+    fail:
+      ret_error_message =
+          "wuffs_aux::TranscodeCborToJson: internal error: unexpected token";
+      goto done;
+
+    write_scalar:
+      ret_error_message =
+          TranscodeCborToJson_WritePreamble(output, dst, ctx, is_key);
+      if (!ret_error_message.empty()) {
+        goto done;
+      } else if (!is_key) {
+        WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE(&num_buf[1], num_len);
+      } else if (can_be_key) {
+        num_buf[0] = '"';
+        num_buf[1 + num_len] = '"';
+        WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE(&num_buf[0], 2 + num_len);
+      } else {
+        ret_error_message = TranscodeCborToJson_UnsupportedMapKey;
+        goto done;
+      }
+
+    parsed_a_value:
+      if (depth == 0) {
+        goto done;
+      }
+    }
+  } while (false);
+
+done:
+  std::string flush_error_message = private_impl::FlushIOBuffer(output, dst);
+  if (ret_error_message.empty()) {
+    ret_error_message = std::move(flush_error_message);
+  }
+  return DecodeCborResult(
+      std::move(ret_error_message),
+      wuffs_base__u64__sat_add(io_buf->meta.pos, cursor_index));
+}
+
+#undef WUFFS_AUX__TRANSCODE_CBOR_TO_JSON__WRITE
+
 }  // namespace wuffs_aux
 
 #endif  // !defined(WUFFS_CONFIG__MODULES) ||
@@ -23,6 +23,42 @@ struct DecodeCborResult {
   uint64_t cursor_position;
 };
 
+// CborTypedArray is a view of a CBOR typed array (RFC 8746): a byte string
+// whose preceding tag, in the range WUFFS_CBOR__TYPED_ARRAY_TAG__MIN_INCL ..=
+// WUFFS_CBOR__TYPED_ARRAY_TAG__MAX_INCL, gives its element type.
+//
+// ptr and len refer to the encoded (packed, possibly byte-swapped) elements.
+// They may point directly into DecodeCbor's input buffer and so are only valid
+// for the duration of the AppendTypedArray call.
+struct CborTypedArray {
+  enum ElementKind {
+    Unsigned = 0,
+    Signed = 1,
+    Float = 2,
+  };
+
+  CborTypedArray(uint64_t tag0, const uint8_t* ptr0, size_t len0);
+
+  uint64_t tag;
+  const uint8_t* ptr;
+  size_t len;
+
+  // These fields are derived from the tag. element_size is 1, 2, 4, 8 or 16.
+  // clamped is only true for tag 68 (uint8 clamped arithmetic).
+  ElementKind element_kind;
+  uint32_t element_size;
+  bool little_endian;
+  bool clamped;
+
+  size_t NumElements() const;
+
+  // CopyToNative copies the elements to dst, converting them to the host's
+  // byte order (in a single wuffs_base__byte_swap__copy pass, if it differs
+  // from the encoded byte order). It returns the number of bytes copied, which
+  // is a multiple of element_size and at most dst_len.
+  size_t CopyToNative(void* dst, size_t dst_len) const;
+};
+
 class DecodeCborCallbacks {
  public:
   virtual ~DecodeCborCallbacks();
@@ -41,6 +77,14 @@ class DecodeCborCallbacks {
   virtual std::string AppendCborSimpleValue(uint8_t val) = 0;
   virtual std::string AppendCborTag(uint64_t val) = 0;
 
+  // AppendTypedArray is called for a typed array tag followed by a byte string
+  // whose length is a multiple of the element size. Other typed array tags are
+  // passed to AppendCborTag as usual.
+  //
+  // The default AppendTypedArray implementation calls AppendCborTag and then
+  // AppendByteString, as if the tag had no special meaning.
+  virtual std::string AppendTypedArray(const CborTypedArray& val);
+
   // Push and Pop are called for container nodes: CBOR arrays (lists) and CBOR
   // maps (dictionaries).
   //
@@ -99,4 +143,82 @@ DecodeCbor(DecodeCborCallbacks& callbacks,
            sync_io::Input& input,
            DecodeCborArgQuirks quirks = DecodeCborArgQuirks::DefaultValue());
 
+// --------
+
+// CborEncoder writes CBOR (RFC 8949) to an Output. Encoded bytes are staged in
+// a buffer and passed to output.CopyOut whenever that buffer fills up, or when
+// Flush is called. Call Flush when done, as the destructor does not.
+//
+// The WriteXxx methods mirror DecodeCborCallbacks' AppendXxx methods. Arrays
+// and maps are started by WriteHead (with major type 4 or 5 and the element
+// count) or by WriteIndefiniteHead (and ended by WriteBreak). It is the
+// caller's responsibility to produce well-formed CBOR, e.g. following a map
+// head with the right number of key-value pairs.
+class CborEncoder {
+ public:
+  // This constructor allocates a 4 KiB buffer.
+  explicit CborEncoder(sync_io::Output& output);
+  // This constructor does not allocate. It uses the caller's buffer, which
+  // must be non-empty and must outlive the CborEncoder.
+  CborEncoder(sync_io::Output& output, wuffs_base__slice_u8 buffer);
+
+  std::string Flush();
+
+  std::string WriteNull();
+  std::string WriteUndefined();
+  std::string WriteBool(bool val);
+  // WriteF64 uses the shortest (16, 32 or 64 bit) lossless representation.
+  std::string WriteF64(double val);
+  std::string WriteI64(int64_t val);
+  std::string WriteU64(uint64_t val);
+  std::string WriteByteString(const uint8_t* ptr, size_t len);
+  // WriteTextString does not check that its argument is valid UTF-8.
+  std::string WriteTextString(const char* ptr, size_t len);
+  std::string WriteMinus1MinusX(uint64_t val);
+  std::string WriteCborSimpleValue(uint8_t val);
+  std::string WriteCborTag(uint64_t val);
+
+  // WriteHead writes a head for a major_type (in the range 0 ..= 7) and an
+  // argument, using the shortest encoding.
+  std::string WriteHead(uint8_t major_type, uint64_t argument);
+  // WriteIndefiniteHead starts an indefinite-length byte string, text string,
+  // array or map (major_type 2, 3, 4 or 5). WriteBreak ends it.
+  std::string WriteIndefiniteHead(uint8_t major_type);
+  std::string WriteBreak();
+
+  // WriteRaw writes already-encoded CBOR bytes.
+  std::string WriteRaw(const uint8_t* ptr, size_t len);
+
+ private:
+  sync_io::Output& m_output;
+  std::unique_ptr<uint8_t[]> m_owned_array;
+  IOBuffer m_buf;
+
+  // Delete the copy and assign constructors.
+  CborEncoder(const CborEncoder&) = delete;
+  CborEncoder& operator=(const CborEncoder&) = delete;
+};
+
+// --------
+
+extern const char TranscodeCborToJson_UnsupportedMapKey[];
+
+// TranscodeCborToJson converts the CBOR-formatted data in input to compact
+// JSON, writing it to output. It works directly on the low-level CBOR tokens,
+// so that strings are copied (and escaped or base64url-encoded) from the input
+// buffer to the output buffer without materializing a std::string.
+//
+// The conversion may be lossy, in the same way as the example/cbor-to-json
+// program's defaults. CBOR tags are dropped. Undefined, simple values and
+// non-finite numbers become null. Byte strings become (unpadded) base64url
+// strings. Integer map keys are quoted. Other non-string map keys are rejected
+// with TranscodeCborToJson_UnsupportedMapKey.
+//
+// The returned cursor_position is the input position, like DecodeCbor's.
+DecodeCborResult  //
+TranscodeCborToJson(
+    sync_io::Output& output,
+    sync_io::Input& input,
+    DecodeCborArgQuirks quirks = DecodeCborArgQuirks::DefaultValue());
+
 }  // namespace wuffs_aux
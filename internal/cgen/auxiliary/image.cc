@@ -71,6 +71,15 @@ DecodeImageCallbacks::SelectDecoder(uint32_t fourcc,
       return wuffs_gif__decoder::alloc_as__wuffs_base__image_decoder();
 #endif
 
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__ICO)
+    case WUFFS_BASE__FOURCC__ICO: {
+      auto dec = wuffs_ico__decoder::alloc_as__wuffs_base__image_decoder();
+      // Favor faster decodes over rejecting invalid (embedded PNG) checksums.
+      dec->set_quirk(WUFFS_BASE__QUIRK_IGNORE_CHECKSUM, 1);
+      return dec;
+    }
+#endif
+
 #if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__JPEG)
     case WUFFS_BASE__FOURCC__JPEG:
       return wuffs_jpeg__decoder::alloc_as__wuffs_base__image_decoder();
@@ -95,15 +104,30 @@ DecodeImageCallbacks::SelectDecoder(uint32_t fourcc,
     }
 #endif
 
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__QOI)
+    case WUFFS_BASE__FOURCC__QOI:
+      return wuffs_qoi__decoder::alloc_as__wuffs_base__image_decoder();
+#endif
+
 #if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__TGA)
     case WUFFS_BASE__FOURCC__TGA:
       return wuffs_tga__decoder::alloc_as__wuffs_base__image_decoder();
 #endif
 
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__TIFF)
+    case WUFFS_BASE__FOURCC__TIFF:
+      return wuffs_tiff__decoder::alloc_as__wuffs_base__image_decoder();
+#endif
+
 #if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WBMP)
     case WUFFS_BASE__FOURCC__WBMP:
       return wuffs_wbmp__decoder::alloc_as__wuffs_base__image_decoder();
 #endif
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__WEBP)
+    case WUFFS_BASE__FOURCC__WEBP:
+      return wuffs_webp__decoder::alloc_as__wuffs_base__image_decoder();
+#endif
   }
 
   return wuffs_base__image_decoder::unique_ptr(nullptr, &free);
@@ -269,6 +293,42 @@ DecodeImageAdvanceIOBufferTo(sync_io::Input& input,
                                          io_buf, absolute_position);
 }
 
+// DecodeImageSeekIOBufferTo is like DecodeImageAdvanceIOBufferTo but it can
+// also go backwards, either within io_buf's buffered data or, failing that,
+// by asking the input to seek.
+std::string  //
+DecodeImageSeekIOBufferTo(sync_io::Input& input,
+                          wuffs_base__io_buffer& io_buf,
+                          uint64_t absolute_position) {
+  if ((absolute_position >= io_buf.meta.pos) &&
+      ((absolute_position - io_buf.meta.pos) <= io_buf.meta.wi)) {
+    io_buf.meta.ri = (size_t)(absolute_position - io_buf.meta.pos);
+    return "";
+  } else if (absolute_position > io_buf.reader_position()) {
+    return DecodeImageAdvanceIOBufferTo(input, io_buf, absolute_position);
+  }
+  return input.Seek(&io_buf, absolute_position);
+}
+
+// DecodeImageHandleIOSeek handles a "@I/O redirect" note whose more
+// information is an I/O seek (not an image format redirect), such as a TIFF
+// decoder jumping to an IFD or a strip.
+std::string  //
+DecodeImageHandleIOSeek(wuffs_base__image_decoder::unique_ptr& image_decoder,
+                        sync_io::Input& input,
+                        wuffs_base__io_buffer& io_buf) {
+  wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+  wuffs_base__more_information minfo = wuffs_base__empty_more_information();
+  wuffs_base__status tmm_status =
+      image_decoder->tell_me_more(&empty, &minfo, &io_buf);
+  if (tmm_status.repr != nullptr) {
+    return tmm_status.message();
+  } else if (minfo.flavor != WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+    return DecodeImage_UnsupportedImageFormat;
+  }
+  return DecodeImageSeekIOBufferTo(input, io_buf, minfo.io_seek__position());
+}
+
 wuffs_base__status  //
 DIHM0(void* self,
       wuffs_base__io_buffer* a_dst,
@@ -322,6 +382,8 @@ DecodeImage0(wuffs_base__image_decoder::unique_ptr& image_decoder,
   uint64_t start_pos = io_buf.reader_position();
   bool interested_in_metadata_after_the_frame = false;
   bool redirected = false;
+  wuffs_base__more_information redirect_minfo =
+      wuffs_base__empty_more_information();
   int32_t fourcc = 0;
 redirect:
   do {
@@ -350,16 +412,7 @@ redirect:
         }
       }
     } else {
-      wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
-      wuffs_base__more_information minfo = wuffs_base__empty_more_information();
-      wuffs_base__status tmm_status =
-          image_decoder->tell_me_more(&empty, &minfo, &io_buf);
-      if (tmm_status.repr != nullptr) {
-        return DecodeImageResult(tmm_status.message());
-      }
-      if (minfo.flavor != WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_REDIRECT) {
-        return DecodeImageResult(DecodeImage_UnsupportedImageFormat);
-      }
+      const wuffs_base__more_information& minfo = redirect_minfo;
       uint64_t pos = minfo.io_redirect__range().min_incl;
       if (pos <= start_pos) {
         // Redirects must go forward.
@@ -424,10 +477,28 @@ redirect:
       if (id_dic_status.repr == nullptr) {
         break;
       } else if (id_dic_status.repr == wuffs_base__note__i_o_redirect) {
-        if (redirected) {
+        wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+        wuffs_base__more_information minfo =
+            wuffs_base__empty_more_information();
+        wuffs_base__status tmm_status =
+            image_decoder->tell_me_more(&empty, &minfo, &io_buf);
+        if (tmm_status.repr != nullptr) {
+          return DecodeImageResult(tmm_status.message());
+        } else if (minfo.flavor ==
+                   WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+          std::string error_message = DecodeImageSeekIOBufferTo(
+              input, io_buf, minfo.io_seek__position());
+          if (!error_message.empty()) {
+            return DecodeImageResult(std::move(error_message));
+          }
+          continue;
+        } else if (redirected ||
+                   (minfo.flavor !=
+                    WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_REDIRECT)) {
           return DecodeImageResult(DecodeImage_UnsupportedImageFormat);
         }
         redirected = true;
+        redirect_minfo = minfo;
         goto redirect;
       } else if (id_dic_status.repr == wuffs_base__note__metadata_reported) {
         std::string error_message = DecodeImageHandleMetadata(
@@ -510,6 +581,12 @@ redirect:
         image_decoder->decode_frame_config(&frame_config, &io_buf);
     if (id_dfc_status.repr == nullptr) {
       break;
+    } else if (id_dfc_status.repr == wuffs_base__note__i_o_redirect) {
+      std::string error_message =
+          DecodeImageHandleIOSeek(image_decoder, input, io_buf);
+      if (!error_message.empty()) {
+        return DecodeImageResult(std::move(error_message));
+      }
     } else if (id_dfc_status.repr == wuffs_base__note__metadata_reported) {
       std::string error_message = DecodeImageHandleMetadata(
           image_decoder, callbacks, input, io_buf, raw_metadata_buf);
@@ -543,6 +620,13 @@ redirect:
                                     alloc_workbuf_result.workbuf, nullptr);
     if (id_df_status.repr == nullptr) {
       break;
+    } else if (id_df_status.repr == wuffs_base__note__i_o_redirect) {
+      std::string error_message =
+          DecodeImageHandleIOSeek(image_decoder, input, io_buf);
+      if (!error_message.empty()) {
+        message = std::move(error_message);
+        break;
+      }
     } else if (id_df_status.repr != wuffs_base__suspension__short_read) {
       message = id_df_status.message();
       break;
@@ -567,6 +651,12 @@ redirect:
         break;
       } else if (id_dfc_status.repr == nullptr) {
         continue;
+      } else if (id_dfc_status.repr == wuffs_base__note__i_o_redirect) {
+        std::string error_message =
+            DecodeImageHandleIOSeek(image_decoder, input, io_buf);
+        if (!error_message.empty()) {
+          return DecodeImageResult(std::move(error_message));
+        }
       } else if (id_dfc_status.repr == wuffs_base__note__metadata_reported) {
         std::string error_message = DecodeImageHandleMetadata(
             image_decoder, callbacks, input, io_buf, raw_metadata_buf);
@@ -620,6 +710,883 @@ DecodeImage(DecodeImageCallbacks& callbacks,
   return result;
 }
 
+// --------
+
+const char ImageDecodeSession_FeedAfterClose[] =  //
+    "wuffs_aux::ImageDecodeSession: feed after close";
+const char ImageDecodeSession_MaxInclBufferLengthExceeded[] =  //
+    "wuffs_aux::ImageDecodeSession: max_incl_buffer_length exceeded";
+const char ImageDecodeSession_UnsupportedBackwardsSeek[] =  //
+    "wuffs_aux::ImageDecodeSession: unsupported backwards seek";
+
+ImageDecodeSessionArgMaxInclBufferLength::
+    ImageDecodeSessionArgMaxInclBufferLength(uint64_t repr0)
+    : repr(repr0) {}
+
+ImageDecodeSessionArgMaxInclBufferLength  //
+ImageDecodeSessionArgMaxInclBufferLength::DefaultValue() {
+  return ImageDecodeSessionArgMaxInclBufferLength(16777215);
+}
+
+ImageDecodeSession::ImageDecodeSession(
+    DecodeImageCallbacks& callbacks,
+    DecodeImageArgQuirks quirks,
+    DecodeImageArgPixelBlend pixel_blend,
+    DecodeImageArgBackgroundColor background_color,
+    DecodeImageArgMaxInclDimension max_incl_dimension,
+    ImageDecodeSessionArgMaxInclBufferLength max_incl_buffer_length)
+    : m_callbacks(callbacks),
+      m_quirks(quirks.repr),
+      m_pixel_blend(pixel_blend.repr),
+      m_background_color(background_color.repr),
+      m_max_incl_dimension(max_incl_dimension.repr),
+      m_state(State::Sniff),
+      m_closed(false),
+      m_redirected(false),
+      m_retain_consumed(false),
+      m_fourcc(0),
+      m_skip_length(0),
+      m_buffer(max_incl_buffer_length.repr),
+      m_image_decoder(nullptr, &free),
+      m_image_config(wuffs_base__null_image_config()),
+      m_frame_config(wuffs_base__null_frame_config()),
+      m_pixbuf_mem_owner(nullptr, &free),
+      m_pixbuf(wuffs_base__null_pixel_buffer()),
+      m_workbuf_mem_owner(nullptr, &free),
+      m_workbuf(wuffs_base__empty_slice_u8()),
+      m_error_message() {
+  switch (m_pixel_blend) {
+    case WUFFS_BASE__PIXEL_BLEND__SRC:
+    case WUFFS_BASE__PIXEL_BLEND__SRC_OVER:
+      break;
+    default:
+      Fail(DecodeImage_UnsupportedPixelBlend);
+      break;
+  }
+}
+
+ImageDecodeSession::Event  //
+ImageDecodeSession::Feed(wuffs_base__slice_u8 bytes, bool closed) {
+  if (m_state == State::Done) {
+    return Event::Done;
+  } else if (m_state == State::Error) {
+    return Event::Error;
+  } else if (m_closed && (bytes.len > 0)) {
+    return Fail(ImageDecodeSession_FeedAfterClose);
+  }
+  m_closed = m_closed || closed;
+
+  // m_buffer holds the bytes fed earlier but not yet consumed. Its meta.pos
+  // tracks the absolute position of the next byte to be fed, once compacted.
+  // When m_retain_consumed, it is never compacted, so that its meta.pos stays
+  // at zero and the decoder can seek back to any byte fed so far.
+  IOBuffer& buf = m_buffer.m_buf;
+  if (!m_retain_consumed) {
+    buf.compact();
+  }
+  if (m_skip_length > 0) {
+    size_t n = (bytes.len < m_skip_length) ? bytes.len : (size_t)m_skip_length;
+    if (m_retain_consumed) {
+      sync_io::DynIOBuffer::GrowResult grow_result =
+          Append(wuffs_base__make_slice_u8(bytes.ptr, n));
+      if (grow_result != sync_io::DynIOBuffer::GrowResult::OK) {
+        return FailGrow(grow_result);
+      }
+      buf.meta.ri = buf.meta.wi;
+    } else {
+      buf.meta.pos = wuffs_base__u64__sat_add(buf.meta.pos, n);
+    }
+    bytes.ptr += n;
+    bytes.len -= n;
+    m_skip_length -= n;
+  }
+  buf.meta.closed = m_closed;
+
+  if ((buf.meta.wi > 0) || m_retain_consumed) {
+    sync_io::DynIOBuffer::GrowResult grow_result = Append(bytes);
+    if (grow_result != sync_io::DynIOBuffer::GrowResult::OK) {
+      return FailGrow(grow_result);
+    }
+    return Decode(buf);
+  }
+
+  // Nothing is buffered, so decode directly from the caller's bytes, then
+  // keep whatever was left unconsumed (or, if Decode selected a decoder that
+  // can seek backwards, everything).
+  IOBuffer direct = wuffs_base__ptr_u8__reader(bytes.ptr, bytes.len, m_closed);
+  direct.meta.pos = buf.meta.pos;
+  Event event = Decode(direct);
+  size_t consumed = m_retain_consumed ? 0 : direct.meta.ri;
+  buf.meta.pos = wuffs_base__u64__sat_add(direct.meta.pos, consumed);
+  sync_io::DynIOBuffer::GrowResult grow_result = Append(
+      wuffs_base__make_slice_u8(bytes.ptr + consumed, bytes.len - consumed));
+  if (grow_result != sync_io::DynIOBuffer::GrowResult::OK) {
+    return FailGrow(grow_result);
+  }
+  buf.meta.ri = direct.meta.ri - consumed;
+  return event;
+}
+
+wuffs_base__pixel_buffer&  //
+ImageDecodeSession::Pixbuf() {
+  return m_pixbuf;
+}
+
+const wuffs_base__frame_config&  //
+ImageDecodeSession::FrameConfig() const {
+  return m_frame_config;
+}
+
+const std::string&  //
+ImageDecodeSession::ErrorMessage() const {
+  return m_error_message;
+}
+
+DecodeImageResult  //
+ImageDecodeSession::TakeResult() {
+  wuffs_base__pixel_buffer pixbuf = m_pixbuf;
+  m_pixbuf = wuffs_base__null_pixel_buffer();
+  return DecodeImageResult(std::move(m_pixbuf_mem_owner), pixbuf,
+                           std::string(m_error_message));
+}
+
+ImageDecodeSession::Event  //
+ImageDecodeSession::Fail(std::string&& error_message) {
+  m_state = State::Error;
+  m_error_message = std::move(error_message);
+  return Event::Error;
+}
+
+// Append copies bytes to the end of m_buffer, growing it if necessary.
+sync_io::DynIOBuffer::GrowResult  //
+ImageDecodeSession::Append(wuffs_base__slice_u8 bytes) {
+  if (bytes.len > 0) {
+    IOBuffer& buf = m_buffer.m_buf;
+    sync_io::DynIOBuffer::GrowResult grow_result =
+        m_buffer.grow(wuffs_base__u64__sat_add(buf.meta.wi, bytes.len));
+    if (grow_result != sync_io::DynIOBuffer::GrowResult::OK) {
+      return grow_result;
+    }
+    memcpy(buf.data.ptr + buf.meta.wi, bytes.ptr, bytes.len);
+    buf.meta.wi += bytes.len;
+  }
+  return sync_io::DynIOBuffer::GrowResult::OK;
+}
+
+ImageDecodeSession::Event  //
+ImageDecodeSession::FailGrow(sync_io::DynIOBuffer::GrowResult grow_result) {
+  return Fail((grow_result ==
+               sync_io::DynIOBuffer::GrowResult::FailedMaxInclExceeded)
+                  ? ImageDecodeSession_MaxInclBufferLengthExceeded
+                  : DecodeImage_OutOfMemory);
+}
+
+// SeekTo repositions io_buf's reader. Going forward past the buffered bytes
+// discards them and sets m_skip_length, so that Feed drops (or, when
+// m_retain_consumed, buffers as already consumed) the next bytes until it
+// reaches absolute_position. Going backward past the buffered bytes is an
+// error, since they are gone.
+std::string  //
+ImageDecodeSession::SeekTo(IOBuffer& io_buf, uint64_t absolute_position) {
+  if (absolute_position < io_buf.meta.pos) {
+    return ImageDecodeSession_UnsupportedBackwardsSeek;
+  } else if ((absolute_position - io_buf.meta.pos) <= io_buf.meta.wi) {
+    io_buf.meta.ri = (size_t)(absolute_position - io_buf.meta.pos);
+    return "";
+  }
+  m_skip_length = absolute_position - (io_buf.meta.pos + io_buf.meta.wi);
+  io_buf.meta.ri = io_buf.meta.wi;
+  return "";
+}
+
+// HandleIORedirect handles a "@I/O redirect" note: either an I/O seek or, if
+// allow_format_redirect, an image format redirect such as a BMP file that
+// wraps a PNG. The latter sets m_state so that Decode selects a new decoder.
+std::string  //
+ImageDecodeSession::HandleIORedirect(IOBuffer& io_buf,
+                                     bool allow_format_redirect) {
+  wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+  wuffs_base__more_information minfo = wuffs_base__empty_more_information();
+  wuffs_base__status tmm_status =
+      m_image_decoder->tell_me_more(&empty, &minfo, &io_buf);
+  if (tmm_status.repr != nullptr) {
+    return tmm_status.message();
+  } else if (minfo.flavor == WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+    return SeekTo(io_buf, minfo.io_seek__position());
+  } else if (!allow_format_redirect || m_redirected ||
+             (minfo.flavor !=
+              WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_REDIRECT)) {
+    return DecodeImage_UnsupportedImageFormat;
+  }
+
+  // Redirects must go forward.
+  uint64_t pos = minfo.io_redirect__range().min_incl;
+  m_fourcc = minfo.io_redirect__fourcc();
+  if ((pos == 0) || (m_fourcc == 0)) {
+    return DecodeImage_UnsupportedImageFormat;
+  }
+  m_redirected = true;
+  m_image_decoder.reset();
+  m_state = State::SelectDecoder;
+  return SeekTo(io_buf, pos);
+}
+
+ImageDecodeSession::Event  //
+ImageDecodeSession::Decode(IOBuffer& io_buf) {
+  while (true) {
+    wuffs_base__status status = wuffs_base__make_status(nullptr);
+    if (m_skip_length > 0) {
+      return m_closed ? Fail(DecodeImage_UnexpectedEndOfFile) : Event::NeedMore;
+    }
+
+    switch (m_state) {
+      case State::Sniff: {
+        int32_t fourcc = wuffs_base__magic_number_guess_fourcc(
+            io_buf.reader_slice(), io_buf.meta.closed);
+        // As for DecodeImage, try to give custom callbacks at least 64 bytes
+        // of prefix data when Wuffs' built in MIME sniffer says (fourcc == 0).
+        if ((fourcc < 0) || ((fourcc == 0) && (io_buf.reader_length() < 64))) {
+          if (!io_buf.meta.closed) {
+            return Event::NeedMore;
+          }
+          fourcc = 0;
+        }
+        m_fourcc = (uint32_t)fourcc;
+        // TIFF files often put their pixel data before the IFD that
+        // describes it, so the decoder seeks backwards. Nothing has been
+        // consumed yet, so keeping every byte from now on keeps them all.
+        m_retain_consumed = (m_fourcc == WUFFS_BASE__FOURCC__TIFF);
+        m_state = State::SelectDecoder;
+        continue;
+      }
+
+      case State::SelectDecoder:
+        m_image_decoder = m_callbacks.SelectDecoder(
+            m_fourcc, io_buf.reader_slice(), io_buf.meta.closed);
+        if (!m_image_decoder) {
+          return Fail(DecodeImage_UnsupportedImageFormat);
+        }
+        for (size_t i = 0; i < m_quirks.len; i++) {
+          m_image_decoder->set_quirk(m_quirks.ptr[i], 1);
+        }
+        m_state = State::DecodeImageConfig;
+        continue;
+
+      case State::DecodeImageConfig:
+        status = m_image_decoder->decode_image_config(&m_image_config, &io_buf);
+        if (status.repr == nullptr) {
+          m_state = State::AllocBuffers;
+          continue;
+        } else if (status.repr == wuffs_base__note__i_o_redirect) {
+          std::string error_message = HandleIORedirect(io_buf, true);
+          if (!error_message.empty()) {
+            return Fail(std::move(error_message));
+          }
+          continue;
+        }
+        break;
+
+      case State::AllocBuffers: {
+        uint32_t w = m_image_config.pixcfg.width();
+        uint32_t h = m_image_config.pixcfg.height();
+        if ((w > m_max_incl_dimension) || (h > m_max_incl_dimension)) {
+          return Fail(DecodeImage_MaxInclDimensionExceeded);
+        }
+        wuffs_base__pixel_format pixel_format =
+            m_callbacks.SelectPixfmt(m_image_config);
+        if (pixel_format.repr != m_image_config.pixcfg.pixel_format().repr) {
+          switch (pixel_format.repr) {
+            case WUFFS_BASE__PIXEL_FORMAT__BGR_565:
+            case WUFFS_BASE__PIXEL_FORMAT__BGR:
+            case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+            case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:
+            case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+            case WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL:
+            case WUFFS_BASE__PIXEL_FORMAT__RGBA_PREMUL:
+              break;
+            default:
+              return Fail(DecodeImage_UnsupportedPixelFormat);
+          }
+          m_image_config.pixcfg.set(pixel_format.repr,
+                                    WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, w, h);
+        }
+
+        bool valid_background_color =
+            wuffs_base__color_u32_argb_premul__is_valid(m_background_color);
+        DecodeImageCallbacks::AllocPixbufResult alloc_pixbuf_result =
+            m_callbacks.AllocPixbuf(m_image_config, valid_background_color);
+        if (!alloc_pixbuf_result.error_message.empty()) {
+          return Fail(std::move(alloc_pixbuf_result.error_message));
+        }
+        m_pixbuf_mem_owner = std::move(alloc_pixbuf_result.mem_owner);
+        m_pixbuf = alloc_pixbuf_result.pixbuf;
+        if (valid_background_color) {
+          wuffs_base__status pb_scufr_status = m_pixbuf.set_color_u32_fill_rect(
+              m_pixbuf.pixcfg.bounds(), m_background_color);
+          if (pb_scufr_status.repr != nullptr) {
+            return Fail(pb_scufr_status.message());
+          }
+        }
+
+        wuffs_base__range_ii_u64 workbuf_len = m_image_decoder->workbuf_len();
+        DecodeImageCallbacks::AllocWorkbufResult alloc_workbuf_result =
+            m_callbacks.AllocWorkbuf(workbuf_len, true);
+        if (!alloc_workbuf_result.error_message.empty()) {
+          return Fail(std::move(alloc_workbuf_result.error_message));
+        } else if (alloc_workbuf_result.workbuf.len < workbuf_len.min_incl) {
+          return Fail(DecodeImage_BufferIsTooShort);
+        }
+        m_workbuf_mem_owner = std::move(alloc_workbuf_result.mem_owner);
+        m_workbuf = alloc_workbuf_result.workbuf;
+        m_state = State::DecodeFrameConfig;
+        continue;
+      }
+
+      case State::DecodeFrameConfig:
+        status = m_image_decoder->decode_frame_config(&m_frame_config, &io_buf);
+        if (status.repr == nullptr) {
+          m_state = State::DecodeFrame;
+          continue;
+        } else if (status.repr == wuffs_base__note__end_of_data) {
+          m_state = State::Done;
+          return Event::Done;
+        } else if (status.repr == wuffs_base__note__i_o_redirect) {
+          std::string error_message = HandleIORedirect(io_buf, false);
+          if (!error_message.empty()) {
+            return Fail(std::move(error_message));
+          }
+          continue;
+        }
+        break;
+
+      case State::DecodeFrame: {
+        wuffs_base__pixel_blend pixel_blend = m_pixel_blend;
+        if ((pixel_blend == WUFFS_BASE__PIXEL_BLEND__SRC_OVER) &&
+            m_frame_config.overwrite_instead_of_blend()) {
+          pixel_blend = WUFFS_BASE__PIXEL_BLEND__SRC;
+        }
+        status = m_image_decoder->decode_frame(&m_pixbuf, &io_buf, pixel_blend,
+                                               m_workbuf, nullptr);
+        if (status.repr == nullptr) {
+          m_state = State::DecodeFrameConfig;
+          return Event::Frame;
+        } else if (status.repr == wuffs_base__note__i_o_redirect) {
+          std::string error_message = HandleIORedirect(io_buf, false);
+          if (!error_message.empty()) {
+            return Fail(std::move(error_message));
+          }
+          continue;
+        }
+        break;
+      }
+
+      case State::Done:
+        return Event::Done;
+
+      case State::Error:
+        return Event::Error;
+    }
+
+    // The decoder method returned a status other than ok or a redirect.
+    if (status.repr != wuffs_base__suspension__short_read) {
+      return Fail(status.message());
+    } else if (io_buf.meta.closed) {
+      return Fail(DecodeImage_UnexpectedEndOfFile);
+    }
+    return Event::NeedMore;
+  }
+}
+
+// --------
+
+const char EncodeImageQoi_OutOfMemory[] =  //
+    "wuffs_aux::EncodeImageQoi: out of memory";
+const char EncodeImageQoi_UnsupportedPixelFormat[] =  //
+    "wuffs_aux::EncodeImageQoi: unsupported pixel format";
+
+namespace {
+
+// QoiHash returns the QOI index position of an RGBA_NONPREMUL pixel, loaded
+// as a little-endian uint32_t.
+inline uint32_t  //
+QoiHash(uint32_t px) {
+  return (((px >> 0) & 0xFF) * 3 + ((px >> 8) & 0xFF) * 5 +
+          ((px >> 16) & 0xFF) * 7 + ((px >> 24) & 0xFF) * 11) &
+         63;
+}
+
+}  // namespace
+
+std::string  //
+EncodeImageQoi(sync_io::Output& output, wuffs_base__pixel_buffer& pixbuf) {
+  wuffs_base__pixel_format src_pixfmt = pixbuf.pixel_format();
+  if (src_pixfmt.is_planar()) {
+    return EncodeImageQoi_UnsupportedPixelFormat;
+  }
+  wuffs_base__pixel_swizzler swizzler;
+  if (!swizzler
+           .prepare(wuffs_base__make_pixel_format(
+                        WUFFS_BASE__PIXEL_FORMAT__RGBA_NONPREMUL),
+                    wuffs_base__empty_slice_u8(), src_pixfmt, pixbuf.palette(),
+                    WUFFS_BASE__PIXEL_BLEND__SRC)
+           .is_ok()) {
+    return EncodeImageQoi_UnsupportedPixelFormat;
+  }
+
+  uint32_t width = pixbuf.pixcfg.width();
+  uint32_t height = pixbuf.pixcfg.height();
+  uint64_t row_len = 4 * ((uint64_t)width);
+  if (row_len > SIZE_MAX) {
+    return EncodeImageQoi_OutOfMemory;
+  }
+  MemOwner row_owner(malloc(row_len ? row_len : 1), &free);
+  if (!row_owner) {
+    return EncodeImageQoi_OutOfMemory;
+  }
+  uint8_t* row = static_cast<uint8_t*>(row_owner.get());
+
+  const size_t out_len = 65536;
+  std::unique_ptr<uint8_t[]> out_array(new uint8_t[out_len]);
+  IOBuffer out = wuffs_base__ptr_u8__writer(out_array.get(), out_len);
+
+  // Write the 14 byte header.
+  uint8_t* p = out.writer_pointer();
+  wuffs_base__poke_u32be__no_bounds_check(p + 0, 0x716F6966);  // "qoif".
+  wuffs_base__poke_u32be__no_bounds_check(p + 4, width);
+  wuffs_base__poke_u32be__no_bounds_check(p + 8, height);
+  p[12] = (src_pixfmt.transparency() ==
+           WUFFS_BASE__PIXEL_ALPHA_TRANSPARENCY__OPAQUE)
+              ? 3
+              : 4;
+  p[13] = 0;
+  out.meta.wi += 14;
+
+  uint32_t index[64] = {0};
+  uint32_t prev = 0xFF000000;
+  uint32_t run = 0;
+  uint64_t num_remaining = ((uint64_t)width) * ((uint64_t)height);
+  wuffs_base__table_u8 tab = pixbuf.plane(0);
+  for (uint32_t y = 0; y < height; y++) {
+    swizzler.swizzle_interleaved_from_slice(
+        wuffs_base__make_slice_u8(row, row_len), wuffs_base__empty_slice_u8(),
+        wuffs_base__make_slice_u8(tab.ptr + (y * tab.stride), tab.width));
+
+    for (uint32_t x = 0; x < width; x++) {
+      // Every chunk is at most 5 bytes. Keeping 8 bytes of slack also leaves
+      // room for the 8 byte end marker.
+      if (out.writer_length() < 8) {
+        std::string error_message = private_impl::FlushIOBuffer(output, out);
+        if (!error_message.empty()) {
+          return error_message;
+        }
+      }
+      p = out.writer_pointer();
+      num_remaining--;
+
+      uint32_t px = wuffs_base__peek_u32le__no_bounds_check(row + (4 * x));
+      if (px == prev) {
+        run++;
+        if ((run == 62) || (num_remaining == 0)) {
+          p[0] = (uint8_t)(0xC0 | (run - 1));  // QOI_OP_RUN.
+          out.meta.wi += 1;
+          run = 0;
+        }
+        continue;
+      }
+      if (run > 0) {
+        *p++ = (uint8_t)(0xC0 | (run - 1));  // QOI_OP_RUN.
+        out.meta.wi += 1;
+        run = 0;
+      }
+
+      uint32_t h = QoiHash(px);
+      if (index[h] == px) {
+        p[0] = (uint8_t)h;  // QOI_OP_INDEX.
+        out.meta.wi += 1;
+      } else {
+        index[h] = px;
+        if ((px >> 24) == (prev >> 24)) {
+          int8_t vr = (int8_t)((px >> 0) - (prev >> 0));
+          int8_t vg = (int8_t)((px >> 8) - (prev >> 8));
+          int8_t vb = (int8_t)((px >> 16) - (prev >> 16));
+          int8_t vg_r = (int8_t)(vr - vg);
+          int8_t vg_b = (int8_t)(vb - vg);
+          if ((vr > -3) && (vr < 2) && (vg > -3) && (vg < 2) && (vb > -3) &&
+              (vb < 2)) {
+            p[0] = (uint8_t)(0x40 | ((vr + 2) << 4) |  // QOI_OP_DIFF.
+                             ((vg + 2) << 2) | (vb + 2));
+            out.meta.wi += 1;
+          } else if ((vg_r > -9) && (vg_r < 8) && (vg > -33) && (vg < 32) &&
+                     (vg_b > -9) && (vg_b < 8)) {
+            p[0] = (uint8_t)(0x80 | (vg + 32));  // QOI_OP_LUMA.
+            p[1] = (uint8_t)(((vg_r + 8) << 4) | (vg_b + 8));
+            out.meta.wi += 2;
+          } else {
+            p[0] = 0xFE;  // QOI_OP_RGB.
+            p[1] = (uint8_t)(px >> 0);
+            p[2] = (uint8_t)(px >> 8);
+            p[3] = (uint8_t)(px >> 16);
+            out.meta.wi += 4;
+          }
+        } else {
+          p[0] = 0xFF;  // QOI_OP_RGBA.
+          wuffs_base__poke_u32le__no_bounds_check(p + 1, px);
+          out.meta.wi += 5;
+        }
+      }
+      prev = px;
+    }
+  }
+
+  // Write the 8 byte end marker.
+  if (out.writer_length() < 8) {
+    std::string error_message = private_impl::FlushIOBuffer(output, out);
+    if (!error_message.empty()) {
+      return error_message;
+    }
+  }
+  wuffs_base__poke_u64be__no_bounds_check(out.writer_pointer(), 1);
+  out.meta.wi += 8;
+  return private_impl::FlushIOBuffer(output, out);
+}
+
+// --------
+
+const char EncodeImageNie_UnsupportedPixelConfiguration[] =  //
+    "wuffs_aux::EncodeImageNie: unsupported pixel configuration";
+const char NiaEncoder_BadCumulativeDisplayDuration[] =  //
+    "wuffs_aux::NiaEncoder: bad cumulative display duration";
+const char NiaEncoder_InconsistentPixelConfiguration[] =  //
+    "wuffs_aux::NiaEncoder: inconsistent pixel configuration";
+const char NiaEncoder_WriteAfterFinish[] =  //
+    "wuffs_aux::NiaEncoder: write after finish";
+
+namespace {
+
+// NieConfigurationFor returns the NIE version-and-configuration bytes (loaded
+// as a little-endian uint32_t) for pixfmt_repr, or zero if NIE cannot
+// represent that pixel format verbatim.
+uint32_t  //
+NieConfigurationFor(uint32_t pixfmt_repr) {
+  switch (pixfmt_repr) {
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL:
+      return 0x346E62FF;  // "\xFFbn4".
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL:
+      return 0x347062FF;  // "\xFFbp4".
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE:
+      return 0x386E62FF;  // "\xFFbn8".
+    case WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE:
+      return 0x387062FF;  // "\xFFbp8".
+  }
+  return 0;
+}
+
+// PixelFormatForNieConfiguration is the inverse of NieConfigurationFor. It
+// returns zero for an invalid configuration.
+uint32_t  //
+PixelFormatForNieConfiguration(uint32_t nie_configuration) {
+  switch (nie_configuration) {
+    case 0x346E62FF:
+      return WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL;
+    case 0x347062FF:
+      return WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL;
+    case 0x386E62FF:
+      return WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE;
+    case 0x387062FF:
+      return WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL_4X16LE;
+  }
+  return 0;
+}
+
+// WriteNieHeader writes a 16 byte NIE (or NIA) header to p.
+void  //
+WriteNieHeader(uint8_t* p,
+               uint32_t magic,
+               uint32_t nie_configuration,
+               uint32_t width,
+               uint32_t height) {
+  wuffs_base__poke_u32le__no_bounds_check(p + 0x0, magic);
+  wuffs_base__poke_u32le__no_bounds_check(p + 0x4, nie_configuration);
+  wuffs_base__poke_u32le__no_bounds_check(p + 0x8, width);
+  wuffs_base__poke_u32le__no_bounds_check(p + 0xC, height);
+}
+
+// CopyOutBytes passes ptr[:len] to output without staging it in an
+// intermediate buffer.
+std::string  //
+CopyOutBytes(sync_io::Output& output, uint8_t* ptr, size_t len) {
+  IOBuffer io_buf = wuffs_base__ptr_u8__reader(ptr, len, false);
+  return output.CopyOut(&io_buf);
+}
+
+// WriteNiePixels writes pixbuf's rows, which must hold bytes_per_pixel (4 or
+// 8) bytes per pixel, to output.
+std::string  //
+WriteNiePixels(sync_io::Output& output,
+               wuffs_base__pixel_buffer& pixbuf,
+               uint32_t bytes_per_pixel) {
+  uint32_t width = pixbuf.pixcfg.width();
+  uint32_t height = pixbuf.pixcfg.height();
+  wuffs_base__table_u8 tab = pixbuf.plane(0);
+  uint64_t row_len = ((uint64_t)width) * bytes_per_pixel;
+  if ((row_len > tab.width) || (height > tab.height)) {
+    return EncodeImageNie_UnsupportedPixelConfiguration;
+  } else if (row_len == 0) {
+    return "";
+  }
+  for (uint32_t y = 0; y < height; y++) {
+    std::string error_message = CopyOutBytes(
+        output, tab.ptr + (y * tab.stride), static_cast<size_t>(row_len));
+    if (!error_message.empty()) {
+      return error_message;
+    }
+  }
+  return "";
+}
+
+inline uint32_t  //
+NieBytesPerPixel(uint32_t nie_configuration) {
+  return ((nie_configuration >> 24) == '8') ? 8 : 4;
+}
+
+inline bool  //
+NieDimensionsAreValid(uint32_t width, uint32_t height) {
+  return ((width | height) >> 31) == 0;
+}
+
+}  // namespace
+
+std::string  //
+EncodeImageNie(sync_io::Output& output, wuffs_base__pixel_buffer& pixbuf) {
+  uint32_t nie_configuration =
+      NieConfigurationFor(pixbuf.pixcfg.pixel_format().repr);
+  uint32_t width = pixbuf.pixcfg.width();
+  uint32_t height = pixbuf.pixcfg.height();
+  if (!nie_configuration || !NieDimensionsAreValid(width, height)) {
+    return EncodeImageNie_UnsupportedPixelConfiguration;
+  }
+
+  uint8_t header[16];
+  WriteNieHeader(header, 0x45AFC36E, nie_configuration, width, height);
+  std::string error_message = CopyOutBytes(output, header, sizeof header);
+  if (!error_message.empty()) {
+    return error_message;
+  }
+  return WriteNiePixels(output, pixbuf, NieBytesPerPixel(nie_configuration));
+}
+
+NiaEncoder::NiaEncoder(sync_io::Output& output,
+                       wuffs_base__pixel_config pixcfg)
+    : m_output(output),
+      m_pixcfg(pixcfg),
+      m_cumulative_display_duration(0),
+      m_wrote_header(false),
+      m_finished(false) {}
+
+std::string  //
+NiaEncoder::WriteHeader() {
+  uint32_t nie_configuration =
+      NieConfigurationFor(m_pixcfg.pixel_format().repr);
+  uint32_t width = m_pixcfg.width();
+  uint32_t height = m_pixcfg.height();
+  if (!nie_configuration || !NieDimensionsAreValid(width, height)) {
+    return EncodeImageNie_UnsupportedPixelConfiguration;
+  }
+
+  uint8_t header[16];
+  WriteNieHeader(header, 0x41AFC36E, nie_configuration, width, height);
+  std::string error_message = CopyOutBytes(m_output, header, sizeof header);
+  if (error_message.empty()) {
+    m_wrote_header = true;
+  }
+  return error_message;
+}
+
+std::string  //
+NiaEncoder::WriteFrame(wuffs_base__pixel_buffer& pixbuf,
+                       wuffs_base__flicks cumulative_display_duration) {
+  if (m_finished) {
+    return NiaEncoder_WriteAfterFinish;
+  } else if (cumulative_display_duration < m_cumulative_display_duration) {
+    return NiaEncoder_BadCumulativeDisplayDuration;
+  }
+  uint32_t width = m_pixcfg.width();
+  uint32_t height = m_pixcfg.height();
+  if ((pixbuf.pixcfg.pixel_format().repr != m_pixcfg.pixel_format().repr) ||
+      (pixbuf.pixcfg.width() != width) || (pixbuf.pixcfg.height() != height)) {
+    return NiaEncoder_InconsistentPixelConfiguration;
+  }
+  if (!m_wrote_header) {
+    std::string error_message = WriteHeader();
+    if (!error_message.empty()) {
+      return error_message;
+    }
+  }
+  uint32_t nie_configuration =
+      NieConfigurationFor(m_pixcfg.pixel_format().repr);
+  uint32_t bytes_per_pixel = NieBytesPerPixel(nie_configuration);
+
+  // Write the 8 byte CDD and the 16 byte NIE header.
+  uint8_t prefix[24];
+  wuffs_base__poke_u64le__no_bounds_check(
+      prefix, static_cast<uint64_t>(cumulative_display_duration));
+  WriteNieHeader(prefix + 8, 0x45AFC36E, nie_configuration, width, height);
+  std::string error_message = CopyOutBytes(m_output, prefix, sizeof prefix);
+  if (!error_message.empty()) {
+    return error_message;
+  }
+
+  error_message = WriteNiePixels(m_output, pixbuf, bytes_per_pixel);
+  if (!error_message.empty()) {
+    return error_message;
+  }
+
+  // Pad the NIE image to a multiple of 8 bytes.
+  if ((bytes_per_pixel == 4) && (width & height & 1)) {
+    uint8_t padding[4] = {0};
+    error_message = CopyOutBytes(m_output, padding, sizeof padding);
+    if (!error_message.empty()) {
+      return error_message;
+    }
+  }
+  m_cumulative_display_duration = cumulative_display_duration;
+  return "";
+}
+
+std::string  //
+NiaEncoder::Finish(uint32_t loop_count) {
+  if (m_finished) {
+    return NiaEncoder_WriteAfterFinish;
+  } else if (!m_wrote_header) {
+    std::string error_message = WriteHeader();
+    if (!error_message.empty()) {
+      return error_message;
+    }
+  }
+  uint8_t footer[8];
+  wuffs_base__poke_u32le__no_bounds_check(footer + 0, loop_count);
+  wuffs_base__poke_u32le__no_bounds_check(footer + 4, 0x80000000);
+  std::string error_message = CopyOutBytes(m_output, footer, sizeof footer);
+  if (error_message.empty()) {
+    m_finished = true;
+  }
+  return error_message;
+}
+
+// --------
+
+MappedImageFrame::MappedImageFrame(
+    wuffs_base__pixel_buffer pixbuf0,
+    wuffs_base__flicks cumulative_display_duration0)
+    : pixbuf(pixbuf0),
+      cumulative_display_duration(cumulative_display_duration0) {}
+
+MapImageResult::MapImageResult(std::vector<MappedImageFrame>&& frames0,
+                               uint32_t loop_count0)
+    : frames(std::move(frames0)), loop_count(loop_count0), error_message("") {}
+
+MapImageResult::MapImageResult(std::string&& error_message0)
+    : frames(), loop_count(0), error_message(std::move(error_message0)) {}
+
+const char MapImage_BadHeader[] =  //
+    "wuffs_aux::MapImage: bad header";
+const char MapImage_BadFrame[] =  //
+    "wuffs_aux::MapImage: bad frame";
+const char MapImage_UnexpectedEndOfFile[] =  //
+    "wuffs_aux::MapImage: unexpected end of file";
+const char MapImage_UnsupportedImageFormat[] =  //
+    "wuffs_aux::MapImage: unsupported image format";
+
+MapImageResult  //
+MapImage(wuffs_base__slice_u8 src) {
+  if (src.len < 16) {
+    return MapImageResult(MapImage_UnexpectedEndOfFile);
+  }
+  uint32_t magic = wuffs_base__peek_u32le__no_bounds_check(src.ptr + 0x0);
+  uint32_t nie_configuration =
+      wuffs_base__peek_u32le__no_bounds_check(src.ptr + 0x4);
+  uint32_t width = wuffs_base__peek_u32le__no_bounds_check(src.ptr + 0x8);
+  uint32_t height = wuffs_base__peek_u32le__no_bounds_check(src.ptr + 0xC);
+  if ((magic != 0x45AFC36E) && (magic != 0x41AFC36E)) {
+    return MapImageResult(MapImage_UnsupportedImageFormat);
+  }
+  uint32_t pixfmt_repr = PixelFormatForNieConfiguration(nie_configuration);
+  if (!pixfmt_repr || !NieDimensionsAreValid(width, height)) {
+    return MapImageResult(MapImage_BadHeader);
+  }
+  wuffs_base__pixel_config pixcfg;
+  pixcfg.set(pixfmt_repr, WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width, height);
+
+  // The width and height are both below (1 << 31), so pixels_len fits in a
+  // uint64_t once it is known to be no more than src.len.
+  uint64_t bytes_per_pixel = NieBytesPerPixel(nie_configuration);
+  uint64_t num_pixels = ((uint64_t)width) * ((uint64_t)height);
+  if (num_pixels > ((src.len - 16) / bytes_per_pixel)) {
+    return MapImageResult(MapImage_UnexpectedEndOfFile);
+  }
+  size_t pixels_len = static_cast<size_t>(num_pixels * bytes_per_pixel);
+  size_t padding_len = ((bytes_per_pixel == 4) && (width & height & 1)) ? 4 : 0;
+
+  std::vector<MappedImageFrame> frames;
+  wuffs_base__pixel_buffer pixbuf = wuffs_base__null_pixel_buffer();
+
+  if (magic == 0x45AFC36E) {  // "nïE".
+    wuffs_base__status status = pixbuf.set_from_slice(
+        &pixcfg, wuffs_base__make_slice_u8(src.ptr + 16, pixels_len));
+    if (!status.is_ok()) {
+      return MapImageResult(status.message());
+    }
+    frames.emplace_back(pixbuf, 0);
+    return MapImageResult(std::move(frames), 0);
+  }
+
+  // For NIA, walk the frames (each a CDD, a NIE image and optional padding)
+  // until the footer, whose high bit is set.
+  wuffs_base__flicks prev_cdd = 0;
+  size_t pos = 16;
+  while (true) {
+    if ((src.len - pos) < 8) {
+      return MapImageResult(MapImage_UnexpectedEndOfFile);
+    }
+    uint64_t cdd = wuffs_base__peek_u64le__no_bounds_check(src.ptr + pos);
+    pos += 8;
+    if ((cdd >> 63) != 0) {
+      if (((cdd >> 32) != 0x80000000) || (pos != src.len)) {
+        return MapImageResult(MapImage_BadFrame);
+      }
+      return MapImageResult(std::move(frames), static_cast<uint32_t>(cdd));
+    } else if (static_cast<wuffs_base__flicks>(cdd) < prev_cdd) {
+      return MapImageResult(MapImage_BadFrame);
+    }
+    prev_cdd = static_cast<wuffs_base__flicks>(cdd);
+
+    if ((src.len - pos) < 16) {
+      return MapImageResult(MapImage_UnexpectedEndOfFile);
+    } else if ((wuffs_base__peek_u32le__no_bounds_check(src.ptr + pos) !=
+                0x45AFC36E) ||
+               (memcmp(src.ptr + pos + 4, src.ptr + 4, 12) != 0)) {
+      return MapImageResult(MapImage_BadFrame);
+    }
+    pos += 16;
+
+    if ((src.len - pos) < (pixels_len + padding_len)) {
+      return MapImageResult(MapImage_UnexpectedEndOfFile);
+    }
+    wuffs_base__status status = pixbuf.set_from_slice(
+        &pixcfg, wuffs_base__make_slice_u8(src.ptr + pos, pixels_len));
+    if (!status.is_ok()) {
+      return MapImageResult(status.message());
+    }
+    pos += pixels_len;
+    if (padding_len &&
+        (wuffs_base__peek_u32le__no_bounds_check(src.ptr + pos) != 0)) {
+      return MapImageResult(MapImage_BadFrame);
+    }
+    pos += padding_len;
+    frames.emplace_back(pixbuf, prev_cdd);
+  }
+}
+
 }  // namespace wuffs_aux
 
 #endif  // !defined(WUFFS_CONFIG__MODULES) ||
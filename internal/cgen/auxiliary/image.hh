@@ -89,12 +89,16 @@ class DecodeImageCallbacks {
   // WUFFS_CONFIG__MODULE__ETC).
   //  - WUFFS_BASE__FOURCC__BMP
   //  - WUFFS_BASE__FOURCC__GIF
+  //  - WUFFS_BASE__FOURCC__ICO
   //  - WUFFS_BASE__FOURCC__JPEG
   //  - WUFFS_BASE__FOURCC__NIE
   //  - WUFFS_BASE__FOURCC__NPBM
   //  - WUFFS_BASE__FOURCC__PNG
+  //  - WUFFS_BASE__FOURCC__QOI
   //  - WUFFS_BASE__FOURCC__TGA
+  //  - WUFFS_BASE__FOURCC__TIFF
   //  - WUFFS_BASE__FOURCC__WBMP
+  //  - WUFFS_BASE__FOURCC__WEBP
   virtual wuffs_base__image_decoder::unique_ptr  //
   SelectDecoder(uint32_t fourcc,
                 wuffs_base__slice_u8 prefix_data,
@@ -300,8 +304,7 @@ struct DecodeImageArgMaxInclMetadataLength {
 // completely done, but rendering animation often involves handling other
 // events in between animation frames. To decode multiple frames of animated
 // images, or for asynchronous I/O (e.g. when decoding an image streamed over
-// the network), use Wuffs' lower level C API instead of its higher level,
-// simplified C++ API (the wuffs_aux API).
+// the network), use ImageDecodeSession (below) or Wuffs' lower level C API.
 //
 // The DecodeImageResult's fields depend on whether decoding succeeded:
 //  - On total success, the error_message is empty and pixbuf.pixcfg.is_valid()
@@ -350,4 +353,266 @@ DecodeImage(DecodeImageCallbacks& callbacks,
             DecodeImageArgMaxInclMetadataLength max_incl_metadata_length =
                 DecodeImageArgMaxInclMetadataLength::DefaultValue());
 
+// --------
+
+extern const char ImageDecodeSession_FeedAfterClose[];
+extern const char ImageDecodeSession_MaxInclBufferLengthExceeded[];
+extern const char ImageDecodeSession_UnsupportedBackwardsSeek[];
+
+// ImageDecodeSessionArgMaxInclBufferLength wraps an optional argument to the
+// ImageDecodeSession constructor.
+struct ImageDecodeSessionArgMaxInclBufferLength {
+  explicit ImageDecodeSessionArgMaxInclBufferLength(uint64_t repr0);
+
+  // DefaultValue returns 16777215 = 0x00FF_FFFF, one less than 16 MiB.
+  static ImageDecodeSessionArgMaxInclBufferLength DefaultValue();
+
+  uint64_t repr;
+};
+
+// ImageDecodeSession is a push-style alternative to DecodeImage, for callers
+// (such as event loop servers) that receive the image data in chunks and
+// cannot block waiting for more. Instead of pulling bytes from a
+// sync_io::Input, the caller pushes them, one Feed call per chunk, and the
+// session keeps the decoder's state between calls.
+//
+// Each Feed call decodes as far as it can and returns an Event:
+//  - NeedMore means that all of the bytes fed so far have been consumed or
+//    buffered and that the session needs more input before it can progress.
+//  - Frame means that a frame was decoded into Pixbuf(). There may be more
+//    frames, and some of them may already be buffered, so call Feed again
+//    (possibly with an empty bytes slice) to continue.
+//  - Done means that the image (all of its frames) was successfully decoded.
+//  - Error means that decoding failed. ErrorMessage() says why.
+// Once Feed returns Done or Error, every later call returns the same Event.
+//
+// The callbacks are used as for DecodeImage, other than Done (which is never
+// called). The optional arguments also mean the same as for DecodeImage.
+// There is no flags argument, as metadata is not reported.
+//
+// Unlike DecodeImage, every frame of an animated image is decoded, each one
+// composited onto the same pixel buffer. FrameConfig() describes the most
+// recent frame (e.g. its bounds and duration). As with Wuffs' lower level C
+// API, handling the frame's disposal is up to the caller.
+//
+// When nothing is buffered, Feed decodes directly from the caller's bytes,
+// only copying whatever the decoder has not yet consumed when Feed returns.
+// The caller can therefore re-use or free those bytes after each Feed call.
+//
+// Some image formats can ask to seek backwards. That only works if the bytes
+// sought are still buffered, otherwise decoding fails with
+// ImageDecodeSession_UnsupportedBackwardsSeek. Forward seeks are fine. For
+// TIFF, which routinely seeks backwards, the session buffers every byte fed.
+//
+// The session's buffer holds at most max_incl_buffer_length bytes. Feeding
+// more than that, without the decoder consuming them (or, for TIFF, at all),
+// fails with ImageDecodeSession_MaxInclBufferLengthExceeded.
+class ImageDecodeSession {
+ public:
+  enum class Event {
+    NeedMore = 0,
+    Frame = 1,
+    Done = 2,
+    Error = 3,
+  };
+
+  ImageDecodeSession(
+      DecodeImageCallbacks& callbacks,
+      DecodeImageArgQuirks quirks = DecodeImageArgQuirks::DefaultValue(),
+      DecodeImageArgPixelBlend pixel_blend =
+          DecodeImageArgPixelBlend::DefaultValue(),
+      DecodeImageArgBackgroundColor background_color =
+          DecodeImageArgBackgroundColor::DefaultValue(),
+      DecodeImageArgMaxInclDimension max_incl_dimension =
+          DecodeImageArgMaxInclDimension::DefaultValue(),
+      ImageDecodeSessionArgMaxInclBufferLength max_incl_buffer_length =
+          ImageDecodeSessionArgMaxInclBufferLength::DefaultValue());
+
+  // Feed pushes the next chunk of image data. Pass closed as true, with or
+  // without a final chunk, when there is no more data, so that truncated
+  // input is reported as an Error instead of as NeedMore.
+  Event Feed(wuffs_base__slice_u8 bytes, bool closed = false);
+
+  // Pixbuf returns the pixel buffer being decoded into. It is invalid (its
+  // pixcfg.is_valid() is false) until the image config has been decoded. It
+  // may be partially decoded, even after an Error Event.
+  wuffs_base__pixel_buffer& Pixbuf();
+
+  const wuffs_base__frame_config& FrameConfig() const;
+  const std::string& ErrorMessage() const;
+
+  // TakeResult moves the pixel buffer (and its memory ownership) and the error
+  // message out of the session, like the DecodeImage return value. It should
+  // only be called once, typically after Feed returns Done or Error.
+  DecodeImageResult TakeResult();
+
+ private:
+  enum class State {
+    Sniff,
+    SelectDecoder,
+    DecodeImageConfig,
+    AllocBuffers,
+    DecodeFrameConfig,
+    DecodeFrame,
+    Done,
+    Error,
+  };
+
+  Event Decode(IOBuffer& io_buf);
+  Event Fail(std::string&& error_message);
+  Event FailGrow(sync_io::DynIOBuffer::GrowResult grow_result);
+  sync_io::DynIOBuffer::GrowResult Append(wuffs_base__slice_u8 bytes);
+  std::string SeekTo(IOBuffer& io_buf, uint64_t absolute_position);
+  std::string HandleIORedirect(IOBuffer& io_buf, bool allow_format_redirect);
+
+  DecodeImageCallbacks& m_callbacks;
+  wuffs_base__slice_u32 m_quirks;
+  wuffs_base__pixel_blend m_pixel_blend;
+  wuffs_base__color_u32_argb_premul m_background_color;
+  uint32_t m_max_incl_dimension;
+
+  State m_state;
+  bool m_closed;
+  bool m_redirected;
+  bool m_retain_consumed;
+  uint32_t m_fourcc;
+  uint64_t m_skip_length;
+  sync_io::DynIOBuffer m_buffer;
+
+  wuffs_base__image_decoder::unique_ptr m_image_decoder;
+  wuffs_base__image_config m_image_config;
+  wuffs_base__frame_config m_frame_config;
+  MemOwner m_pixbuf_mem_owner;
+  wuffs_base__pixel_buffer m_pixbuf;
+  MemOwner m_workbuf_mem_owner;
+  wuffs_base__slice_u8 m_workbuf;
+  std::string m_error_message;
+
+  // Delete the copy and assign constructors.
+  ImageDecodeSession(const ImageDecodeSession&) = delete;
+  ImageDecodeSession& operator=(const ImageDecodeSession&) = delete;
+};
+
+// --------
+
+extern const char EncodeImageQoi_OutOfMemory[];
+extern const char EncodeImageQoi_UnsupportedPixelFormat[];
+
+// EncodeImageQoi writes pixbuf's pixels to output in the QOI (Quite OK Image)
+// file format. Its output is byte-for-byte identical to the reference qoi.h
+// encoder, given the same RGBA input.
+//
+// Each row is first converted to RGBA_NONPREMUL by a
+// wuffs_base__pixel_swizzler, so pixbuf can have any interleaved (not planar)
+// pixel format that the swizzler can read. The QOI header's channels field is
+// 3 if that pixel format is opaque and 4 otherwise. Its colorspace field is 0
+// (sRGB with linear alpha).
+//
+// Encoded bytes are staged in a 64 KiB buffer and passed to output.CopyOut
+// whenever that buffer fills up, and again at the end.
+std::string  //
+EncodeImageQoi(sync_io::Output& output, wuffs_base__pixel_buffer& pixbuf);
+
+// --------
+
+extern const char EncodeImageNie_UnsupportedPixelConfiguration[];
+
+// EncodeImageNie writes pixbuf's pixels to output in the NIE file format (see
+// doc/spec/nie-spec.md): a 16 byte header and then the pixels, verbatim.
+//
+// pixbuf's pixel format must be BGRA_NONPREMUL or BGRA_PREMUL (NIE's "bn4" and
+// "bp4" configurations) or their 4X16LE variants ("bn8" and "bp8"). Other pixel
+// formats are rejected, not converted. Callers holding other pixel formats can
+// convert them with a wuffs_base__pixel_swizzler first.
+//
+// There is no staging buffer. Each row is passed to output.CopyOut directly,
+// so that writing to a MemoryOutput costs one memcpy per row.
+std::string  //
+EncodeImageNie(sync_io::Output& output, wuffs_base__pixel_buffer& pixbuf);
+
+extern const char NiaEncoder_BadCumulativeDisplayDuration[];
+extern const char NiaEncoder_InconsistentPixelConfiguration[];
+extern const char NiaEncoder_WriteAfterFinish[];
+
+// NiaEncoder writes an animated image in the NIA file format, one frame at a
+// time. The pixcfg passed to the constructor fixes the width, height and pixel
+// format (with the same constraints as for EncodeImageNie) of every frame.
+//
+// The NIA header is written by the first WriteFrame or Finish call. Call
+// Finish when done, as the destructor does not. Like EncodeImageNie, each row
+// of pixels is passed to output.CopyOut directly.
+class NiaEncoder {
+ public:
+  NiaEncoder(sync_io::Output& output, wuffs_base__pixel_config pixcfg);
+
+  // WriteFrame writes the next frame, to be shown until the
+  // cumulative_display_duration (relative to the start of the animation, in
+  // flicks) has elapsed. That duration must be non-negative and must not be
+  // less than the previous frame's. pixbuf's width, height and pixel format
+  // must match the constructor's pixcfg.
+  std::string WriteFrame(wuffs_base__pixel_buffer& pixbuf,
+                         wuffs_base__flicks cumulative_display_duration);
+
+  // Finish writes the NIA footer. A zero loop_count means to loop forever.
+  std::string Finish(uint32_t loop_count);
+
+ private:
+  std::string WriteHeader();
+
+  sync_io::Output& m_output;
+  wuffs_base__pixel_config m_pixcfg;
+  wuffs_base__flicks m_cumulative_display_duration;
+  bool m_wrote_header;
+  bool m_finished;
+
+  // Delete the copy and assign constructors.
+  NiaEncoder(const NiaEncoder&) = delete;
+  NiaEncoder& operator=(const NiaEncoder&) = delete;
+};
+
+// --------
+
+struct MappedImageFrame {
+  MappedImageFrame(wuffs_base__pixel_buffer pixbuf0,
+                   wuffs_base__flicks cumulative_display_duration0);
+
+  wuffs_base__pixel_buffer pixbuf;
+  wuffs_base__flicks cumulative_display_duration;
+};
+
+struct MapImageResult {
+  MapImageResult(std::vector<MappedImageFrame>&& frames0,
+                 uint32_t loop_count0);
+  MapImageResult(std::string&& error_message0);
+
+  std::vector<MappedImageFrame> frames;
+  uint32_t loop_count;
+  std::string error_message;
+};
+
+extern const char MapImage_BadHeader[];
+extern const char MapImage_BadFrame[];
+extern const char MapImage_UnexpectedEndOfFile[];
+extern const char MapImage_UnsupportedImageFormat[];
+
+// MapImage validates src as a NIE or NIA image and returns one pixel buffer
+// per frame (one, for NIE). Each pixbuf points directly into src. Nothing is
+// decoded or copied, so MapImage's cost is independent of the image size for
+// NIE and proportional to the number of frames for NIA.
+//
+// src is typically a memory-mapped file, such as a cache of previously decoded
+// images written by EncodeImageNie or NiaEncoder. It must outlive the returned
+// pixel buffers and must not be modified while they are in use. The pixbufs
+// are nominally writable but, if src is mapped read-only, writing through them
+// will crash.
+//
+// If src's start is 8 byte aligned (which page-aligned mappings are), then so
+// is every frame's pixel data, as the NIE header is 16 bytes and NIA pads its
+// frames to a multiple of 8 bytes.
+//
+// For NIE, the single frame's cumulative_display_duration and the loop_count
+// are both zero. For NIA, the footer must be the final 8 bytes of src.
+MapImageResult  //
+MapImage(wuffs_base__slice_u8 src);
+
 }  // namespace wuffs_aux
@@ -16,7 +16,9 @@
 
 #if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__AUX__JSON)
 
+#include <initializer_list>
 #include <utility>
+#include <vector>
 
 namespace wuffs_aux {
 
@@ -36,6 +38,10 @@ const char DecodeJson_BadJsonPointer[] =  //
     "wuffs_aux::DecodeJson: bad JSON Pointer";
 const char DecodeJson_NoMatch[] =  //
     "wuffs_aux::DecodeJson: no match";
+const char ReplayJsonTokenCache_BadCache[] =  //
+    "wuffs_aux::ReplayJsonTokenCache: bad cache";
+const char ReplayJsonTokenCache_ChecksumMismatch[] =  //
+    "wuffs_aux::ReplayJsonTokenCache: checksum mismatch";
 
 DecodeJsonArgQuirks::DecodeJsonArgQuirks(wuffs_base__slice_u32 repr0)
     : repr(repr0) {}
@@ -354,15 +360,15 @@ done:
   return ret_error_message;
 }
 
-}  // namespace
-
-// --------
-
+// DecodeJson_Impl implements DecodeJson and, when replay_tokens.ptr is
+// non-null, ReplayJsonTokenCache. In the latter case, input holds the source
+// bytes that replay_tokens (which are already decoded) refer to.
 DecodeJsonResult  //
-DecodeJson(DecodeJsonCallbacks& callbacks,
-           sync_io::Input& input,
-           DecodeJsonArgQuirks quirks,
-           DecodeJsonArgJsonPointer json_pointer) {
+DecodeJson_Impl(DecodeJsonCallbacks& callbacks,
+                sync_io::Input& input,
+                DecodeJsonArgQuirks quirks,
+                DecodeJsonArgJsonPointer json_pointer,
+                wuffs_base__slice_token replay_tokens) {
   // Prepare the wuffs_base__io_buffer and the resultant error_message.
   wuffs_base__io_buffer* io_buf = input.BringsItsOwnIOBuffer();
   wuffs_base__io_buffer fallback_io_buf = wuffs_base__empty_io_buffer();
@@ -377,6 +383,9 @@ DecodeJson(DecodeJsonCallbacks& callbacks,
   size_t cursor_index = 0;
   std::string ret_error_message;
   std::string io_error_message;
+  // value_complete is whether we have seen the end of the top-level (or
+  // JSON Pointer'ed) value. Replayed tokens can run out before then.
+  bool value_complete = false;
 
   do {
     // Prepare the low-level JSON decoder.
@@ -403,8 +412,15 @@ DecodeJson(DecodeJsonCallbacks& callbacks,
     wuffs_base__token_buffer tok_buf =
         wuffs_base__slice_token__writer(wuffs_base__make_slice_token(
             &tok_array[0], (sizeof(tok_array) / sizeof(tok_array[0]))));
-    wuffs_base__status tok_status =
-        dec->decode_tokens(&tok_buf, io_buf, wuffs_base__empty_slice_u8());
+    wuffs_base__status tok_status = wuffs_base__make_status(nullptr);
+    if (replay_tokens.ptr) {
+      // Every token has already been decoded, consuming all of io_buf.
+      tok_buf = wuffs_base__slice_token__reader(replay_tokens, true);
+      io_buf->meta.ri = io_buf->meta.wi;
+    } else {
+      tok_status =
+          dec->decode_tokens(&tok_buf, io_buf, wuffs_base__empty_slice_u8());
+    }
 
     // Prepare other state.
     int32_t depth = 0;
@@ -577,14 +593,21 @@ DecodeJson(DecodeJsonCallbacks& callbacks,
       // further (unexpected) data"). We aren't done yet. Instead, keep the
       // loop running until WUFFS_AUX__DECODE_JSON__GET_THE_NEXT_TOKEN's
       // decode_tokens returns an ok status.
-      if (!ret_error_message.empty() ||
-          ((depth == 0) && !json_pointer.repr.empty())) {
+      if (!ret_error_message.empty()) {
         goto done;
+      } else if (depth == 0) {
+        value_complete = true;
+        if (!json_pointer.repr.empty()) {
+          goto done;
+        }
       }
     }
   } while (false);
 
 done:
+  if (replay_tokens.ptr && ret_error_message.empty() && !value_complete) {
+    ret_error_message = ReplayJsonTokenCache_BadCache;
+  }
   DecodeJsonResult result(
       std::move(ret_error_message),
       wuffs_base__u64__sat_add(io_buf->meta.pos, cursor_index));
@@ -592,6 +615,528 @@ done:
   return result;
 }
 
+}  // namespace
+
+// --------
+
+DecodeJsonResult  //
+DecodeJson(DecodeJsonCallbacks& callbacks,
+           sync_io::Input& input,
+           DecodeJsonArgQuirks quirks,
+           DecodeJsonArgJsonPointer json_pointer) {
+  return DecodeJson_Impl(callbacks, input, quirks, json_pointer,
+                         wuffs_base__empty_slice_token());
+}
+
+// --------
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__AUX__CBOR)
+
+namespace {
+
+// TranscodeJsonToCbor_AppendString appends a JSON string fragment to str_array
+// (of size str_cap) if it fits. If not, it starts a CBOR indefinite-length
+// text string, writes what was buffered and then writes each subsequent
+// fragment as its own chunk. The JSON decoder's tokens don't split multi-byte
+// UTF-8 sequences, so each chunk is valid UTF-8.
+std::string  //
+TranscodeJsonToCbor_AppendString(CborEncoder& enc,
+                                 uint8_t* str_array,
+                                 size_t str_cap,
+                                 size_t& str_len,
+                                 bool& str_is_indefinite,
+                                 const uint8_t* ptr,
+                                 size_t len) {
+  if (!str_is_indefinite) {
+    if (len <= (str_cap - str_len)) {
+      memcpy(str_array + str_len, ptr, len);
+      str_len += len;
+      return "";
+    }
+    str_is_indefinite = true;
+    std::string z = enc.WriteIndefiniteHead(3);
+    if (z.empty() && (str_len > 0)) {
+      z = enc.WriteTextString(
+          static_cast<const char*>(static_cast<void*>(str_array)), str_len);
+    }
+    if (!z.empty()) {
+      return z;
+    }
+  }
+  return (len > 0)
+             ? enc.WriteTextString(static_cast<const char*>(
+                                       static_cast<const void*>(ptr)),
+                                   len)
+             : std::string();
+}
+
+}  // namespace
+
+DecodeJsonResult  //
+TranscodeJsonToCbor(sync_io::Output& output,
+                    sync_io::Input& input,
+                    DecodeJsonArgQuirks quirks) {
+  // Prepare the wuffs_base__io_buffer and the resultant error_message.
+  wuffs_base__io_buffer* io_buf = input.BringsItsOwnIOBuffer();
+  wuffs_base__io_buffer fallback_io_buf = wuffs_base__empty_io_buffer();
+  std::unique_ptr<uint8_t[]> fallback_io_array(nullptr);
+  if (!io_buf) {
+    fallback_io_array = std::unique_ptr<uint8_t[]>(new uint8_t[4096]);
+    fallback_io_buf = wuffs_base__ptr_u8__writer(fallback_io_array.get(), 4096);
+    io_buf = &fallback_io_buf;
+  }
+  // The CBOR is written to dst_array, which is drained to output when full.
+  uint8_t dst_array[4096];
+  CborEncoder enc(output,
+                  wuffs_base__make_slice_u8(&dst_array[0], sizeof(dst_array)));
+  // cursor_index is discussed at
+  // https://nigeltao.github.io/blog/2020/jsonptr.html#the-cursor-index
+  size_t cursor_index = 0;
+  std::string ret_error_message;
+  std::string io_error_message;
+
+  do {
+    // Prepare the low-level JSON decoder.
+    wuffs_json__decoder::unique_ptr dec = wuffs_json__decoder::alloc();
+    if (!dec) {
+      ret_error_message = "wuffs_aux::TranscodeJsonToCbor: out of memory";
+      goto done;
+    } else if (WUFFS_JSON__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE != 0) {
+      ret_error_message =
+          "wuffs_aux::TranscodeJsonToCbor: internal error: bad WORKBUF_LEN";
+      goto done;
+    }
+    for (size_t i = 0; i < quirks.repr.len; i++) {
+      dec->set_quirk(quirks.repr.ptr[i], 1);
+    }
+
+    // Prepare the wuffs_base__tok_buffer. 256 tokens is 2KiB.
+    wuffs_base__token tok_array[256];
+    wuffs_base__token_buffer tok_buf =
+        wuffs_base__slice_token__writer(wuffs_base__make_slice_token(
+            &tok_array[0], (sizeof(tok_array) / sizeof(tok_array[0]))));
+    wuffs_base__status tok_status =
+        dec->decode_tokens(&tok_buf, io_buf, wuffs_base__empty_slice_u8());
+
+    // Prepare other state. Each string is buffered in str_array, so that its
+    // CBOR head can give its length, unless it's too long.
+    int32_t depth = 0;
+    uint8_t str_array[4096];
+    size_t str_len = 0;
+    bool str_is_indefinite = false;
+
+    // Loop, doing these two things:
+    //  1. Get the next token.
+    //  2. Process that token.
+    while (true) {
+      WUFFS_AUX__DECODE_JSON__GET_THE_NEXT_TOKEN;
+
+      int64_t vbc = token.value_base_category();
+      uint64_t vbd = token.value_base_detail();
+      switch (vbc) {
+        case WUFFS_BASE__TOKEN__VBC__FILLER:
+          continue;
+
+        case WUFFS_BASE__TOKEN__VBC__STRUCTURE: {
+          if (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__PUSH) {
+            ret_error_message = enc.WriteIndefiniteHead(
+                (vbd & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_LIST) ? 4 : 5);
+            if (!ret_error_message.empty()) {
+              goto done;
+            }
+            depth++;
+            if (depth > WUFFS_JSON__DECODER_DEPTH_MAX_INCL) {
+              ret_error_message =
+                  "wuffs_aux::TranscodeJsonToCbor: internal error: bad depth";
+              goto done;
+            }
+            continue;
+          }
+          ret_error_message = enc.WriteBreak();
+          depth--;
+          if (depth < 0) {
+            ret_error_message =
+                "wuffs_aux::TranscodeJsonToCbor: internal error: bad depth";
+            goto done;
+          }
+          goto parsed_a_value;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__STRING: {
+          if (vbd & WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_0_DST_1_SRC_DROP) {
+            // No-op.
+          } else if (vbd &
+                     WUFFS_BASE__TOKEN__VBD__STRING__CONVERT_1_DST_1_SRC_COPY) {
+            ret_error_message = TranscodeJsonToCbor_AppendString(
+                enc, &str_array[0], sizeof(str_array), str_len,
+                str_is_indefinite, token_ptr, static_cast<size_t>(token_len));
+            if (!ret_error_message.empty()) {
+              goto done;
+            }
+          } else {
+            goto fail;
+          }
+          if (token.continued()) {
+            continue;
+          }
+          ret_error_message =
+              str_is_indefinite
+                  ? enc.WriteBreak()
+                  : enc.WriteTextString(static_cast<const char*>(
+                                            static_cast<void*>(&str_array[0])),
+                                        str_len);
+          str_len = 0;
+          str_is_indefinite = false;
+          goto parsed_a_value;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__UNICODE_CODE_POINT: {
+          uint8_t u[WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL];
+          size_t n = wuffs_base__utf_8__encode(
+              wuffs_base__make_slice_u8(
+                  &u[0], WUFFS_BASE__UTF_8__BYTE_LENGTH__MAX_INCL),
+              static_cast<uint32_t>(vbd));
+          ret_error_message = TranscodeJsonToCbor_AppendString(
+              enc, &str_array[0], sizeof(str_array), str_len,
+              str_is_indefinite, &u[0], n);
+          if (!ret_error_message.empty()) {
+            goto done;
+          } else if (token.continued()) {
+            continue;
+          }
+          goto fail;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__LITERAL: {
+          ret_error_message =
+              (vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__NULL)
+                  ? enc.WriteNull()
+                  : enc.WriteBool(vbd & WUFFS_BASE__TOKEN__VBD__LITERAL__TRUE);
+          goto parsed_a_value;
+        }
+
+        case WUFFS_BASE__TOKEN__VBC__NUMBER: {
+          if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__FORMAT_TEXT) {
+            wuffs_base__slice_u8 s =
+                wuffs_base__make_slice_u8(token_ptr,
+                                          static_cast<size_t>(token_len));
+            if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_INTEGER_SIGNED) {
+              wuffs_base__result_i64 r = wuffs_base__parse_number_i64(
+                  s, WUFFS_BASE__PARSE_NUMBER_XXX__DEFAULT_OPTIONS);
+              if (r.status.is_ok()) {
+                ret_error_message = enc.WriteI64(r.value);
+                goto parsed_a_value;
+              } else if ((token_len > 0) && (token_ptr[0] != '-')) {
+                wuffs_base__result_u64 r64 = wuffs_base__parse_number_u64(
+                    s, WUFFS_BASE__PARSE_NUMBER_XXX__DEFAULT_OPTIONS);
+                if (r64.status.is_ok()) {
+                  ret_error_message = enc.WriteU64(r64.value);
+                  goto parsed_a_value;
+                }
+              }
+            }
+            if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_FLOATING_POINT) {
+              wuffs_base__result_f64 r = wuffs_base__parse_number_f64(
+                  s, WUFFS_BASE__PARSE_NUMBER_XXX__DEFAULT_OPTIONS);
+              if (r.status.is_ok()) {
+                ret_error_message = enc.WriteF64(r.value);
+                goto parsed_a_value;
+              }
+            }
+          } else if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_NEG_INF) {
+            ret_error_message = enc.WriteF64(
+                wuffs_base__ieee_754_bit_representation__from_u64_to_f64(
+                    0xFFF0000000000000ul));
+            goto parsed_a_value;
+          } else if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_POS_INF) {
+            ret_error_message = enc.WriteF64(
+                wuffs_base__ieee_754_bit_representation__from_u64_to_f64(
+                    0x7FF0000000000000ul));
+            goto parsed_a_value;
+          } else if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_NEG_NAN) {
+            ret_error_message = enc.WriteF64(
+                wuffs_base__ieee_754_bit_representation__from_u64_to_f64(
+                    0xFFFFFFFFFFFFFFFFul));
+            goto parsed_a_value;
+          } else if (vbd & WUFFS_BASE__TOKEN__VBD__NUMBER__CONTENT_POS_NAN) {
+            ret_error_message = enc.WriteF64(
+                wuffs_base__ieee_754_bit_representation__from_u64_to_f64(
+                    0x7FFFFFFFFFFFFFFFul));
+            goto parsed_a_value;
+          }
+          goto fail;
+        }
+      }
+
+    fail:
+      ret_error_message =
+          "wuffs_aux::TranscodeJsonToCbor: internal error: unexpected token";
+      goto done;
+
+    parsed_a_value:
+      // As for DecodeJson, keep the loop running (when there's no error)
+      // until decode_tokens returns an ok status, consuming any trailing
+      // filler allowed by the quirks.
+      if (!ret_error_message.empty()) {
+        goto done;
+      }
+    }
+  } while (false);
+
+done:
+  std::string flush_error_message = enc.Flush();
+  if (ret_error_message.empty()) {
+    ret_error_message = std::move(flush_error_message);
+  }
+  return DecodeJsonResult(
+      std::move(ret_error_message),
+      wuffs_base__u64__sat_add(io_buf->meta.pos, cursor_index));
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__AUX__CBOR)
+
+// --------
+
+#if !defined(WUFFS_CONFIG__MODULES) || defined(WUFFS_CONFIG__MODULE__CRC32)
+
+namespace {
+
+constexpr size_t JsonTokenCache_HeaderLength = 40;
+
+// JsonTokenCache_Slice converts from (const uint8_t*).
+wuffs_base__slice_u8  //
+JsonTokenCache_Slice(const uint8_t* ptr, size_t len) {
+  return wuffs_base__make_slice_u8(const_cast<uint8_t*>(ptr), len);
+}
+
+// JsonTokenCache_Checksum returns the CRC-32/IEEE checksum of the
+// concatenated pieces. The initialize call can only fail on a sizeof or
+// WUFFS_VERSION mismatch, which can't happen within this translation unit.
+uint32_t  //
+JsonTokenCache_Checksum(std::initializer_list<wuffs_base__slice_u8> pieces) {
+  wuffs_crc32__ieee_hasher h;
+  if (!h.initialize(sizeof h, WUFFS_VERSION, WUFFS_INITIALIZE__DEFAULT_OPTIONS)
+           .is_ok()) {
+    return 0;
+  }
+  uint32_t ret = 0;
+  for (wuffs_base__slice_u8 piece : pieces) {
+    ret = h.update_u32(piece);
+  }
+  return ret;
+}
+
+// JsonTokenCache_QuirksChecksum returns the checksum of the quirks, each as 4
+// little-endian bytes.
+uint32_t  //
+JsonTokenCache_QuirksChecksum(DecodeJsonArgQuirks quirks) {
+  std::vector<uint8_t> b(4 * quirks.repr.len);
+  for (size_t i = 0; i < quirks.repr.len; i++) {
+    wuffs_base__poke_u32le__no_bounds_check(&b[4 * i], quirks.repr.ptr[i]);
+  }
+  return JsonTokenCache_Checksum({JsonTokenCache_Slice(b.data(), b.size())});
+}
+
+std::string  //
+JsonTokenCache_Write(sync_io::Output& output,
+                     DecodeJsonArgQuirks quirks,
+                     std::vector<uint64_t>& tokens,
+                     const std::string& src) {
+  const uint8_t* src_ptr =  // Convert from (const char*).
+      static_cast<const uint8_t*>(static_cast<const void*>(src.data()));
+
+  uint8_t header[JsonTokenCache_HeaderLength] = {0};
+  memcpy(&header[0], "WuffsJTC", 8);
+  wuffs_base__poke_u32le__no_bounds_check(&header[8], 1);
+  wuffs_base__poke_u32le__no_bounds_check(
+      &header[12], JsonTokenCache_QuirksChecksum(quirks));
+  wuffs_base__poke_u64le__no_bounds_check(&header[16], tokens.size());
+  wuffs_base__poke_u64le__no_bounds_check(&header[24], src.size());
+  wuffs_base__poke_u32le__no_bounds_check(
+      &header[32],
+      JsonTokenCache_Checksum({JsonTokenCache_Slice(src_ptr, src.size())}));
+
+  // Convert the tokens to little-endian in place.
+  uint8_t* tokens_ptr =
+      static_cast<uint8_t*>(static_cast<void*>(tokens.data()));
+  for (size_t i = 0; i < tokens.size(); i++) {
+    wuffs_base__poke_u64le__no_bounds_check(tokens_ptr + (8 * i), tokens[i]);
+  }
+
+  // The header's final checksum covers everything else: the header's other
+  // bytes (including the counts), the tokens and the source bytes.
+  wuffs_base__poke_u32le__no_bounds_check(
+      &header[36],
+      JsonTokenCache_Checksum({
+          JsonTokenCache_Slice(&header[0], 36),
+          JsonTokenCache_Slice(tokens_ptr, 8 * tokens.size()),
+          JsonTokenCache_Slice(src_ptr, src.size()),
+      }));
+
+  uint8_t dst_array[4096];
+  IOBuffer dst = wuffs_base__ptr_u8__writer(&dst_array[0], 4096);
+  std::string error_message = private_impl::WriteToIOBuffer(
+      output, dst, &header[0], JsonTokenCache_HeaderLength);
+  if (error_message.empty()) {
+    error_message = private_impl::WriteToIOBuffer(output, dst, tokens_ptr,
+                                                  8 * tokens.size());
+  }
+  if (error_message.empty()) {
+    error_message =
+        private_impl::WriteToIOBuffer(output, dst, src_ptr, src.size());
+  }
+  if (error_message.empty()) {
+    error_message = private_impl::FlushIOBuffer(output, dst);
+  }
+  return error_message;
+}
+
+}  // namespace
+
+DecodeJsonResult  //
+WriteJsonTokenCache(sync_io::Output& output,
+                    sync_io::Input& input,
+                    DecodeJsonArgQuirks quirks) {
+  // Prepare the wuffs_base__io_buffer and the resultant error_message.
+  wuffs_base__io_buffer* io_buf = input.BringsItsOwnIOBuffer();
+  wuffs_base__io_buffer fallback_io_buf = wuffs_base__empty_io_buffer();
+  std::unique_ptr<uint8_t[]> fallback_io_array(nullptr);
+  if (!io_buf) {
+    fallback_io_array = std::unique_ptr<uint8_t[]>(new uint8_t[4096]);
+    fallback_io_buf = wuffs_base__ptr_u8__writer(fallback_io_array.get(), 4096);
+    io_buf = &fallback_io_buf;
+  }
+  size_t cursor_index = 0;
+  std::string ret_error_message;
+  std::string io_error_message;
+  std::vector<uint64_t> tokens;
+  std::string src;
+
+  do {
+    // Prepare the low-level JSON decoder.
+    wuffs_json__decoder::unique_ptr dec = wuffs_json__decoder::alloc();
+    if (!dec) {
+      ret_error_message = "wuffs_aux::WriteJsonTokenCache: out of memory";
+      goto done;
+    } else if (WUFFS_JSON__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE != 0) {
+      ret_error_message =
+          "wuffs_aux::WriteJsonTokenCache: internal error: bad WORKBUF_LEN";
+      goto done;
+    }
+    for (size_t i = 0; i < quirks.repr.len; i++) {
+      dec->set_quirk(quirks.repr.ptr[i], 1);
+    }
+
+    // Prepare the wuffs_base__tok_buffer. 256 tokens is 2KiB.
+    wuffs_base__token tok_array[256];
+    wuffs_base__token_buffer tok_buf =
+        wuffs_base__slice_token__writer(wuffs_base__make_slice_token(
+            &tok_array[0], (sizeof(tok_array) / sizeof(tok_array[0]))));
+    wuffs_base__status tok_status =
+        dec->decode_tokens(&tok_buf, io_buf, wuffs_base__empty_slice_u8());
+
+    // Record every token, and the source bytes that it covers, until
+    // decode_tokens returns an ok status and the GET_THE_NEXT_TOKEN macro
+    // jumps to done.
+    while (true) {
+      WUFFS_AUX__DECODE_JSON__GET_THE_NEXT_TOKEN;
+      tokens.push_back(token.repr);
+      const char* ptr =  // Convert from (uint8_t*).
+          static_cast<const char*>(static_cast<void*>(token_ptr));
+      src.append(ptr, static_cast<size_t>(token_len));
+    }
+  } while (false);
+
+done:
+  if (ret_error_message.empty()) {
+    ret_error_message = JsonTokenCache_Write(output, quirks, tokens, src);
+  }
+  return DecodeJsonResult(
+      std::move(ret_error_message),
+      wuffs_base__u64__sat_add(io_buf->meta.pos, cursor_index));
+}
+
+DecodeJsonResult  //
+ReplayJsonTokenCache(DecodeJsonCallbacks& callbacks,
+                     const uint8_t* ptr,
+                     size_t len,
+                     DecodeJsonArgQuirks quirks,
+                     DecodeJsonArgJsonPointer json_pointer) {
+  // Validate the header and the checksums.
+  const char* error_message = ReplayJsonTokenCache_BadCache;
+  uint64_t num_tokens = 0;
+  uint64_t src_len = 0;
+  const uint8_t* src_ptr = nullptr;
+  do {
+    if ((len < JsonTokenCache_HeaderLength) ||
+        (memcmp(ptr, "WuffsJTC", 8) != 0) ||
+        (wuffs_base__peek_u32le__no_bounds_check(ptr + 8) != 1)) {
+      break;
+    }
+    num_tokens = wuffs_base__peek_u64le__no_bounds_check(ptr + 16);
+    src_len = wuffs_base__peek_u64le__no_bounds_check(ptr + 24);
+    uint64_t n = len - JsonTokenCache_HeaderLength;
+    if ((num_tokens == 0) || (num_tokens > (n / 8)) ||
+        (src_len != (n - (8 * num_tokens)))) {
+      break;
+    }
+    src_ptr = ptr + JsonTokenCache_HeaderLength + (8 * num_tokens);
+
+    error_message = ReplayJsonTokenCache_ChecksumMismatch;
+    if ((wuffs_base__peek_u32le__no_bounds_check(ptr + 12) !=
+         JsonTokenCache_QuirksChecksum(quirks)) ||
+        (wuffs_base__peek_u32le__no_bounds_check(ptr + 32) !=
+         JsonTokenCache_Checksum({JsonTokenCache_Slice(
+             src_ptr, static_cast<size_t>(src_len))})) ||
+        (wuffs_base__peek_u32le__no_bounds_check(ptr + 36) !=
+         JsonTokenCache_Checksum({
+             JsonTokenCache_Slice(ptr, 36),
+             JsonTokenCache_Slice(ptr + JsonTokenCache_HeaderLength,
+                                  len - JsonTokenCache_HeaderLength),
+         }))) {
+      break;
+    }
+    error_message = nullptr;
+  } while (false);
+
+  if (error_message) {
+    sync_io::MemoryInput empty_input("", 0);
+    DecodeJsonResult result(error_message, 0);
+    callbacks.Done(result, empty_input, *empty_input.BringsItsOwnIOBuffer());
+    return result;
+  }
+
+  // Use the tokens in place if they're suitably aligned and already in the
+  // CPU's byte order. Otherwise, copy and convert them.
+  const uint8_t* tokens_ptr = ptr + JsonTokenCache_HeaderLength;
+  size_t tokens_len = static_cast<size_t>(num_tokens);
+  std::unique_ptr<wuffs_base__token[]> tokens_copy(nullptr);
+  wuffs_base__slice_token tokens = wuffs_base__empty_slice_token();
+  if (private_impl::HostIsLittleEndian() &&
+      ((reinterpret_cast<uintptr_t>(tokens_ptr) %
+        alignof(wuffs_base__token)) == 0)) {
+    tokens = wuffs_base__make_slice_token(
+        static_cast<wuffs_base__token*>(
+            static_cast<void*>(const_cast<uint8_t*>(tokens_ptr))),
+        tokens_len);
+  } else {
+    tokens_copy =
+        std::unique_ptr<wuffs_base__token[]>(new wuffs_base__token[tokens_len]);
+    for (size_t i = 0; i < tokens_len; i++) {
+      tokens_copy[i].repr =
+          wuffs_base__peek_u64le__no_bounds_check(tokens_ptr + (8 * i));
+    }
+    tokens = wuffs_base__make_slice_token(tokens_copy.get(), tokens_len);
+  }
+
+  sync_io::MemoryInput src_input(src_ptr, static_cast<size_t>(src_len));
+  return DecodeJson_Impl(callbacks, src_input, quirks, json_pointer, tokens);
+}
+
+#endif  // !defined(WUFFS_CONFIG__MODULES) ||
+        // defined(WUFFS_CONFIG__MODULE__CRC32)
+
 #undef WUFFS_AUX__DECODE_JSON__GET_THE_NEXT_TOKEN
 
 }  // namespace wuffs_aux
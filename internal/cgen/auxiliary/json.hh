@@ -120,4 +120,79 @@ DecodeJson(DecodeJsonCallbacks& callbacks,
            DecodeJsonArgJsonPointer json_pointer =
                DecodeJsonArgJsonPointer::DefaultValue());
 
+// TranscodeJsonToCbor converts the JSON-formatted data in input to CBOR,
+// writing it to output. It works directly on the low-level JSON tokens, so
+// that, unlike DecodeJson, it doesn't materialize each string as a
+// std::string. It requires the AUX__CBOR module too, for CborEncoder.
+//
+// JSON arrays and objects become indefinite-length CBOR arrays and maps.
+// Strings become definite-length text strings, unless longer than 4 KiB
+// (after unescaping), in which case they are written as indefinite-length
+// (chunked) text strings. Numbers are converted as per DecodeJson, with
+// integers that overflow an int64_t but not a uint64_t staying integers.
+//
+// The returned cursor_position is the input position, like DecodeJson's.
+DecodeJsonResult  //
+TranscodeJsonToCbor(
+    sync_io::Output& output,
+    sync_io::Input& input,
+    DecodeJsonArgQuirks quirks = DecodeJsonArgQuirks::DefaultValue());
+
+// --------
+
+extern const char ReplayJsonTokenCache_BadCache[];
+extern const char ReplayJsonTokenCache_ChecksumMismatch[];
+
+// WriteJsonTokenCache decodes the JSON-formatted data in input and writes a
+// token cache to output: the low-level wuffs_base__token stream and the source
+// bytes that it covers. ReplayJsonTokenCache can later run DecodeJson
+// callbacks from that cache (e.g. a mmap'ed file) without re-running the JSON
+// decoder. It requires the CRC32 module too.
+//
+// As per DecodeJson, it reads one JSON value (and any trailing filler that the
+// quirks allow) from input. The returned cursor_position is the input
+// position, like DecodeJson's. Nothing is written on failure.
+//
+// The cache format's numbers are little-endian:
+//  - bytes  0 ..  8 hold the magic "WuffsJTC".
+//  - bytes  8 .. 12 hold the version, 1.
+//  - bytes 12 .. 16 hold the CRC-32/IEEE checksum of the quirks (each as 4
+//    bytes).
+//  - bytes 16 .. 24 hold the number of tokens, N.
+//  - bytes 24 .. 32 hold the number of source bytes, M.
+//  - bytes 32 .. 36 hold the CRC-32/IEEE checksum of the source bytes.
+//  - bytes 36 .. 40 hold the CRC-32/IEEE checksum of everything else: bytes
+//    0 .. 36, the tokens and the source bytes.
+//  - the next 8*N bytes hold each token's repr.
+//  - the final M bytes are the source bytes.
+DecodeJsonResult  //
+WriteJsonTokenCache(
+    sync_io::Output& output,
+    sync_io::Input& input,
+    DecodeJsonArgQuirks quirks = DecodeJsonArgQuirks::DefaultValue());
+
+// ReplayJsonTokenCache is like DecodeJson except that its input is ptr[:len],
+// a token cache written by WriteJsonTokenCache, which must outlive the call.
+// The quirks must be the same (and in the same order) as those passed when
+// writing the cache. The returned cursor_position is relative to the source
+// bytes, as if DecodeJson had read them.
+//
+// Before running any other callbacks, it checks the cache's header and
+// checksums, returning ReplayJsonTokenCache_BadCache or
+// ReplayJsonTokenCache_ChecksumMismatch (and calling Done) if they don't
+// match. It also returns ReplayJsonTokenCache_BadCache if the tokens end
+// before the JSON value does. Callers that still have the original JSON can
+// compare its CRC-32 with bytes 32 .. 36 to detect a stale cache.
+//
+// On little-endian CPUs, if ptr is 8-byte aligned (as mmap'ed memory is), the
+// tokens are used in place, without copying.
+DecodeJsonResult  //
+ReplayJsonTokenCache(
+    DecodeJsonCallbacks& callbacks,
+    const uint8_t* ptr,
+    size_t len,
+    DecodeJsonArgQuirks quirks = DecodeJsonArgQuirks::DefaultValue(),
+    DecodeJsonArgJsonPointer json_pointer =
+        DecodeJsonArgJsonPointer::DefaultValue());
+
 }  // namespace wuffs_aux
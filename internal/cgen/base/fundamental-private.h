@@ -49,6 +49,20 @@
   goto suspend;                                                 \
   case n:;
 
+// WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT etc are the same, minus the case
+// labels, for the copy of a coroutine's body that is outside of its switch.
+// See WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY.
+#define WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT(n) coro_susp_point = n;
+
+#define WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT_MAYBE_SUSPEND(n) \
+  if (!status.repr) {                                           \
+    goto ok;                                                    \
+  } else if (*status.repr != '$') {                             \
+    goto exit;                                                  \
+  }                                                             \
+  coro_susp_point = n;                                          \
+  goto suspend;
+
 // The "defined(__clang__)" isn't redundant. While vanilla clang defines
 // __GNUC__, clang-cl (which mimics MSVC's cl.exe) does not.
 #if defined(__GNUC__) || defined(__clang__)
@@ -135,6 +135,48 @@
 #define WUFFS_BASE__MAYBE_STATIC
 #endif  // defined(WUFFS_CONFIG__STATIC_FUNCTIONS)
 
+// --------
+
+// Define WUFFS_CONFIG__ENABLE_STATS to have every Wuffs object (e.g. a
+// decoder) count, per method, how often it is called and, for coroutines, how
+// often it suspends and how long it takes. Public coroutines also count the
+// bytes read from their io_reader arguments and written to their io_writer
+// arguments. Call wuffs_foo__bar__stats to read those counters.
+//
+// Without WUFFS_CONFIG__ENABLE_STATS, the counters, the code that updates them
+// and the wuffs_foo__bar__stats functions are all compiled out.
+//
+// Timing is measured by WUFFS_CONFIG__STATS__TICKS(), which should be a
+// uint64_t-typed, monotonic expression, such as __rdtsc() on x86. Its units
+// are up to the caller. If not defined, no timing is measured.
+#if defined(WUFFS_CONFIG__ENABLE_STATS) && !defined(WUFFS_CONFIG__STATS__TICKS)
+#define WUFFS_CONFIG__STATS__TICKS() ((uint64_t)0)
+#endif
+
+// --------
+
+// Define WUFFS_CONFIG__ENABLE_MULTIVERSIONING to also compile some hot but
+// otherwise CPU-agnostic functions (a choosy function whose choose statement
+// lists that function itself) for the x86-64-v3 (AVX2, BMI2, etc) and
+// x86-64-v4 (AVX-512) feature levels, picking the best version at runtime.
+// This lets a binary built for the baseline x86-64 ISA, such as a Linux
+// distribution's package, still benefit from newer instructions without
+// "-march=native", at the cost of larger code.
+#if defined(WUFFS_CONFIG__ENABLE_MULTIVERSIONING) && \
+    defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+#define WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION
+#endif
+
+// --------
+
+// Define WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY to also compile a second
+// copy of every coroutine that takes an io_reader, outside of its coroutine
+// switch, for calls that start the coroutine with that io_reader already
+// closed (the complete input is available). Case labels for the suspension
+// points otherwise jump into the middle of loops, which hinders the C
+// compiler's optimizations. This costs larger code and only helps callers
+// that pass the whole input (not chunks) to one call.
+
 // ---------------- CPU Architecture
 
 static inline bool  //
@@ -231,6 +273,140 @@ wuffs_base__cpu_arch__have_x86_bmi2() {
   return false;
 }
 
+// wuffs_base__cpu_arch__x86_64_level returns 4 for x86-64-v4, 3 for
+// x86-64-v3 and 0 otherwise. Those levels are defined by the x86-64 psABI.
+static inline int  //
+wuffs_base__cpu_arch__x86_64_level() {
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+  // GCC defines these macros but MSVC does not.
+  //  - bit_SSE3       = (1 <<  0)
+  //  - bit_SSSE3      = (1 <<  9)
+  //  - bit_FMA        = (1 << 12)
+  //  - bit_CMPXCHG16B = (1 << 13)
+  //  - bit_SSE4_1     = (1 << 19)
+  //  - bit_SSE4_2     = (1 << 20)
+  //  - bit_MOVBE      = (1 << 22)
+  //  - bit_POPCNT     = (1 << 23)
+  //  - bit_OSXSAVE    = (1 << 27)
+  //  - bit_AVX        = (1 << 28)
+  //  - bit_F16C       = (1 << 29)
+  const unsigned int v3_ecx1 = 0x38D83201;
+  // GCC defines these macros but MSVC does not.
+  //  - bit_BMI        = (1 <<  3)
+  //  - bit_AVX2       = (1 <<  5)
+  //  - bit_BMI2       = (1 <<  8)
+  const unsigned int v3_ebx7 = 0x00000128;
+  // GCC defines these macros but MSVC does not.
+  //  - bit_LZCNT      = (1 <<  5)
+  const unsigned int v3_ecx8 = 0x00000020;
+  // The OS saves the XMM and YMM registers.
+  const unsigned int v3_xcr0 = 0x00000006;
+  // GCC defines these macros but MSVC does not.
+  //  - bit_AVX512F    = (1 << 16)
+  //  - bit_AVX512DQ   = (1 << 17)
+  //  - bit_AVX512CD   = (1 << 28)
+  //  - bit_AVX512BW   = (1 << 30)
+  //  - bit_AVX512VL   = (1 << 31)
+  const unsigned int v4_ebx7 = 0xD0030000;
+  // The OS also saves the opmask and ZMM registers.
+  const unsigned int v4_xcr0 = 0x000000E6;
+
+  unsigned int ecx1 = 0;
+  unsigned int ebx7 = 0;
+  unsigned int ecx8 = 0;
+  unsigned int xcr0 = 0;
+
+  // clang defines __GNUC__ and clang-cl defines _MSC_VER (but not __GNUC__).
+#if defined(__GNUC__)
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  ecx1 = ecx;
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  ebx7 = ebx;
+  if (!__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  ecx8 = ecx;
+  if ((ecx1 & v3_ecx1) == v3_ecx1) {
+    // xgetbv is only valid if OSXSAVE (part of v3_ecx1) is set.
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    xcr0 = eax;
+  }
+#elif defined(_MSC_VER)  // defined(__GNUC__)
+  int x1[4];
+  __cpuid(x1, 1);
+  ecx1 = (unsigned int)(x1[2]);
+  int x7[4];
+  __cpuidex(x7, 7, 0);
+  ebx7 = (unsigned int)(x7[1]);
+  int x8[4];
+  __cpuid(x8, (int)0x80000001);
+  ecx8 = (unsigned int)(x8[2]);
+  if ((ecx1 & v3_ecx1) == v3_ecx1) {
+    // xgetbv is only valid if OSXSAVE (part of v3_ecx1) is set.
+    xcr0 = (unsigned int)(_xgetbv(0));
+  }
+#else
+#error "WUFFS_BASE__CPU_ARCH__ETC combined with an unsupported compiler"
+#endif  // defined(__GNUC__); defined(_MSC_VER)
+
+  if (((ecx1 & v3_ecx1) != v3_ecx1) || ((ebx7 & v3_ebx7) != v3_ebx7) ||
+      ((ecx8 & v3_ecx8) != v3_ecx8) || ((xcr0 & v3_xcr0) != v3_xcr0)) {
+    return 0;
+  } else if (((ebx7 & v4_ebx7) != v4_ebx7) || ((xcr0 & v4_xcr0) != v4_xcr0)) {
+    return 3;
+  }
+  return 4;
+#else
+  return 0;
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+}
+
+// wuffs_base__cpu_arch__x86_64_level_cached is like
+// wuffs_base__cpu_arch__x86_64_level but only runs the cpuid and xgetbv
+// instructions once, as they can be slow (especially under virtualization)
+// and choose statements can run on every call to a decoder method.
+//
+// The cache holds the level plus 1, so that 0 means not yet detected.
+// Concurrent first calls may each detect the level, but they will all store
+// the same value.
+static inline int  //
+wuffs_base__cpu_arch__x86_64_level_cached() {
+#if defined(__GNUC__)
+  static int cache = 0;
+  int c = __atomic_load_n(&cache, __ATOMIC_RELAXED);
+  if (c == 0) {
+    c = 1 + wuffs_base__cpu_arch__x86_64_level();
+    __atomic_store_n(&cache, c, __ATOMIC_RELAXED);
+  }
+#else
+  static volatile int cache = 0;
+  int c = cache;
+  if (c == 0) {
+    c = 1 + wuffs_base__cpu_arch__x86_64_level();
+    cache = c;
+  }
+#endif
+  return c - 1;
+}
+
+static inline bool  //
+wuffs_base__cpu_arch__have_x86_64_v3() {
+  return wuffs_base__cpu_arch__x86_64_level_cached() >= 3;
+}
+
+static inline bool  //
+wuffs_base__cpu_arch__have_x86_64_v4() {
+  return wuffs_base__cpu_arch__x86_64_level_cached() >= 4;
+}
+
 static inline bool  //
 wuffs_base__cpu_arch__have_x86_sse42() {
 #if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
@@ -474,6 +650,33 @@ typedef struct wuffs_base__transform__output__struct {
 
 // --------
 
+// wuffs_base__stats_counters are one method's statistics. They are only
+// updated when WUFFS_CONFIG__ENABLE_STATS is defined.
+//
+// num_calls counts every call, including those that resume a suspended
+// coroutine. num_suspensions and num_ticks are only updated for coroutines.
+// num_ticks is inclusive: it includes the time spent in any callees.
+typedef struct wuffs_base__stats_counters__struct {
+  uint64_t num_calls;
+  uint64_t num_suspensions;
+  uint64_t num_ticks;
+} wuffs_base__stats_counters;
+
+// wuffs_base__stats are one Wuffs object's statistics, as returned by the
+// wuffs_foo__bar__stats functions. The func_names and func_counters arrays
+// both have num_funcs elements. func_counters points into the Wuffs object
+// and so is only valid for as long as that object is.
+typedef struct wuffs_base__stats__struct {
+  const char* struct_name;
+  uint64_t num_src_bytes;
+  uint64_t num_dst_bytes;
+  size_t num_funcs;
+  const char* const* func_names;
+  const wuffs_base__stats_counters* func_counters;
+} wuffs_base__stats;
+
+// --------
+
 // FourCC constants. Four Character Codes are literally four ASCII characters
 // (sometimes padded with ' ' spaces) that pack neatly into a signed or
 // unsigned 32-bit integer. ASCII letters are conventionally upper case.
@@ -0,0 +1,33 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ---------------- Byte Swapping
+
+// wuffs_base__byte_swap__copy copies from src to dst, reversing the byte order
+// of each element_size-byte element. For example, with an element_size of 4,
+// it converts an array of big-endian uint32_t values to little-endian or vice
+// versa. The element_size must be 1, 2, 4, 8 or 16.
+//
+// It copies only whole elements, as many as fit in both dst and src, and
+// returns the number of bytes copied. It returns zero if element_size is
+// invalid. The dst and src slices may be equal (an in-place swap) but must not
+// otherwise overlap.
+//
+// For modular builds that divide the base module into sub-modules, using this
+// function requires the WUFFS_CONFIG__MODULE__BASE__INTCONV sub-module, not
+// just WUFFS_CONFIG__MODULE__BASE__CORE.
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__byte_swap__copy(wuffs_base__slice_u8 dst,
+                            wuffs_base__slice_u8 src,
+                            uint32_t element_size);
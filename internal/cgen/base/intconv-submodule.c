@@ -895,3 +895,127 @@ done:
   o.num_src = (size_t)(s_ptr - src.ptr);
   return o;
 }
+
+// ---------------- Byte Swapping
+
+// ‼ WUFFS MULTI-FILE SECTION +x86_sse42
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET("pclmul,popcnt,sse4.2")
+static size_t  //
+wuffs_base__byte_swap__copy__sse42(uint8_t* dst_ptr,
+                                   const uint8_t* src_ptr,
+                                   size_t len,
+                                   uint32_t element_size) {
+  uint8_t* d = dst_ptr;
+  const uint8_t* s = src_ptr;
+  size_t n = len / 16;
+
+  __m128i shuffle;
+  switch (element_size) {
+    case 2:
+      shuffle = _mm_set_epi8(+0x0E, +0x0F, +0x0C, +0x0D,  //
+                             +0x0A, +0x0B, +0x08, +0x09,  //
+                             +0x06, +0x07, +0x04, +0x05,  //
+                             +0x02, +0x03, +0x00, +0x01);
+      break;
+    case 4:
+      shuffle = _mm_set_epi8(+0x0C, +0x0D, +0x0E, +0x0F,  //
+                             +0x08, +0x09, +0x0A, +0x0B,  //
+                             +0x04, +0x05, +0x06, +0x07,  //
+                             +0x00, +0x01, +0x02, +0x03);
+      break;
+    case 8:
+      shuffle = _mm_set_epi8(+0x08, +0x09, +0x0A, +0x0B,  //
+                             +0x0C, +0x0D, +0x0E, +0x0F,  //
+                             +0x00, +0x01, +0x02, +0x03,  //
+                             +0x04, +0x05, +0x06, +0x07);
+      break;
+    default:
+      shuffle = _mm_set_epi8(+0x00, +0x01, +0x02, +0x03,  //
+                             +0x04, +0x05, +0x06, +0x07,  //
+                             +0x08, +0x09, +0x0A, +0x0B,  //
+                             +0x0C, +0x0D, +0x0E, +0x0F);
+      break;
+  }
+
+  while (n--) {
+    __m128i x;
+    x = _mm_lddqu_si128((const __m128i*)(const void*)s);
+    x = _mm_shuffle_epi8(x, shuffle);
+    _mm_storeu_si128((__m128i*)(void*)d, x);
+
+    s += 16;
+    d += 16;
+  }
+  return len - (len % 16);
+}
+#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+// ‼ WUFFS MULTI-FILE SECTION -x86_sse42
+
+WUFFS_BASE__MAYBE_STATIC size_t  //
+wuffs_base__byte_swap__copy(wuffs_base__slice_u8 dst,
+                            wuffs_base__slice_u8 src,
+                            uint32_t element_size) {
+  switch (element_size) {
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+    case 16:
+      break;
+    default:
+      return 0;
+  }
+
+  size_t len = (dst.len < src.len) ? dst.len : src.len;
+  len -= len % element_size;
+  uint8_t* d = dst.ptr;
+  const uint8_t* s = src.ptr;
+  size_t n = len;
+
+  if (element_size == 1) {
+    if (d != s) {
+      memmove(d, s, len);
+    }
+    return len;
+  }
+
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+  if (wuffs_base__cpu_arch__have_x86_sse42()) {
+    size_t m = wuffs_base__byte_swap__copy__sse42(d, s, n, element_size);
+    d += m;
+    s += m;
+    n -= m;
+  }
+#endif
+
+  switch (element_size) {
+    case 2:
+      for (; n >= 2; n -= 2, d += 2, s += 2) {
+        wuffs_base__poke_u16le__no_bounds_check(
+            d, wuffs_base__peek_u16be__no_bounds_check(s));
+      }
+      break;
+    case 4:
+      for (; n >= 4; n -= 4, d += 4, s += 4) {
+        wuffs_base__poke_u32le__no_bounds_check(
+            d, wuffs_base__peek_u32be__no_bounds_check(s));
+      }
+      break;
+    case 8:
+      for (; n >= 8; n -= 8, d += 8, s += 8) {
+        wuffs_base__poke_u64le__no_bounds_check(
+            d, wuffs_base__peek_u64be__no_bounds_check(s));
+      }
+      break;
+    case 16:
+      for (; n >= 16; n -= 16, d += 16, s += 16) {
+        uint64_t lo = wuffs_base__peek_u64be__no_bounds_check(s + 0);
+        uint64_t hi = wuffs_base__peek_u64be__no_bounds_check(s + 8);
+        wuffs_base__poke_u64le__no_bounds_check(d + 0, hi);
+        wuffs_base__poke_u64le__no_bounds_check(d + 8, lo);
+      }
+      break;
+  }
+  return len;
+}
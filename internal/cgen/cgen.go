@@ -352,6 +352,8 @@ func insertBaseAllPublicH(buf *buffer) error {
 	buf.writes(embedBaseImagePublicH.Trim())
 	buf.writeb('\n')
 	buf.writes(embedBaseStrConvPublicH.Trim())
+	buf.writeb('\n')
+	buf.writes(embedBaseIntConvPublicH.Trim())
 	return nil
 }
 
@@ -587,6 +589,22 @@ type gen struct {
 	funks    map[t.QQID]funk
 
 	numPublicCoroutines map[t.QID]uint32
+
+	// statsFuncs lists, per classy struct, the methods that are counted when
+	// WUFFS_CONFIG__ENABLE_STATS is defined. statsFuncIndexes maps from a
+	// method to its index in that list.
+	statsFuncs       map[t.QID][]*a.Func
+	statsFuncIndexes map[t.QQID]int
+
+	// multiversionFuncs are the choosy functions whose choose statements list
+	// that function itself. Their default implementations are also compiled
+	// for each of the multiversions feature levels.
+	multiversionFuncs map[t.QQID]struct{}
+
+	// otherChoiceFuncs are the choosy functions whose choose statements list
+	// any function other than that function itself, such as a CPU-arch
+	// specific implementation or a sibling chosen at run time.
+	otherChoiceFuncs map[t.QQID]struct{}
 }
 
 func (g *gen) generate() ([]byte, error) {
@@ -643,6 +661,18 @@ func (g *gen) generate() ([]byte, error) {
 		}
 	}
 
+	g.statsFuncs = map[t.QID][]*a.Func{}
+	g.statsFuncIndexes = map[t.QQID]int{}
+	if err := g.forEachFunc(nil, bothPubPri, (*gen).gatherStatsFunc); err != nil {
+		return nil, err
+	}
+
+	g.multiversionFuncs = map[t.QQID]struct{}{}
+	g.otherChoiceFuncs = map[t.QQID]struct{}{}
+	if err := g.forEachFunc(nil, bothPubPri, (*gen).gatherMultiversionFuncs); err != nil {
+		return nil, err
+	}
+
 	g.funks = map[t.QQID]funk{}
 	if err := g.forEachFunc(nil, bothPubPri, (*gen).gatherFuncImpl); err != nil {
 		return nil, err
@@ -1139,6 +1169,15 @@ func (g *gen) writeStructPrivateImpl(b *buffer, n *a.Struct) error {
 			}
 		}
 	}
+	if n.Classy() {
+		b.writes("\n#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+		b.writes("uint64_t stats_num_src_bytes;\n")
+		b.writes("uint64_t stats_num_dst_bytes;\n")
+		if fs := g.statsFuncs[n.QID()]; len(fs) > 0 {
+			b.printf("wuffs_base__stats_counters stats_funcs[%d];\n", len(fs))
+		}
+		b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	}
 	b.writes("} private_impl;\n\n")
 
 	{
@@ -1292,6 +1331,13 @@ func (g *gen) writeCppMethods(b *buffer, n *a.Struct) error {
 		b.printf("}\n\n")
 	}
 
+	if n.Classy() {
+		b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+		b.writes("inline size_t\nstats(\nwuffs_base__stats* dst_ptr,\nsize_t dst_len) const {\n")
+		b.printf("return %s%s__stats(this, dst_ptr, dst_len);\n}\n", g.pkgPrefix, structName)
+		b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+	}
+
 	structID := n.QID()[1]
 	for _, file := range g.files {
 		for _, tld := range file.TopLevelDecls() {
@@ -1386,6 +1432,87 @@ func (g *gen) writeSizeofSignature(b *buffer, n *a.Struct) error {
 	return nil
 }
 
+// writeStatsSignature writes the signature of the wuffs_foo__bar__stats
+// function. It copies up to dst_len wuffs_base__stats to dst_ptr (this
+// object's first, then those of any sub-objects, depth first) and returns the
+// number that would be copied if dst_len was unlimited.
+func (g *gen) writeStatsSignature(b *buffer, n *a.Struct) error {
+	structName := n.QID().Str(g.tm)
+	if !n.Public() {
+		b.writes("static ")
+	}
+	b.printf("size_t\n"+
+		"%s%s__stats(\n"+
+		"    const %s%s* self,\n"+
+		"    wuffs_base__stats* dst_ptr,\n"+
+		"    size_t dst_len)",
+		g.pkgPrefix, structName, g.pkgPrefix, structName)
+	return nil
+}
+
+func (g *gen) writeStatsImpl(b *buffer, n *a.Struct) error {
+	structName := n.QID().Str(g.tm)
+	fs := g.statsFuncs[n.QID()]
+
+	b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	if len(fs) > 0 {
+		b.printf("static const char* const %s%s__stats_func_names[%d] = {\n",
+			g.pkgPrefix, structName, len(fs))
+		for _, f := range fs {
+			b.printf("\"%s.%s\",\n", g.pkgName, f.QQID().Str(g.tm))
+		}
+		b.writes("};\n\n")
+	}
+
+	if err := g.writeStatsSignature(b, n); err != nil {
+		return err
+	}
+	b.writes(" {\n")
+	b.writes("if (!self) {\nreturn 0;\n}\n")
+	b.writes("size_t n = 1;\n")
+	b.writes("if (dst_len > 0) {\n")
+	b.printf("dst_ptr->struct_name = \"%s.%s\";\n", g.pkgName, structName)
+	b.writes("dst_ptr->num_src_bytes = self->private_impl.stats_num_src_bytes;\n")
+	b.writes("dst_ptr->num_dst_bytes = self->private_impl.stats_num_dst_bytes;\n")
+	b.printf("dst_ptr->num_funcs = %d;\n", len(fs))
+	if len(fs) > 0 {
+		b.printf("dst_ptr->func_names = %s%s__stats_func_names;\n", g.pkgPrefix, structName)
+		b.writes("dst_ptr->func_counters = self->private_impl.stats_funcs;\n")
+	} else {
+		b.writes("dst_ptr->func_names = NULL;\n")
+		b.writes("dst_ptr->func_counters = NULL;\n")
+	}
+	b.writes("}\n")
+
+	// Recurse into sub-structs, the same ones that the initializer calls
+	// initialize on.
+	for _, f := range n.Fields() {
+		f := f.AsField()
+		x := f.XType()
+		if x != x.Innermost() {
+			continue
+		}
+		prefix := g.pkgPrefix
+		qid := x.QID()
+		if qid[0] == t.IDBase {
+			continue
+		} else if qid[0] != 0 {
+			prefix = "wuffs_" + g.tm.ByID(qid[0]) + "__"
+		} else if g.structMap[qid] == nil {
+			continue
+		}
+		b.printf("n += %s%s__stats(\n&self->private_data.%s%s,\n"+
+			"(n < dst_len) ? (dst_ptr + n) : NULL,\n"+
+			"(n < dst_len) ? (dst_len - n) : 0);\n",
+			prefix, qid[1].Str(g.tm), fPrefix, f.Name().Str(g.tm))
+	}
+
+	b.writes("return n;\n")
+	b.writes("}\n")
+	b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+	return nil
+}
+
 func (g *gen) writeInitializerPrototype(b *buffer, n *a.Struct) error {
 	if !n.Classy() {
 		return nil
@@ -1401,6 +1528,12 @@ func (g *gen) writeInitializerPrototype(b *buffer, n *a.Struct) error {
 		}
 		b.writes(";\n\n")
 	}
+
+	b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	if err := g.writeStatsSignature(b, n); err != nil {
+		return err
+	}
+	b.writes(";\n#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
 	return nil
 }
 
@@ -1530,5 +1663,5 @@ func (g *gen) writeInitializerImpl(b *buffer, n *a.Struct) error {
 		}
 		b.printf(" {\nreturn sizeof(%s%s);\n}\n\n", g.pkgPrefix, structName)
 	}
-	return nil
+	return g.writeStatsImpl(b, n)
 }
@@ -59,6 +59,9 @@ var embedBaseImagePrivateH EmbeddedString
 //go:embed base/image-public.h
 var embedBaseImagePublicH EmbeddedString
 
+//go:embed base/intconv-public.h
+var embedBaseIntConvPublicH EmbeddedString
+
 //go:embed base/io-private.h
 var embedBaseIOPrivateH EmbeddedString
 
@@ -15,6 +15,7 @@
 package cgen
 
 import (
+	"bytes"
 	"fmt"
 	"math/big"
 	"strconv"
@@ -88,6 +89,12 @@ const (
 )
 
 func (g *gen) writeFuncSignature(b *buffer, n *a.Func, wfs uint32) error {
+	return g.writeFuncSignatureChoosy(b, n, wfs, "default")
+}
+
+// writeFuncSignatureChoosy is like writeFuncSignature but, for the
+// wfsCDeclChoosy mode, names the "__choosy_etc" variant.
+func (g *gen) writeFuncSignatureChoosy(b *buffer, n *a.Func, wfs uint32, choosyName string) error {
 	switch wfs {
 	case wfsCDecl:
 		if n.Public() {
@@ -130,7 +137,8 @@ func (g *gen) writeFuncSignature(b *buffer, n *a.Func, wfs uint32) error {
 	case wfsCDecl, wfsCDeclChoosy:
 		b.writes(g.funcCName(n))
 		if wfs == wfsCDeclChoosy {
-			b.writes("__choosy_default")
+			b.writes("__choosy_")
+			b.writes(choosyName)
 		}
 		b.writeb('(')
 		if r := n.Receiver(); !r.IsZero() {
@@ -223,6 +231,17 @@ func (g *gen) writeFuncPrototype(b *buffer, n *a.Func) error {
 		}
 		b.writes(";\n\n")
 	}
+	if _, ok := g.multiversionFuncs[n.QQID()]; ok {
+		b.writes("#if defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n")
+		for _, mv := range multiversions {
+			b.printf("%s\n", mv.attribute)
+			if err := g.writeFuncSignatureChoosy(b, n, wfsCDeclChoosy, mv.name); err != nil {
+				return err
+			}
+			b.writes(";\n")
+		}
+		b.writes("#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n\n")
+	}
 	return nil
 }
 
@@ -250,11 +269,26 @@ func (g *gen) writeFuncImpl(b *buffer, n *a.Func) error {
 	b.writes(" {\n")
 
 	if n.Choosy() {
+		// When a multiversionFuncs function's only alternatives are its own
+		// multiversions, call the default directly (without them) instead of
+		// through the function pointer. Other choices, such as LZW's
+		// read_from_msb, are made at run time and need the pointer.
+		_, mv := g.multiversionFuncs[n.QQID()]
+		if _, other := g.otherChoiceFuncs[n.QQID()]; other {
+			mv = false
+		}
+		if mv {
+			b.writes("#if defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n")
+		}
 		b.printf("return (*self->private_impl.choosy_%s)(self", n.FuncName().Str(g.tm))
-		for _, o := range n.In().Fields() {
-			b.printf(", %s%s", aPrefix, o.AsField().Name().Str(g.tm))
+		g.writeFuncTrampolineArgs(b, n)
+		if mv {
+			b.writes("#else\n")
+			b.printf("return %s__choosy_default(self", g.funcCName(n))
+			g.writeFuncTrampolineArgs(b, n)
+			b.writes("#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n")
 		}
-		b.writes(");\n}\n\n")
+		b.writes("}\n\n")
 
 		if err := g.writeFuncSignature(b, n, wfsCDeclChoosy); err != nil {
 			return err
@@ -262,6 +296,43 @@ func (g *gen) writeFuncImpl(b *buffer, n *a.Func) error {
 		b.writes(" {\n")
 	}
 
+	g.writeFuncImplBodies(b, n, &k)
+	if caMacro != "" {
+		b.printf("#endif  // defined(WUFFS_BASE__CPU_ARCH__%s)\n", caMacro)
+	}
+	if caName != "" {
+		b.printf("// ‼ WUFFS MULTI-FILE SECTION -%s\n", caName)
+	}
+	b.writes("\n")
+
+	if _, ok := g.multiversionFuncs[n.QQID()]; ok {
+		b.writes("#if defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n")
+		for _, mv := range multiversions {
+			b.printf("%s\n", mv.attribute)
+			if err := g.writeFuncSignatureChoosy(b, n, wfsCDeclChoosy, mv.name); err != nil {
+				return err
+			}
+			b.writes(" {\n")
+			g.writeFuncImplBodies(b, n, &k)
+			b.writes("\n")
+		}
+		b.writes("#endif  // defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n\n")
+	}
+	return nil
+}
+
+// writeFuncTrampolineArgs writes the rest of a choosy function's forwarding
+// call: the arguments after "self", the closing paren and the semicolon.
+func (g *gen) writeFuncTrampolineArgs(b *buffer, n *a.Func) {
+	for _, o := range n.In().Fields() {
+		b.printf(", %s%s", aPrefix, o.AsField().Name().Str(g.tm))
+	}
+	b.writes(");\n")
+}
+
+// writeFuncImplBodies writes the function body (after the opening brace) and
+// closing brace, shared by a choosy function's default and multiversions.
+func (g *gen) writeFuncImplBodies(b *buffer, n *a.Func, k *funk) {
 	if (len(n.Body()) != 0) || n.Effect().Coroutine() || (n.Out() != nil) {
 		b.writex(k.bPrologue)
 		if n.Effect().Coroutine() {
@@ -277,13 +348,23 @@ func (g *gen) writeFuncImpl(b *buffer, n *a.Func) error {
 
 	b.writex(k.bEpilogue)
 	b.writes("}\n")
-	if caMacro != "" {
-		b.printf("#endif  // defined(WUFFS_BASE__CPU_ARCH__%s)\n", caMacro)
-	}
-	if caName != "" {
-		b.printf("// ‼ WUFFS MULTI-FILE SECTION -%s\n", caName)
+}
+
+func (g *gen) gatherStatsFunc(_ *buffer, n *a.Func) error {
+	if n.Receiver().IsZero() || (n.Receiver()[0] != 0) {
+		return nil
+	} else if s := g.structMap[n.Receiver()]; (s == nil) || !s.Classy() {
+		return nil
+	} else if n.Effect().Pure() {
+		// Pure methods take a const receiver, so they cannot update counters.
+		return nil
+	} else if (len(n.Body()) == 0) && !n.Effect().Coroutine() && (n.Out() == nil) {
+		// writeFuncImpl writes no prologue or epilogue for such functions.
+		return nil
 	}
-	b.writes("\n")
+	fs := g.statsFuncs[n.Receiver()]
+	g.statsFuncIndexes[n.QQID()] = len(fs)
+	g.statsFuncs[n.Receiver()] = append(fs, n)
 	return nil
 }
 
@@ -463,6 +544,73 @@ func (g *gen) writeFuncImplPrologue(b *buffer) error {
 		}
 		b.writes("\n")
 	}
+
+	return g.writeFuncImplStatsPrologue(b)
+}
+
+// statsIOArgs returns the names of a public coroutine's io_reader and
+// io_writer arguments, whose bytes read and written are counted when
+// WUFFS_CONFIG__ENABLE_STATS is defined.
+func (g *gen) statsIOArgs() (readers []string, writers []string) {
+	n := g.currFunk.astFunc
+	if !n.Public() || !n.Effect().Coroutine() {
+		return nil, nil
+	}
+	for _, o := range n.In().Fields() {
+		o := o.AsField()
+		if typ := o.XType(); typ.Decorator() == 0 {
+			switch typ.QID() {
+			case t.QID{t.IDBase, t.IDIOReader}:
+				readers = append(readers, o.Name().Str(g.tm))
+			case t.QID{t.IDBase, t.IDIOWriter}:
+				writers = append(writers, o.Name().Str(g.tm))
+			}
+		}
+	}
+	return readers, writers
+}
+
+func (g *gen) writeFuncImplStatsPrologue(b *buffer) error {
+	index, ok := g.statsFuncIndexes[g.currFunk.astFunc.QQID()]
+	if !ok {
+		return nil
+	}
+	b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	b.printf("self->private_impl.stats_funcs[%d].num_calls++;\n", index)
+	if g.currFunk.astFunc.Effect().Coroutine() {
+		b.writes("const uint64_t stats_ticks = WUFFS_CONFIG__STATS__TICKS();\n")
+		readers, writers := g.statsIOArgs()
+		for _, o := range readers {
+			b.printf("const uint64_t stats_%s%s = %s%s->meta.ri;\n", aPrefix, o, aPrefix, o)
+		}
+		for _, o := range writers {
+			b.printf("const uint64_t stats_%s%s = %s%s->meta.wi;\n", aPrefix, o, aPrefix, o)
+		}
+	}
+	b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
+	return nil
+}
+
+func (g *gen) writeFuncImplStatsEpilogue(b *buffer) error {
+	index, ok := g.statsFuncIndexes[g.currFunk.astFunc.QQID()]
+	if !ok || !g.currFunk.astFunc.Effect().Coroutine() {
+		return nil
+	}
+	b.writes("#if defined(WUFFS_CONFIG__ENABLE_STATS)\n")
+	b.printf("if (wuffs_base__status__is_suspension(&status)) {\n"+
+		"self->private_impl.stats_funcs[%d].num_suspensions++;\n}\n", index)
+	b.printf("self->private_impl.stats_funcs[%d].num_ticks +=\n"+
+		"WUFFS_CONFIG__STATS__TICKS() - stats_ticks;\n", index)
+	readers, writers := g.statsIOArgs()
+	for _, o := range readers {
+		b.printf("self->private_impl.stats_num_src_bytes += %s%s->meta.ri - stats_%s%s;\n",
+			aPrefix, o, aPrefix, o)
+	}
+	for _, o := range writers {
+		b.printf("self->private_impl.stats_num_dst_bytes += %s%s->meta.wi - stats_%s%s;\n",
+			aPrefix, o, aPrefix, o)
+	}
+	b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_STATS)\n\n")
 	return nil
 }
 
@@ -482,6 +630,18 @@ func (g *gen) writeFuncImplBodyResume(b *buffer) error {
 			b.writes("}\n")
 		}
 
+		if readers := g.fastEntryReaders(); len(readers) > 0 {
+			b.writes("#if defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)\n")
+			b.writes("if (!coro_susp_point")
+			for _, o := range readers {
+				b.printf(" && %s%s && %s%s->meta.closed", aPrefix, o, aPrefix, o)
+			}
+			b.writes(") {\n")
+			b.writex(fastEntryBody(g.currFunk.bBody))
+			b.writes("goto ok;\n}\n")
+			b.writes("#endif  // defined(WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY)\n\n")
+		}
+
 		// Generate a coroutine switch similiar to the technique in
 		// https://www.chiark.greenend.org.uk/~sgtatham/coroutines.html
 		//
@@ -491,6 +651,37 @@ func (g *gen) writeFuncImplBodyResume(b *buffer) error {
 	return nil
 }
 
+// fastEntryReaders returns the names of a coroutine's io_reader arguments. If
+// there are any, and WUFFS_CONFIG__ENABLE_CLOSED_INPUT_FAST_ENTRY is defined,
+// a call that starts (instead of resumes) the coroutine with all of them
+// closed runs a copy of the function body that is outside of the coroutine
+// switch. Its loops have no case labels jumping into their middle, which lets
+// the C compiler optimize them (e.g. keep locals in registers) as usual.
+//
+// The copy is otherwise the same code. If it suspends (e.g. on a short write)
+// then it sets coro_susp_point and saves its resumable locals like the
+// original and the next call resumes in the original (the coroutine switch).
+func (g *gen) fastEntryReaders() (readers []string) {
+	for _, o := range g.currFunk.astFunc.In().Fields() {
+		o := o.AsField()
+		if typ := o.XType(); (typ.Decorator() == 0) &&
+			(typ.QID() == t.QID{t.IDBase, t.IDIOReader}) {
+			readers = append(readers, o.Name().Str(g.tm))
+		}
+	}
+	return readers
+}
+
+// fastEntryBody returns a copy of a coroutine's body for its fast entry (see
+// fastEntryReaders), with its own loop labels and with suspension points that
+// are not case labels.
+func fastEntryBody(body buffer) []byte {
+	s := bytes.ReplaceAll(body,
+		[]byte("WUFFS_BASE__COROUTINE_SUSPENSION_POINT"),
+		[]byte("WUFFS_BASE__FAST_ENTRY_SUSPENSION_POINT"))
+	return bytes.ReplaceAll(s, []byte("label__"), []byte("label__fast__"))
+}
+
 func (g *gen) writeFuncImplBody(b *buffer) error {
 	for _, o := range g.currFunk.astFunc.Body() {
 		if err := g.writeStatement(b, o, 0); err != nil {
@@ -565,6 +756,9 @@ func (g *gen) writeFuncImplEpilogue(b *buffer) error {
 		b.writes("\n")
 	}
 
+	if err := g.writeFuncImplStatsEpilogue(b); err != nil {
+		return err
+	}
 	b.writes(epilogue)
 	return nil
 }
@@ -243,6 +243,14 @@ func (g *gen) writeStatementChoose(b *buffer, n *a.Choose, depth uint32) error {
 			return err
 		}
 		if caMacro == "" {
+			if _, ok := g.multiversionFuncs[t.QQID{recv[0], recv[1], id}]; ok && (n.Name() == id) {
+				b.writes("#if defined(WUFFS_BASE__CPU_ARCH__X86_MULTIVERSION)\n")
+				for _, mv := range multiversions {
+					b.printf("wuffs_base__cpu_arch__have_%s() ? &%s%s__%s__choosy_%s :\n",
+						mv.name, g.pkgPrefix, recv.Str(g.tm), id.Str(g.tm), mv.name)
+				}
+				b.writes("#endif\n")
+			}
 			b.printf("&%s%s__%s%s", g.pkgPrefix, recv.Str(g.tm), id.Str(g.tm), suffix)
 			conclusive = true
 			break
@@ -260,6 +268,40 @@ func (g *gen) writeStatementChoose(b *buffer, n *a.Choose, depth uint32) error {
 	return nil
 }
 
+// multiversions are the x86-64 feature levels, most capable first, that a
+// multiversionFuncs function's default implementation is also compiled for,
+// when WUFFS_CONFIG__ENABLE_MULTIVERSIONING is defined.
+var multiversions = [...]struct {
+	name      string
+	attribute string
+}{{
+	"x86_64_v4",
+	"WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET(\"avx,avx2,bmi,bmi2,f16c,fma,lzcnt,movbe,popcnt,sse4.2," +
+		"avx512f,avx512bw,avx512cd,avx512dq,avx512vl\")",
+}, {
+	"x86_64_v3",
+	"WUFFS_BASE__MAYBE_ATTRIBUTE_TARGET(\"avx,avx2,bmi,bmi2,f16c,fma,lzcnt,movbe,popcnt,sse4.2\")",
+}}
+
+func (g *gen) gatherMultiversionFuncs(_ *buffer, n *a.Func) error {
+	return n.AsNode().Walk(func(o *a.Node) error {
+		if o.Kind() != a.KChoose {
+			return nil
+		}
+		c := o.AsChoose()
+		recv := n.Receiver()
+		qqid := t.QQID{recv[0], recv[1], c.Name()}
+		for _, arg := range c.Args() {
+			if arg.AsExpr().Ident() == c.Name() {
+				g.multiversionFuncs[qqid] = struct{}{}
+			} else {
+				g.otherChoiceFuncs[qqid] = struct{}{}
+			}
+		}
+		return nil
+	})
+}
+
 func cpuArchCNames(asserts []*a.Node) (caMacro string, caName string, caAttribute string, retErr error) {
 	match := false
 	for _, o := range asserts {
@@ -785,7 +785,10 @@ var funcsOther = [...]string{
 	"x86_m128i._mm_add_epi32(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_add_epi64(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_add_epi8(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_adds_epi8(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_adds_epu8(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_and_si128(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_andnot_si128(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_avg_epu16(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_avg_epu8(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_blend_epi16(b: x86_m128i, imm8: u32) x86_m128i",
@@ -813,6 +816,9 @@ var funcsOther = [...]string{
 	"x86_m128i._mm_min_epu16(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_min_epu32(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_min_epu8(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_mulhi_epi16(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_or_si128(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_packs_epi16(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_packus_epi16(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_sad_epu8(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_shuffle_epi32(imm8: u32) x86_m128i",
@@ -821,6 +827,7 @@ var funcsOther = [...]string{
 	"x86_m128i._mm_slli_epi32(imm8: u32) x86_m128i",
 	"x86_m128i._mm_slli_epi64(imm8: u32) x86_m128i",
 	"x86_m128i._mm_slli_si128(imm8: u32) x86_m128i",
+	"x86_m128i._mm_srai_epi16(imm8: u32) x86_m128i",
 	"x86_m128i._mm_srli_epi16(imm8: u32) x86_m128i",
 	"x86_m128i._mm_srli_epi32(imm8: u32) x86_m128i",
 	"x86_m128i._mm_srli_epi64(imm8: u32) x86_m128i",
@@ -829,6 +836,8 @@ var funcsOther = [...]string{
 	"x86_m128i._mm_sub_epi32(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_sub_epi64(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_sub_epi8(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_subs_epi8(b: x86_m128i) x86_m128i",
+	"x86_m128i._mm_subs_epu8(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_unpackhi_epi16(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_unpackhi_epi32(b: x86_m128i) x86_m128i",
 	"x86_m128i._mm_unpackhi_epi64(b: x86_m128i) x86_m128i",
@@ -0,0 +1,619 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+// bench-async-streams benchmarks decompressing many concurrent streams on a
+// single thread. Each stream runs a wuffs_aux::async_io::TransformIO coroutine
+// that suspends whenever its input runs dry and is resumed by a small event
+// loop when more input arrives. There are no threads.
+//
+// Its argument is a gzip or zlib file, such as test/data/pi.txt.gz. Every one
+// of the "-streams=N" (default 1000) streams decodes that same file, receiving
+// it in "-chunk=N" (default 4096) byte pieces and decoding into a "-dst=N"
+// (default 65536) byte buffer. The input comes from one of two stand-in
+// asynchronous sources:
+//  - By default, an in-memory source. The event loop visits the waiting
+//    streams round-robin, delivering one chunk to each, so that every chunk
+//    costs one coroutine suspension and resumption.
+//  - With the "-socket" flag (Linux only), a non-blocking AF_UNIX socketpair
+//    per stream, multiplexed by epoll. The event loop also writes the file
+//    into each socketpair's other end, one chunk per write. A read that would
+//    block suspends the stream until epoll says that it is readable.
+//
+// For comparison, it also reports decoding the same number of streams one
+// after another, each with a single (never suspending) transform_io call. The
+// difference between the two is the cost of interleaving: coroutine frames,
+// more transform_io calls and less cache locality.
+//
+// Each measurement is repeated 1+N times (for N from the "-reps=N" flag,
+// default 3) and the fastest of the N non-warm-up times is reported.
+//
+// To run:
+//
+// $CXX -O3 -std=c++20 bench-async-streams.cc -o bench-async-streams
+// ./bench-async-streams -streams=1000 ../test/data/pi.txt.gz
+
+#if defined(__cplusplus) && (__cplusplus < 202002L)
+#error "This C++ program requires -std=c++20 or later"
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define BENCH_ASYNC_STREAMS__HAVE_SOCKETS
+#endif
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__AUX__BASE
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__GZIP
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C++ file.
+#include "../release/c/wuffs-unsupported-snapshot.c"
+
+#if !defined(WUFFS_AUX__HAVE_COROUTINES)
+#error "This C++ program requires C++20 coroutine support"
+#endif
+
+using wuffs_aux::IOBuffer;
+using wuffs_aux::async_io::Task;
+
+// ----
+
+static struct {
+  size_t chunk;
+  size_t dst;
+  int reps;
+  bool socket;
+  int streams;
+  std::string filename;
+} g_flags;
+
+static const char* g_usage =
+    "Usage: bench-async-streams -flags gzip_or_zlib_file\n"
+    "\n"
+    "Flags:\n"
+    "    -chunk=N\n"
+    "    -dst=N\n"
+    "    -reps=N\n"
+    "    -socket\n"
+    "    -streams=N\n";
+
+static std::vector<uint8_t> g_src;
+static uint32_t g_fourcc = 0;
+
+// ----
+
+static wuffs_base__io_transformer::unique_ptr  //
+new_decoder() {
+  if (g_fourcc == WUFFS_BASE__FOURCC__GZ) {
+    return wuffs_gzip__decoder::alloc_as__wuffs_base__io_transformer();
+  }
+  return wuffs_zlib__decoder::alloc_as__wuffs_base__io_transformer();
+}
+
+// CountingOutput is an Output that discards its bytes, counting them. It never
+// suspends, as if the decoded bytes were consumed in memory.
+class CountingOutput : public wuffs_aux::async_io::Output {
+ public:
+  uint64_t m_count = 0;
+
+  bool StartCopyOut(IOBuffer* src,
+                    std::coroutine_handle<> /* h */,
+                    std::string* /* error_message */) override {
+    m_count += src->reader_length();
+    src->meta.ri = src->meta.wi;
+    return true;
+  }
+};
+
+// Stream holds one stream's decoder and buffers. Its Input is provided by the
+// event loop.
+struct Stream {
+  wuffs_base__io_transformer::unique_ptr dec;
+  std::unique_ptr<uint8_t[]> workbuf;
+  std::unique_ptr<uint8_t[]> dst_array;
+  std::unique_ptr<uint8_t[]> src_array;
+  wuffs_base__slice_u8 workbuf_slice;
+  IOBuffer dst;
+  IOBuffer src;
+  CountingOutput output;
+
+  Stream() : dec(new_decoder()) {
+    size_t n = (size_t)dec->workbuf_len().max_incl;
+    workbuf.reset(new uint8_t[n]);
+    workbuf_slice = wuffs_base__make_slice_u8(workbuf.get(), n);
+    dst_array.reset(new uint8_t[g_flags.dst]);
+    dst = wuffs_base__ptr_u8__writer(dst_array.get(), g_flags.dst);
+    src_array.reset(new uint8_t[g_flags.chunk]);
+    src = wuffs_base__ptr_u8__writer(src_array.get(), g_flags.chunk);
+  }
+};
+
+// ----
+
+// MemoryLoop is the in-memory stand-in event loop. StartCopyIn always
+// suspends, queueing the stream, and Run delivers one chunk per queued stream
+// in FIFO (round-robin) order.
+class MemoryLoop {
+ public:
+  class StreamInput : public wuffs_aux::async_io::Input {
+   public:
+    MemoryLoop* m_loop = nullptr;
+    size_t m_offset = 0;
+
+    bool StartCopyIn(IOBuffer* dst,
+                     std::coroutine_handle<> h,
+                     std::string* /* error_message */) override {
+      m_loop->m_queue.push_back({this, dst, h});
+      m_loop->m_num_suspensions++;
+      return false;
+    }
+  };
+
+  uint64_t m_num_suspensions = 0;
+
+  void Run() {
+    while (!m_queue.empty()) {
+      Pending p = m_queue.front();
+      m_queue.pop_front();
+      p.dst->compact();
+      size_t n = g_src.size() - p.input->m_offset;
+      if (n > p.dst->writer_length()) {
+        n = p.dst->writer_length();
+      }
+      memcpy(p.dst->writer_pointer(), g_src.data() + p.input->m_offset, n);
+      p.dst->meta.wi += n;
+      p.input->m_offset += n;
+      p.dst->meta.closed = p.input->m_offset == g_src.size();
+      p.h.resume();
+    }
+  }
+
+ private:
+  struct Pending {
+    StreamInput* input;
+    IOBuffer* dst;
+    std::coroutine_handle<> h;
+  };
+
+  std::deque<Pending> m_queue;
+};
+
+static std::string  //
+run_memory(uint64_t* dst_len, uint64_t* num_suspensions) {
+  std::vector<Stream> streams(g_flags.streams);
+  std::vector<MemoryLoop::StreamInput> inputs(g_flags.streams);
+  std::vector<Task> tasks;
+  tasks.reserve(g_flags.streams);
+  MemoryLoop loop;
+  for (int i = 0; i < g_flags.streams; i++) {
+    Stream& s = streams[i];
+    inputs[i].m_loop = &loop;
+    tasks.push_back(wuffs_aux::async_io::TransformIO(
+        s.dec.get(), s.output, inputs[i], s.dst, s.src, s.workbuf_slice));
+    tasks.back().Start();
+  }
+  loop.Run();
+
+  *dst_len = 0;
+  *num_suspensions = loop.m_num_suspensions;
+  for (int i = 0; i < g_flags.streams; i++) {
+    if (!tasks[i].Done()) {
+      return "stream did not finish";
+    } else if (!tasks[i].Result().empty()) {
+      return tasks[i].Result();
+    }
+    *dst_len += streams[i].output.m_count;
+  }
+  return "";
+}
+
+// ----
+
+#if defined(BENCH_ASYNC_STREAMS__HAVE_SOCKETS)
+
+// SocketLoop is the socketpair and epoll stand-in event loop.
+class SocketLoop {
+ public:
+  // StreamInput reads from the rfd end of a socketpair. The event loop writes
+  // to the wfd end.
+  class StreamInput : public wuffs_aux::async_io::Input {
+   public:
+    SocketLoop* m_loop = nullptr;
+    int m_rfd = -1;
+    int m_wfd = -1;
+    size_t m_written = 0;
+    IOBuffer* m_dst = nullptr;
+    std::coroutine_handle<> m_h;
+    std::string* m_error_message = nullptr;
+
+    ~StreamInput() {
+      if (m_rfd >= 0) {
+        close(m_rfd);
+      }
+      if (m_wfd >= 0) {
+        close(m_wfd);
+      }
+    }
+
+    // Read returns whether it made progress: bytes, end of file or an error.
+    bool Read(IOBuffer* dst, std::string* error_message) {
+      dst->compact();
+      ssize_t n = read(m_rfd, dst->writer_pointer(), dst->writer_length());
+      if (n > 0) {
+        dst->meta.wi += (size_t)n;
+        return true;
+      } else if (n == 0) {
+        dst->meta.closed = true;
+        return true;
+      } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+        return false;
+      }
+      *error_message = strerror(errno);
+      return true;
+    }
+
+    bool StartCopyIn(IOBuffer* dst,
+                     std::coroutine_handle<> h,
+                     std::string* error_message) override {
+      if (Read(dst, error_message)) {
+        return true;
+      }
+      m_dst = dst;
+      m_h = h;
+      m_error_message = error_message;
+      m_loop->Watch(m_rfd, EPOLLIN, this);
+      m_loop->m_num_suspensions++;
+      return false;
+    }
+  };
+
+  int m_epfd = -1;
+  int m_num_open_streams = 0;
+  uint64_t m_num_suspensions = 0;
+
+  ~SocketLoop() {
+    if (m_epfd >= 0) {
+      close(m_epfd);
+    }
+  }
+
+  void Watch(int fd, uint32_t events, StreamInput* input) {
+    struct epoll_event e = {};
+    e.events = events;
+    e.data.ptr = input;
+    epoll_ctl(m_epfd, EPOLL_CTL_MOD, fd, &e);
+  }
+
+  // Run returns when every stream's coroutine has finished.
+  std::string Run() {
+    struct epoll_event events[256];
+    while (m_num_open_streams > 0) {
+      int n = epoll_wait(m_epfd, events, 256, 1000);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return strerror(errno);
+      } else if (n == 0) {
+        return "timed out";
+      }
+      for (int i = 0; i < n; i++) {
+        StreamInput* input = static_cast<StreamInput*>(events[i].data.ptr);
+        if (events[i].events & EPOLLOUT) {
+          Write(input);
+        }
+        if ((events[i].events & (EPOLLIN | EPOLLHUP)) && input->m_h) {
+          if (input->Read(input->m_dst, input->m_error_message)) {
+            std::coroutine_handle<> h = input->m_h;
+            input->m_h = nullptr;
+            Watch(input->m_rfd, 0, input);
+            h.resume();
+            if (h.done()) {
+              epoll_ctl(m_epfd, EPOLL_CTL_DEL, input->m_rfd, nullptr);
+              m_num_open_streams--;
+            }
+          }
+        }
+      }
+    }
+    return "";
+  }
+
+ private:
+  void Write(StreamInput* input) {
+    size_t n = g_src.size() - input->m_written;
+    if (n > g_flags.chunk) {
+      n = g_flags.chunk;
+    }
+    ssize_t w = write(input->m_wfd, g_src.data() + input->m_written, n);
+    if (w > 0) {
+      input->m_written += (size_t)w;
+    }
+    if (input->m_written == g_src.size()) {
+      epoll_ctl(m_epfd, EPOLL_CTL_DEL, input->m_wfd, nullptr);
+      close(input->m_wfd);
+      input->m_wfd = -1;
+    }
+  }
+};
+
+static std::string  //
+run_socket(uint64_t* dst_len, uint64_t* num_suspensions) {
+  std::vector<Stream> streams(g_flags.streams);
+  std::vector<SocketLoop::StreamInput> inputs(g_flags.streams);
+  std::vector<Task> tasks;
+  tasks.reserve(g_flags.streams);
+  SocketLoop loop;
+  loop.m_epfd = epoll_create1(0);
+  if (loop.m_epfd < 0) {
+    return strerror(errno);
+  }
+  loop.m_num_open_streams = g_flags.streams;
+  for (int i = 0; i < g_flags.streams; i++) {
+    SocketLoop::StreamInput& input = inputs[i];
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0) {
+      return strerror(errno);
+    }
+    input.m_loop = &loop;
+    input.m_rfd = fds[0];
+    input.m_wfd = fds[1];
+    struct epoll_event e = {};
+    e.data.ptr = &input;
+    epoll_ctl(loop.m_epfd, EPOLL_CTL_ADD, input.m_rfd, &e);
+    e.events = EPOLLOUT;
+    epoll_ctl(loop.m_epfd, EPOLL_CTL_ADD, input.m_wfd, &e);
+  }
+  for (int i = 0; i < g_flags.streams; i++) {
+    Stream& s = streams[i];
+    tasks.push_back(wuffs_aux::async_io::TransformIO(
+        s.dec.get(), s.output, inputs[i], s.dst, s.src, s.workbuf_slice));
+    tasks.back().Start();
+  }
+  std::string err = loop.Run();
+  if (!err.empty()) {
+    return err;
+  }
+
+  *dst_len = 0;
+  *num_suspensions = loop.m_num_suspensions;
+  for (int i = 0; i < g_flags.streams; i++) {
+    if (!tasks[i].Done()) {
+      return "stream did not finish";
+    } else if (!tasks[i].Result().empty()) {
+      return tasks[i].Result();
+    }
+    *dst_len += streams[i].output.m_count;
+  }
+  return "";
+}
+
+#endif  // defined(BENCH_ASYNC_STREAMS__HAVE_SOCKETS)
+
+// ----
+
+// run_sequential decodes each stream with one transform_io call, into a dst
+// buffer big enough for the entire output. It never suspends.
+static std::string  //
+run_sequential(uint64_t* dst_len, uint64_t* num_suspensions) {
+  static std::vector<uint8_t> dst_array;
+  static std::vector<uint8_t> workbuf;
+  *dst_len = 0;
+  *num_suspensions = 0;
+  for (int i = 0; i < g_flags.streams; i++) {
+    wuffs_base__io_transformer::unique_ptr dec = new_decoder();
+    if (workbuf.empty()) {
+      workbuf.resize((size_t)dec->workbuf_len().max_incl);
+    }
+    while (true) {
+      IOBuffer src =
+          wuffs_base__ptr_u8__reader(g_src.data(), g_src.size(), true);
+      IOBuffer dst =
+          wuffs_base__ptr_u8__writer(dst_array.data(), dst_array.size());
+      wuffs_base__status status = dec->transform_io(
+          &dst, &src,
+          wuffs_base__make_slice_u8(workbuf.data(), workbuf.size()));
+      if (status.repr == nullptr) {
+        *dst_len += dst.meta.wi;
+        break;
+      } else if (status.repr != wuffs_base__suspension__short_write) {
+        return status.message();
+      }
+      // The dst buffer, re-used by every stream, is too small. Grow it and
+      // start this stream again.
+      dst_array.resize(2 * dst_array.size() + 65536);
+      dec = new_decoder();
+    }
+  }
+  return "";
+}
+
+// ----
+
+static void  //
+measure(const char* name,
+        std::string (*f)(uint64_t* dst_len, uint64_t* num_suspensions)) {
+  uint64_t best_nanos = UINT64_MAX;
+  uint64_t dst_len = 0;
+  uint64_t num_suspensions = 0;
+  for (int i = 0; i <= g_flags.reps; i++) {
+    auto start = std::chrono::steady_clock::now();
+    std::string err = f(&dst_len, &num_suspensions);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    if (!err.empty()) {
+      fprintf(stderr, "%s: %s\n", name, err.c_str());
+      return;
+    }
+    uint64_t nanos = (uint64_t)(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    if ((i > 0) && (best_nanos > nanos)) {
+      best_nanos = nanos;
+    }
+  }
+  double secs = (double)best_nanos / 1e9;
+  double src_mb = (double)(g_src.size() * (uint64_t)g_flags.streams) / 1e6;
+  double dst_mb = (double)dst_len / 1e6;
+  printf("%-10s  %6d streams  %9.3f ms  %8.2f MB/s (src)  %8.2f MB/s (dst)"
+         "  %10" PRIu64 " suspensions\n",
+         name, g_flags.streams, secs * 1e3, src_mb / secs, dst_mb / secs,
+         num_suspensions);
+}
+
+// ----
+
+static const char*  //
+parse_flags(int argc, char** argv) {
+  g_flags.chunk = 4096;
+  g_flags.dst = 65536;
+  g_flags.reps = 3;
+  g_flags.streams = 1000;
+
+  for (int c = 1; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg != '-') {
+      if (!g_flags.filename.empty()) {
+        return g_usage;
+      }
+      g_flags.filename = arg;
+      continue;
+    }
+    arg++;
+    if (*arg == '-') {
+      arg++;
+    }
+
+    if (!strncmp(arg, "chunk=", 6)) {
+      char* end = nullptr;
+      long int n = strtol(arg + 6, &end, 10);
+      if (*end || (n < 1) || (16777216 < n)) {
+        return "invalid -chunk=N value";
+      }
+      g_flags.chunk = (size_t)(n);
+      continue;
+    }
+    if (!strncmp(arg, "dst=", 4)) {
+      char* end = nullptr;
+      long int n = strtol(arg + 4, &end, 10);
+      if (*end || (n < 1) || (268435456 < n)) {
+        return "invalid -dst=N value";
+      }
+      g_flags.dst = (size_t)(n);
+      continue;
+    }
+    if (!strncmp(arg, "reps=", 5)) {
+      char* end = nullptr;
+      long int n = strtol(arg + 5, &end, 10);
+      if (*end || (n < 1) || (1000000 < n)) {
+        return "invalid -reps=N value";
+      }
+      g_flags.reps = (int)(n);
+      continue;
+    }
+    if (!strcmp(arg, "socket")) {
+      g_flags.socket = true;
+      continue;
+    }
+    if (!strncmp(arg, "streams=", 8)) {
+      char* end = nullptr;
+      long int n = strtol(arg + 8, &end, 10);
+      if (*end || (n < 1) || (1000000 < n)) {
+        return "invalid -streams=N value";
+      }
+      g_flags.streams = (int)(n);
+      continue;
+    }
+
+    return g_usage;
+  }
+
+  if (g_flags.filename.empty()) {
+    return g_usage;
+  }
+  return nullptr;
+}
+
+int  //
+main(int argc, char** argv) {
+  const char* z = parse_flags(argc, argv);
+  if (z) {
+    fprintf(stderr, "%s\n", z);
+    return 1;
+  }
+
+  std::ifstream f(g_flags.filename, std::ios::binary);
+  g_src.assign(std::istreambuf_iterator<char>(f),
+               std::istreambuf_iterator<char>());
+  if (!f.good() && !f.eof()) {
+    fprintf(stderr, "%s: could not read\n", g_flags.filename.c_str());
+    return 1;
+  }
+  int32_t fourcc = wuffs_base__magic_number_guess_fourcc(
+      wuffs_base__make_slice_u8(g_src.data(), g_src.size()), true);
+  if ((fourcc != WUFFS_BASE__FOURCC__GZ) &&
+      (fourcc != WUFFS_BASE__FOURCC__ZLIB)) {
+    fprintf(stderr, "%s: not a gzip or zlib file\n", g_flags.filename.c_str());
+    return 1;
+  }
+  g_fourcc = (uint32_t)fourcc;
+
+  measure("sequential", run_sequential);
+  if (g_flags.socket) {
+#if defined(BENCH_ASYNC_STREAMS__HAVE_SOCKETS)
+    measure("socket", run_socket);
+#else
+    fprintf(stderr, "-socket is not supported on this platform\n");
+    return 1;
+#endif
+  } else {
+    measure("memory", run_memory);
+  }
+  return 0;
+}
@@ -0,0 +1,934 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+// bench-corpus benchmarks decoding a corpus of real-world files, as opposed to
+// the small, curated test/data files that "wuffs bench" uses.
+//
+// Its arguments are files or directories (which are walked recursively). A
+// "-manifest=foo.txt" flag adds the files listed (one per line) in foo.txt.
+// Each file's format is guessed by wuffs_base__magic_number_guess_fourcc (or,
+// for JSON and CBOR, which don't have magic numbers, by a leading '{' or '['
+// byte or by a ".cbor" filename extension) and the file is decoded with the
+// wuffs_aux API (DecodeImage, DecodeJson or DecodeCbor) or, for compressed
+// formats (bzip2, gzip, zlib), a wuffs_base__io_transformer.
+//
+// Each file is decoded 1+N times (for N from the "-reps=N" flag, default 3)
+// and the fastest of the N non-warm-up decodes is recorded. Results are
+// summarized per (format, size bucket), where the size bucket is based on the
+// file's (compressed) size: throughput (in terms of both source and
+// destination bytes), the bytes allocated (pixel buffers, work buffers and
+// output buffers) and a histogram of per-file decode times.
+//
+// The "-json" flag prints JSON Lines (one object per file and one per
+// summary) instead of a human readable table.
+//
+// The "-transcode" flag converts JSON and CBOR files (with TranscodeJsonToCbor
+// and TranscodeCborToJson) instead of decoding them. Those results are
+// reported under the "json2cbor" and "cbor2json" formats.
+//
+// The "-qoi" flag also measures a decoded-pixel cache for each image file. The
+// decoded pixels are re-encoded (with EncodeImageQoi) and that QOI file is
+// decoded again, checking that the pixels round-trip. These are reported under
+// the "qoi-enc" and "qoi-dec" formats, next to the original format's decode
+// numbers. For comparison, "nie-enc" measures writing the same pixels as NIE
+// (with EncodeImageNie: a 16 byte header and one memcpy per row) and
+// "nie-map" measures serving them back with MapImage, which points a pixel
+// buffer into the NIE bytes instead of decoding them.
+//
+// To run:
+//
+// $CXX -O3 -std=c++17 bench-corpus.cc -o bench-corpus
+// ./bench-corpus -reps=5 /path/to/corpus/dir
+//
+// To also compare with third party libraries (libbz2, libpng and zlib), like
+// "wuffs bench -mimic" does, add the "-DWUFFS_MIMIC -lbz2
+// -lpng -lz" compiler flags. The summary will then also report each mimic
+// library's throughput and the Wuffs-versus-mimic speed ratio.
+
+#if defined(__cplusplus) && (__cplusplus < 201703L)
+#error "This C++ program requires -std=c++17 or later"
+#endif
+
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__AUX__BASE
+#define WUFFS_CONFIG__MODULE__AUX__CBOR
+#define WUFFS_CONFIG__MODULE__AUX__IMAGE
+#define WUFFS_CONFIG__MODULE__AUX__JSON
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__BMP
+#define WUFFS_CONFIG__MODULE__BZIP2
+#define WUFFS_CONFIG__MODULE__CBOR
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__GIF
+#define WUFFS_CONFIG__MODULE__GZIP
+#define WUFFS_CONFIG__MODULE__ICO
+#define WUFFS_CONFIG__MODULE__JPEG
+#define WUFFS_CONFIG__MODULE__JSON
+#define WUFFS_CONFIG__MODULE__LZW
+#define WUFFS_CONFIG__MODULE__NETPBM
+#define WUFFS_CONFIG__MODULE__NIE
+#define WUFFS_CONFIG__MODULE__PNG
+#define WUFFS_CONFIG__MODULE__QOI
+#define WUFFS_CONFIG__MODULE__TGA
+#define WUFFS_CONFIG__MODULE__TIFF
+#define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__WEBP
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C++ file.
+#include "../release/c/wuffs-unsupported-snapshot.c"
+
+#ifdef WUFFS_MIMIC
+#include "bzlib.h"
+#include "png.h"
+#include "zlib.h"
+#endif
+
+// ----
+
+#ifndef WORKBUF_ARRAY_SIZE
+#define WORKBUF_ARRAY_SIZE (64 * 1024 * 1024)
+#endif
+
+#ifndef DST_BUFFER_ARRAY_SIZE
+#define DST_BUFFER_ARRAY_SIZE (256 * 1024 * 1024)
+#endif
+
+static struct {
+  bool json;
+  bool qoi;
+  int reps;
+  bool transcode;
+  bool verbose;
+  std::vector<std::string> filenames;
+} g_flags;
+
+static const char* g_usage =
+    "Usage: bench-corpus -flags dirs_or_files...\n"
+    "\n"
+    "Flags:\n"
+    "    -json\n"
+    "    -manifest=FILENAME\n"
+    "    -qoi\n"
+    "    -reps=N\n"
+    "    -transcode\n"
+    "    -v\n";
+
+// ----
+
+// Result holds one file's decode measurements.
+struct Result {
+  std::string format;
+  uint64_t src_len = 0;
+  uint64_t dst_len = 0;
+  uint64_t alloc_len = 0;
+  uint64_t nanos = 0;
+  uint64_t mimic_nanos = 0;
+};
+
+static constexpr int g_num_size_buckets = 5;
+static const char* g_size_bucket_names[g_num_size_buckets] = {
+    "<4K", "<64K", "<1M", "<16M", ">=16M",
+};
+
+static int  //
+size_bucket(uint64_t n) {
+  if (n < (4 << 10)) {
+    return 0;
+  } else if (n < (64 << 10)) {
+    return 1;
+  } else if (n < (1 << 20)) {
+    return 2;
+  } else if (n < (16 << 20)) {
+    return 3;
+  }
+  return 4;
+}
+
+static constexpr int g_num_time_buckets = 7;
+static const char* g_time_bucket_names[g_num_time_buckets] = {
+    "<10us", "<100us", "<1ms", "<10ms", "<100ms", "<1s", ">=1s",
+};
+
+static int  //
+time_bucket(uint64_t nanos) {
+  uint64_t limit = 10000;
+  for (int i = 0; i < (g_num_time_buckets - 1); i++) {
+    if (nanos < limit) {
+      return i;
+    }
+    limit *= 10;
+  }
+  return g_num_time_buckets - 1;
+}
+
+// Summary accumulates the Results for one (format, size bucket) pair.
+struct Summary {
+  uint64_t num_files = 0;
+  uint64_t src_len = 0;
+  uint64_t dst_len = 0;
+  uint64_t alloc_len = 0;
+  uint64_t nanos = 0;
+  uint64_t mimic_nanos = 0;
+  uint64_t num_mimic_files = 0;
+  uint64_t mimic_src_len = 0;
+  uint64_t time_histogram[g_num_time_buckets] = {0};
+};
+
+static std::map<std::pair<std::string, int>, Summary> g_summaries;
+static uint64_t g_num_skipped_files = 0;
+static uint64_t g_num_failed_files = 0;
+
+static uint8_t g_workbuf_array[WORKBUF_ARRAY_SIZE];
+static uint8_t g_dst_buffer_array[DST_BUFFER_ARRAY_SIZE];
+
+static uint64_t  //
+now_nanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// measure calls fn 1+N times (for N from the "-reps=N" flag) and records the
+// fastest of the N non-warm-up calls in r->nanos.
+template <typename F>
+static std::string  //
+measure(Result* r, F fn) {
+  for (int i = 0; i <= g_flags.reps; i++) {
+    uint64_t t0 = now_nanos();
+    std::string err = fn();
+    uint64_t t1 = now_nanos();
+    if (!err.empty()) {
+      return err;
+    }
+    // The i == 0 call is a warm up.
+    if ((i == 1) || ((i > 1) && (r->nanos > (t1 - t0)))) {
+      r->nanos = t1 - t0;
+    }
+  }
+  return "";
+}
+
+// ----
+
+// ImageCallbacks decodes to BGRA_NONPREMUL (libpng's simplified API's closest
+// equivalent, for a fair mimic comparison) and counts the bytes allocated.
+class ImageCallbacks : public wuffs_aux::DecodeImageCallbacks {
+ public:
+  uint64_t m_alloc_len = 0;
+  uint64_t m_dst_len = 0;
+
+  wuffs_base__pixel_format  //
+  SelectPixfmt(const wuffs_base__image_config& image_config) override {
+    return wuffs_base__make_pixel_format(
+        WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL);
+  }
+
+  AllocPixbufResult  //
+  AllocPixbuf(const wuffs_base__image_config& image_config,
+              bool allow_uninitialized_memory) override {
+    AllocPixbufResult r = wuffs_aux::DecodeImageCallbacks::AllocPixbuf(
+        image_config, allow_uninitialized_memory);
+    if (r.error_message.empty()) {
+      wuffs_base__table_u8 t = r.pixbuf.plane(0);
+      m_alloc_len += t.stride * t.height;
+      m_dst_len += t.width * t.height;
+    }
+    return r;
+  }
+
+  AllocWorkbufResult  //
+  AllocWorkbuf(wuffs_base__range_ii_u64 len_range,
+               bool allow_uninitialized_memory) override {
+    AllocWorkbufResult r = wuffs_aux::DecodeImageCallbacks::AllocWorkbuf(
+        len_range, allow_uninitialized_memory);
+    if (r.error_message.empty()) {
+      m_alloc_len += r.workbuf.len;
+    }
+    return r;
+  }
+};
+
+// NopJsonCallbacks and NopCborCallbacks discard the decoded values. The
+// numbers measured are the cost of tokenizing and of the wuffs_aux callback
+// machinery (including materializing each string as a std::string), not of
+// building a DOM.
+class NopJsonCallbacks : public wuffs_aux::DecodeJsonCallbacks {
+ public:
+  std::string AppendNull() override { return ""; }
+  std::string AppendBool(bool val) override { return ""; }
+  std::string AppendF64(double val) override { return ""; }
+  std::string AppendI64(int64_t val) override { return ""; }
+  std::string AppendTextString(std::string&& val) override { return ""; }
+  std::string Push(uint32_t flags) override { return ""; }
+  std::string Pop(uint32_t flags) override { return ""; }
+};
+
+class NopCborCallbacks : public wuffs_aux::DecodeCborCallbacks {
+ public:
+  std::string AppendNull() override { return ""; }
+  std::string AppendUndefined() override { return ""; }
+  std::string AppendBool(bool val) override { return ""; }
+  std::string AppendF64(double val) override { return ""; }
+  std::string AppendI64(int64_t val) override { return ""; }
+  std::string AppendU64(uint64_t val) override { return ""; }
+  std::string AppendByteString(std::string&& val) override { return ""; }
+  std::string AppendTextString(std::string&& val) override { return ""; }
+  std::string AppendMinus1MinusX(uint64_t val) override { return ""; }
+  std::string AppendCborSimpleValue(uint8_t val) override { return ""; }
+  std::string AppendCborTag(uint64_t val) override { return ""; }
+  std::string Push(uint32_t flags) override { return ""; }
+  std::string Pop(uint32_t flags) override { return ""; }
+};
+
+// ----
+
+static const char*  //
+format_name(int32_t fourcc, const std::string& filename, const uint8_t* ptr,
+            size_t len) {
+  switch (fourcc) {
+    case WUFFS_BASE__FOURCC__BMP:
+      return "bmp";
+    case WUFFS_BASE__FOURCC__BZ2:
+      return "bzip2";
+    case WUFFS_BASE__FOURCC__GIF:
+      return "gif";
+    case WUFFS_BASE__FOURCC__GZ:
+      return "gzip";
+    case WUFFS_BASE__FOURCC__ICO:
+      return "ico";
+    case WUFFS_BASE__FOURCC__JPEG:
+      return "jpeg";
+    case WUFFS_BASE__FOURCC__NIE:
+      return "nie";
+    case WUFFS_BASE__FOURCC__NPBM:
+      return "netpbm";
+    case WUFFS_BASE__FOURCC__PNG:
+      return "png";
+    case WUFFS_BASE__FOURCC__QOI:
+      return "qoi";
+    case WUFFS_BASE__FOURCC__TGA:
+      return "tga";
+    case WUFFS_BASE__FOURCC__TIFF:
+      return "tiff";
+    case WUFFS_BASE__FOURCC__WBMP:
+      return "wbmp";
+    case WUFFS_BASE__FOURCC__WEBP:
+      return "webp";
+    case WUFFS_BASE__FOURCC__ZLIB:
+      return "zlib";
+  }
+
+  size_t n = filename.size();
+  if ((n >= 5) && (filename.compare(n - 5, 5, ".cbor") == 0)) {
+    return "cbor";
+  }
+  for (size_t i = 0; i < len; i++) {
+    switch (ptr[i]) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        continue;
+      case '[':
+      case '{':
+        return "json";
+    }
+    break;
+  }
+  return nullptr;
+}
+
+static std::string  //
+decode_image(Result* r, const uint8_t* ptr, size_t len) {
+  ImageCallbacks callbacks;
+  wuffs_aux::sync_io::MemoryInput input(ptr, len);
+  wuffs_aux::DecodeImageResult res = wuffs_aux::DecodeImage(callbacks, input);
+  r->alloc_len = callbacks.m_alloc_len;
+  r->dst_len = callbacks.m_dst_len * 4;
+  return std::move(res.error_message);
+}
+
+static std::string  //
+decode_json(Result* r, const uint8_t* ptr, size_t len) {
+  NopJsonCallbacks callbacks;
+  wuffs_aux::sync_io::MemoryInput input(ptr, len);
+  return std::move(wuffs_aux::DecodeJson(callbacks, input).error_message);
+}
+
+static std::string  //
+decode_cbor(Result* r, const uint8_t* ptr, size_t len) {
+  NopCborCallbacks callbacks;
+  wuffs_aux::sync_io::MemoryInput input(ptr, len);
+  return std::move(wuffs_aux::DecodeCbor(callbacks, input).error_message);
+}
+
+static std::string  //
+transcode(Result* r, const uint8_t* ptr, size_t len) {
+  wuffs_aux::sync_io::MemoryInput input(ptr, len);
+  wuffs_aux::sync_io::MemoryOutput output(g_dst_buffer_array,
+                                          DST_BUFFER_ARRAY_SIZE);
+  std::string err =
+      (r->format == "json2cbor")
+          ? std::move(
+                wuffs_aux::TranscodeJsonToCbor(output, input).error_message)
+          : std::move(
+                wuffs_aux::TranscodeCborToJson(output, input).error_message);
+  r->dst_len = output.Length();
+  return err;
+}
+
+static std::string  //
+decode_io_transformer(Result* r,
+                      const std::string& format,
+                      const uint8_t* ptr,
+                      size_t len) {
+  wuffs_base__io_transformer::unique_ptr dec(nullptr, &free);
+  if (format == "bzip2") {
+    dec = wuffs_bzip2__decoder::alloc_as__wuffs_base__io_transformer();
+  } else if (format == "gzip") {
+    dec = wuffs_gzip__decoder::alloc_as__wuffs_base__io_transformer();
+  } else if (format == "zlib") {
+    dec = wuffs_zlib__decoder::alloc_as__wuffs_base__io_transformer();
+  }
+  if (!dec) {
+    return "out of memory";
+  }
+
+  wuffs_base__range_ii_u64 workbuf_len = dec->workbuf_len();
+  if (workbuf_len.min_incl > WORKBUF_ARRAY_SIZE) {
+    return "work buffer is too small";
+  }
+  r->alloc_len = wuffs_base__u64__min(workbuf_len.max_incl, WORKBUF_ARRAY_SIZE);
+
+  auto src = wuffs_base__ptr_u8__reader(const_cast<uint8_t*>(ptr), len, true);
+  auto dst = wuffs_base__ptr_u8__writer(g_dst_buffer_array,
+                                        DST_BUFFER_ARRAY_SIZE);
+  auto status = dec->transform_io(
+      &dst, &src,
+      wuffs_base__make_slice_u8(g_workbuf_array, r->alloc_len));
+  r->dst_len = dst.meta.wi;
+  if (status.repr == wuffs_base__suspension__short_write) {
+    return "decoded output is too large";
+  }
+  return status.is_ok() ? "" : status.message();
+}
+
+static bool  //
+is_image_format(const std::string& f) {
+  return (f != "bzip2") && (f != "gzip") && (f != "zlib") && (f != "json") &&
+         (f != "cbor") && (f != "json2cbor") && (f != "cbor2json");
+}
+
+static std::string  //
+decode(Result* r, const uint8_t* ptr, size_t len) {
+  const std::string& f = r->format;
+  if ((f == "bzip2") || (f == "gzip") || (f == "zlib")) {
+    return decode_io_transformer(r, f, ptr, len);
+  } else if (f == "json") {
+    return decode_json(r, ptr, len);
+  } else if (f == "cbor") {
+    return decode_cbor(r, ptr, len);
+  } else if ((f == "json2cbor") || (f == "cbor2json")) {
+    return transcode(r, ptr, len);
+  }
+  return decode_image(r, ptr, len);
+}
+
+#ifdef WUFFS_MIMIC
+// decode_mimic returns whether the third party library could decode the
+// format. Its destination buffer is the same one Wuffs decodes into.
+//
+// This does not #include the test/c/mimiclib code, as those files are C, not
+// C++, but the library calls below are equivalent.
+static bool  //
+decode_mimic(const Result& r, const uint8_t* ptr, size_t len) {
+  if (r.format == "bzip2") {
+    unsigned int dst_len = DST_BUFFER_ARRAY_SIZE;
+    return BZ2_bzBuffToBuffDecompress((char*)(g_dst_buffer_array), &dst_len,
+                                      (char*)(ptr), len, 0, 0) == BZ_OK;
+
+  } else if ((r.format == "gzip") || (r.format == "zlib")) {
+    z_stream z = {0};
+    // Adding 16 to the window bits means to expect a gzip wrapper.
+    if (inflateInit2(&z, (r.format == "gzip") ? (16 + MAX_WBITS)
+                                              : MAX_WBITS) != Z_OK) {
+      return false;
+    }
+    z.next_in = (Bytef*)(ptr);
+    z.avail_in = len;
+    z.next_out = g_dst_buffer_array;
+    z.avail_out = DST_BUFFER_ARRAY_SIZE;
+    int ret = inflate(&z, Z_FINISH);
+    inflateEnd(&z);
+    return ret == Z_STREAM_END;
+
+  } else if (r.format == "png") {
+    png_image pi = {0};
+    pi.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&pi, ptr, len)) {
+      return false;
+    }
+    pi.format = PNG_FORMAT_BGRA;
+    if (PNG_IMAGE_SIZE(pi) > DST_BUFFER_ARRAY_SIZE) {
+      png_image_free(&pi);
+      return false;
+    }
+    return png_image_finish_read(&pi, nullptr, g_dst_buffer_array, 0,
+                                 nullptr) != 0;
+  }
+  return false;
+}
+#endif
+
+static void  //
+record(const std::string& filename, const Result& r) {
+  Summary& s = g_summaries[std::make_pair(r.format, size_bucket(r.src_len))];
+  s.num_files++;
+  s.src_len += r.src_len;
+  s.dst_len += r.dst_len;
+  s.alloc_len += r.alloc_len;
+  s.nanos += r.nanos;
+  s.time_histogram[time_bucket(r.nanos)]++;
+  if (r.mimic_nanos > 0) {
+    s.num_mimic_files++;
+    s.mimic_src_len += r.src_len;
+    s.mimic_nanos += r.mimic_nanos;
+  }
+
+  if (g_flags.json) {
+    printf("{\"file\":\"");
+    for (char c : filename) {
+      if ((c == '"') || (c == '\\')) {
+        printf("\\%c", c);
+      } else if ((uint8_t)(c) < 0x20) {
+        printf("\\u%04X", (uint8_t)(c));
+      } else {
+        putchar(c);
+      }
+    }
+    printf("\",\"format\":\"%s\",\"src_len\":%" PRIu64 ",\"dst_len\":%" PRIu64
+           ",\"alloc_len\":%" PRIu64 ",\"ns\":%" PRIu64,
+           r.format.c_str(), r.src_len, r.dst_len, r.alloc_len, r.nanos);
+    if (r.mimic_nanos > 0) {
+      printf(",\"mimic_ns\":%" PRIu64, r.mimic_nanos);
+    }
+    printf("}\n");
+  } else if (g_flags.verbose) {
+    printf("%-9s %10" PRIu64 " bytes %12.3f ms  %s\n", r.format.c_str(),
+           r.src_len, ((double)(r.nanos)) / 1e6, filename.c_str());
+  }
+}
+
+static std::string  //
+handle_qoi(const std::string& filename, const uint8_t* ptr, size_t len) {
+  ImageCallbacks callbacks;
+  wuffs_aux::sync_io::MemoryInput input(ptr, len);
+  wuffs_aux::DecodeImageResult orig = wuffs_aux::DecodeImage(callbacks, input);
+  if (!orig.error_message.empty()) {
+    return orig.error_message;
+  }
+  uint32_t width = orig.pixbuf.pixcfg.width();
+  uint32_t height = orig.pixbuf.pixcfg.height();
+  wuffs_base__table_u8 orig_tab = orig.pixbuf.plane(0);
+  uint64_t pix_len = 4 * ((uint64_t)width) * ((uint64_t)height);
+
+  Result enc;
+  enc.format = "qoi-enc";
+  enc.src_len = pix_len;
+  std::string err = measure(&enc, [&]() {
+    wuffs_aux::sync_io::MemoryOutput output(g_dst_buffer_array,
+                                            DST_BUFFER_ARRAY_SIZE);
+    std::string e = wuffs_aux::EncodeImageQoi(output, orig.pixbuf);
+    enc.dst_len = output.Length();
+    return e;
+  });
+  if (!err.empty()) {
+    return err;
+  }
+  std::string qoi((const char*)(g_dst_buffer_array), enc.dst_len);
+  const uint8_t* qoi_ptr = (const uint8_t*)(qoi.data());
+
+  Result dec;
+  dec.format = "qoi-dec";
+  dec.src_len = qoi.size();
+  err = measure(&dec,
+                [&]() { return decode_image(&dec, qoi_ptr, qoi.size()); });
+  if (!err.empty()) {
+    return err;
+  }
+
+  // Check that the pixels round-trip.
+  ImageCallbacks round_trip_callbacks;
+  wuffs_aux::sync_io::MemoryInput round_trip_input(qoi_ptr, qoi.size());
+  wuffs_aux::DecodeImageResult round_trip =
+      wuffs_aux::DecodeImage(round_trip_callbacks, round_trip_input);
+  if (!round_trip.error_message.empty()) {
+    return round_trip.error_message;
+  }
+  wuffs_base__table_u8 round_trip_tab = round_trip.pixbuf.plane(0);
+  if ((round_trip.pixbuf.pixcfg.width() != width) ||
+      (round_trip.pixbuf.pixcfg.height() != height)) {
+    return "QOI round trip: inconsistent dimensions";
+  }
+  for (uint32_t y = 0; y < height; y++) {
+    if (memcmp(orig_tab.ptr + (y * orig_tab.stride),
+               round_trip_tab.ptr + (y * round_trip_tab.stride),
+               4 * ((size_t)width))) {
+      return "QOI round trip: inconsistent pixels";
+    }
+  }
+
+  Result nie;
+  nie.format = "nie-enc";
+  nie.src_len = pix_len;
+  err = measure(&nie, [&]() {
+    wuffs_aux::sync_io::MemoryOutput output(g_dst_buffer_array,
+                                            DST_BUFFER_ARRAY_SIZE);
+    std::string e = wuffs_aux::EncodeImageNie(output, orig.pixbuf);
+    nie.dst_len = output.Length();
+    return e;
+  });
+  if (!err.empty()) {
+    return err;
+  }
+
+  wuffs_base__slice_u8 nie_bytes =
+      wuffs_base__make_slice_u8(g_dst_buffer_array, nie.dst_len);
+  Result map;
+  map.format = "nie-map";
+  map.src_len = nie.dst_len;
+  map.dst_len = pix_len;
+  err = measure(&map, [&]() {
+    wuffs_aux::MapImageResult m = wuffs_aux::MapImage(nie_bytes);
+    return m.error_message;
+  });
+  if (!err.empty()) {
+    return err;
+  }
+
+  // Check that the mapped pixels are the original pixels.
+  wuffs_aux::MapImageResult mapped = wuffs_aux::MapImage(nie_bytes);
+  if (!mapped.error_message.empty()) {
+    return mapped.error_message;
+  } else if ((mapped.frames.size() != 1) ||
+             (mapped.frames[0].pixbuf.pixcfg.width() != width) ||
+             (mapped.frames[0].pixbuf.pixcfg.height() != height)) {
+    return "NIE round trip: inconsistent dimensions";
+  }
+  wuffs_base__table_u8 mapped_tab = mapped.frames[0].pixbuf.plane(0);
+  for (uint32_t y = 0; y < height; y++) {
+    if (memcmp(orig_tab.ptr + (y * orig_tab.stride),
+               mapped_tab.ptr + (y * mapped_tab.stride),
+               4 * ((size_t)width))) {
+      return "NIE round trip: inconsistent pixels";
+    }
+  }
+
+  record(filename, enc);
+  record(filename, dec);
+  record(filename, nie);
+  record(filename, map);
+  return "";
+}
+
+static void  //
+handle(const std::string& filename) {
+  std::ifstream f(filename, std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(f)),
+                       std::istreambuf_iterator<char>());
+  if (!f.good() && !f.eof()) {
+    fprintf(stderr, "%s: could not read\n", filename.c_str());
+    g_num_failed_files++;
+    return;
+  }
+  const uint8_t* ptr = (const uint8_t*)(contents.data());
+  size_t len = contents.size();
+
+  int32_t fourcc = wuffs_base__magic_number_guess_fourcc(
+      wuffs_base__make_slice_u8(const_cast<uint8_t*>(ptr), len), true);
+  const char* format = format_name(fourcc, filename, ptr, len);
+  if (!format) {
+    g_num_skipped_files++;
+    return;
+  }
+
+  Result r;
+  r.format = format;
+  if (g_flags.transcode) {
+    if (r.format == "json") {
+      r.format = "json2cbor";
+    } else if (r.format == "cbor") {
+      r.format = "cbor2json";
+    }
+  }
+  r.src_len = len;
+  std::string err = measure(&r, [&]() { return decode(&r, ptr, len); });
+  if (!err.empty()) {
+    fprintf(stderr, "%s: %s\n", filename.c_str(), err.c_str());
+    g_num_failed_files++;
+    return;
+  }
+
+#ifdef WUFFS_MIMIC
+  for (int i = 0; i <= g_flags.reps; i++) {
+    uint64_t t0 = now_nanos();
+    if (!decode_mimic(r, ptr, len)) {
+      r.mimic_nanos = 0;
+      break;
+    }
+    uint64_t t1 = now_nanos();
+    if ((i == 1) || ((i > 1) && (r.mimic_nanos > (t1 - t0)))) {
+      r.mimic_nanos = t1 - t0;
+    }
+  }
+#endif
+
+  record(filename, r);
+
+  if (g_flags.qoi && is_image_format(r.format)) {
+    err = handle_qoi(filename, ptr, len);
+    if (!err.empty()) {
+      fprintf(stderr, "%s: %s\n", filename.c_str(), err.c_str());
+      g_num_failed_files++;
+    }
+  }
+}
+
+static void  //
+visit(const std::string& filename) {
+  struct stat z;
+  if (stat(filename.c_str(), &z)) {
+    fprintf(stderr, "%s: stat: %s\n", filename.c_str(), strerror(errno));
+    g_num_failed_files++;
+    return;
+  } else if (S_ISREG(z.st_mode)) {
+    handle(filename);
+    return;
+  } else if (!S_ISDIR(z.st_mode)) {
+    return;
+  }
+
+  DIR* d = opendir(filename.c_str());
+  if (!d) {
+    fprintf(stderr, "%s: opendir: %s\n", filename.c_str(), strerror(errno));
+    g_num_failed_files++;
+    return;
+  }
+  std::vector<std::string> children;
+  while (struct dirent* e = readdir(d)) {
+    if ((e->d_name[0] != '\x00') && (e->d_name[0] != '.')) {
+      children.push_back(filename + "/" + e->d_name);
+    }
+  }
+  closedir(d);
+  // Sort, for deterministic output.
+  std::sort(children.begin(), children.end());
+  for (const auto& child : children) {
+    visit(child);
+  }
+}
+
+// ----
+
+static double  //
+mb_per_s(uint64_t n_bytes, uint64_t nanos) {
+  return nanos ? (((double)(n_bytes)) * 1e3 / ((double)(nanos))) : 0.0;
+}
+
+static void  //
+print_summaries() {
+  if (!g_flags.json) {
+    printf("%-9s %-6s %6s %10s %10s %10s %10s", "format", "size", "files",
+           "src_MB/s", "dst_MB/s", "alloc_MiB", "total_ms");
+#ifdef WUFFS_MIMIC
+    printf(" %10s %8s", "mimic_MB/s", "vs_mimic");
+#endif
+    printf("   time_histogram(");
+    for (int i = 0; i < g_num_time_buckets; i++) {
+      printf("%s%s", i ? " " : "", g_time_bucket_names[i]);
+    }
+    printf(")\n");
+  }
+
+  for (const auto& kv : g_summaries) {
+    const std::string& format = kv.first.first;
+    const char* size = g_size_bucket_names[kv.first.second];
+    const Summary& s = kv.second;
+    double src_mbps = mb_per_s(s.src_len, s.nanos);
+    double dst_mbps = mb_per_s(s.dst_len, s.nanos);
+    double mimic_mbps = mb_per_s(s.mimic_src_len, s.mimic_nanos);
+    // The ratio compares like with like: only those files that both Wuffs and
+    // the mimic library decoded.
+    double ratio = 0.0;
+    if ((s.num_mimic_files == s.num_files) && (mimic_mbps > 0)) {
+      ratio = src_mbps / mimic_mbps;
+    }
+
+    if (g_flags.json) {
+      printf("{\"summary\":true,\"format\":\"%s\",\"size\":\"%s\","
+             "\"files\":%" PRIu64 ",\"src_len\":%" PRIu64
+             ",\"dst_len\":%" PRIu64 ",\"alloc_len\":%" PRIu64
+             ",\"ns\":%" PRIu64 ",\"src_mb_per_s\":%.3f,\"dst_mb_per_s\":%.3f",
+             format.c_str(), size, s.num_files, s.src_len, s.dst_len,
+             s.alloc_len, s.nanos, src_mbps, dst_mbps);
+      if (s.num_mimic_files > 0) {
+        printf(",\"mimic_files\":%" PRIu64 ",\"mimic_mb_per_s\":%.3f",
+               s.num_mimic_files, mimic_mbps);
+      }
+      if (ratio > 0) {
+        printf(",\"vs_mimic\":%.3f", ratio);
+      }
+      printf(",\"time_histogram\":[");
+      for (int i = 0; i < g_num_time_buckets; i++) {
+        printf("%s%" PRIu64, i ? "," : "", s.time_histogram[i]);
+      }
+      printf("]}\n");
+      continue;
+    }
+
+    printf("%-9s %-6s %6" PRIu64 " %10.2f %10.2f %10.2f %10.2f",
+           format.c_str(), size, s.num_files, src_mbps, dst_mbps,
+           ((double)(s.alloc_len)) / (1 << 20), ((double)(s.nanos)) / 1e6);
+#ifdef WUFFS_MIMIC
+    if (ratio > 0) {
+      printf(" %10.2f %7.2fx", mimic_mbps, ratio);
+    } else {
+      printf(" %10s %8s", "-", "-");
+    }
+#endif
+    printf("   ");
+    for (int i = 0; i < g_num_time_buckets; i++) {
+      printf("%s%" PRIu64, i ? " " : "", s.time_histogram[i]);
+    }
+    printf("\n");
+  }
+
+  if (!g_flags.json) {
+    printf("# %" PRIu64 " files skipped (unrecognized format), %" PRIu64
+           " files failed\n",
+           g_num_skipped_files, g_num_failed_files);
+  }
+}
+
+static const char*  //
+parse_flags(int argc, char** argv) {
+  g_flags.reps = 3;
+
+  for (int c = 1; c < argc; c++) {
+    char* arg = argv[c];
+    if (*arg != '-') {
+      g_flags.filenames.push_back(arg);
+      continue;
+    }
+    arg++;
+    if (*arg == '-') {
+      arg++;
+    }
+
+    if (!strcmp(arg, "json")) {
+      g_flags.json = true;
+      continue;
+    }
+    if (!strncmp(arg, "manifest=", 9)) {
+      std::ifstream f(arg + 9);
+      if (!f.good()) {
+        return "could not open the -manifest=FILENAME file";
+      }
+      for (std::string line; std::getline(f, line);) {
+        if (!line.empty() && (line[0] != '#')) {
+          g_flags.filenames.push_back(line);
+        }
+      }
+      continue;
+    }
+    if (!strcmp(arg, "qoi")) {
+      g_flags.qoi = true;
+      continue;
+    }
+    if (!strncmp(arg, "reps=", 5)) {
+      char* end = nullptr;
+      long int n = strtol(arg + 5, &end, 10);
+      if (*end || (n < 1) || (1000000 < n)) {
+        return "invalid -reps=N value";
+      }
+      g_flags.reps = (int)(n);
+      continue;
+    }
+    if (!strcmp(arg, "transcode")) {
+      g_flags.transcode = true;
+      continue;
+    }
+    if (!strcmp(arg, "v")) {
+      g_flags.verbose = true;
+      continue;
+    }
+
+    return g_usage;
+  }
+
+  if (g_flags.filenames.empty()) {
+    return g_usage;
+  }
+  return nullptr;
+}
+
+int  //
+main(int argc, char** argv) {
+  const char* z = parse_flags(argc, argv);
+  if (z) {
+    fprintf(stderr, "%s\n", z);
+    return 1;
+  }
+  for (const auto& filename : g_flags.filenames) {
+    visit(filename);
+  }
+  print_summaries();
+  return 0;
+}
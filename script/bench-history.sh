@@ -18,6 +18,11 @@
 # This script measures Wuffs benchmarks over recent commits. For example:
 #
 # PACKAGE=deflate FOCUS=wuffs_deflate_decode_100k script/bench-history.sh
+#
+# With JSON=1, the benchmark program is run with "-json" and each commit's
+# metric is the median throughput and p99 iteration time, as summarized by
+# "script/benchstat-ratio.go -json", instead of benchstat's mean. Commits that
+# predate the "-json" flag report 'bench_failed'.
 
 num_commits=${NUM_COMMITS:-100}
 cc=${CC:-gcc}
@@ -25,17 +30,29 @@ package=${PACKAGE:-gif}
 focus=${FOCUS:-wuffs_gif_decode_1000k_full_init}
 iterscale=${ITERSCALE:-50}
 reps=${REPS:-20}
+json=${JSON:-0}
 
 # ----
 
 save=`git log -1 --pretty=format:"%H"`
 
+# Checking out older commits can change (or remove) script/benchstat-ratio.go,
+# so run a copy of the current version.
+tmpdir=`mktemp -d`
+trap "rm -rf $tmpdir" EXIT
+cp script/benchstat-ratio.go $tmpdir/benchstat-ratio.go
+
 i=0
 while [ $i -lt $num_commits ]; do
   set +e
   $cc -O3 -o bench-history.out test/c/std/$package.c
   if [ $? -ne 0 ]; then
     this_metric='compile_failed'
+  elif [ $json -ne 0 ]; then
+    this_metric=`./bench-history.out -bench -json -focus=$focus -iterscale=$iterscale -reps=$reps | GO111MODULE=off go run $tmpdir/benchstat-ratio.go -json | grep $focus`
+    if [ $? -ne 0 ]; then
+      this_metric='bench_failed'
+    fi
   else
     this_metric=`./bench-history.out -bench -focus=$focus -iterscale=$iterscale -reps=$reps | benchstat /dev/stdin | sed -ne '/^name.*speed$/,$ p' | grep $focus`
     if [ $? -ne 0 ]; then
@@ -55,18 +55,30 @@ package main
 // There are two groups here: "crc32_ieee_10k" and "crc32_ieee_100k".
 //
 // Usage: benchstat etc | go run benchstat-ratio.go
+//
+// Alternatively, with the -json flag, this program reads the JSON Lines output
+// of "wuffs bench -json" (or a test/c/std program run with "-bench -json")
+// directly, instead of benchstat's summary. Each name's reps are summarized
+// by their median throughput (or median ns/op, for benchmarks that don't
+// count bytes) and the median of their per-rep 99th percentile iteration
+// times, and the ratios are then computed as above.
+//
+// Usage: wuffs bench -json etc | go run benchstat-ratio.go -json
 
 import (
 	"bufio"
+	"encoding/json"
 	"flag"
 	"fmt"
 	"os"
+	"sort"
 	"strconv"
 	"strings"
 )
 
 var (
 	baseline = flag.String("baseline", "mimic", "benchmark name prefix of the 1.00x case")
+	jsonFlag = flag.Bool("json", false, "whether the input is \"wuffs bench -json\" output")
 )
 
 func main() {
@@ -80,6 +92,14 @@ func main1() error {
 	flag.Parse()
 	baselineUnderscore = *baseline + "_"
 
+	if *jsonFlag {
+		if err := parseJSON(); err != nil {
+			return err
+		}
+		printEntries()
+		return nil
+	}
+
 	r := bufio.NewScanner(os.Stdin)
 	for r.Scan() {
 		line := strings.TrimSpace(string(r.Bytes()))
@@ -114,7 +134,11 @@ func main1() error {
 	if err := r.Err(); err != nil {
 		return err
 	}
+	printEntries()
+	return nil
+}
 
+func printEntries() {
 	for _, e := range entries {
 		if e.key == "" {
 			fmt.Println()
@@ -134,10 +158,104 @@ func main1() error {
 		}
 		fmt.Printf("%s\n", e.line)
 	}
+}
+
+// jsonResult is one line of "wuffs bench -json" output. Only the fields that
+// this program uses are listed.
+type jsonResult struct {
+	Name     string  `json:"name"`
+	CC       string  `json:"cc"`
+	NsPerOp  float64 `json:"ns_per_op"`
+	MBPerS   float64 `json:"mb_per_s"`
+	NsP99    float64 `json:"ns_p99"`
+	NumBytes uint64  `json:"n_bytes"`
+}
 
+func parseJSON() error {
+	names := []string(nil)
+	reps := map[string][]jsonResult{}
+
+	r := bufio.NewScanner(os.Stdin)
+	for r.Scan() {
+		line := strings.TrimSpace(string(r.Bytes()))
+		if (line == "") || (line[0] != '{') {
+			continue
+		}
+		j := jsonResult{}
+		if err := json.Unmarshal([]byte(line), &j); err != nil {
+			return fmt.Errorf("could not parse %q: %v", line, err)
+		}
+		name := j.Name + "/" + j.CC
+		if _, ok := reps[name]; !ok {
+			names = append(names, name)
+		}
+		reps[name] = append(reps[name], j)
+
+		// Find the "/gcc10" in "mimic_etc/gcc10".
+		if (gccSuffix == "") && strings.HasPrefix(name, baselineUnderscore) &&
+			strings.HasPrefix(j.CC, slashGCC[1:]) {
+			gccSuffix = "/" + j.CC
+		}
+	}
+	if err := r.Err(); err != nil {
+		return err
+	}
+
+	for _, name := range names {
+		rs := reps[name]
+		xs := make([]float64, len(rs))
+		p99s := make([]float64, len(rs))
+		prefix, unit, multiplier := prefix2, suffix_MBs, 1e6
+		if rs[0].NumBytes == 0 {
+			prefix, unit, multiplier = prefix1, suffix_ns, 1e0
+		}
+		for i, x := range rs {
+			if prefix == prefix2 {
+				xs[i] = x.MBPerS
+			} else {
+				xs[i] = x.NsPerOp
+			}
+			p99s[i] = x.NsP99
+		}
+		med, spread := medianAndSpread(xs)
+		p99, _ := medianAndSpread(p99s)
+
+		key := prefix + name
+		entries = append(entries, entry{key, fmt.Sprintf("%-48s %10.2f%s %s %3.0f%%  p99 %10.0f%s",
+			name, med, unit, plusMinus[1:len(plusMinus)-1], 100*spread, p99, suffix_ns)})
+		values[key] = med * multiplier
+	}
 	return nil
 }
 
+// medianAndSpread returns the median of xs and the largest relative deviation
+// of any element of xs from that median.
+func medianAndSpread(xs []float64) (median float64, spread float64) {
+	if len(xs) == 0 {
+		return 0, 0
+	}
+	sorted := append([]float64(nil), xs...)
+	sort.Float64s(sorted)
+	if n := len(sorted); (n & 1) != 0 {
+		median = sorted[n/2]
+	} else {
+		median = (sorted[(n/2)-1] + sorted[n/2]) / 2
+	}
+	if median == 0 {
+		return 0, 0
+	}
+	for _, x := range sorted {
+		d := (x - median) / median
+		if d < 0 {
+			d = -d
+		}
+		if spread < d {
+			spread = d
+		}
+	}
+	return median, spread
+}
+
 func parse(line string) (key string, val float64) {
 	i := strings.IndexByte(line, ' ')
 	if i < 0 {
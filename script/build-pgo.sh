@@ -0,0 +1,148 @@
+#!/bin/bash -eu
+# Copyright 2023 The Wuffs Authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# ----------------
+
+# This script builds a profile-guided optimization (PGO) profile for the single
+# file C library (release/c/wuffs-unsupported-snapshot.c by default) and then
+# measures what that profile is worth. For example:
+#
+# RELEASE=release/c/wuffs-v0.3.c CORPUS=/path/to/images script/build-pgo.sh
+#
+# It compiles the library as its own, instrumented, translation unit, links the
+# test/c/std programs and script/decode-corpus.c against it and runs their
+# benchmarks (and decodes test/data plus the space-separated $CORPUS
+# directories) as the training workload. It then compiles the library again,
+# with and without that profile, and compares the test/c/std benchmarks.
+#
+# The profile is written to $OUT/wuffs.gcda (gcc) or $OUT/wuffs.profdata
+# (clang). A production build can reuse it if it compiles the same library file
+# with the same $CFLAGS as its own translation unit:
+#
+#  - for gcc, to an object file named wuffs.o with that wuffs.gcda next to it
+#    (gcc looks for the .gcda file named after the object file), adding the
+#    "-fprofile-use -fprofile-partial-training -Wno-missing-profile" flags.
+#  - for clang, adding the "-fprofile-use=path/to/wuffs.profdata" flag.
+#
+# With MEASURE=0, the comparison is skipped.
+
+cc=${CC:-gcc}
+cflags=${CFLAGS:--O3}
+release=${RELEASE:-release/c/wuffs-unsupported-snapshot.c}
+out=${OUT:-pgo-out}
+corpus=${CORPUS:-}
+iterscale=${ITERSCALE:-10}
+measure=${MEASURE:-1}
+reps=${REPS:-5}
+
+if [ ! -e wuffs-root-directory.txt ]; then
+  echo "$0 should be run from the Wuffs root directory."
+  exit 1
+fi
+
+rm -rf $out
+mkdir -p $out/base $out/gen $out/use $out/programs
+out=$(cd $out && pwd)
+
+if $cc --version | grep -q clang; then
+  is_clang=1
+  use_flags="-fprofile-use=$out/wuffs.profdata -Wno-profile-instr-unprofiled"
+else
+  is_clang=0
+  use_flags="-fprofile-use -fprofile-partial-training -Wno-missing-profile"
+fi
+
+# Compiling test programs (or decode-corpus.c) with -include $out/shim.h makes
+# their own #include of the library a no-op, leaving them to link with a
+# separately compiled wuffs.o. WUFFS_NONMONOLITHIC also compiles out the few
+# tests that call Wuffs' private (static) functions.
+cat > $out/shim.h <<EOF
+#define WUFFS_IMPLEMENTATION
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_NONMONOLITHIC
+#include "$(pwd)/$release"
+EOF
+
+# compile_wuffs_o compiles the library to $1/wuffs.o, with extra flags $2.
+compile_wuffs_o() {
+  $cc $cflags $2 -std=c99 -c -x c -DWUFFS_IMPLEMENTATION $release -o $1/wuffs.o
+}
+
+programs=""
+for f in test/c/std/*.c script/decode-corpus.c; do
+  p=$(basename ${f%.c})
+  $cc $cflags -std=c99 -c -include $out/shim.h $f -o $out/programs/$p.o
+  programs="$programs $p"
+done
+
+# ----
+
+echo "# Training."
+compile_wuffs_o $out/gen "-fprofile-generate"
+export LLVM_PROFILE_FILE="$out/gen/%p.profraw"
+for p in $programs; do
+  $cc -fprofile-generate $out/programs/$p.o $out/gen/wuffs.o -lm -o $out/gen/$p
+done
+for p in $programs; do
+  if [ $p = decode-corpus ]; then
+    $out/gen/$p test/data $corpus 2>/dev/null
+  else
+    $out/gen/$p -bench -iterscale=$iterscale -reps=1 >/dev/null
+  fi
+done
+
+if [ $is_clang -ne 0 ]; then
+  llvm-profdata merge -o $out/wuffs.profdata $out/gen/*.profraw
+  echo "Wrote $out/wuffs.profdata"
+else
+  # gcc names the .gcda file after the object file.
+  cp $out/gen/wuffs.gcda $out/wuffs.gcda
+  cp $out/wuffs.gcda $out/use/wuffs.gcda
+  echo "Wrote $out/wuffs.gcda"
+fi
+
+if [ $measure -eq 0 ]; then
+  exit 0
+fi
+
+# ----
+
+echo "# Measuring (best of $reps reps, ns/op, base versus PGO)."
+compile_wuffs_o $out/base ""
+compile_wuffs_o $out/use "$use_flags"
+for p in $programs; do
+  if [ $p = decode-corpus ]; then
+    continue
+  fi
+  for v in base use; do
+    $cc $out/programs/$p.o $out/$v/wuffs.o -lm -o $out/$v/$p
+    $out/$v/$p -bench -reps=$reps | grep '^Benchmark' > $out/$v/$p.txt || true
+  done
+  # Print each benchmark's best (minimum) ns/op for base and PGO and their
+  # ratio, then the geometric mean ratio for the package.
+  awk -v pkg=$p '
+    FNR == NR { if (!($1 in base) || ($3 < base[$1])) base[$1] = $3; next }
+    { if (!($1 in use) || ($3 < use[$1])) use[$1] = $3 }
+    END {
+      n = 0; sum = 0
+      for (k in base) {
+        if (!(k in use) || (use[k] <= 0)) continue
+        r = base[k] / use[k]
+        printf "%-72s %12d %12d %6.2fx\n", substr(k, 10), base[k], use[k], r
+        n++; sum += log(r)
+      }
+      if (n > 0) printf "%-72s %25s %6.2fx\n", "# " pkg " (geomean)", "", exp(sum / n)
+    }' $out/base/$p.txt $out/use/$p.txt | sort
+done
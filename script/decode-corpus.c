@@ -0,0 +1,463 @@
+// Copyright 2023 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+// decode-corpus decodes every file under the given directories (walked
+// recursively), "-reps=N" times each (default 1), and prints how many files
+// were decoded, failed or skipped (unrecognized format).
+//
+// It guesses each file's format like script/bench-corpus.cc does, but it only
+// uses Wuffs' C API, not the C++-only wuffs_aux API, and it does not time
+// anything. Its purpose is to drive a representative workload, such as
+// script/build-pgo.sh's profile-guided optimization training run, which links
+// this program against a separately compiled (and instrumented) Wuffs.
+//
+// To run:
+//
+// $CC -O3 decode-corpus.c -o decode-corpus
+// ./decode-corpus -reps=3 /path/to/corpus/dir
+
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__BMP
+#define WUFFS_CONFIG__MODULE__BZIP2
+#define WUFFS_CONFIG__MODULE__CBOR
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__GIF
+#define WUFFS_CONFIG__MODULE__GZIP
+#define WUFFS_CONFIG__MODULE__JPEG
+#define WUFFS_CONFIG__MODULE__JSON
+#define WUFFS_CONFIG__MODULE__LZW
+#define WUFFS_CONFIG__MODULE__NETPBM
+#define WUFFS_CONFIG__MODULE__NIE
+#define WUFFS_CONFIG__MODULE__PNG
+#define WUFFS_CONFIG__MODULE__TGA
+#define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__WEBP
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../release/c/wuffs-unsupported-snapshot.c"
+
+// Files larger than this, or images with more pixel data than this, are
+// skipped.
+#ifndef MAX_INCL_LEN
+#define MAX_INCL_LEN (256 * 1024 * 1024)
+#endif
+
+#ifndef DST_BUFFER_ARRAY_SIZE
+#define DST_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
+#endif
+
+#ifndef TOKEN_BUFFER_ARRAY_SIZE
+#define TOKEN_BUFFER_ARRAY_SIZE 4096
+#endif
+
+uint8_t* g_dst_buffer_array = NULL;
+wuffs_base__token g_token_buffer_array[TOKEN_BUFFER_ARRAY_SIZE];
+
+int g_reps = 1;
+
+uint64_t g_num_decoded = 0;
+uint64_t g_num_failed = 0;
+uint64_t g_num_skipped = 0;
+
+// ----
+
+static const char*  //
+decode_image(wuffs_base__image_decoder* dec,
+             uint8_t* src_ptr,
+             size_t src_len) {
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(src_ptr, src_len, true);
+  wuffs_base__image_config ic = {0};
+  wuffs_base__status status =
+      wuffs_base__image_decoder__decode_image_config(dec, &ic, &src);
+  if (!wuffs_base__status__is_ok(&status)) {
+    return wuffs_base__status__message(&status);
+  }
+  uint32_t w = wuffs_base__pixel_config__width(&ic.pixcfg);
+  uint32_t h = wuffs_base__pixel_config__height(&ic.pixcfg);
+  if ((((uint64_t)w) * ((uint64_t)h)) > (MAX_INCL_LEN / 4)) {
+    return "image is too large";
+  }
+  wuffs_base__pixel_config__set(&ic.pixcfg,
+                                WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, w, h);
+
+  uint64_t workbuf_len = wuffs_base__image_decoder__workbuf_len(dec).max_incl;
+  if (workbuf_len > MAX_INCL_LEN) {
+    return "work buffer is too large";
+  }
+  size_t pixbuf_len = ((size_t)w) * ((size_t)h) * 4;
+  uint8_t* pixbuf_ptr = malloc(pixbuf_len ? pixbuf_len : 1);
+  uint8_t* workbuf_ptr = malloc(workbuf_len ? ((size_t)workbuf_len) : 1);
+  const char* ret = NULL;
+  if (!pixbuf_ptr || !workbuf_ptr) {
+    ret = "out of memory";
+    goto done;
+  }
+
+  wuffs_base__pixel_buffer pb = {0};
+  status = wuffs_base__pixel_buffer__set_from_slice(
+      &pb, &ic.pixcfg, wuffs_base__make_slice_u8(pixbuf_ptr, pixbuf_len));
+  if (!wuffs_base__status__is_ok(&status)) {
+    ret = wuffs_base__status__message(&status);
+    goto done;
+  }
+
+  while (true) {
+    status = wuffs_base__image_decoder__decode_frame_config(dec, NULL, &src);
+    if (status.repr == wuffs_base__note__end_of_data) {
+      break;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      ret = wuffs_base__status__message(&status);
+      goto done;
+    }
+    status = wuffs_base__image_decoder__decode_frame(
+        dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
+        wuffs_base__make_slice_u8(workbuf_ptr, (size_t)workbuf_len), NULL);
+    if (!wuffs_base__status__is_ok(&status)) {
+      ret = wuffs_base__status__message(&status);
+      goto done;
+    }
+  }
+
+done:
+  free(workbuf_ptr);
+  free(pixbuf_ptr);
+  return ret;
+}
+
+static const char*  //
+decode_io_transformer(wuffs_base__io_transformer* dec,
+                      uint8_t* src_ptr,
+                      size_t src_len) {
+  uint64_t workbuf_len = wuffs_base__io_transformer__workbuf_len(dec).max_incl;
+  if (workbuf_len > MAX_INCL_LEN) {
+    return "work buffer is too large";
+  }
+  uint8_t* workbuf_ptr = malloc(workbuf_len ? ((size_t)workbuf_len) : 1);
+  if (!workbuf_ptr) {
+    return "out of memory";
+  }
+
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(src_ptr, src_len, true);
+  wuffs_base__io_buffer dst =
+      wuffs_base__ptr_u8__writer(g_dst_buffer_array, DST_BUFFER_ARRAY_SIZE);
+  const char* ret = NULL;
+  while (true) {
+    wuffs_base__status status = wuffs_base__io_transformer__transform_io(
+        dec, &dst, &src,
+        wuffs_base__make_slice_u8(workbuf_ptr, (size_t)workbuf_len));
+    if (status.repr == wuffs_base__suspension__short_write) {
+      // Discard the output so far. The decoder keeps its own history.
+      dst.meta.ri = dst.meta.wi;
+      wuffs_base__io_buffer__compact(&dst);
+      continue;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      ret = wuffs_base__status__message(&status);
+    }
+    break;
+  }
+  free(workbuf_ptr);
+  return ret;
+}
+
+static const char*  //
+decode_token_decoder(wuffs_base__token_decoder* dec,
+                     uint8_t* src_ptr,
+                     size_t src_len) {
+  uint64_t workbuf_len = wuffs_base__token_decoder__workbuf_len(dec).max_incl;
+  if (workbuf_len > MAX_INCL_LEN) {
+    return "work buffer is too large";
+  }
+  uint8_t* workbuf_ptr = malloc(workbuf_len ? ((size_t)workbuf_len) : 1);
+  if (!workbuf_ptr) {
+    return "out of memory";
+  }
+
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(src_ptr, src_len, true);
+  wuffs_base__token_buffer tok =
+      wuffs_base__slice_token__writer(wuffs_base__make_slice_token(
+          g_token_buffer_array, TOKEN_BUFFER_ARRAY_SIZE));
+  const char* ret = NULL;
+  while (true) {
+    wuffs_base__status status = wuffs_base__token_decoder__decode_tokens(
+        dec, &tok, &src,
+        wuffs_base__make_slice_u8(workbuf_ptr, (size_t)workbuf_len));
+    if (status.repr == wuffs_base__suspension__short_write) {
+      tok.meta.ri = 0;
+      tok.meta.wi = 0;
+      continue;
+    } else if (!wuffs_base__status__is_ok(&status)) {
+      ret = wuffs_base__status__message(&status);
+    }
+    break;
+  }
+  free(workbuf_ptr);
+  return ret;
+}
+
+static bool  //
+has_suffix(const char* s, const char* suffix) {
+  size_t n = strlen(s);
+  size_t m = strlen(suffix);
+  return (n >= m) && !strcmp(s + n - m, suffix);
+}
+
+static bool  //
+looks_like_json(const uint8_t* ptr, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    switch (ptr[i]) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        continue;
+      case '[':
+      case '{':
+        return true;
+    }
+    break;
+  }
+  return false;
+}
+
+// decode_once returns NULL on success, "" if the format is unrecognized or
+// otherwise an error message.
+static const char*  //
+decode_once(const char* filename, uint8_t* ptr, size_t len) {
+  int32_t fourcc = wuffs_base__magic_number_guess_fourcc(
+      wuffs_base__make_slice_u8(ptr, len), true);
+  if (fourcc <= 0) {
+    if (has_suffix(filename, ".cbor")) {
+      fourcc = WUFFS_BASE__FOURCC__CBOR;
+    } else if (looks_like_json(ptr, len)) {
+      fourcc = WUFFS_BASE__FOURCC__JSON;
+    }
+  }
+
+  wuffs_base__image_decoder* image_decoder = NULL;
+  wuffs_base__io_transformer* io_transformer = NULL;
+  wuffs_base__token_decoder* token_decoder = NULL;
+  switch (fourcc) {
+    case WUFFS_BASE__FOURCC__BMP:
+      image_decoder = wuffs_bmp__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__GIF:
+      image_decoder = wuffs_gif__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__JPEG:
+      image_decoder =
+          wuffs_jpeg__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__NIE:
+      image_decoder = wuffs_nie__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__NPBM:
+      image_decoder =
+          wuffs_netpbm__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__PNG:
+      image_decoder = wuffs_png__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__TGA:
+      image_decoder = wuffs_tga__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__WBMP:
+      image_decoder =
+          wuffs_wbmp__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__WEBP:
+      image_decoder =
+          wuffs_webp__decoder__alloc_as__wuffs_base__image_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__BZ2:
+      io_transformer =
+          wuffs_bzip2__decoder__alloc_as__wuffs_base__io_transformer();
+      break;
+    case WUFFS_BASE__FOURCC__GZ:
+      io_transformer =
+          wuffs_gzip__decoder__alloc_as__wuffs_base__io_transformer();
+      break;
+    case WUFFS_BASE__FOURCC__ZLIB:
+      io_transformer =
+          wuffs_zlib__decoder__alloc_as__wuffs_base__io_transformer();
+      break;
+    case WUFFS_BASE__FOURCC__CBOR:
+      token_decoder =
+          wuffs_cbor__decoder__alloc_as__wuffs_base__token_decoder();
+      break;
+    case WUFFS_BASE__FOURCC__JSON:
+      token_decoder =
+          wuffs_json__decoder__alloc_as__wuffs_base__token_decoder();
+      break;
+    default:
+      return "";
+  }
+
+  const char* ret = "out of memory";
+  if (image_decoder) {
+    ret = decode_image(image_decoder, ptr, len);
+    free(image_decoder);
+  } else if (io_transformer) {
+    ret = decode_io_transformer(io_transformer, ptr, len);
+    free(io_transformer);
+  } else if (token_decoder) {
+    ret = decode_token_decoder(token_decoder, ptr, len);
+    free(token_decoder);
+  }
+  return ret;
+}
+
+static void  //
+handle(const char* filename, size_t len) {
+  FILE* f = fopen(filename, "rb");
+  if (!f) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    g_num_failed++;
+    return;
+  }
+  uint8_t* ptr = NULL;
+  if ((len > MAX_INCL_LEN) || !(ptr = malloc(len ? len : 1)) ||
+      (fread(ptr, 1, len, f) != len)) {
+    fprintf(stderr, "%s: could not read file\n", filename);
+    g_num_failed++;
+    free(ptr);
+    fclose(f);
+    return;
+  }
+  fclose(f);
+
+  const char* msg = NULL;
+  for (int i = 0; i < g_reps; i++) {
+    msg = decode_once(filename, ptr, len);
+    if (msg) {
+      break;
+    }
+  }
+  free(ptr);
+
+  if (!msg) {
+    g_num_decoded++;
+  } else if (!*msg) {
+    g_num_skipped++;
+  } else {
+    fprintf(stderr, "%s: %s\n", filename, msg);
+    g_num_failed++;
+  }
+}
+
+static void  //
+visit(const char* filename) {
+  struct stat st;
+  if (stat(filename, &st) != 0) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    g_num_failed++;
+    return;
+  } else if (!S_ISDIR(st.st_mode)) {
+    handle(filename, (size_t)st.st_size);
+    return;
+  }
+
+  DIR* d = opendir(filename);
+  if (!d) {
+    fprintf(stderr, "%s: %s\n", filename, strerror(errno));
+    g_num_failed++;
+    return;
+  }
+  size_t n = strlen(filename);
+  while (true) {
+    struct dirent* e = readdir(d);
+    if (!e) {
+      break;
+    } else if (e->d_name[0] == '.') {
+      continue;
+    }
+    size_t m = strlen(e->d_name);
+    char* child = malloc(n + 1 + m + 1);
+    if (!child) {
+      g_num_failed++;
+      break;
+    }
+    memcpy(child, filename, n);
+    child[n] = '/';
+    memcpy(child + n + 1, e->d_name, m + 1);
+    visit(child);
+    free(child);
+  }
+  closedir(d);
+}
+
+int  //
+main(int argc, char** argv) {
+  g_dst_buffer_array = malloc(DST_BUFFER_ARRAY_SIZE);
+  if (!g_dst_buffer_array) {
+    fprintf(stderr, "main: out of memory\n");
+    return 1;
+  }
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    if (!strncmp(arg, "-reps=", 6)) {
+      g_reps = atoi(arg + 6);
+      if (g_reps < 1) {
+        fprintf(stderr, "main: bad -reps flag\n");
+        return 1;
+      }
+    } else if (arg[0] == '-') {
+      fprintf(stderr, "main: unrecognized flag %s\n", arg);
+      return 1;
+    } else {
+      visit(arg);
+    }
+  }
+
+  printf("# %" PRIu64 " files decoded, %" PRIu64 " failed, %" PRIu64
+         " skipped (unrecognized format)\n",
+         g_num_decoded, g_num_failed, g_num_skipped);
+  free(g_dst_buffer_array);
+  return 0;
+}
@@ -72,6 +72,7 @@
 #define WUFFS_CONFIG__MODULE__PNG
 #define WUFFS_CONFIG__MODULE__TGA
 #define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__WEBP
 #define WUFFS_CONFIG__MODULE__ZLIB
 
 // If building this program in an environment that doesn't easily accommodate
@@ -134,6 +135,9 @@ handle_image_decoder(wuffs_base__io_buffer src,
     case WUFFS_BASE__FOURCC__WBMP:
       dec = wuffs_wbmp__decoder::alloc_as__wuffs_base__image_decoder();
       break;
+    case WUFFS_BASE__FOURCC__WEBP:
+      dec = wuffs_webp__decoder::alloc_as__wuffs_base__image_decoder();
+      break;
     default:
       return unsupported_file_format;
   }
@@ -60,6 +60,7 @@ print-image-metadata prints images' metadata.
 #define WUFFS_CONFIG__MODULE__PNG
 #define WUFFS_CONFIG__MODULE__TGA
 #define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__WEBP
 #define WUFFS_CONFIG__MODULE__ZLIB
 
 // If building this program in an environment that doesn't easily accommodate
@@ -396,6 +397,9 @@ redirect:
       case WUFFS_BASE__FOURCC__WBMP:
         dec = wuffs_wbmp__decoder::alloc_as__wuffs_base__image_decoder();
         break;
+      case WUFFS_BASE__FOURCC__WEBP:
+        dec = wuffs_webp__decoder::alloc_as__wuffs_base__image_decoder();
+        break;
       default:
         return "main: unsupported file format";
     }
@@ -0,0 +1,622 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program tests the wuffs_aux C++ CBOR API: CborEncoder,
+TranscodeCborToJson, TranscodeJsonToCbor and DecodeCbor's typed arrays. Unlike
+the test/c/std programs, it is C++, not C, and it is not run by the "wuffs
+test" command.
+
+To manually run this test:
+
+for CXX in clang++ g++; do
+  $CXX -std=c++11 -Wall -Werror cbor.cc && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+*/
+
+#if defined(__cplusplus) && (__cplusplus < 201103L)
+#error "This C++ program requires -std=c++11 or later"
+#endif
+
+#include <string>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__AUX__BASE
+#define WUFFS_CONFIG__MODULE__AUX__CBOR
+#define WUFFS_CONFIG__MODULE__AUX__JSON
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__CBOR
+#define WUFFS_CONFIG__MODULE__JSON
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+
+// ---------------- CBOR Helpers
+
+// LogCborCallbacks records DecodeCbor's callbacks as a space-separated string,
+// such as "[ u64:1 f64:0x3FF8000000000000 ]".
+class LogCborCallbacks : public wuffs_aux::DecodeCborCallbacks {
+ public:
+  std::string m_log;
+
+  std::string Log(const char* s) {
+    m_log += s;
+    m_log += ' ';
+    return "";
+  }
+
+  std::string LogU64(const char* prefix, uint64_t val) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s:%" PRIu64, prefix, val);
+    return Log(buf);
+  }
+
+  std::string LogBytes(const char* prefix, const uint8_t* ptr, size_t len) {
+    m_log += prefix;
+    m_log += ':';
+    for (size_t i = 0; i < len; i++) {
+      char buf[4];
+      snprintf(buf, sizeof(buf), "%02X", ptr[i]);
+      m_log += buf;
+    }
+    return Log("");
+  }
+
+  std::string AppendNull() override { return Log("null"); }
+  std::string AppendUndefined() override { return Log("undefined"); }
+  std::string AppendBool(bool val) override {
+    return Log(val ? "true" : "false");
+  }
+  std::string AppendF64(double val) override {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "f64:0x%016" PRIX64,
+             wuffs_base__ieee_754_bit_representation__from_f64_to_u64(val));
+    return Log(buf);
+  }
+  std::string AppendI64(int64_t val) override {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "i64:%" PRId64, val);
+    return Log(buf);
+  }
+  std::string AppendU64(uint64_t val) override { return LogU64("u64", val); }
+  std::string AppendByteString(std::string&& val) override {
+    return LogBytes("bytes", (const uint8_t*)(val.data()), val.size());
+  }
+  std::string AppendTextString(std::string&& val) override {
+    return Log(("text:" + val).c_str());
+  }
+  std::string AppendMinus1MinusX(uint64_t val) override {
+    return LogU64("m1mx", val);
+  }
+  std::string AppendCborSimpleValue(uint8_t val) override {
+    return LogU64("simple", val);
+  }
+  std::string AppendCborTag(uint64_t val) override {
+    return LogU64("tag", val);
+  }
+  std::string Push(uint32_t flags) override {
+    return Log((flags & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT) ? "{"
+                                                                    : "[");
+  }
+  std::string Pop(uint32_t flags) override {
+    return Log((flags & WUFFS_BASE__TOKEN__VBD__STRUCTURE__FROM_DICT) ? "}"
+                                                                      : "]");
+  }
+};
+
+// LogTypedArrayCallbacks is like LogCborCallbacks but also logs typed arrays,
+// such as "typed:69:u2le:0201,0403", printing each element's value (after
+// CopyToNative) in hexadecimal.
+class LogTypedArrayCallbacks : public LogCborCallbacks {
+ public:
+  std::string AppendTypedArray(const wuffs_aux::CborTypedArray& val) override {
+    static const char kinds[3] = {'u', 's', 'f'};
+    char buf[64];
+    snprintf(buf, sizeof(buf), "typed:%d:%c%d%s%s:", (int)(val.tag),
+             kinds[val.element_kind], (int)(val.element_size),
+             (val.element_size == 1) ? "" : val.little_endian ? "le" : "be",
+             val.clamped ? "c" : "");
+    m_log += buf;
+
+    uint8_t native[64];
+    size_t n = val.CopyToNative(native, sizeof(native));
+    if (n != (val.NumElements() * val.element_size)) {
+      return "LogTypedArrayCallbacks: too many elements";
+    }
+    for (size_t i = 0; i < n; i += val.element_size) {
+      uint64_t x = 0;
+      switch (val.element_size) {
+        case 1:
+          x = native[i];
+          break;
+        case 2: {
+          uint16_t y;
+          memcpy(&y, &native[i], 2);
+          x = y;
+          break;
+        }
+        case 4: {
+          uint32_t y;
+          memcpy(&y, &native[i], 4);
+          x = y;
+          break;
+        }
+        case 8:
+          memcpy(&x, &native[i], 8);
+          break;
+        default:
+          return "LogTypedArrayCallbacks: unsupported element_size";
+      }
+      snprintf(buf, sizeof(buf), "%s%0*" PRIX64, (i > 0) ? "," : "",
+               (int)(2 * val.element_size), x);
+      m_log += buf;
+    }
+    return Log("");
+  }
+};
+
+// decode_cbor_to_log decodes src (as CBOR) and sets *log to the callbacks'
+// log or, on failure, to the error message prefixed by "error:". The
+// typed_arrays argument is whether AppendTypedArray is overridden.
+const char*  //
+decode_cbor_to_log(std::string* log,
+                   wuffs_base__slice_u8 src,
+                   bool typed_arrays) {
+  LogTypedArrayCallbacks typed_array_callbacks;
+  LogCborCallbacks plain_callbacks;
+  LogCborCallbacks& callbacks =
+      typed_arrays ? typed_array_callbacks : plain_callbacks;
+  wuffs_aux::sync_io::MemoryInput input(src.ptr, src.len);
+  wuffs_aux::DecodeCborResult result = wuffs_aux::DecodeCbor(callbacks, input);
+  if (!result.error_message.empty()) {
+    *log = "error:" + result.error_message;
+  } else {
+    *log = std::move(callbacks.m_log);
+  }
+  return NULL;
+}
+
+// ---------------- CborEncoder Tests
+
+const char*  //
+test_wuffs_aux_cbor_encoder_round_trip() {
+  CHECK_FOCUS(__func__);
+
+  uint8_t bytes[300];
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    bytes[i] = (uint8_t)(i);
+  }
+
+  // Use a small staging buffer, so that CopyOut is called more than once.
+  uint8_t staging[16];
+  wuffs_aux::sync_io::MemoryOutput output(g_have_array_u8,
+                                          sizeof(g_have_array_u8));
+  wuffs_aux::CborEncoder enc(output, wuffs_base__make_slice_u8(staging, 16));
+
+  std::string z;
+  z += enc.WriteIndefiniteHead(4);
+  // Floats.
+  z += enc.WriteF64(0.0);
+  z += enc.WriteF64(-0.0);
+  z += enc.WriteF64(1.5);
+  z += enc.WriteF64(1e300);
+  z += enc.WriteF64(-1.0 / 0.0);
+  // Integers, including negative integers beyond int64_t's range.
+  z += enc.WriteI64(-1);
+  z += enc.WriteI64(INT64_MIN);
+  z += enc.WriteU64(UINT64_MAX);
+  z += enc.WriteMinus1MinusX(0x8000000000000000ull);
+  z += enc.WriteMinus1MinusX(UINT64_MAX);
+  // Byte strings.
+  z += enc.WriteByteString(bytes, 0);
+  z += enc.WriteByteString(bytes, 3);
+  z += enc.WriteByteString(bytes, sizeof(bytes));
+  // Tags.
+  z += enc.WriteCborTag(1);
+  z += enc.WriteU64(1234567890);
+  z += enc.WriteCborTag(UINT64_MAX);
+  z += enc.WriteTextString("abc", 3);
+  // Other values, in a map.
+  z += enc.WriteHead(5, 2);
+  z += enc.WriteTextString("k", 1);
+  z += enc.WriteBool(true);
+  z += enc.WriteCborSimpleValue(16);
+  z += enc.WriteUndefined();
+  z += enc.WriteBreak();
+  z += enc.Flush();
+  if (!z.empty()) {
+    RETURN_FAIL("CborEncoder: %s", z.c_str());
+  }
+
+  std::string have;
+  CHECK_STRING(decode_cbor_to_log(
+      &have, wuffs_base__make_slice_u8(g_have_array_u8, output.Length()),
+      false));
+
+  std::string bytes_300 = "bytes:";
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    char buf[4];
+    snprintf(buf, sizeof(buf), "%02X", bytes[i]);
+    bytes_300 += buf;
+  }
+  std::string want =
+      "[ "
+      "f64:0x0000000000000000 f64:0x8000000000000000 f64:0x3FF8000000000000 "
+      "f64:0x7E37E43C8800759C f64:0xFFF0000000000000 "
+      "i64:-1 i64:-9223372036854775808 u64:18446744073709551615 "
+      "m1mx:9223372036854775808 m1mx:18446744073709551615 "
+      "bytes: bytes:000102 " +
+      bytes_300 +
+      " "
+      "tag:1 u64:1234567890 tag:18446744073709551615 text:abc "
+      "{ text:k true simple:16 undefined } ] ";
+  if (have != want) {
+    RETURN_FAIL("decoded:\nhave \"%s\"\nwant \"%s\"", have.c_str(),
+                want.c_str());
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_cbor_encoder_shortest_f64() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    double val;
+    size_t want_len;
+  } test_cases[] = {
+      {0.0, 3},       //
+      {1.5, 3},       //
+      {65504.0, 3},   //
+      {100000.0, 5},  //
+      {1.1, 9},       //
+      {1e300, 9},     //
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_aux::sync_io::MemoryOutput output(g_have_array_u8,
+                                            sizeof(g_have_array_u8));
+    wuffs_aux::CborEncoder enc(output);
+    std::string z = enc.WriteF64(test_cases[tc].val);
+    if (z.empty()) {
+      z = enc.Flush();
+    }
+    if (!z.empty()) {
+      RETURN_FAIL("tc=%d: CborEncoder: %s", (int)(tc), z.c_str());
+    } else if (output.Length() != test_cases[tc].want_len) {
+      RETURN_FAIL("tc=%d: length: have %d, want %d", (int)(tc),
+                  (int)(output.Length()), (int)(test_cases[tc].want_len));
+    }
+  }
+  return NULL;
+}
+
+// ---------------- DecodeCbor Typed Array Tests
+
+const char*  //
+test_wuffs_aux_cbor_decode_typed_arrays() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    const char* src;
+    size_t src_len;
+    const char* want_typed;  // With AppendTypedArray overridden.
+    const char* want_plain;  // With the default AppendTypedArray.
+  } test_cases[] = {
+      // uint8 (tag 64) and uint8 clamped (tag 68).
+      {"\xD8\x40\x42\x01\xFF", 5,  //
+       "typed:64:u1:01,FF ", "tag:64 bytes:01FF "},
+      {"\xD8\x44\x41\x80", 4,  //
+       "typed:68:u1c:80 ", "tag:68 bytes:80 "},
+      // uint16, big-endian (tag 65) and little-endian (tag 69).
+      {"\xD8\x41\x44\x01\x02\x03\x04", 7,  //
+       "typed:65:u2be:0102,0304 ", "tag:65 bytes:01020304 "},
+      {"\xD8\x45\x44\x01\x02\x03\x04", 7,  //
+       "typed:69:u2le:0201,0403 ", "tag:69 bytes:01020304 "},
+      // sint32, little-endian (tag 78).
+      {"\xD8\x4E\x44\xFE\xFF\xFF\xFF", 7,  //
+       "typed:78:s4le:FFFFFFFE ", "tag:78 bytes:FEFFFFFF "},
+      // float64, big-endian (tag 82).
+      {"\xD8\x52\x48\x3F\xF8\x00\x00\x00\x00\x00\x00", 11,  //
+       "typed:82:f8be:3FF8000000000000 ", "tag:82 bytes:3FF8000000000000 "},
+      // An empty byte string.
+      {"\xD8\x55\x40", 3,  //
+       "typed:85:f4le: ", "tag:85 bytes: "},
+      // Odd lengths: 3 bytes of uint16 and 6 bytes of float32.
+      {"\xD8\x45\x43\x01\x02\x03", 6,  //
+       "tag:69 bytes:010203 ", "tag:69 bytes:010203 "},
+      {"\xD8\x51\x46\x00\x00\x80\x3F\x00\x00", 9,  //
+       "tag:81 bytes:0000803F0000 ", "tag:81 bytes:0000803F0000 "},
+      // Typed array tags wrapping non-byte-strings.
+      {"\xD8\x45\x63\x61\x62\x63", 6,  //
+       "tag:69 text:abc ", "tag:69 text:abc "},
+      {"\xD8\x41\x82\x01\x02", 5,  //
+       "tag:65 [ u64:1 u64:2 ] ", "tag:65 [ u64:1 u64:2 ] "},
+      // Tag 76 is reserved, not a typed array.
+      {"\xD8\x4C\x41\x01", 4,  //
+       "tag:76 bytes:01 ", "tag:76 bytes:01 "},
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    for (int typed = 0; typed < 2; typed++) {
+      std::string have;
+      CHECK_STRING(decode_cbor_to_log(
+          &have,
+          wuffs_base__make_slice_u8((uint8_t*)(test_cases[tc].src),
+                                    test_cases[tc].src_len),
+          typed));
+      const char* want =
+          typed ? test_cases[tc].want_typed : test_cases[tc].want_plain;
+      if (have != want) {
+        RETURN_FAIL("tc=%d, typed=%d: have \"%s\", want \"%s\"", (int)(tc),
+                    typed, have.c_str(), want);
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_cbor_typed_array_copy_to_native() {
+  CHECK_FOCUS(__func__);
+
+  // Five big-endian uint32 elements, copied to a 13-byte dst: only three
+  // whole elements fit.
+  const uint8_t src[20] = {
+      0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+      0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78,
+  };
+  wuffs_aux::CborTypedArray val(66, src, sizeof(src));
+  if (val.NumElements() != 5) {
+    RETURN_FAIL("NumElements: have %d, want 5", (int)(val.NumElements()));
+  }
+  uint32_t dst[4] = {0};
+  size_t n = val.CopyToNative(dst, 13);
+  if (n != 12) {
+    RETURN_FAIL("CopyToNative: have %d, want 12", (int)(n));
+  }
+  const uint32_t want[4] = {0x00000001, 0x00000100, 0x00010000, 0x00000000};
+  for (int i = 0; i < 4; i++) {
+    if (dst[i] != want[i]) {
+      RETURN_FAIL("dst[%d]: have 0x%08" PRIX32 ", want 0x%08" PRIX32, i,
+                  dst[i], want[i]);
+    }
+  }
+  return NULL;
+}
+
+// ---------------- Transcoder Tests
+
+// transcode_json_to_cbor_to_json converts src (JSON) to CBOR, in
+// g_work_array_u8, and back to JSON, in g_have_array_u8, setting *dst to the
+// final JSON.
+const char*  //
+transcode_json_to_cbor_to_json(std::string* dst, const char* src) {
+  wuffs_aux::sync_io::MemoryInput input0(src, strlen(src));
+  wuffs_aux::sync_io::MemoryOutput output0(g_work_array_u8,
+                                           sizeof(g_work_array_u8));
+  wuffs_aux::DecodeJsonResult result0 =
+      wuffs_aux::TranscodeJsonToCbor(output0, input0);
+  if (!result0.error_message.empty()) {
+    RETURN_FAIL("TranscodeJsonToCbor: %s", result0.error_message.c_str());
+  }
+
+  wuffs_aux::sync_io::MemoryInput input1(g_work_array_u8, output0.Length());
+  wuffs_aux::sync_io::MemoryOutput output1(g_have_array_u8,
+                                           sizeof(g_have_array_u8));
+  wuffs_aux::DecodeCborResult result1 =
+      wuffs_aux::TranscodeCborToJson(output1, input1);
+  if (!result1.error_message.empty()) {
+    RETURN_FAIL("TranscodeCborToJson: %s", result1.error_message.c_str());
+  }
+  *dst = std::string((const char*)(g_have_array_u8), output1.Length());
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_cbor_transcode_json_round_trip() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    const char* src;
+    const char* want;
+  } test_cases[] = {
+      {"[]", "[]"},
+      {" { \"a\" : [ 1 , -2 ] , \"b\" : { } } ", "{\"a\":[1,-2],\"b\":{}}"},
+      {"[0.5, -1.25, 1e300, -0.0]", "[0.5,-1.25,1e+300,-0]"},
+      {"[9223372036854775807, -9223372036854775808]",
+       "[9223372036854775807,-9223372036854775808]"},
+      {"18446744073709551615", "18446744073709551615"},
+      {"[true, false, null]", "[true,false,null]"},
+      {"\"tab\\tquote\\\"\\u00E9\\uD83D\\uDE00\"",
+       "\"tab\\tquote\\\"\xC3\xA9\xF0\x9F\x98\x80\""},
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    std::string have;
+    CHECK_STRING(transcode_json_to_cbor_to_json(&have, test_cases[tc].src));
+    if (have != test_cases[tc].want) {
+      RETURN_FAIL("tc=%d: have \"%s\", want \"%s\"", (int)(tc), have.c_str(),
+                  test_cases[tc].want);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_cbor_transcode_cbor_to_json() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    const char* src;
+    size_t src_len;
+    const char* want;
+  } test_cases[] = {
+      // Byte strings become base64url.
+      {"\x43\xFB\xFF\x00", 4, "\"-_8A\""},
+      // Tags are dropped.
+      {"\xC1\x1A\x49\x96\x02\xD2", 6, "1234567890"},
+      // Negative integers beyond int64_t's range.
+      {"\x3B\x80\x00\x00\x00\x00\x00\x00\x00", 9, "-9223372036854775809"},
+      {"\x3B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF", 9, "-18446744073709551616"},
+      // Undefined, simple values and non-finite floats become null.
+      {"\x83\xF7\xF0\xF9\x7C\x00", 6, "[null,null,null]"},
+      // Integer map keys are quoted.
+      {"\xA1\x20\xF5", 3, "{\"-1\":true}"},
+      // Indefinite-length strings are concatenated.
+      {"\x7F\x61\x61\x62\x62\x63\xFF", 7, "\"abc\""},
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_aux::sync_io::MemoryInput input(test_cases[tc].src,
+                                          test_cases[tc].src_len);
+    wuffs_aux::sync_io::MemoryOutput output(g_have_array_u8,
+                                            sizeof(g_have_array_u8));
+    wuffs_aux::DecodeCborResult result =
+        wuffs_aux::TranscodeCborToJson(output, input);
+    if (!result.error_message.empty()) {
+      RETURN_FAIL("tc=%d: %s", (int)(tc), result.error_message.c_str());
+    }
+    std::string have((const char*)(g_have_array_u8), output.Length());
+    if (have != test_cases[tc].want) {
+      RETURN_FAIL("tc=%d: have \"%s\", want \"%s\"", (int)(tc), have.c_str(),
+                  test_cases[tc].want);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_cbor_transcode_rejections() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    const char* src;
+    size_t src_len;
+    const char* want_error;  // NULL means any non-empty error message.
+  } cbor_test_cases[] = {
+      // A map with an array key.
+      {"\xA1\x80\x00", 3, wuffs_aux::TranscodeCborToJson_UnsupportedMapKey},
+      // A map with a float key.
+      {"\xA1\xF9\x3C\x00\x00", 5,
+       wuffs_aux::TranscodeCborToJson_UnsupportedMapKey},
+      // Truncated.
+      {"\x82\x01", 2, NULL},
+      // Reserved additional information (28).
+      {"\x1C", 1, NULL},
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(cbor_test_cases); tc++) {
+    wuffs_aux::sync_io::MemoryInput input(cbor_test_cases[tc].src,
+                                          cbor_test_cases[tc].src_len);
+    wuffs_aux::sync_io::MemoryOutput output(g_have_array_u8,
+                                            sizeof(g_have_array_u8));
+    wuffs_aux::DecodeCborResult result =
+        wuffs_aux::TranscodeCborToJson(output, input);
+    if (result.error_message.empty()) {
+      RETURN_FAIL("cbor tc=%d: have no error, want one", (int)(tc));
+    } else if (cbor_test_cases[tc].want_error &&
+               (result.error_message != cbor_test_cases[tc].want_error)) {
+      RETURN_FAIL("cbor tc=%d: have \"%s\", want \"%s\"", (int)(tc),
+                  result.error_message.c_str(), cbor_test_cases[tc].want_error);
+    }
+  }
+
+  const char* json_test_cases[] = {
+      "[1,",        // Truncated.
+      "{1:2}",      // Non-string key.
+      "[1 2]",      // Missing comma.
+      "\"\\uD800",  // Truncated string.
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(json_test_cases); tc++) {
+    wuffs_aux::sync_io::MemoryInput input(json_test_cases[tc],
+                                          strlen(json_test_cases[tc]));
+    wuffs_aux::sync_io::MemoryOutput output(g_have_array_u8,
+                                            sizeof(g_have_array_u8));
+    wuffs_aux::DecodeJsonResult result =
+        wuffs_aux::TranscodeJsonToCbor(output, input);
+    if (result.error_message.empty()) {
+      RETURN_FAIL("json tc=%d: have no error, want one", (int)(tc));
+    }
+  }
+
+  // The output is too short.
+  {
+    const char* src = "[\"0123456789\"]";
+    wuffs_aux::sync_io::MemoryInput input(src, strlen(src));
+    wuffs_aux::sync_io::MemoryOutput output(g_have_array_u8, 4);
+    wuffs_aux::DecodeJsonResult result =
+        wuffs_aux::TranscodeJsonToCbor(output, input);
+    if (result.error_message.empty()) {
+      RETURN_FAIL("short output: have no error, want one");
+    }
+  }
+  return NULL;
+}
+
+// ---------------- Mimic Tests
+
+// No mimic tests.
+
+// ---------------- Tests
+
+proc g_tests[] = {
+
+    test_wuffs_aux_cbor_decode_typed_arrays,
+    test_wuffs_aux_cbor_encoder_round_trip,
+    test_wuffs_aux_cbor_encoder_shortest_f64,
+    test_wuffs_aux_cbor_transcode_cbor_to_json,
+    test_wuffs_aux_cbor_transcode_json_round_trip,
+    test_wuffs_aux_cbor_transcode_rejections,
+    test_wuffs_aux_cbor_typed_array_copy_to_native,
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+// No benches.
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "aux/cbor";
+  return test_main(argc, argv, g_tests, g_benches);
+}
@@ -0,0 +1,299 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program tests the wuffs_aux C++ image API: ImageDecodeSession, by
+comparing it to DecodeImage. Unlike the test/c/std programs, it is C++, not C,
+and it is not run by the "wuffs test" command.
+
+To manually run this test:
+
+for CXX in clang++ g++; do
+  $CXX -std=c++11 -Wall -Werror image.cc && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+*/
+
+#if defined(__cplusplus) && (__cplusplus < 201103L)
+#error "This C++ program requires -std=c++11 or later"
+#endif
+
+#include <string>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__AUX__BASE
+#define WUFFS_CONFIG__MODULE__AUX__IMAGE
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__BMP
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__GIF
+#define WUFFS_CONFIG__MODULE__ICO
+#define WUFFS_CONFIG__MODULE__JPEG
+#define WUFFS_CONFIG__MODULE__LZW
+#define WUFFS_CONFIG__MODULE__NETPBM
+#define WUFFS_CONFIG__MODULE__NIE
+#define WUFFS_CONFIG__MODULE__PNG
+#define WUFFS_CONFIG__MODULE__QOI
+#define WUFFS_CONFIG__MODULE__TGA
+#define WUFFS_CONFIG__MODULE__TIFF
+#define WUFFS_CONFIG__MODULE__WBMP
+#define WUFFS_CONFIG__MODULE__WEBP
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+
+// ---------------- Image Helpers
+
+// g_image_filenames are the test/data images that the ImageDecodeSession
+// tests decode. They cover every image format that wuffs_aux supports, as
+// well as animated, interlaced, redirected (ICO wrapping PNG), seeking (TIFF)
+// and truncated images.
+const char* g_image_filenames[] = {
+    "test/data/animated-red-blue.apng",
+    "test/data/animated-red-blue.gif",
+    "test/data/bricks-color.16bit.ppm",
+    "test/data/bricks-color.a2r10g10b10.bmp",
+    "test/data/bricks-color.lzw.tiff",
+    "test/data/bricks-color.qoi",
+    "test/data/bricks-color.rgb565.bmp",
+    "test/data/bricks-color.tga",
+    "test/data/bricks-dither.gif",
+    "test/data/bricks-gray.16bit.pgm",
+    "test/data/bricks-gray.1bpp.bmp",
+    "test/data/bricks-gray.jpeg",
+    "test/data/bricks-gray.packbits.tiff",
+    "test/data/bricks-nodither.lossless.webp",
+    "test/data/bricks-nodither.wbmp",
+    "test/data/crude-flag.nie",
+    "test/data/hat.lossy.webp",
+    "test/data/hat.rgba.qoi",
+    "test/data/hat.rgba.tiff",
+    "test/data/hibiscus.primitive.tiled.tiff",
+    "test/data/hippopotamus.interlaced.gif",
+    "test/data/hippopotamus.interlaced.png",
+    "test/data/hippopotamus.interlaced.truncated.gif",
+    "test/data/hippopotamus.interlaced.truncated.png",
+    "test/data/hippopotamus.multipage.tiff",
+    "test/data/hippopotamus.regular.ico",
+    "test/data/hippopotamus.regular.truncated.png",
+    "test/data/muybridge.gif",
+    "test/data/pjw-thumbnail.bilevel.tiff",
+    "test/data/pjw-thumbnail.jpeg",
+    "test/data/pjw-thumbnail.lossless.webp",
+    "test/data/red-blue-gradient.gamma2dot2.png",
+    "test/data/rgb24png.bmp",
+};
+
+// g_rng_state is the state of a simple pseudo-random number generator, for
+// random (but reproducible) chunk sizes.
+uint32_t g_rng_state = 1;
+
+size_t  //
+next_chunk_length() {
+  g_rng_state = (g_rng_state * 1103515245u) + 12345u;
+  return 1 + ((g_rng_state >> 16) % 4096);
+}
+
+const char*  //
+check_pixbufs_equal(const char* filename,
+                    wuffs_base__pixel_buffer* have,
+                    wuffs_base__pixel_buffer* want) {
+  wuffs_base__pixel_config* have_pixcfg = &have->pixcfg;
+  wuffs_base__pixel_config* want_pixcfg = &want->pixcfg;
+  if ((have_pixcfg->pixel_format().repr != want_pixcfg->pixel_format().repr) ||
+      (have_pixcfg->width() != want_pixcfg->width()) ||
+      (have_pixcfg->height() != want_pixcfg->height())) {
+    RETURN_FAIL("%s: pixel configurations differ", filename);
+  }
+
+  size_t row_length = have_pixcfg->width() *
+                      (have_pixcfg->pixel_format().bits_per_pixel() / 8);
+  wuffs_base__table_u8 have_table = have->plane(0);
+  wuffs_base__table_u8 want_table = want->plane(0);
+  for (uint32_t y = 0; y < have_pixcfg->height(); y++) {
+    if (memcmp(have_table.ptr + (y * have_table.stride),
+               want_table.ptr + (y * want_table.stride), row_length)) {
+      RETURN_FAIL("%s: pixels differ at row %" PRIu32, filename, y);
+    }
+  }
+  return NULL;
+}
+
+// do_test_image_decode_session decodes filename with DecodeImage and then
+// with ImageDecodeSession, fed in chunks whose lengths come from
+// chunk_length_func. DecodeImage only decodes the first frame, so the
+// session's pixels are compared after its first Frame Event.
+const char*  //
+do_test_image_decode_session(const char* filename,
+                             size_t (*chunk_length_func)()) {
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, filename));
+
+  wuffs_aux::DecodeImageCallbacks callbacks;
+  wuffs_aux::sync_io::MemoryInput input(src.data.ptr, src.meta.wi);
+  wuffs_aux::DecodeImageResult want =
+      wuffs_aux::DecodeImage(callbacks, input);
+
+  wuffs_aux::ImageDecodeSession session(callbacks);
+  wuffs_aux::ImageDecodeSession::Event event =
+      wuffs_aux::ImageDecodeSession::Event::NeedMore;
+  size_t pos = 0;
+  while (event == wuffs_aux::ImageDecodeSession::Event::NeedMore) {
+    if (pos >= src.meta.wi) {
+      RETURN_FAIL("%s: NeedMore after closing", filename);
+    }
+    size_t n = chunk_length_func();
+    if (n > (src.meta.wi - pos)) {
+      n = src.meta.wi - pos;
+    }
+    event = session.Feed(wuffs_base__make_slice_u8(src.data.ptr + pos, n),
+                         (pos + n) == src.meta.wi);
+    pos += n;
+  }
+
+  if (!want.error_message.empty()) {
+    if (event != wuffs_aux::ImageDecodeSession::Event::Error) {
+      RETURN_FAIL("%s: have Event %d, want Error", filename, (int)(event));
+    } else if (session.ErrorMessage() != want.error_message) {
+      RETURN_FAIL("%s: have \"%s\", want \"%s\"", filename,
+                  session.ErrorMessage().c_str(),
+                  want.error_message.c_str());
+    }
+    return NULL;
+  } else if (event != wuffs_aux::ImageDecodeSession::Event::Frame) {
+    RETURN_FAIL("%s: have Event %d (\"%s\"), want Frame", filename,
+                (int)(event), session.ErrorMessage().c_str());
+  }
+  return check_pixbufs_equal(filename, &session.Pixbuf(), &want.pixbuf);
+}
+
+size_t  //
+one_byte_chunk_length() {
+  return 1;
+}
+
+// ---------------- Image Tests
+
+const char*  //
+test_wuffs_aux_image_decode_session_max_incl_buffer_length() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/muybridge.gif"));
+
+  // Feed the whole animated image in one chunk. After the first frame, the
+  // session has to buffer the rest, which is longer than 4096 bytes.
+  for (int i = 0; i < 2; i++) {
+    uint64_t max_incl_buffer_length = (i == 0) ? 4096 : UINT64_MAX;
+    wuffs_aux::DecodeImageCallbacks callbacks;
+    wuffs_aux::ImageDecodeSession session(
+        callbacks, wuffs_aux::DecodeImageArgQuirks::DefaultValue(),
+        wuffs_aux::DecodeImageArgPixelBlend::DefaultValue(),
+        wuffs_aux::DecodeImageArgBackgroundColor::DefaultValue(),
+        wuffs_aux::DecodeImageArgMaxInclDimension::DefaultValue(),
+        wuffs_aux::ImageDecodeSessionArgMaxInclBufferLength(
+            max_incl_buffer_length));
+    wuffs_aux::ImageDecodeSession::Event event = session.Feed(
+        wuffs_base__make_slice_u8(src.data.ptr, src.meta.wi), true);
+
+    wuffs_aux::ImageDecodeSession::Event want_event =
+        (i == 0) ? wuffs_aux::ImageDecodeSession::Event::Error
+                 : wuffs_aux::ImageDecodeSession::Event::Frame;
+    std::string want_error_message =
+        (i == 0) ? wuffs_aux::ImageDecodeSession_MaxInclBufferLengthExceeded
+                 : "";
+    if (event != want_event) {
+      RETURN_FAIL("i=%d: have Event %d, want %d", i, (int)(event),
+                  (int)(want_event));
+    } else if (session.ErrorMessage() != want_error_message) {
+      RETURN_FAIL("i=%d: have \"%s\", want \"%s\"", i,
+                  session.ErrorMessage().c_str(), want_error_message.c_str());
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_image_decode_session_one_byte_chunks() {
+  CHECK_FOCUS(__func__);
+  for (size_t i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(g_image_filenames); i++) {
+    CHECK_STRING(do_test_image_decode_session(g_image_filenames[i],
+                                              &one_byte_chunk_length));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_image_decode_session_random_chunks() {
+  CHECK_FOCUS(__func__);
+  g_rng_state = 1;
+  for (size_t i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(g_image_filenames); i++) {
+    CHECK_STRING(do_test_image_decode_session(g_image_filenames[i],
+                                              &next_chunk_length));
+  }
+  return NULL;
+}
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_aux_image_decode_session_max_incl_buffer_length,
+    test_wuffs_aux_image_decode_session_one_byte_chunks,
+    test_wuffs_aux_image_decode_session_random_chunks,
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+// No benches.
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "aux/image";
+  return test_main(argc, argv, g_tests, g_benches);
+}
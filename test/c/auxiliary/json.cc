@@ -0,0 +1,369 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program tests the wuffs_aux C++ JSON API: WriteJsonTokenCache and
+ReplayJsonTokenCache. Unlike the test/c/std programs, it is C++, not C, and it
+is not run by the "wuffs test" command.
+
+To manually run this test:
+
+for CXX in clang++ g++; do
+  $CXX -std=c++11 -Wall -Werror json.cc && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+*/
+
+#if defined(__cplusplus) && (__cplusplus < 201103L)
+#error "This C++ program requires -std=c++11 or later"
+#endif
+
+#include <string>
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__AUX__BASE
+#define WUFFS_CONFIG__MODULE__AUX__JSON
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__JSON
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+
+// ---------------- JSON Helpers
+
+// LogJsonCallbacks records DecodeJson's callbacks as a space-separated string,
+// such as "[ i64:1 text:a ]", followed by the error message (if any) and the
+// cursor position.
+class LogJsonCallbacks : public wuffs_aux::DecodeJsonCallbacks {
+ public:
+  std::string m_log;
+
+  std::string Log(const std::string& s) {
+    m_log += s;
+    m_log += ' ';
+    return "";
+  }
+
+  std::string AppendNull() override { return Log("null"); }
+  std::string AppendBool(bool val) override {
+    return Log(val ? "true" : "false");
+  }
+  std::string AppendF64(double val) override {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "f64:0x%016" PRIX64,
+             wuffs_base__ieee_754_bit_representation__from_f64_to_u64(val));
+    return Log(buf);
+  }
+  std::string AppendI64(int64_t val) override {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "i64:%" PRId64, val);
+    return Log(buf);
+  }
+  std::string AppendTextString(std::string&& val) override {
+    return Log("text:" + val);
+  }
+  std::string Push(uint32_t flags) override {
+    return Log((flags & WUFFS_BASE__TOKEN__VBD__STRUCTURE__TO_DICT) ? "{"
+                                                                    : "[");
+  }
+  std::string Pop(uint32_t flags) override {
+    return Log((flags & WUFFS_BASE__TOKEN__VBD__STRUCTURE__FROM_DICT) ? "}"
+                                                                      : "]");
+  }
+  void Done(wuffs_aux::DecodeJsonResult& result,
+            wuffs_aux::sync_io::Input& input,
+            wuffs_aux::IOBuffer& buffer) override {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "pos:%" PRIu64, result.cursor_position);
+    Log("error:" + result.error_message);
+    Log(buf);
+  }
+};
+
+// write_json_token_cache writes src's token cache to g_work_array_u8, setting
+// *dst_len to its length.
+const char*  //
+write_json_token_cache(size_t* dst_len,
+                       wuffs_base__slice_u8 src,
+                       wuffs_aux::DecodeJsonArgQuirks quirks) {
+  wuffs_aux::sync_io::MemoryInput input(src.ptr, src.len);
+  wuffs_aux::sync_io::MemoryOutput output(g_work_array_u8,
+                                          sizeof(g_work_array_u8));
+  wuffs_aux::DecodeJsonResult result =
+      wuffs_aux::WriteJsonTokenCache(output, input, quirks);
+  if (!result.error_message.empty()) {
+    RETURN_FAIL("WriteJsonTokenCache: %s", result.error_message.c_str());
+  }
+  *dst_len = output.Length();
+  return NULL;
+}
+
+// replay_json_token_cache returns the error message from replaying the
+// g_work_array_u8[:len] token cache.
+std::string  //
+replay_json_token_cache(size_t len,
+                        wuffs_aux::DecodeJsonArgQuirks quirks =
+                            wuffs_aux::DecodeJsonArgQuirks::DefaultValue()) {
+  LogJsonCallbacks callbacks;
+  return wuffs_aux::ReplayJsonTokenCache(callbacks, g_work_array_u8, len,
+                                         quirks)
+      .error_message;
+}
+
+// rewrite_json_token_cache_checksums recalculates the checksums (other than
+// the quirks') of the g_work_array_u8[:len] token cache.
+const char*  //
+rewrite_json_token_cache_checksums(size_t len) {
+  uint64_t num_tokens =
+      wuffs_base__peek_u64le__no_bounds_check(&g_work_array_u8[16]);
+  size_t src_start = 40 + (8 * num_tokens);
+
+  wuffs_crc32__ieee_hasher h;
+  CHECK_STATUS("initialize", h.initialize(sizeof h, WUFFS_VERSION,
+                                          WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+  wuffs_base__poke_u32le__no_bounds_check(
+      &g_work_array_u8[32],
+      h.update_u32(wuffs_base__make_slice_u8(&g_work_array_u8[src_start],
+                                             len - src_start)));
+
+  CHECK_STATUS("initialize", h.initialize(sizeof h, WUFFS_VERSION,
+                                          WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+  h.update_u32(wuffs_base__make_slice_u8(&g_work_array_u8[0], 36));
+  wuffs_base__poke_u32le__no_bounds_check(
+      &g_work_array_u8[36],
+      h.update_u32(wuffs_base__make_slice_u8(&g_work_array_u8[40], len - 40)));
+  return NULL;
+}
+
+// ---------------- JSON Token Cache Tests
+
+const char*  //
+test_wuffs_aux_json_token_cache_bad_cache() {
+  CHECK_FOCUS(__func__);
+
+  const char* src = "[1, {\"a\": [true]}]";
+  size_t len = 0;
+  CHECK_STRING(write_json_token_cache(
+      &len, wuffs_base__make_slice_u8((uint8_t*)(src), strlen(src)),
+      wuffs_aux::DecodeJsonArgQuirks::DefaultValue()));
+  std::string have = replay_json_token_cache(len);
+  if (!have.empty()) {
+    RETURN_FAIL("original: have \"%s\", want \"\"", have.c_str());
+  }
+
+  // Truncate the cache.
+  have = replay_json_token_cache(len - 1);
+  if (have != wuffs_aux::ReplayJsonTokenCache_BadCache) {
+    RETURN_FAIL("truncated: have \"%s\", want \"%s\"", have.c_str(),
+                wuffs_aux::ReplayJsonTokenCache_BadCache);
+  }
+
+  // Flip a byte in each of the header's token count, the first token, the
+  // last token, the source bytes and the checksums.
+  uint64_t num_tokens =
+      wuffs_base__peek_u64le__no_bounds_check(&g_work_array_u8[16]);
+  size_t offsets[] = {
+      16, 32, 36, 40, 40 + (8 * num_tokens) - 1, 40 + (8 * num_tokens),
+  };
+  for (size_t i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(offsets); i++) {
+    g_work_array_u8[offsets[i]] ^= 0x01;
+    have = replay_json_token_cache(len);
+    g_work_array_u8[offsets[i]] ^= 0x01;
+    if (have.empty()) {
+      RETURN_FAIL("offset=%d: have no error, want one", (int)(offsets[i]));
+    }
+  }
+
+  // Swap the token and source byte counts' balance: one fewer token and 8
+  // more source bytes keeps the overall length consistent, but the checksum
+  // covering the header catches it.
+  wuffs_base__poke_u64le__no_bounds_check(&g_work_array_u8[16],
+                                          num_tokens - 1);
+  wuffs_base__poke_u64le__no_bounds_check(
+      &g_work_array_u8[24],
+      wuffs_base__peek_u64le__no_bounds_check(&g_work_array_u8[24]) + 8);
+  have = replay_json_token_cache(len);
+  if (have != wuffs_aux::ReplayJsonTokenCache_ChecksumMismatch) {
+    RETURN_FAIL("counts: have \"%s\", want \"%s\"", have.c_str(),
+                wuffs_aux::ReplayJsonTokenCache_ChecksumMismatch);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_json_token_cache_quirks_mismatch() {
+  CHECK_FOCUS(__func__);
+
+  const char* src = "/* c */ [1]";
+  uint32_t quirks[1] = {WUFFS_JSON__QUIRK_ALLOW_COMMENT_BLOCK};
+  size_t len = 0;
+  CHECK_STRING(write_json_token_cache(
+      &len, wuffs_base__make_slice_u8((uint8_t*)(src), strlen(src)),
+      wuffs_aux::DecodeJsonArgQuirks(&quirks[0], 1)));
+
+  std::string have =
+      replay_json_token_cache(len, wuffs_aux::DecodeJsonArgQuirks(quirks, 1));
+  if (!have.empty()) {
+    RETURN_FAIL("same quirks: have \"%s\", want \"\"", have.c_str());
+  }
+  have = replay_json_token_cache(len);
+  if (have != wuffs_aux::ReplayJsonTokenCache_ChecksumMismatch) {
+    RETURN_FAIL("no quirks: have \"%s\", want \"%s\"", have.c_str(),
+                wuffs_aux::ReplayJsonTokenCache_ChecksumMismatch);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_json_token_cache_round_trip() {
+  CHECK_FOCUS(__func__);
+
+  struct {
+    const char* filename;
+    const char* json_pointer;
+  } test_cases[] = {
+      {"test/data/github-tags.json", ""},
+      {"test/data/json-things.unformatted.json", ""},
+      {"test/data/nobel-prizes.json", ""},
+      {"test/data/nobel-prizes.json", "/prizes/3/laureates/0"},
+      {"test/data/rfc-6901-json-pointer.json", ""},
+      {"test/data/rfc-6901-json-pointer.json", "/foo/1"},
+      {"test/data/rfc-6901-json-pointer.json", "/m~0n"},
+      {"test/data/rfc-6901-json-pointer.json", "/no such key"},
+  };
+
+  for (size_t tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_base__io_buffer src = wuffs_base__slice_u8__writer(g_src_slice_u8);
+    CHECK_STRING(read_file(&src, test_cases[tc].filename));
+    wuffs_aux::DecodeJsonArgJsonPointer json_pointer(
+        test_cases[tc].json_pointer);
+
+    LogJsonCallbacks want;
+    {
+      wuffs_aux::sync_io::MemoryInput input(src.data.ptr, src.meta.wi);
+      wuffs_aux::DecodeJson(want, input,
+                            wuffs_aux::DecodeJsonArgQuirks::DefaultValue(),
+                            json_pointer);
+    }
+
+    size_t len = 0;
+    CHECK_STRING(write_json_token_cache(
+        &len, wuffs_base__make_slice_u8(src.data.ptr, src.meta.wi),
+        wuffs_aux::DecodeJsonArgQuirks::DefaultValue()));
+    LogJsonCallbacks have;
+    wuffs_aux::ReplayJsonTokenCache(
+        have, g_work_array_u8, len,
+        wuffs_aux::DecodeJsonArgQuirks::DefaultValue(), json_pointer);
+
+    if (have.m_log != want.m_log) {
+      size_t i = 0;
+      while ((i < have.m_log.size()) && (i < want.m_log.size()) &&
+             (have.m_log[i] == want.m_log[i])) {
+        i++;
+      }
+      RETURN_FAIL("tc=%d: logs differ at byte %d:\nhave \"%.40s\"\nwant "
+                  "\"%.40s\"",
+                  (int)(tc), (int)(i), have.m_log.c_str() + i,
+                  want.m_log.c_str() + i);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_aux_json_token_cache_truncated_tokens() {
+  CHECK_FOCUS(__func__);
+
+  // Write a cache for "[[1]]" and then drop the final token (and its source
+  // byte), the outer "]", recalculating the checksums. Replaying it should
+  // fail, even though its checksums are valid.
+  const char* src = "[[1]]";
+  size_t len = 0;
+  CHECK_STRING(write_json_token_cache(
+      &len, wuffs_base__make_slice_u8((uint8_t*)(src), strlen(src)),
+      wuffs_aux::DecodeJsonArgQuirks::DefaultValue()));
+  uint64_t num_tokens =
+      wuffs_base__peek_u64le__no_bounds_check(&g_work_array_u8[16]);
+  if (num_tokens != 5) {
+    RETURN_FAIL("num_tokens: have %d, want 5", (int)(num_tokens));
+  }
+  size_t last_token = 40 + (8 * (num_tokens - 1));
+  memmove(&g_work_array_u8[last_token], &g_work_array_u8[last_token + 8],
+          len - (last_token + 8));
+  len -= 9;
+  wuffs_base__poke_u64le__no_bounds_check(&g_work_array_u8[16],
+                                          num_tokens - 1);
+  wuffs_base__poke_u64le__no_bounds_check(&g_work_array_u8[24],
+                                          strlen(src) - 1);
+  CHECK_STRING(rewrite_json_token_cache_checksums(len));
+
+  std::string have = replay_json_token_cache(len);
+  if (have != wuffs_aux::ReplayJsonTokenCache_BadCache) {
+    RETURN_FAIL("have \"%s\", want \"%s\"", have.c_str(),
+                wuffs_aux::ReplayJsonTokenCache_BadCache);
+  }
+  return NULL;
+}
+
+// ---------------- Mimic Tests
+
+// No mimic tests.
+
+// ---------------- Tests
+
+proc g_tests[] = {
+
+    test_wuffs_aux_json_token_cache_bad_cache,
+    test_wuffs_aux_json_token_cache_quirks_mismatch,
+    test_wuffs_aux_json_token_cache_round_trip,
+    test_wuffs_aux_json_token_cache_truncated_tokens,
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+// No benches.
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "aux/json";
+  return test_main(argc, argv, g_tests, g_benches);
+}
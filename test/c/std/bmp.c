@@ -129,6 +129,39 @@ test_wuffs_bmp_decode_truncated_input() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_bmp_decode_files() {
+  CHECK_FOCUS(__func__);
+
+  // Each file re-encodes bricks-color.bmp or bricks-gray.bmp, exercising a
+  // different pixel layout. The 16 bits per pixel files are lossy.
+  const struct {
+    const char* filename;
+    wuffs_base__color_u32_argb_premul final_pixel;
+  } test_cases[] = {
+      {"test/data/bricks-color.a2r10g10b10.bmp", 0xFF022460},
+      {"test/data/bricks-color.rgb555.bmp", 0xFF002163},
+      {"test/data/bricks-color.rgb565.bmp", 0xFF002463},
+      {"test/data/bricks-gray.1bpp.bmp", 0xFF000000},
+      {"test/data/bricks-gray.2bpp.bmp", 0xFF000000},
+      {"test/data/bricks-gray.4bpp.bmp", 0xFF000000},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_bmp__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_bmp__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    CHECK_STRING(do_test__wuffs_base__image_decoder(
+        wuffs_bmp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        test_cases[tc].filename, 0, SIZE_MAX, 160, 120,
+        test_cases[tc].final_pixel));
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_bmp_decode_frame_config() {
   CHECK_FOCUS(__func__);
@@ -226,6 +259,42 @@ bench_wuffs_bmp_decode_40k() {
       NULL, 0, "test/data/hat.bmp", 0, SIZE_MAX, 1000);
 }
 
+const char*  //
+bench_wuffs_bmp_decode_77k_1bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_bmp_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-gray.1bpp.bmp", 0, SIZE_MAX, 1000);
+}
+
+const char*  //
+bench_wuffs_bmp_decode_77k_4bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_bmp_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-gray.4bpp.bmp", 0, SIZE_MAX, 1000);
+}
+
+const char*  //
+bench_wuffs_bmp_decode_77k_16bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_bmp_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.rgb565.bmp", 0, SIZE_MAX, 1000);
+}
+
+const char*  //
+bench_wuffs_bmp_decode_77k_32bpp_bitfields() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_bmp_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.a2r10g10b10.bmp", 0, SIZE_MAX, 200);
+}
+
 // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -238,6 +307,7 @@ bench_wuffs_bmp_decode_40k() {
 
 proc g_tests[] = {
 
+    test_wuffs_bmp_decode_files,
     test_wuffs_bmp_decode_frame_config,
     test_wuffs_bmp_decode_interface,
     test_wuffs_bmp_decode_io_redirect,
@@ -255,6 +325,10 @@ proc g_tests[] = {
 proc g_benches[] = {
 
     bench_wuffs_bmp_decode_40k,
+    bench_wuffs_bmp_decode_77k_16bpp,
+    bench_wuffs_bmp_decode_77k_1bpp,
+    bench_wuffs_bmp_decode_77k_32bpp_bitfields,
+    bench_wuffs_bmp_decode_77k_4bpp,
 
 #ifdef WUFFS_MIMIC
 
@@ -153,6 +153,214 @@ golden_test g_deflate_romeo_fixed_gt = {
 
 // ---------------- Deflate Tests
 
+const char*  //
+test_wuffs_deflate_decode_bad_call_sequence() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  golden_test* gt = &g_deflate_romeo_gt;
+  CHECK_STRING(read_file(&src, gt->src_filename));
+  src.meta.ri = gt->src_offset0;
+  src.meta.wi = gt->src_offset1;
+
+  wuffs_deflate__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_deflate__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  // Decode only the first byte, so that transform_io suspends.
+  wuffs_base__io_buffer have = wuffs_base__ptr_u8__writer(g_have_array_u8, 1);
+  wuffs_base__status status =
+      wuffs_deflate__decoder__transform_io(&dec, &have, &src, g_work_slice_u8);
+  if (status.repr != wuffs_base__suspension__short_write) {
+    RETURN_FAIL("transform_io #0: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__suspension__short_write);
+  }
+
+  // Changing the quirks or priming the history, once decoding has started,
+  // is rejected.
+  status = wuffs_deflate__decoder__set_quirk(
+      &dec, WUFFS_DEFLATE__QUIRK_DST_HISTORY_IS_ADDRESSABLE, 1);
+  if (status.repr != wuffs_base__error__bad_call_sequence) {
+    RETURN_FAIL("set_quirk: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__error__bad_call_sequence);
+  }
+  // Unknown keys are still unsupported, not a bad call sequence.
+  status = wuffs_deflate__decoder__set_quirk(&dec, 0x12345678, 1);
+  if (status.repr != wuffs_base__error__unsupported_option) {
+    RETURN_FAIL("set_quirk (unknown key): have \"%s\", want \"%s\"",
+                status.repr, wuffs_base__error__unsupported_option);
+  }
+  wuffs_deflate__decoder__use_primed_history(&dec, 0);
+  have = wuffs_base__ptr_u8__writer(g_have_array_u8, IO_BUFFER_ARRAY_SIZE);
+  status =
+      wuffs_deflate__decoder__transform_io(&dec, &have, &src, g_work_slice_u8);
+  if (status.repr != wuffs_base__error__bad_call_sequence) {
+    RETURN_FAIL("transform_io #1: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__error__bad_call_sequence);
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_deflate_decode_dst_history_is_addressable() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  golden_test* gt = &g_deflate_pi_gt;
+  CHECK_STRING(read_file(&src, gt->src_filename));
+  CHECK_STRING(read_file(&want, gt->want_filename));
+
+  // Decode in 1000 byte pieces, with an empty workbuf. After each piece, the
+  // dst buffer is compacted so that it keeps (i == 0) everything, (i == 1)
+  // the last 32 KiB or (i == 2) nothing. Only the last case breaks the
+  // QUIRK_DST_HISTORY_IS_ADDRESSABLE promise.
+  const size_t keeps[3] = {SIZE_MAX, 0x8000, 0};
+  for (int i = 0; i < 3; i++) {
+    src.meta.ri = gt->src_offset0;
+    src.meta.wi = gt->src_offset1;
+
+    wuffs_deflate__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_deflate__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    CHECK_STATUS("set_quirk",
+                 wuffs_deflate__decoder__set_quirk(
+                     &dec, WUFFS_DEFLATE__QUIRK_DST_HISTORY_IS_ADDRESSABLE, 1));
+
+    wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+        .data = g_have_slice_u8,
+    });
+    wuffs_base__status have_z = wuffs_base__make_status(NULL);
+    while (true) {
+      size_t wi0 = have.meta.wi;
+      have.data.len = wuffs_base__u64__min(wi0 + 1000, g_have_slice_u8.len);
+      have_z = wuffs_deflate__decoder__transform_io(
+          &dec, &have, &src, wuffs_base__empty_slice_u8());
+
+      uint64_t n = have.meta.wi - wi0;
+      uint64_t offset = have.meta.pos + wi0;
+      if ((offset > want.meta.wi) || (n > (want.meta.wi - offset)) ||
+          memcmp(have.data.ptr + wi0, want.data.ptr + offset, n)) {
+        RETURN_FAIL("i=%d: output differs near offset %" PRIu64, i, offset);
+      } else if (have_z.repr != wuffs_base__suspension__short_write) {
+        break;
+      } else if (have.meta.wi > keeps[i]) {
+        size_t discard = have.meta.wi - keeps[i];
+        memmove(have.data.ptr, have.data.ptr + discard, keeps[i]);
+        have.meta.wi = keeps[i];
+        have.meta.pos += discard;
+      }
+    }
+
+    const char* want_z = (i < 2) ? NULL : wuffs_deflate__error__bad_distance;
+    if (have_z.repr != want_z) {
+      RETURN_FAIL("i=%d: have \"%s\", want \"%s\"", i, have_z.repr, want_z);
+    } else if ((i < 2) && ((have.meta.pos + have.meta.wi) != want.meta.wi)) {
+      RETURN_FAIL("i=%d: length: have %" PRIu64 ", want %zu", i,
+                  have.meta.pos + have.meta.wi, want.meta.wi);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_deflate_decode_history_is_in_workbuf() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  wuffs_base__io_buffer want = ((wuffs_base__io_buffer){
+      .data = g_want_slice_u8,
+  });
+
+  golden_test* gt = &g_deflate_pi_gt;
+  CHECK_STRING(read_file(&src, gt->src_filename));
+  CHECK_STRING(read_file(&want, gt->want_filename));
+
+  // With QUIRK_HISTORY_IS_IN_WORKBUF, the workbuf is only needed when
+  // transform_io suspends. Decoding (i == 0) in one call needs no workbuf,
+  // but (i == 1) a short write after producing some output does. Decoding
+  // (i == 2) in 1000 byte pieces, discarding dst after each piece, works with
+  // a long enough workbuf. In all cases, the decoder's own history array is
+  // left untouched.
+  for (int i = 0; i < 3; i++) {
+    src.meta.ri = gt->src_offset0;
+    src.meta.wi = gt->src_offset1;
+
+    wuffs_deflate__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_deflate__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    memset(&(dec.private_data.f_history), 0xA5,
+           sizeof(dec.private_data.f_history));
+    if (wuffs_deflate__decoder__workbuf_len(&dec).max_incl !=
+        WUFFS_DEFLATE__DECODER_WORKBUF_LEN_MAX_INCL_WORST_CASE) {
+      RETURN_FAIL("i=%d: workbuf_len (before set_quirk)", i);
+    }
+    CHECK_STATUS("set_quirk",
+                 wuffs_deflate__decoder__set_quirk(
+                     &dec, WUFFS_DEFLATE__QUIRK_HISTORY_IS_IN_WORKBUF, 1));
+    if (wuffs_deflate__decoder__workbuf_len(&dec).max_incl !=
+        WUFFS_DEFLATE__DECODER_HISTORY_WORKBUF_LEN) {
+      RETURN_FAIL("i=%d: workbuf_len (after set_quirk)", i);
+    }
+
+    wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+        .data = g_have_slice_u8,
+    });
+    wuffs_base__slice_u8 workbuf =
+        (i < 2) ? wuffs_base__empty_slice_u8() : g_work_slice_u8;
+    size_t piece = (i == 0)   ? want.meta.wi
+                   : (i == 1) ? (want.meta.wi - 1)
+                              : 1000;
+    wuffs_base__status have_z = wuffs_base__make_status(NULL);
+    while (true) {
+      have.meta.wi = 0;
+      have.data.len = piece;
+      have_z = wuffs_deflate__decoder__transform_io(&dec, &have, &src, workbuf);
+
+      uint64_t n = have.meta.wi;
+      uint64_t offset = have.meta.pos;
+      if ((offset > want.meta.wi) || (n > (want.meta.wi - offset)) ||
+          memcmp(have.data.ptr, want.data.ptr + offset, n)) {
+        RETURN_FAIL("i=%d: output differs near offset %" PRIu64, i, offset);
+      } else if ((i < 2) ||
+                 (have_z.repr != wuffs_base__suspension__short_write)) {
+        break;
+      }
+      have.meta.pos += n;
+    }
+
+    const char* want_z =
+        (i == 1) ? wuffs_base__error__bad_workbuf_length : NULL;
+    if (have_z.repr != want_z) {
+      RETURN_FAIL("i=%d: have \"%s\", want \"%s\"", i, have_z.repr, want_z);
+    } else if ((i != 1) && ((have.meta.pos + have.meta.wi) != want.meta.wi)) {
+      RETURN_FAIL("i=%d: length: have %" PRIu64 ", want %zu", i,
+                  have.meta.pos + have.meta.wi, want.meta.wi);
+    }
+    for (size_t j = 0; j < sizeof(dec.private_data.f_history); j++) {
+      if (dec.private_data.f_history[j] != 0xA5) {
+        RETURN_FAIL("i=%d: history array was modified at %zu", i, j);
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_deflate_decode_interface() {
   CHECK_FOCUS(__func__);
@@ -271,6 +479,8 @@ test_wuffs_deflate_decode_deflate_distance_code_31() {
   return NULL;
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_deflate_decode_deflate_huffman_primlen_9() {
   CHECK_FOCUS(__func__);
@@ -317,6 +527,8 @@ test_wuffs_deflate_decode_deflate_huffman_primlen_9() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_deflate_decode_midsummer() {
   CHECK_FOCUS(__func__);
@@ -604,6 +816,8 @@ test_wuffs_deflate_history_partial() {
   return NULL;
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_deflate_table_redirect() {
   CHECK_FOCUS(__func__);
@@ -732,6 +946,8 @@ test_wuffs_deflate_table_redirect() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // ---------------- Mimic Tests
 
 #ifdef WUFFS_MIMIC
@@ -879,6 +1095,24 @@ bench_wuffs_deflate_decode_100k_many_big_reads() {
       &g_deflate_pi_gt, UINT64_MAX, 4096, 30);
 }
 
+const char*  //
+bench_wuffs_deflate_decode_100k_many_small_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_dst,
+      &g_deflate_pi_gt, UINT64_MAX, 512, 30);
+}
+
+const char*  //
+bench_wuffs_deflate_decode_100k_many_tiny_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(
+      wuffs_deflate_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED, tcounter_dst,
+      &g_deflate_pi_gt, UINT64_MAX, 64, 30);
+}
+
 // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -912,6 +1146,20 @@ bench_mimic_deflate_decode_100k_many_big_reads() {
                              &g_deflate_pi_gt, UINT64_MAX, 4096, 30);
 }
 
+const char*  //
+bench_mimic_deflate_decode_100k_many_small_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_decode, 0, tcounter_dst,
+                             &g_deflate_pi_gt, UINT64_MAX, 512, 30);
+}
+
+const char*  //
+bench_mimic_deflate_decode_100k_many_tiny_reads() {
+  CHECK_FOCUS(__func__);
+  return do_bench_io_buffers(mimic_deflate_decode, 0, tcounter_dst,
+                             &g_deflate_pi_gt, UINT64_MAX, 64, 30);
+}
+
 #endif  // WUFFS_MIMIC
 
 // ---------------- Manifest
@@ -923,7 +1171,12 @@ proc g_tests[] = {
     test_wuffs_deflate_decode_deflate_degenerate_huffman,
     test_wuffs_deflate_decode_deflate_distance_32768,
     test_wuffs_deflate_decode_deflate_distance_code_31,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_deflate_decode_deflate_huffman_primlen_9,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+    test_wuffs_deflate_decode_bad_call_sequence,
+    test_wuffs_deflate_decode_dst_history_is_addressable,
+    test_wuffs_deflate_decode_history_is_in_workbuf,
     test_wuffs_deflate_decode_interface,
     test_wuffs_deflate_decode_midsummer,
     test_wuffs_deflate_decode_pi_just_one_read,
@@ -936,7 +1189,9 @@ proc g_tests[] = {
     test_wuffs_deflate_decode_truncated_input,
     test_wuffs_deflate_history_full,
     test_wuffs_deflate_history_partial,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_deflate_table_redirect,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
 
 #ifdef WUFFS_MIMIC
 
@@ -967,6 +1222,8 @@ proc g_benches[] = {
     bench_wuffs_deflate_decode_10k_part_init,
     bench_wuffs_deflate_decode_100k_just_one_read,
     bench_wuffs_deflate_decode_100k_many_big_reads,
+    bench_wuffs_deflate_decode_100k_many_small_reads,
+    bench_wuffs_deflate_decode_100k_many_tiny_reads,
 
 #ifdef WUFFS_MIMIC
 
@@ -975,6 +1232,8 @@ proc g_benches[] = {
     bench_mimic_deflate_decode_100k_just_one_read,
 #ifndef WUFFS_MIMICLIB_DEFLATE_DOES_NOT_SUPPORT_STREAMING
     bench_mimic_deflate_decode_100k_many_big_reads,
+    bench_mimic_deflate_decode_100k_many_small_reads,
+    bench_mimic_deflate_decode_100k_many_tiny_reads,
 #endif
 
 #endif  // WUFFS_MIMIC
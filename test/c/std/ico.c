@@ -0,0 +1,373 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program is typically run indirectly, by the "wuffs test" or "wuffs
+bench" commands. These commands take an optional "-mimic" flag to check that
+Wuffs' output mimics (i.e. exactly matches) other libraries' output, such as
+giflib for GIF, libpng for PNG, etc.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror ico.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+
+Add the "wuffs mimic cflags" (everything after the colon below) to the C
+compiler flags (after the .c file) to run the mimic tests.
+
+To manually run the benchmarks, replace "-Wall -Werror" with "-O3" and replace
+the first "./a.out" with "./a.out -bench". Combine these changes with the
+"wuffs mimic cflags" to run the mimic benchmarks.
+*/
+
+// ¿ wuffs mimic cflags: -DWUFFS_MIMIC
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__BMP
+#define WUFFS_CONFIG__MODULE__CRC32
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__ICO
+#define WUFFS_CONFIG__MODULE__PNG
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+#ifdef WUFFS_MIMIC
+// No mimic library.
+#endif
+
+// ---------------- ICO Tests
+
+const char*  //
+wuffs_ico_decode(uint64_t* n_bytes_out,
+                 wuffs_base__io_buffer* dst,
+                 uint32_t wuffs_initialize_flags,
+                 wuffs_base__pixel_format pixfmt,
+                 uint32_t* quirks_ptr,
+                 size_t quirks_len,
+                 wuffs_base__io_buffer* src) {
+  wuffs_ico__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_ico__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                              wuffs_initialize_flags));
+  return do_run__wuffs_base__image_decoder(
+      wuffs_ico__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      n_bytes_out, dst, pixfmt, quirks_ptr, quirks_len, src);
+}
+
+const char*  //
+test_wuffs_ico_decode_and_mask() {
+  CHECK_FOCUS(__func__);
+
+  // Pixels masked out by a DIB's AND mask (including the top left pixel, for
+  // both of hippopotamus.multisize.ico's DIBs) are transparent black. With
+  // SRC_OVER, they leave the dst (here pre-filled with 0x77 bytes) unchanged,
+  // whether or not the dst pixel format has an alpha channel.
+  const struct {
+    uint32_t preferred_size;
+    uint32_t pixfmt_repr;
+    uint32_t bytes_per_pixel;
+    wuffs_base__pixel_blend blend;
+    uint32_t want_top_left;
+    uint32_t want_center;
+  } test_cases[] = {
+      {16, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL, 4,
+       WUFFS_BASE__PIXEL_BLEND__SRC, 0x00000000, 0xFF4C4C4C},
+      {16, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL, 4,
+       WUFFS_BASE__PIXEL_BLEND__SRC_OVER, 0x77777777, 0xFF4C4C4C},
+      {16, WUFFS_BASE__PIXEL_FORMAT__BGR, 3,  //
+       WUFFS_BASE__PIXEL_BLEND__SRC, 0x000000, 0x4C4C4C},
+      {16, WUFFS_BASE__PIXEL_FORMAT__BGR, 3,  //
+       WUFFS_BASE__PIXEL_BLEND__SRC_OVER, 0x777777, 0x4C4C4C},
+      {72, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL, 4,
+       WUFFS_BASE__PIXEL_BLEND__SRC_OVER, 0x77777777, 0xFF2E5B52},
+      {72, WUFFS_BASE__PIXEL_FORMAT__BGR, 3,  //
+       WUFFS_BASE__PIXEL_BLEND__SRC_OVER, 0x777777, 0x2E5B52},
+  };
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hippopotamus.multisize.ico"));
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_ico__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_ico__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    wuffs_ico__decoder__set_quirk(&dec, WUFFS_ICO__QUIRK_PREFERRED_SIZE,
+                                  test_cases[tc].preferred_size);
+
+    src.meta.ri = 0;
+    wuffs_base__image_config ic = ((wuffs_base__image_config){});
+    CHECK_STATUS("decode_image_config",
+                 wuffs_ico__decoder__decode_image_config(&dec, &ic, &src));
+    uint32_t width = wuffs_base__pixel_config__width(&ic.pixcfg);
+    uint32_t height = wuffs_base__pixel_config__height(&ic.pixcfg);
+
+    wuffs_base__pixel_config__set(&ic.pixcfg, test_cases[tc].pixfmt_repr,
+                                  WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, width,
+                                  height);
+    wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice",
+                 wuffs_base__pixel_buffer__set_from_slice(&pb, &ic.pixcfg,
+                                                          g_pixel_slice_u8));
+    memset(g_pixel_slice_u8.ptr, 0x77,
+           (size_t)(width * height * test_cases[tc].bytes_per_pixel));
+    CHECK_STATUS("decode_frame", wuffs_ico__decoder__decode_frame(
+                                     &dec, &pb, &src, test_cases[tc].blend,
+                                     g_work_slice_u8, NULL));
+
+    uint32_t have_top_left =
+        (test_cases[tc].bytes_per_pixel == 4)
+            ? wuffs_base__peek_u32le__no_bounds_check(g_pixel_slice_u8.ptr)
+            : wuffs_base__peek_u24le__no_bounds_check(g_pixel_slice_u8.ptr);
+    if (have_top_left != test_cases[tc].want_top_left) {
+      RETURN_FAIL("tc=%d: top left pixel: have 0x%08" PRIX32
+                  ", want 0x%08" PRIX32,
+                  tc, have_top_left, test_cases[tc].want_top_left);
+    }
+    size_t center =
+        test_cases[tc].bytes_per_pixel *
+        (((size_t)(height / 2) * width) + (size_t)(width / 2));
+    uint32_t have_center =
+        (test_cases[tc].bytes_per_pixel == 4)
+            ? wuffs_base__peek_u32le__no_bounds_check(g_pixel_slice_u8.ptr +
+                                                      center)
+            : wuffs_base__peek_u24le__no_bounds_check(g_pixel_slice_u8.ptr +
+                                                      center);
+    if (have_center != test_cases[tc].want_center) {
+      RETURN_FAIL("tc=%d: center pixel: have 0x%08" PRIX32
+                  ", want 0x%08" PRIX32,
+                  tc, have_center, test_cases[tc].want_center);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_ico_decode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_ico__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_ico__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_ico__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/hippopotamus.regular.ico", 0, SIZE_MAX, 36, 28, 0xFFF5F5F5);
+}
+
+const char*  //
+test_wuffs_ico_decode_preferred_size() {
+  CHECK_FOCUS(__func__);
+
+  // The hippopotamus.multisize.ico directory lists, in order, an 18x14 8bpp
+  // DIB, a 72x56 24bpp DIB and a 36x28 PNG. Both DIBs have some pixels masked
+  // out by their AND masks, including the top left pixel.
+  const struct {
+    uint32_t preferred_size;
+    uint32_t want_width;
+    uint32_t want_height;
+    uint32_t want_top_left;
+    uint32_t want_center;
+  } test_cases[] = {
+      {0, 72, 56, 0x00000000, 0xFF2E5B52},
+      {16, 18, 14, 0x00000000, 0xFF4C4C4C},
+      {30, 36, 28, 0xFF727272, 0xFF2E5B52},
+      {36, 36, 28, 0xFF727272, 0xFF2E5B52},
+      {37, 72, 56, 0x00000000, 0xFF2E5B52},
+      {300, 72, 56, 0x00000000, 0xFF2E5B52},
+  };
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hippopotamus.multisize.ico"));
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_ico__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_ico__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    wuffs_ico__decoder__set_quirk(&dec, WUFFS_ICO__QUIRK_PREFERRED_SIZE,
+                                  test_cases[tc].preferred_size);
+
+    src.meta.ri = 0;
+    wuffs_base__image_config ic = ((wuffs_base__image_config){});
+    CHECK_STATUS("decode_image_config",
+                 wuffs_ico__decoder__decode_image_config(&dec, &ic, &src));
+    uint32_t have_width = wuffs_base__pixel_config__width(&ic.pixcfg);
+    uint32_t have_height = wuffs_base__pixel_config__height(&ic.pixcfg);
+    if ((have_width != test_cases[tc].want_width) ||
+        (have_height != test_cases[tc].want_height)) {
+      RETURN_FAIL("tc=%d: dimensions: have %" PRIu32 "x%" PRIu32
+                  ", want %" PRIu32 "x%" PRIu32,
+                  tc, have_width, have_height, test_cases[tc].want_width,
+                  test_cases[tc].want_height);
+    }
+
+    wuffs_base__pixel_config__set(
+        &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+        WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, have_width, have_height);
+    wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+    CHECK_STATUS("set_from_slice",
+                 wuffs_base__pixel_buffer__set_from_slice(&pb, &ic.pixcfg,
+                                                          g_pixel_slice_u8));
+    CHECK_STATUS("decode_frame",
+                 wuffs_ico__decoder__decode_frame(
+                     &dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
+                     g_work_slice_u8, NULL));
+
+    uint32_t have_top_left = wuffs_base__peek_u32le__no_bounds_check(
+        g_pixel_slice_u8.ptr);
+    if (have_top_left != test_cases[tc].want_top_left) {
+      RETURN_FAIL("tc=%d: top left pixel: have 0x%08" PRIX32
+                  ", want 0x%08" PRIX32,
+                  tc, have_top_left, test_cases[tc].want_top_left);
+    }
+    size_t center = 4 * (((size_t)(have_height / 2) * have_width) +
+                         (size_t)(have_width / 2));
+    uint32_t have_center = wuffs_base__peek_u32le__no_bounds_check(
+        g_pixel_slice_u8.ptr + center);
+    if (have_center != test_cases[tc].want_center) {
+      RETURN_FAIL("tc=%d: center pixel: have 0x%08" PRIX32
+                  ", want 0x%08" PRIX32,
+                  tc, have_center, test_cases[tc].want_center);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_ico_decode_truncated_input() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(g_src_array_u8, 0, false);
+  wuffs_ico__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_ico__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__status status =
+      wuffs_ico__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_base__suspension__short_read) {
+    RETURN_FAIL("closed=false: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__suspension__short_read);
+  }
+
+  src.meta.closed = true;
+  status = wuffs_ico__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_ico__error__truncated_input) {
+    RETURN_FAIL("closed=true: have \"%s\", want \"%s\"", status.repr,
+                wuffs_ico__error__truncated_input);
+  }
+  return NULL;
+}
+
+// ---------------- Mimic Tests
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- ICO Benches
+
+const char*  //
+bench_wuffs_ico_decode_4k_32bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_ico_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/hippopotamus.regular.ico", 0, SIZE_MAX, 1000);
+}
+
+// ---------------- Mimic Benches
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_ico_decode_and_mask,
+    test_wuffs_ico_decode_interface,
+    test_wuffs_ico_decode_preferred_size,
+    test_wuffs_ico_decode_truncated_input,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    bench_wuffs_ico_decode_4k_32bpp,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "std/ico";
+  return test_main(argc, argv, g_tests, g_benches);
+}
@@ -127,6 +127,11 @@ test_wuffs_jpeg_decode_truncated_input() {
   return NULL;
 }
 
+// These tests call Wuffs' private (static) functions, which are not visible
+// when Wuffs is compiled as a separate translation unit, as it is by
+// script/build-pgo.sh.
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 do_test_wuffs_jpeg_decode_dht(wuffs_base__io_buffer* src,
                               const uint32_t arg_bits,
@@ -741,6 +746,8 @@ test_wuffs_jpeg_decode_mcu() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // ---------------- Mimic Tests
 
 #ifdef WUFFS_MIMIC
@@ -773,10 +780,12 @@ bench_wuffs_jpeg_decode_77k_24bpp() {
 
 proc g_tests[] = {
 
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_jpeg_decode_dht_easy,
     test_wuffs_jpeg_decode_dht_hard,
     test_wuffs_jpeg_decode_idct,
     test_wuffs_jpeg_decode_mcu,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_jpeg_decode_interface,
     test_wuffs_jpeg_decode_truncated_input,
 
@@ -138,6 +138,11 @@ test_wuffs_core_multiply_u64() {
 
 // ---------------- String Conversions Tests
 
+// The hpd tests call Wuffs' private (static) functions, which are not visible
+// when Wuffs is compiled as a separate translation unit, as it is by
+// script/build-pgo.sh.
+#if !defined(WUFFS_NONMONOLITHIC)
+
 // wuffs_base__private_implementation__high_prec_dec__to_debug_string converts
 // hpd into a human-readable NUL-terminated C string.
 const char*  //
@@ -417,6 +422,8 @@ test_wuffs_strconv_hpd_shift() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // ----------------
 
 const char*  //
@@ -813,6 +820,64 @@ test_wuffs_strconv_base_64() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_strconv_byte_swap() {
+  CHECK_FOCUS(__func__);
+
+  uint8_t src[67];
+  for (size_t i = 0; i < sizeof(src); i++) {
+    src[i] = (uint8_t)(i + 1);
+  }
+
+  static const uint32_t element_sizes[] = {0, 1, 2, 3, 4, 8, 12, 16, 32};
+  for (size_t e = 0; e < WUFFS_TESTLIB_ARRAY_SIZE(element_sizes); e++) {
+    uint32_t element_size = element_sizes[e];
+    bool valid = (element_size != 0) && (element_size <= 16) &&
+                 ((element_size & (element_size - 1)) == 0);
+
+    // Copying into a separate (and shorter) dst should copy only whole
+    // elements. Copying in place should do the same to src's full length.
+    for (int in_place = 0; in_place < 2; in_place++) {
+      size_t dst_len = 61;
+      if (in_place) {
+        memcpy(g_have_array_u8, src, sizeof(src));
+        dst_len = sizeof(src);
+      }
+      memset(g_have_array_u8 + (in_place ? sizeof(src) : 0), 0xEE, 128);
+
+      wuffs_base__slice_u8 dst =
+          wuffs_base__make_slice_u8(g_have_array_u8, dst_len);
+      size_t have = wuffs_base__byte_swap__copy(
+          dst,
+          in_place ? dst : wuffs_base__make_slice_u8(src, sizeof(src)),
+          element_size);
+      size_t want = valid ? (dst_len - (dst_len % element_size)) : 0;
+      if (have != want) {
+        RETURN_FAIL("element_size=%" PRIu32
+                    ", in_place=%d: have %zu, want %zu",
+                    element_size, in_place, have, want);
+      }
+
+      for (size_t i = 0; i < want; i++) {
+        size_t k = i % element_size;
+        size_t j = (i - k) + (element_size - 1 - k);
+        if (g_have_array_u8[i] != src[j]) {
+          RETURN_FAIL("element_size=%" PRIu32
+                      ", in_place=%d: dst[%zu]: have 0x%02X, want 0x%02X",
+                      element_size, in_place, i, (int)(g_have_array_u8[i]),
+                      (int)(src[j]));
+        }
+      }
+      if (!in_place && (g_have_array_u8[want] != 0xEE)) {
+        RETURN_FAIL("element_size=%" PRIu32 ": dst[%zu] was overwritten",
+                    element_size, want);
+      }
+    }
+  }
+
+  return NULL;
+}
+
 // ----------------
 
 const char*  //
@@ -2694,6 +2759,8 @@ test_wuffs_json_decode_end_of_data() {
   return NULL;
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_json_decode_long_numbers() {
   CHECK_FOCUS(__func__);
@@ -2822,6 +2889,8 @@ test_wuffs_json_decode_long_numbers() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // test_wuffs_json_decode_prior_valid_utf_8 tests that when encountering
 // invalid or incomplete UTF-8, or a backslash-escape, any prior valid UTF-8 is
 // still output. The decoder batches output so that, ignoring the quotation
@@ -3888,6 +3957,8 @@ test_wuffs_json_decode_unicode4_escapes() {
   return NULL;
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 // test_wuffs_json_decode_src_io_buffer_length tests that given a sufficient
 // amount of source data (WUFFS_JSON__DECODER_SRC_IO_BUFFER_LENGTH_MIN_INCL or
 // more), decoding will always return a conclusive result, not a suspension
@@ -3959,6 +4030,8 @@ test_wuffs_json_decode_src_io_buffer_length() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_json_decode_string() {
   CHECK_FOCUS(__func__);
@@ -4080,6 +4153,7 @@ do_bench_wuffs_strconv_parse_number_f64(const char* str,
     CHECK_STATUS("", wuffs_base__parse_number_f64(
                          s, WUFFS_BASE__PARSE_NUMBER_XXX__DEFAULT_OPTIONS)
                          .status);
+    bench_lap();
   }
   bench_finish(iters, 0);
 
@@ -4129,6 +4203,7 @@ do_bench_wuffs_strconv_render_number_f64(wuffs_base__slice_u64 test_cases,
         RETURN_FAIL("0x%016" PRIX64 ": failed", test_cases.ptr[tc]);
       }
     }
+    bench_lap();
   }
   bench_finish(iters, 0);
 
@@ -4230,8 +4305,11 @@ proc g_tests[] = {
     test_wuffs_core_multiply_u64,
     test_wuffs_strconv_base_16,
     test_wuffs_strconv_base_64,
+    test_wuffs_strconv_byte_swap,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_strconv_hpd_rounded_integer,
     test_wuffs_strconv_hpd_shift,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_strconv_ieee_754_bit_representation_from_u16,
     test_wuffs_strconv_ieee_754_bit_representation_from_u32,
     test_wuffs_strconv_parse_number_f64_options,
@@ -4246,7 +4324,9 @@ proc g_tests[] = {
     test_wuffs_json_decode_empty_input,
     test_wuffs_json_decode_end_of_data,
     test_wuffs_json_decode_interface,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_json_decode_long_numbers,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_json_decode_prior_valid_utf_8,
     test_wuffs_json_decode_quirk_allow_backslash_etc,
     test_wuffs_json_decode_quirk_allow_backslash_x,
@@ -4257,7 +4337,9 @@ proc g_tests[] = {
     test_wuffs_json_decode_quirk_allow_trailing_comments,
     test_wuffs_json_decode_quirk_allow_trailing_filler,
     test_wuffs_json_decode_quirk_replace_invalid_unicode,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_json_decode_src_io_buffer_length,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_json_decode_string,
     test_wuffs_json_decode_unicode4_escapes,
 
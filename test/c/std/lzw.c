@@ -448,6 +448,7 @@ do_bench_wuffs_lzw_decode(const char* filename, uint64_t iters_unscaled) {
     CHECK_STATUS("transform_io", wuffs_lzw__decoder__transform_io(
                                      &dec, &have, &src, g_work_slice_u8));
     n_bytes += have.meta.wi;
+    bench_lap();
   }
   bench_finish(iters, n_bytes);
   return NULL;
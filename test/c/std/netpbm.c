@@ -69,6 +69,25 @@ the first "./a.out" with "./a.out -bench". Combine these changes with the
 
 // ---------------- Netpbm Tests
 
+const char*  //
+wuffs_netpbm_decode(uint64_t* n_bytes_out,
+                    wuffs_base__io_buffer* dst,
+                    uint32_t wuffs_initialize_flags,
+                    wuffs_base__pixel_format pixfmt,
+                    uint32_t* quirks_ptr,
+                    size_t quirks_len,
+                    wuffs_base__io_buffer* src) {
+  wuffs_netpbm__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_netpbm__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                                 wuffs_initialize_flags));
+  return do_run__wuffs_base__image_decoder(
+      wuffs_netpbm__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      n_bytes_out, dst, pixfmt, quirks_ptr, quirks_len, src);
+}
+
+// --------
+
 const char*  //
 test_wuffs_netpbm_decode_interface() {
   CHECK_FOCUS(__func__);
@@ -110,6 +129,114 @@ test_wuffs_netpbm_decode_truncated_input() {
   return NULL;
 }
 
+const char*  //
+test_wuffs_netpbm_decode_16_bit() {
+  CHECK_FOCUS(__func__);
+
+  const struct {
+    const char* filename;
+    uint32_t want_pixfmt;
+    wuffs_base__color_u32_argb_premul final_pixel;
+  } test_cases[] = {
+      {"test/data/bricks-color.16bit.ppm",
+       WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL_4X16LE, 0xFF022460},
+      {"test/data/bricks-gray.16bit.pgm", WUFFS_BASE__PIXEL_FORMAT__Y_16BE,
+       0xFF060606},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_netpbm__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_netpbm__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+    wuffs_base__image_config ic = ((wuffs_base__image_config){});
+    wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+        .data = g_src_slice_u8,
+    });
+    CHECK_STRING(read_file(&src, test_cases[tc].filename));
+    CHECK_STATUS("decode_image_config",
+                 wuffs_netpbm__decoder__decode_image_config(&dec, &ic, &src));
+    uint32_t have_pixfmt =
+        wuffs_base__pixel_config__pixel_format(&ic.pixcfg).repr;
+    if (have_pixfmt != test_cases[tc].want_pixfmt) {
+      RETURN_FAIL("tc=%d: pixfmt: have 0x%08" PRIX32 ", want 0x%08" PRIX32, tc,
+                  have_pixfmt, test_cases[tc].want_pixfmt);
+    }
+
+    CHECK_STATUS("initialize",
+                 wuffs_netpbm__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    CHECK_STRING(do_test__wuffs_base__image_decoder(
+        wuffs_netpbm__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        test_cases[tc].filename, 0, SIZE_MAX, 160, 120,
+        test_cases[tc].final_pixel));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_netpbm_decode_16_bit_narrow_dst() {
+  CHECK_FOCUS(__func__);
+
+  // Decode each 160×120 image to a full-width and then to a 50 pixel
+  // narrower pixel buffer. The narrower one's pixels should match the
+  // corresponding (left-most) pixels of the full-width one.
+  const char* filenames[] = {
+      "test/data/bricks-color.16bit.ppm",
+      "test/data/bricks-gray.16bit.pgm",
+  };
+  const uint32_t width = 160;
+  const uint32_t height = 120;
+  const uint32_t narrow_width = width - 50;
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(filenames); tc++) {
+    uint32_t widths[2] = {width, narrow_width};
+    wuffs_base__slice_u8 pixels[2] = {g_want_slice_u8, g_have_slice_u8};
+    int w;
+    for (w = 0; w < 2; w++) {
+      wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+          .data = g_src_slice_u8,
+      });
+      CHECK_STRING(read_file(&src, filenames[tc]));
+
+      wuffs_netpbm__decoder dec;
+      CHECK_STATUS("initialize",
+                   wuffs_netpbm__decoder__initialize(
+                       &dec, sizeof dec, WUFFS_VERSION,
+                       WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+      wuffs_base__pixel_config pc = ((wuffs_base__pixel_config){});
+      wuffs_base__pixel_config__set(&pc,
+                                    WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+                                    WUFFS_BASE__PIXEL_SUBSAMPLING__NONE,
+                                    widths[w], height);
+      wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+      CHECK_STATUS("set_from_slice",
+                   wuffs_base__pixel_buffer__set_from_slice(&pb, &pc,
+                                                            pixels[w]));
+      CHECK_STATUS("decode_frame",
+                   wuffs_netpbm__decoder__decode_frame(
+                       &dec, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
+                       g_work_slice_u8, NULL));
+    }
+
+    uint32_t y;
+    for (y = 0; y < height; y++) {
+      uint8_t* want_row = g_want_slice_u8.ptr + (4 * width * y);
+      uint8_t* have_row = g_have_slice_u8.ptr + (4 * narrow_width * y);
+      if (memcmp(have_row, want_row, 4 * narrow_width)) {
+        RETURN_FAIL("tc=%d: row %" PRIu32 " differs", tc, y);
+      }
+    }
+  }
+  return NULL;
+}
+
 const char*  //
 test_wuffs_netpbm_decode_frame_config() {
   CHECK_FOCUS(__func__);
@@ -178,7 +305,25 @@ test_wuffs_netpbm_decode_image_config() {
 
 // ---------------- Netpbm Benches
 
-// No Netpbm benches.
+const char*  //
+bench_wuffs_netpbm_decode_77k_16bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_netpbm_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-gray.16bit.pgm", 0, SIZE_MAX, 1000);
+}
+
+const char*  //
+bench_wuffs_netpbm_decode_77k_48bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_netpbm_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.16bit.ppm", 0, SIZE_MAX, 200);
+}
 
 // ---------------- Mimic Benches
 
@@ -192,6 +337,8 @@ test_wuffs_netpbm_decode_image_config() {
 
 proc g_tests[] = {
 
+    test_wuffs_netpbm_decode_16_bit,
+    test_wuffs_netpbm_decode_16_bit_narrow_dst,
     test_wuffs_netpbm_decode_frame_config,
     test_wuffs_netpbm_decode_image_config,
     test_wuffs_netpbm_decode_interface,
@@ -208,7 +355,8 @@ proc g_tests[] = {
 
 proc g_benches[] = {
 
-// No Netpbm benches.
+    bench_wuffs_netpbm_decode_77k_16bpp,
+    bench_wuffs_netpbm_decode_77k_48bpp,
 
 #ifdef WUFFS_MIMIC
 
@@ -138,6 +138,11 @@ do_test_xxxxx_png_decode_bad_crc32_checksum_critical(
   return NULL;
 }
 
+// do_wuffs_png_swizzle and its callers call Wuffs' private (static)
+// functions, which are not visible when Wuffs is compiled as a separate
+// translation unit, as it is by script/build-pgo.sh.
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 do_wuffs_png_swizzle(uint32_t width,
                      uint32_t height,
@@ -179,6 +184,8 @@ do_wuffs_png_swizzle(uint32_t width,
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // --------
 
 const char*  //
@@ -242,6 +249,8 @@ test_wuffs_png_decode_bad_crc32_checksum_critical() {
       &wuffs_png_decode);
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_png_decode_filters_golden() {
   CHECK_FOCUS(__func__);
@@ -488,6 +497,8 @@ test_wuffs_png_decode_filters_round_trip() {
   return NULL;
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_png_decode_frame_config() {
   CHECK_FOCUS(__func__);
@@ -1121,6 +1132,8 @@ bench_wuffs_png_decode_image_4002k_24bpp() {
       NULL, 0, "test/data/harvesters.png", 0, SIZE_MAX, 1);
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 do_bench_wuffs_png_decode_filter(uint8_t filter,
                                  uint8_t filter_distance,
@@ -1187,6 +1200,7 @@ do_bench_wuffs_png_decode_filter(uint8_t filter,
         wuffs_png__decoder__filter_and_swizzle(
             &dec, &pb, wuffs_base__make_slice_u8(workbuf.data.ptr, n)));
     n_bytes += n;
+    bench_lap();
   }
   bench_finish(iters, n_bytes);
   return NULL;
@@ -1240,6 +1254,8 @@ bench_wuffs_png_decode_filt_4_dist_4() {
   return do_bench_wuffs_png_decode_filter(4, 4, 20);
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -1306,8 +1322,10 @@ bench_mimic_png_decode_image_4002k_24bpp() {
 proc g_tests[] = {
 
     test_wuffs_png_decode_bad_crc32_checksum_critical,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_png_decode_filters_golden,
     test_wuffs_png_decode_filters_round_trip,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_png_decode_frame_config,
     test_wuffs_png_decode_interface,
     test_wuffs_png_decode_metadata_chrm_gama_srgb,
@@ -1337,6 +1355,7 @@ proc g_tests[] = {
 
 proc g_benches[] = {
 
+#if !defined(WUFFS_NONMONOLITHIC)
     bench_wuffs_png_decode_filt_1_dist_3,
     bench_wuffs_png_decode_filt_1_dist_4,
     bench_wuffs_png_decode_filt_2_dist_3,
@@ -1345,6 +1364,7 @@ proc g_benches[] = {
     bench_wuffs_png_decode_filt_3_dist_4,
     bench_wuffs_png_decode_filt_4_dist_3,
     bench_wuffs_png_decode_filt_4_dist_4,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
     bench_wuffs_png_decode_image_19k_8bpp,
     bench_wuffs_png_decode_image_40k_24bpp,
     bench_wuffs_png_decode_image_77k_8bpp,
@@ -0,0 +1,413 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program is typically run indirectly, by the "wuffs test" or "wuffs
+bench" commands. These commands take an optional "-mimic" flag to check that
+Wuffs' output mimics (i.e. exactly matches) other libraries' output, such as
+giflib for GIF, libpng for PNG, etc.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror qoi.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+
+Add the "wuffs mimic cflags" (everything after the colon below) to the C
+compiler flags (after the .c file) to run the mimic tests.
+
+To manually run the benchmarks, replace "-Wall -Werror" with "-O3" and replace
+the first "./a.out" with "./a.out -bench". Combine these changes with the
+"wuffs mimic cflags" to run the mimic benchmarks.
+*/
+
+// ¿ wuffs mimic cflags: -DWUFFS_MIMIC
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__QOI
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+#ifdef WUFFS_MIMIC
+// No mimic library.
+#endif
+
+// ---------------- QOI Tests
+
+const char*  //
+wuffs_qoi_decode(uint64_t* n_bytes_out,
+                 wuffs_base__io_buffer* dst,
+                 uint32_t wuffs_initialize_flags,
+                 wuffs_base__pixel_format pixfmt,
+                 uint32_t* quirks_ptr,
+                 size_t quirks_len,
+                 wuffs_base__io_buffer* src) {
+  wuffs_qoi__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_qoi__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                              wuffs_initialize_flags));
+  return do_run__wuffs_base__image_decoder(
+      wuffs_qoi__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      n_bytes_out, dst, pixfmt, quirks_ptr, quirks_len, src);
+}
+
+const char*  //
+test_wuffs_qoi_decode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_qoi__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_qoi__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_qoi__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/bricks-color.qoi", 0, SIZE_MAX, 160, 120, 0xFF022460);
+}
+
+const char*  //
+test_wuffs_qoi_decode_files() {
+  CHECK_FOCUS(__func__);
+
+  const struct {
+    const char* filename;
+    uint32_t width;
+    uint32_t height;
+    wuffs_base__color_u32_argb_premul final_pixel;
+  } test_cases[] = {
+      {"test/data/bricks-color.qoi", 160, 120, 0xFF022460},
+      {"test/data/hat.rgba.qoi", 90, 112, 0xFF000000},
+      {"test/data/hibiscus.primitive.qoi", 312, 442, 0xFF7A754D},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_qoi__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_qoi__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    CHECK_STRING(do_test__wuffs_base__image_decoder(
+        wuffs_qoi__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        test_cases[tc].filename, 0, SIZE_MAX, test_cases[tc].width,
+        test_cases[tc].height, test_cases[tc].final_pixel));
+  }
+  return NULL;
+}
+
+// do_decode_qoi_bgra_nonpremul decodes src (a whole QOI image) into
+// g_pixel_slice_u8 as BGRA_NONPREMUL. If chunk_len is positive, src's bytes
+// are revealed chunk_len bytes at a time, to exercise suspension.
+const char*  //
+do_decode_qoi_bgra_nonpremul(wuffs_base__io_buffer* src,
+                             size_t chunk_len,
+                             uint32_t* width_out,
+                             uint32_t* height_out) {
+  size_t src_wi = src->meta.wi;
+  if (chunk_len > 0) {
+    src->meta.wi = wuffs_base__u64__min(src_wi, chunk_len);
+    src->meta.closed = false;
+  }
+
+  wuffs_qoi__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_qoi__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  bool have_config = false;
+  while (true) {
+    wuffs_base__status status;
+    if (!have_config) {
+      status = wuffs_qoi__decoder__decode_image_config(&dec, &ic, src);
+      if (wuffs_base__status__is_ok(&status)) {
+        have_config = true;
+        wuffs_base__pixel_config__set(
+            &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+            WUFFS_BASE__PIXEL_SUBSAMPLING__NONE,
+            wuffs_base__pixel_config__width(&ic.pixcfg),
+            wuffs_base__pixel_config__height(&ic.pixcfg));
+        CHECK_STATUS("set_from_slice",
+                     wuffs_base__pixel_buffer__set_from_slice(
+                         &pb, &ic.pixcfg, g_pixel_slice_u8));
+        continue;
+      }
+    } else {
+      status = wuffs_qoi__decoder__decode_frame(
+          &dec, &pb, src, WUFFS_BASE__PIXEL_BLEND__SRC, g_work_slice_u8, NULL);
+      if (wuffs_base__status__is_ok(&status)) {
+        break;
+      }
+    }
+    if ((status.repr != wuffs_base__suspension__short_read) ||
+        (src->meta.wi >= src_wi)) {
+      RETURN_FAIL("decode: \"%s\"", status.repr);
+    }
+    src->meta.wi = wuffs_base__u64__min(src_wi, src->meta.wi + chunk_len);
+    src->meta.closed = src->meta.wi == src_wi;
+  }
+
+  *width_out = wuffs_base__pixel_config__width(&ic.pixcfg);
+  *height_out = wuffs_base__pixel_config__height(&ic.pixcfg);
+  return NULL;
+}
+
+const char*  //
+test_wuffs_qoi_decode_every_op() {
+  CHECK_FOCUS(__func__);
+
+  const struct {
+    const char* src;
+    size_t src_len;
+    uint32_t width;
+    uint32_t height;
+    uint32_t want[8];
+  } test_cases[] = {
+      {
+          // QOI_OP_RGBA, QOI_OP_DIFF, QOI_OP_LUMA, QOI_OP_INDEX, QOI_OP_RUN
+          // (of length 3) and QOI_OP_RGB (which keeps the previous alpha).
+          .src = "qoif\x00\x00\x00\x04\x00\x00\x00\x02\x04\x00"
+                 "\xFF\x0A\x14\x1E\x28"
+                 "\x72"
+                 "\xAA\x5D"
+                 "\x0C"
+                 "\xC2"
+                 "\xFE\xFF\x00\x00"
+                 "\x00\x00\x00\x00\x00\x00\x00\x01",
+          .src_len = 14 + 5 + 1 + 2 + 1 + 1 + 4 + 8,
+          .width = 4,
+          .height = 2,
+          .want = {0x280A141E, 0x280B121E, 0x28121C2D, 0x280A141E, 0x280A141E,
+                   0x280A141E, 0x280A141E, 0x28FF0000},
+      },
+      {
+          // A leading QOI_OP_RUN repeats the implicit opaque black pixel,
+          // and also adds it to the cache, so that QOI_OP_INDEX (with hash
+          // position 53) can refer to it.
+          .src = "qoif\x00\x00\x00\x03\x00\x00\x00\x01\x03\x00"
+                 "\xC0"
+                 "\xFE\x01\x02\x03"
+                 "\x35"
+                 "\x00\x00\x00\x00\x00\x00\x00\x01",
+          .src_len = 14 + 1 + 4 + 1 + 8,
+          .width = 3,
+          .height = 1,
+          .want = {0xFF000000, 0xFF010203, 0xFF000000},
+      },
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_base__io_buffer src = wuffs_base__ptr_u8__reader(
+        (uint8_t*)(test_cases[tc].src), test_cases[tc].src_len, true);
+    uint32_t have_width = 0;
+    uint32_t have_height = 0;
+    CHECK_STRING(
+        do_decode_qoi_bgra_nonpremul(&src, 0, &have_width, &have_height));
+    if ((have_width != test_cases[tc].width) ||
+        (have_height != test_cases[tc].height)) {
+      RETURN_FAIL("tc=%d: dimensions: have %" PRIu32 "x%" PRIu32
+                  ", want %" PRIu32 "x%" PRIu32,
+                  tc, have_width, have_height, test_cases[tc].width,
+                  test_cases[tc].height);
+    }
+    uint32_t i;
+    for (i = 0; i < have_width * have_height; i++) {
+      uint32_t have =
+          wuffs_base__peek_u32le__no_bounds_check(g_pixel_slice_u8.ptr + 4 * i);
+      if (have != test_cases[tc].want[i]) {
+        RETURN_FAIL("tc=%d: pixel #%" PRIu32 ": have 0x%08" PRIX32
+                    ", want 0x%08" PRIX32,
+                    tc, i, have, test_cases[tc].want[i]);
+      }
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_qoi_decode_incrementally() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hat.rgba.qoi"));
+
+  // Decode all at once (into g_want_array_u8) and then 1, 2, 3, 5 and 7 bytes
+  // at a time. Chunks that straddle a suspension must decode identically.
+  const size_t chunk_lens[] = {0, 1, 2, 3, 5, 7};
+  uint64_t pixbuf_len = 0;
+  int i;
+  for (i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(chunk_lens); i++) {
+    src.meta.ri = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    CHECK_STRING(
+        do_decode_qoi_bgra_nonpremul(&src, chunk_lens[i], &width, &height));
+    pixbuf_len = 4 * ((uint64_t)width) * ((uint64_t)height);
+    if (i == 0) {
+      memcpy(g_want_array_u8, g_pixel_slice_u8.ptr, pixbuf_len);
+      continue;
+    }
+    wuffs_base__io_buffer have =
+        wuffs_base__ptr_u8__reader(g_pixel_slice_u8.ptr, pixbuf_len, true);
+    wuffs_base__io_buffer want =
+        wuffs_base__ptr_u8__reader(g_want_array_u8, pixbuf_len, true);
+    CHECK_STRING(check_io_buffers_equal("", &have, &want));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_qoi_decode_truncated_input() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(g_src_array_u8, 0, false);
+  wuffs_qoi__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_qoi__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__status status =
+      wuffs_qoi__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_base__suspension__short_read) {
+    RETURN_FAIL("closed=false: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__suspension__short_read);
+  }
+
+  src.meta.closed = true;
+  status = wuffs_qoi__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_qoi__error__truncated_input) {
+    RETURN_FAIL("closed=true: have \"%s\", want \"%s\"", status.repr,
+                wuffs_qoi__error__truncated_input);
+  }
+  return NULL;
+}
+
+// ---------------- Mimic Tests
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- QOI Benches
+
+// The 40k, 77k and 552k benchmarks decode the same pixels as the std/png
+// benchmarks bench_wuffs_png_decode_image_40k_24bpp (albeit with an alpha
+// channel), bench_wuffs_png_decode_image_77k_8bpp (albeit for bricks-color,
+// not bricks-dither) and bench_wuffs_png_decode_image_552k_32bpp_etc.
+
+const char*  //
+bench_wuffs_qoi_decode_40k_32bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_qoi_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/hat.rgba.qoi", 0, SIZE_MAX, 30);
+}
+
+const char*  //
+bench_wuffs_qoi_decode_77k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_qoi_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.qoi", 0, SIZE_MAX, 50);
+}
+
+const char*  //
+bench_wuffs_qoi_decode_552k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_qoi_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/hibiscus.primitive.qoi", 0, SIZE_MAX, 4);
+}
+
+// ---------------- Mimic Benches
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_qoi_decode_every_op,
+    test_wuffs_qoi_decode_files,
+    test_wuffs_qoi_decode_incrementally,
+    test_wuffs_qoi_decode_interface,
+    test_wuffs_qoi_decode_truncated_input,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    bench_wuffs_qoi_decode_40k_32bpp,
+    bench_wuffs_qoi_decode_77k_24bpp,
+    bench_wuffs_qoi_decode_552k_24bpp,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "std/qoi";
+  return test_main(argc, argv, g_tests, g_benches);
+}
@@ -99,6 +99,19 @@ test_wuffs_tga_decode_interface() {
       "test/data/bricks-color.tga", 0, SIZE_MAX, 160, 120, 0xFF022460);
 }
 
+const char*  //
+test_wuffs_tga_decode_rle() {
+  CHECK_FOCUS(__func__);
+  wuffs_tga__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_tga__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_tga__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/hibiscus.primitive.tga", 0, SIZE_MAX, 312, 442, 0xFF7A754D);
+}
+
 const char*  //
 test_wuffs_tga_decode_truncated_input() {
   CHECK_FOCUS(__func__);
@@ -156,6 +169,15 @@ bench_wuffs_tga_decode_77k_24bpp() {
       NULL, 0, "test/data/bricks-color.tga", 0, SIZE_MAX, 200);
 }
 
+const char*  //
+bench_wuffs_tga_decode_552k_24bpp_rle() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_tga_decode, WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/hibiscus.primitive.tga", 0, SIZE_MAX, 50);
+}
+
 // ---------------- Mimic Benches
 
 #ifdef WUFFS_MIMIC
@@ -169,6 +191,7 @@ bench_wuffs_tga_decode_77k_24bpp() {
 proc g_tests[] = {
 
     test_wuffs_tga_decode_interface,
+    test_wuffs_tga_decode_rle,
     test_wuffs_tga_decode_truncated_input,
 
 #ifdef WUFFS_MIMIC
@@ -183,6 +206,7 @@ proc g_tests[] = {
 proc g_benches[] = {
 
     bench_wuffs_tga_decode_19k_8bpp,
+    bench_wuffs_tga_decode_552k_24bpp_rle,
     bench_wuffs_tga_decode_77k_24bpp,
 
 #ifdef WUFFS_MIMIC
@@ -0,0 +1,574 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program is typically run indirectly, by the "wuffs test" or "wuffs
+bench" commands. These commands take an optional "-mimic" flag to check that
+Wuffs' output mimics (i.e. exactly matches) other libraries' output, such as
+giflib for GIF, libpng for PNG, etc.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror tiff.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+
+Add the "wuffs mimic cflags" (everything after the colon below) to the C
+compiler flags (after the .c file) to run the mimic tests.
+
+To manually run the benchmarks, replace "-Wall -Werror" with "-O3" and replace
+the first "./a.out" with "./a.out -bench". Combine these changes with the
+"wuffs mimic cflags" to run the mimic benchmarks.
+*/
+
+// ¿ wuffs mimic cflags: -DWUFFS_MIMIC
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__ADLER32
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__DEFLATE
+#define WUFFS_CONFIG__MODULE__LZW
+#define WUFFS_CONFIG__MODULE__TIFF
+#define WUFFS_CONFIG__MODULE__ZLIB
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+#ifdef WUFFS_MIMIC
+// No mimic library.
+#endif
+
+// ---------------- TIFF Tests
+
+const char*  //
+wuffs_tiff_decode(uint64_t* n_bytes_out,
+                  wuffs_base__io_buffer* dst,
+                  uint32_t wuffs_initialize_flags,
+                  wuffs_base__pixel_format pixfmt,
+                  uint32_t* quirks_ptr,
+                  size_t quirks_len,
+                  wuffs_base__io_buffer* src) {
+  wuffs_tiff__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_tiff__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                               wuffs_initialize_flags));
+  return do_run__wuffs_base__image_decoder(
+      wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      n_bytes_out, dst, pixfmt, quirks_ptr, quirks_len, src);
+}
+
+const char*  //
+test_wuffs_tiff_decode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_tiff__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_tiff__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/bricks-color.tiff", 0, SIZE_MAX, 160, 120, 0xFF022460);
+}
+
+const char*  //
+test_wuffs_tiff_decode_compressions_and_layouts() {
+  CHECK_FOCUS(__func__);
+
+  const struct {
+    const char* filename;
+    uint32_t width;
+    uint32_t height;
+    wuffs_base__color_u32_argb_premul final_pixel;
+  } test_cases[] = {
+      // Deflate, one strip, predictor, little-endian.
+      {"test/data/bricks-color.tiff", 160, 120, 0xFF022460},
+      {"test/data/bricks-gray.tiff", 160, 120, 0xFF060606},
+      {"test/data/harvesters.tiff", 1165, 859, 0xFF0D010B},
+      {"test/data/hat.tiff", 90, 112, 0xFF000000},
+      {"test/data/hibiscus.primitive.tiff", 312, 442, 0xFF7A754D},
+      {"test/data/hibiscus.regular.tiff", 312, 442, 0xFF000000},
+      {"test/data/hippopotamus.tiff", 36, 28, 0xFFF5F5F5},
+      {"test/data/pjw-thumbnail.tiff", 32, 32, 0xFFFFFFFF},
+      // LZW, 16-row strips, predictor.
+      {"test/data/bricks-color.lzw.tiff", 160, 120, 0xFF022460},
+      // PackBits, 7-row strips, big-endian.
+      {"test/data/bricks-gray.packbits.tiff", 160, 120, 0xFF060606},
+      // LZW, RGBA (unassociated alpha), big-endian.
+      {"test/data/hat.rgba.tiff", 90, 112, 0xFF000000},
+      // Deflate, 64x48 tiles (some partial), predictor.
+      {"test/data/hibiscus.primitive.tiled.tiff", 312, 442, 0xFF7A754D},
+      // Uncompressed, 1 bit per pixel, WhiteIsZero.
+      {"test/data/pjw-thumbnail.bilevel.tiff", 32, 32, 0xFFFFFFFF},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_tiff__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_tiff__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    const char* z = do_test__wuffs_base__image_decoder(
+        wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        test_cases[tc].filename, 0, SIZE_MAX, test_cases[tc].width,
+        test_cases[tc].height, test_cases[tc].final_pixel);
+    if (z) {
+      RETURN_FAIL("%s: %s", test_cases[tc].filename, z);
+    }
+  }
+  return NULL;
+}
+
+// do_decode_tiff_frame decodes one frame, handling "@I/O redirect" notes.
+const char*  //
+do_decode_tiff_frame(wuffs_tiff__decoder* dec,
+                     wuffs_base__pixel_buffer* pb,
+                     wuffs_base__io_buffer* src) {
+  while (true) {
+    wuffs_base__status status = wuffs_tiff__decoder__decode_frame(
+        dec, pb, src, WUFFS_BASE__PIXEL_BLEND__SRC, g_work_slice_u8, NULL);
+    if (status.repr != wuffs_base__note__i_o_redirect) {
+      CHECK_STATUS("decode_frame", status);
+      return NULL;
+    }
+    CHECK_STRING(seek_for_io_redirect(
+        wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(dec), src));
+  }
+}
+
+const char*  //
+test_wuffs_tiff_decode_chunk_quirks() {
+  CHECK_FOCUS(__func__);
+
+  const char* filenames[] = {
+      "test/data/bricks-color.lzw.tiff",
+      "test/data/hibiscus.primitive.tiled.tiff",
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(filenames); tc++) {
+    wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+        .data = g_src_slice_u8,
+    });
+    CHECK_STRING(read_file(&src, filenames[tc]));
+
+    // Decode the whole frame with one decoder (into g_want_array_u8) and then
+    // in three parts with three decoders (into g_have_array_u8). The split
+    // points need not align with the strip or tile boundaries.
+    const uint32_t splits[4] = {0, 50, 100, 0};
+    wuffs_base__pixel_buffer pbs[2] = {0};
+    uint64_t pixbuf_len = 0;
+    int i;
+    for (i = 0; i < 4; i++) {
+      wuffs_tiff__decoder dec;
+      CHECK_STATUS("initialize",
+                   wuffs_tiff__decoder__initialize(
+                       &dec, sizeof dec, WUFFS_VERSION,
+                       WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+      if (i > 0) {
+        wuffs_tiff__decoder__set_quirk(
+            &dec, WUFFS_TIFF__QUIRK_CHUNK_MIN_INCL_Y, splits[i - 1]);
+        wuffs_tiff__decoder__set_quirk(&dec, WUFFS_TIFF__QUIRK_CHUNK_MAX_EXCL_Y,
+                                       splits[i]);
+      }
+
+      src.meta.ri = 0;
+      wuffs_base__image_config ic = ((wuffs_base__image_config){});
+      while (true) {
+        wuffs_base__status status =
+            wuffs_tiff__decoder__decode_image_config(&dec, &ic, &src);
+        if (status.repr != wuffs_base__note__i_o_redirect) {
+          CHECK_STATUS("decode_image_config", status);
+          break;
+        }
+        CHECK_STRING(seek_for_io_redirect(
+            wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+            &src));
+      }
+      wuffs_base__pixel_config__set(
+          &ic.pixcfg, WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL,
+          WUFFS_BASE__PIXEL_SUBSAMPLING__NONE,
+          wuffs_base__pixel_config__width(&ic.pixcfg),
+          wuffs_base__pixel_config__height(&ic.pixcfg));
+      pixbuf_len = wuffs_base__pixel_config__pixbuf_len(&ic.pixcfg);
+
+      if (i <= 1) {
+        if (i == 0) {
+          memset(g_want_array_u8, 0, pixbuf_len);
+        } else {
+          memset(g_have_array_u8, 0, pixbuf_len);
+        }
+        CHECK_STATUS("set_from_slice",
+                     wuffs_base__pixel_buffer__set_from_slice(
+                         &pbs[i], &ic.pixcfg,
+                         wuffs_base__make_slice_u8(
+                             (i == 0) ? g_want_array_u8 : g_have_array_u8,
+                             pixbuf_len)));
+      }
+      CHECK_STRING(do_decode_tiff_frame(&dec, &pbs[(i == 0) ? 0 : 1], &src));
+    }
+
+    wuffs_base__io_buffer have =
+        wuffs_base__ptr_u8__reader(g_have_array_u8, pixbuf_len, true);
+    wuffs_base__io_buffer want =
+        wuffs_base__ptr_u8__reader(g_want_array_u8, pixbuf_len, true);
+    CHECK_STRING(check_io_buffers_equal(filenames[tc], &have, &want));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_tiff_decode_multiple_pages() {
+  CHECK_FOCUS(__func__);
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/hippopotamus.multipage.tiff"));
+
+  wuffs_tiff__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_tiff__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_base__image_decoder* b =
+      wuffs_tiff__decoder__upcast_as__wuffs_base__image_decoder(&dec);
+
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  while (true) {
+    wuffs_base__status status =
+        wuffs_tiff__decoder__decode_image_config(&dec, &ic, &src);
+    if (status.repr != wuffs_base__note__i_o_redirect) {
+      CHECK_STATUS("decode_image_config", status);
+      break;
+    }
+    CHECK_STRING(seek_for_io_redirect(b, &src));
+  }
+  wuffs_base__pixel_config__set(&ic.pixcfg,
+                                WUFFS_BASE__PIXEL_FORMAT__BGRA_PREMUL,
+                                WUFFS_BASE__PIXEL_SUBSAMPLING__NONE, 36, 28);
+  wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
+  CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
+                                     &pb, &ic.pixcfg, g_pixel_slice_u8));
+
+  // The four pages are the same picture encoded as RGB (LZW), 16-bit gray
+  // (deflate), 4-bit palette (PackBits) and 8-bit WhiteIsZero gray (tiled).
+  // The top left pixel is gray, but the 4-bit page loses some precision.
+  const wuffs_base__color_u32_argb_premul want_top_left[4] = {
+      0xFF727272,
+      0xFF727272,
+      0xFF777777,
+      0xFF727272,
+  };
+  uint64_t io_positions[4] = {0};
+
+  int i;
+  for (i = 0; i < 5; i++) {
+    wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
+    wuffs_base__status status;
+    while (true) {
+      status = wuffs_tiff__decoder__decode_frame_config(&dec, &fc, &src);
+      if (status.repr != wuffs_base__note__i_o_redirect) {
+        break;
+      }
+      CHECK_STRING(seek_for_io_redirect(b, &src));
+    }
+    if (i == 4) {
+      if (status.repr != wuffs_base__note__end_of_data) {
+        RETURN_FAIL("decode_frame_config #%d: have \"%s\", want \"%s\"", i,
+                    status.repr, wuffs_base__note__end_of_data);
+      }
+      break;
+    }
+    CHECK_STATUS("decode_frame_config", status);
+    if (wuffs_base__frame_config__index(&fc) != (uint64_t)i) {
+      RETURN_FAIL("index #%d: have %" PRIu64, i,
+                  wuffs_base__frame_config__index(&fc));
+    }
+    io_positions[i] = wuffs_base__frame_config__io_position(&fc);
+
+    CHECK_STRING(do_decode_tiff_frame(&dec, &pb, &src));
+    wuffs_base__color_u32_argb_premul have =
+        wuffs_base__pixel_buffer__color_u32_at(&pb, 0, 0);
+    if (have != want_top_left[i]) {
+      RETURN_FAIL("top left pixel #%d: have 0x%08" PRIX32 ", want 0x%08" PRIX32,
+                  i, have, want_top_left[i]);
+    }
+  }
+
+  if (wuffs_tiff__decoder__num_decoded_frames(&dec) != 4) {
+    RETURN_FAIL("num_decoded_frames: have %" PRIu64 ", want 4",
+                wuffs_tiff__decoder__num_decoded_frames(&dec));
+  }
+
+  // Seek to each page in reverse order. TIFF pages are addressed by their IFD
+  // position, so restart_frame is all that's needed to jump around.
+  for (i = 3; i >= 0; i--) {
+    CHECK_STATUS("restart_frame", wuffs_tiff__decoder__restart_frame(
+                                      &dec, i, io_positions[i]));
+    wuffs_base__frame_config fc = ((wuffs_base__frame_config){});
+    while (true) {
+      wuffs_base__status status =
+          wuffs_tiff__decoder__decode_frame_config(&dec, &fc, &src);
+      if (status.repr != wuffs_base__note__i_o_redirect) {
+        CHECK_STATUS("decode_frame_config", status);
+        break;
+      }
+      CHECK_STRING(seek_for_io_redirect(b, &src));
+    }
+    if (wuffs_base__frame_config__index(&fc) != (uint64_t)i) {
+      RETURN_FAIL("restarted index #%d: have %" PRIu64, i,
+                  wuffs_base__frame_config__index(&fc));
+    }
+
+    CHECK_STRING(do_decode_tiff_frame(&dec, &pb, &src));
+    wuffs_base__color_u32_argb_premul have =
+        wuffs_base__pixel_buffer__color_u32_at(&pb, 0, 0);
+    if (have != want_top_left[i]) {
+      RETURN_FAIL("restarted top left pixel #%d: have 0x%08" PRIX32
+                  ", want 0x%08" PRIX32,
+                  i, have, want_top_left[i]);
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_tiff_decode_truncated_input() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(g_src_array_u8, 0, false);
+  wuffs_tiff__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_tiff__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__status status =
+      wuffs_tiff__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_base__suspension__short_read) {
+    RETURN_FAIL("closed=false: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__suspension__short_read);
+  }
+
+  src.meta.closed = true;
+  status = wuffs_tiff__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_tiff__error__truncated_input) {
+    RETURN_FAIL("closed=true: have \"%s\", want \"%s\"", status.repr,
+                wuffs_tiff__error__truncated_input);
+  }
+  return NULL;
+}
+
+#if !defined(WUFFS_NONMONOLITHIC)
+
+const char*  //
+test_wuffs_tiff_decode_predictor_implementations() {
+  CHECK_FOCUS(__func__);
+
+  // 100 is deliberately not a multiple of 3, 4 or 16.
+  const size_t n = 100;
+  wuffs_base__io_buffer pi = wuffs_base__slice_u8__writer(g_src_slice_u8);
+  CHECK_STRING(read_file(&pi, "test/data/pi.txt"));
+  if (pi.meta.wi < n) {
+    return "source data is too short";
+  }
+
+  wuffs_tiff__decoder dec;
+  CHECK_STATUS("initialize", wuffs_tiff__decoder__initialize(
+                                 &dec, sizeof dec, WUFFS_VERSION,
+                                 WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+
+  int distance;
+  for (distance = 1; distance <= 4; distance++) {
+    if (distance == 2) {
+      continue;
+    }
+
+    // Apply the predictor (horizontal differencing) to pi's digits.
+    uint8_t* want = g_want_array_u8;
+    uint8_t* have = g_have_array_u8;
+    memcpy(want, pi.data.ptr, n);
+    size_t i;
+    for (i = n - 1; i >= (size_t)distance; i--) {
+      g_work_array_u8[i] = (uint8_t)(want[i] - want[i - distance]);
+    }
+    for (i = 0; i < (size_t)distance; i++) {
+      g_work_array_u8[i] = want[i];
+    }
+
+    int impl;
+    for (impl = 0; impl < 2; impl++) {
+      memcpy(have, g_work_array_u8, n);
+      wuffs_base__slice_u8 s = wuffs_base__make_slice_u8(have, n);
+      if (impl == 0) {
+        switch (distance) {
+          case 1:
+            wuffs_tiff__decoder__undo_predictor_distance_1_fallback(&dec, s);
+            break;
+          case 3:
+            wuffs_tiff__decoder__undo_predictor_distance_3_fallback(&dec, s);
+            break;
+          case 4:
+            wuffs_tiff__decoder__undo_predictor_distance_4_fallback(&dec, s);
+            break;
+        }
+      } else {
+#if defined(WUFFS_BASE__CPU_ARCH__X86_FAMILY)
+        if (!wuffs_base__cpu_arch__have_x86_sse42()) {
+          continue;
+        }
+        switch (distance) {
+          case 1:
+            wuffs_tiff__decoder__undo_predictor_distance_1_x86_sse42(&dec, s);
+            break;
+          case 3:
+            wuffs_tiff__decoder__undo_predictor_distance_3_x86_sse42(&dec, s);
+            break;
+          case 4:
+            wuffs_tiff__decoder__undo_predictor_distance_4_x86_sse42(&dec, s);
+            break;
+        }
+#else
+        continue;
+#endif
+      }
+
+      wuffs_base__io_buffer have_buf =
+          wuffs_base__ptr_u8__reader(have, n, true);
+      wuffs_base__io_buffer want_buf =
+          wuffs_base__ptr_u8__reader(want, n, true);
+      char prefix_buf[256];
+      sprintf(prefix_buf, "distance=%d, impl=%d ", distance, impl);
+      CHECK_STRING(check_io_buffers_equal(prefix_buf, &have_buf, &want_buf));
+    }
+  }
+  return NULL;
+}
+
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
+// ---------------- Mimic Tests
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- TIFF Benches
+
+const char*  //
+bench_wuffs_tiff_decode_77k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_tiff_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.tiff", 0, SIZE_MAX, 200);
+}
+
+const char*  //
+bench_wuffs_tiff_decode_lzw_77k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_tiff_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.lzw.tiff", 0, SIZE_MAX, 200);
+}
+
+const char*  //
+bench_wuffs_tiff_decode_4002k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_tiff_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/harvesters.tiff", 0, SIZE_MAX, 3);
+}
+
+// ---------------- Mimic Benches
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_tiff_decode_chunk_quirks,
+    test_wuffs_tiff_decode_compressions_and_layouts,
+    test_wuffs_tiff_decode_interface,
+    test_wuffs_tiff_decode_multiple_pages,
+    test_wuffs_tiff_decode_truncated_input,
+
+#if !defined(WUFFS_NONMONOLITHIC)
+    test_wuffs_tiff_decode_predictor_implementations,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    bench_wuffs_tiff_decode_77k_24bpp,
+    bench_wuffs_tiff_decode_lzw_77k_24bpp,
+    bench_wuffs_tiff_decode_4002k_24bpp,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "std/tiff";
+  return test_main(argc, argv, g_tests, g_benches);
+}
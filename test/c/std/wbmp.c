@@ -298,6 +298,8 @@ test_wuffs_pixel_buffer_fill_rect() {
   return NULL;
 }
 
+#if !defined(WUFFS_NONMONOLITHIC)
+
 const char*  //
 test_wuffs_pixel_swizzler_swizzle() {
   CHECK_FOCUS(__func__);
@@ -548,6 +550,8 @@ test_wuffs_upsample_inv_h2v1() {
   return check_io_buffers_equal("", &have, &want);
 }
 
+#endif  // !defined(WUFFS_NONMONOLITHIC)
+
 // ---------------- WBMP Tests
 
 const char*  //
@@ -717,6 +721,7 @@ do_bench_wuffs_pixel_swizzler(uint32_t dst_pixfmt_repr,
               g_src_slice_u8.ptr + (src_bytes_per_row * y), src_bytes_per_row));
     }
     n_bytes += dst_bytes_per_row * height;
+    bench_lap();
   }
   bench_finish(iters, n_bytes);
   return NULL;
@@ -804,8 +809,10 @@ proc g_tests[] = {
     // them here is as good as any other place.
     test_wuffs_color_ycc_as_color_u32,
     test_wuffs_pixel_buffer_fill_rect,
+#if !defined(WUFFS_NONMONOLITHIC)
     test_wuffs_pixel_swizzler_swizzle,
     test_wuffs_upsample_inv_h2v1,
+#endif  // !defined(WUFFS_NONMONOLITHIC)
 
     test_wuffs_wbmp_decode_frame_config,
     test_wuffs_wbmp_decode_image_config,
@@ -0,0 +1,413 @@
+// Copyright 2024 The Wuffs Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ----------------
+
+/*
+This test program is typically run indirectly, by the "wuffs test" or "wuffs
+bench" commands. These commands take an optional "-mimic" flag to check that
+Wuffs' output mimics (i.e. exactly matches) other libraries' output, such as
+giflib for GIF, libpng for PNG, etc.
+
+To manually run this test:
+
+for CC in clang gcc; do
+  $CC -std=c99 -Wall -Werror webp.c && ./a.out
+  rm -f a.out
+done
+
+Each edition should print "PASS", amongst other information, and exit(0).
+
+Add the "wuffs mimic cflags" (everything after the colon below) to the C
+compiler flags (after the .c file) to run the mimic tests.
+
+To manually run the benchmarks, replace "-Wall -Werror" with "-O3" and replace
+the first "./a.out" with "./a.out -bench". Combine these changes with the
+"wuffs mimic cflags" to run the mimic benchmarks.
+*/
+
+// ¿ wuffs mimic cflags: -DWUFFS_MIMIC
+
+// Wuffs ships as a "single file C library" or "header file library" as per
+// https://github.com/nothings/stb/blob/master/docs/stb_howto.txt
+//
+// To use that single file as a "foo.c"-like implementation, instead of a
+// "foo.h"-like header, #define WUFFS_IMPLEMENTATION before #include'ing or
+// compiling it.
+#define WUFFS_IMPLEMENTATION
+
+// Defining the WUFFS_CONFIG__MODULE* macros are optional, but it lets users of
+// release/c/etc.c choose which parts of Wuffs to build. That file contains the
+// entire Wuffs standard library, implementing a variety of codecs and file
+// formats. Without this macro definition, an optimizing compiler or linker may
+// very well discard Wuffs code for unused codecs, but listing the Wuffs
+// modules we use makes that process explicit. Preprocessing means that such
+// code simply isn't compiled.
+#define WUFFS_CONFIG__MODULES
+#define WUFFS_CONFIG__MODULE__BASE
+#define WUFFS_CONFIG__MODULE__WEBP
+
+// If building this program in an environment that doesn't easily accommodate
+// relative includes, you can use the script/inline-c-relative-includes.go
+// program to generate a stand-alone C file.
+#include "../../../release/c/wuffs-unsupported-snapshot.c"
+#include "../testlib/testlib.c"
+#ifdef WUFFS_MIMIC
+// No mimic library.
+#endif
+
+// ---------------- WebP Tests
+
+const char*  //
+wuffs_webp_decode(uint64_t* n_bytes_out,
+                  wuffs_base__io_buffer* dst,
+                  uint32_t wuffs_initialize_flags,
+                  wuffs_base__pixel_format pixfmt,
+                  uint32_t* quirks_ptr,
+                  size_t quirks_len,
+                  wuffs_base__io_buffer* src) {
+  wuffs_webp__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_webp__decoder__initialize(&dec, sizeof dec, WUFFS_VERSION,
+                                               wuffs_initialize_flags));
+  return do_run__wuffs_base__image_decoder(
+      wuffs_webp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      n_bytes_out, dst, pixfmt, quirks_ptr, quirks_len, src);
+}
+
+const char*  //
+test_wuffs_webp_decode_interface() {
+  CHECK_FOCUS(__func__);
+  wuffs_webp__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_webp__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  return do_test__wuffs_base__image_decoder(
+      wuffs_webp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+      "test/data/bricks-color.lossless.webp", 0, SIZE_MAX, 160, 120,
+      0xFF022460);
+}
+
+const char*  //
+test_wuffs_webp_decode_transforms() {
+  CHECK_FOCUS(__func__);
+
+  const struct {
+    const char* filename;
+    uint32_t width;
+    uint32_t height;
+    wuffs_base__color_u32_argb_premul final_pixel;
+  } test_cases[] = {
+      {"test/data/bricks-dither.lossless.webp", 160, 120, 0xFF012463},
+      {"test/data/bricks-gray.lossless.webp", 160, 120, 0xFF060606},
+      {"test/data/hat.lossless.webp", 90, 112, 0xFF000000},
+      {"test/data/hibiscus.primitive.lossless.webp", 312, 442, 0xFF7A754D},
+      {"test/data/hibiscus.regular.lossless.webp", 312, 442, 0xFF000000},
+      {"test/data/hippopotamus.lossless.webp", 36, 28, 0xFFF5F5F5},
+      {"test/data/pjw-thumbnail.lossless.webp", 32, 32, 0xFFFFFFFF},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_webp__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_webp__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    CHECK_STRING(do_test__wuffs_base__image_decoder(
+        wuffs_webp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        test_cases[tc].filename, 0, SIZE_MAX, test_cases[tc].width,
+        test_cases[tc].height, test_cases[tc].final_pixel));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_webp_decode_lossy() {
+  CHECK_FOCUS(__func__);
+
+  const struct {
+    const char* filename;
+    uint32_t width;
+    uint32_t height;
+    wuffs_base__color_u32_argb_premul final_pixel;
+  } test_cases[] = {
+      {"test/data/bricks-color.lossy.webp", 160, 120, 0xFF032666},
+      {"test/data/bricks-gray.lossy.webp", 160, 120, 0xFF070707},
+      {"test/data/hat.lossy.webp", 90, 112, 0xFF070000},
+      {"test/data/hibiscus.primitive.lossy.webp", 312, 442, 0xFF797454},
+      {"test/data/hibiscus.regular.lossy.webp", 312, 442, 0xFF000000},
+      {"test/data/hippopotamus.lossy.webp", 36, 28, 0xFFF3F3F5},
+      {"test/data/pjw-thumbnail.lossy.webp", 32, 32, 0xFFFFFFFF},
+  };
+
+  int tc;
+  for (tc = 0; tc < WUFFS_TESTLIB_ARRAY_SIZE(test_cases); tc++) {
+    wuffs_webp__decoder dec;
+    CHECK_STATUS("initialize",
+                 wuffs_webp__decoder__initialize(
+                     &dec, sizeof dec, WUFFS_VERSION,
+                     WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+    CHECK_STRING(do_test__wuffs_base__image_decoder(
+        wuffs_webp__decoder__upcast_as__wuffs_base__image_decoder(&dec),
+        test_cases[tc].filename, 0, SIZE_MAX, test_cases[tc].width,
+        test_cases[tc].height, test_cases[tc].final_pixel));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_webp_decode_metadata() {
+  CHECK_FOCUS(__func__);
+  wuffs_base__io_buffer vp8l = ((wuffs_base__io_buffer){
+      .data = g_work_slice_u8,
+  });
+  CHECK_STRING(read_file(&vp8l, "test/data/pjw-thumbnail.lossless.webp"));
+  if (vp8l.meta.wi < 12) {
+    RETURN_FAIL("read_file: short file");
+  }
+
+  // Wrap the file's VP8L chunk in the extended (VP8X) format, preceded by
+  // ICCP, EXIF and XMP chunks. The odd-length chunks have a padding byte.
+  static const uint8_t header[] = {
+      'R', 'I', 'F', 'F', 0x00, 0x00, 0x00, 0x00, 'W', 'E', 'B', 'P',  //
+      'V', 'P', '8', 'X', 0x0A, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,                              //
+      'I', 'C', 'C', 'P', 0x03, 0x00, 0x00, 0x00, 'a', 'b', 'c', 0x00,  //
+      'E', 'X', 'I', 'F', 0x04, 0x00, 0x00, 0x00, 'd', 'e', 'f', 'g',  //
+      'X', 'M', 'P', ' ', 0x05, 0x00, 0x00, 0x00, 'h', 'i', 'j', 'k',
+      'l', 0x00,  //
+  };
+  size_t n = sizeof(header) + (vp8l.meta.wi - 12);
+  if (n > g_src_slice_u8.len) {
+    RETURN_FAIL("src buffer is too short");
+  }
+  memcpy(g_src_slice_u8.ptr, header, sizeof(header));
+  memcpy(g_src_slice_u8.ptr + sizeof(header), vp8l.data.ptr + 12,
+         vp8l.meta.wi - 12);
+  wuffs_base__poke_u32le__no_bounds_check(g_src_slice_u8.ptr + 4,
+                                          (uint32_t)(n - 8));
+
+  // Report the ICCP and EXIF chunks but not the XMP chunk.
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(g_src_slice_u8.ptr, n, true);
+  wuffs_webp__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_webp__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+  wuffs_webp__decoder__set_report_metadata(&dec, WUFFS_BASE__FOURCC__EXIF,
+                                           true);
+  wuffs_webp__decoder__set_report_metadata(&dec, WUFFS_BASE__FOURCC__ICCP,
+                                           true);
+
+  wuffs_base__image_config ic = ((wuffs_base__image_config){});
+  wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+  wuffs_base__more_information minfo = wuffs_base__empty_more_information();
+
+  struct {
+    uint32_t fourcc;
+    uint64_t min_incl;
+    uint64_t max_excl;
+  } wants[] = {
+      {WUFFS_BASE__FOURCC__ICCP, 0x26, 0x29},
+      {WUFFS_BASE__FOURCC__EXIF, 0x32, 0x36},
+  };
+
+  for (size_t i = 0; i < WUFFS_TESTLIB_ARRAY_SIZE(wants); i++) {
+    wuffs_base__status status =
+        wuffs_webp__decoder__decode_image_config(&dec, &ic, &src);
+    if (status.repr != wuffs_base__note__metadata_reported) {
+      RETURN_FAIL("decode_image_config #%d: have \"%s\", want \"%s\"", (int)(i),
+                  status.repr, wuffs_base__note__metadata_reported);
+    }
+
+    status = wuffs_webp__decoder__tell_me_more(&dec, &empty, &minfo, &src);
+    if (status.repr != wuffs_base__suspension__even_more_information) {
+      RETURN_FAIL("tell_me_more #%d.0: have \"%s\", want \"%s\"", (int)(i),
+                  status.repr, wuffs_base__suspension__even_more_information);
+    } else if (minfo.w != wants[i].fourcc) {
+      RETURN_FAIL("tell_me_more #%d.0: have fourcc 0x%08" PRIX32
+                  ", want 0x%08" PRIX32,
+                  (int)(i), minfo.w, wants[i].fourcc);
+    }
+    wuffs_base__range_ie_u64 have =
+        wuffs_base__more_information__metadata_raw_passthrough__range(&minfo);
+    wuffs_base__range_ie_u64 want =
+        wuffs_base__make_range_ie_u64(wants[i].min_incl, wants[i].max_excl);
+    if (!wuffs_base__range_ie_u64__equals(&have, want)) {
+      RETURN_FAIL("range #%d: have 0x%" PRIx64 "..0x%" PRIX64
+                  ", want 0x%" PRIx64 "..0x%" PRIX64,
+                  (int)(i), have.min_incl, have.max_excl, want.min_incl,
+                  want.max_excl);
+    }
+    src.meta.ri = (size_t)(want.max_excl);
+
+    status = wuffs_webp__decoder__tell_me_more(&dec, &empty, &minfo, &src);
+    if (status.repr != NULL) {
+      RETURN_FAIL("tell_me_more #%d.1: have \"%s\", want \"(null)\"", (int)(i),
+                  status.repr);
+    }
+  }
+
+  wuffs_base__status status =
+      wuffs_webp__decoder__decode_image_config(&dec, &ic, &src);
+  if (status.repr != NULL) {
+    RETURN_FAIL("decode_image_config #2: have \"%s\", want \"(null)\"",
+                status.repr);
+  } else if (wuffs_base__pixel_config__width(&ic.pixcfg) != 32) {
+    RETURN_FAIL("decode_image_config #2: have %" PRIu32 ", want 32",
+                wuffs_base__pixel_config__width(&ic.pixcfg));
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_webp_decode_truncated_input() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer src =
+      wuffs_base__ptr_u8__reader(g_src_array_u8, 0, false);
+  wuffs_webp__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_webp__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  wuffs_base__status status =
+      wuffs_webp__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_base__suspension__short_read) {
+    RETURN_FAIL("closed=false: have \"%s\", want \"%s\"", status.repr,
+                wuffs_base__suspension__short_read);
+  }
+
+  src.meta.closed = true;
+  status = wuffs_webp__decoder__decode_image_config(&dec, NULL, &src);
+  if (status.repr != wuffs_webp__error__truncated_input) {
+    RETURN_FAIL("closed=true: have \"%s\", want \"%s\"", status.repr,
+                wuffs_webp__error__truncated_input);
+  }
+  return NULL;
+}
+
+// ---------------- Mimic Tests
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- WebP Benches
+
+const char*  //
+bench_wuffs_webp_decode_77k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_webp_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.lossless.webp", 0, SIZE_MAX, 200);
+}
+
+const char*  //
+bench_wuffs_webp_decode_552k_32bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_webp_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/hibiscus.regular.lossless.webp", 0, SIZE_MAX, 30);
+}
+
+const char*  //
+bench_wuffs_webp_decode_4002k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_webp_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/harvesters.lossless.webp", 0, SIZE_MAX, 3);
+}
+
+const char*  //
+bench_wuffs_webp_decode_lossy_77k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_webp_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/bricks-color.lossy.webp", 0, SIZE_MAX, 200);
+}
+
+const char*  //
+bench_wuffs_webp_decode_lossy_4002k_24bpp() {
+  CHECK_FOCUS(__func__);
+  return do_bench_image_decode(
+      &wuffs_webp_decode,
+      WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED,
+      wuffs_base__make_pixel_format(WUFFS_BASE__PIXEL_FORMAT__BGRA_NONPREMUL),
+      NULL, 0, "test/data/harvesters.lossy.webp", 0, SIZE_MAX, 3);
+}
+
+// ---------------- Mimic Benches
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+// ---------------- Manifest
+
+proc g_tests[] = {
+
+    test_wuffs_webp_decode_interface,
+    test_wuffs_webp_decode_lossy,
+    test_wuffs_webp_decode_metadata,
+    test_wuffs_webp_decode_transforms,
+    test_wuffs_webp_decode_truncated_input,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic tests.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+proc g_benches[] = {
+
+    bench_wuffs_webp_decode_77k_24bpp,
+    bench_wuffs_webp_decode_552k_32bpp,
+    bench_wuffs_webp_decode_4002k_24bpp,
+    bench_wuffs_webp_decode_lossy_77k_24bpp,
+    bench_wuffs_webp_decode_lossy_4002k_24bpp,
+
+#ifdef WUFFS_MIMIC
+
+// No mimic benches.
+
+#endif  // WUFFS_MIMIC
+
+    NULL,
+};
+
+int  //
+main(int argc, char** argv) {
+  g_proc_package_name = "std/webp";
+  return test_main(argc, argv, g_tests, g_benches);
+}
@@ -363,6 +363,181 @@ test_wuffs_zlib_decode_sheep() {
   return check_io_buffers_equal("", &have, &want);
 }
 
+const char*  //
+test_wuffs_zlib_decode_sheep_primed() {
+  CHECK_FOCUS(__func__);
+
+  // Prime a workbuf once, then copy it (to g_want_slice_u8) so that we can
+  // check that decoding never modifies it.
+  wuffs_base__slice_u8 primed = wuffs_base__slice_u8__subslice_j(
+      g_work_slice_u8, WUFFS_DEFLATE__DECODER_HISTORY_WORKBUF_LEN);
+  {
+    wuffs_zlib__decoder dec;
+    CHECK_STATUS("initialize", wuffs_zlib__decoder__initialize(
+                                   &dec, sizeof dec, WUFFS_VERSION,
+                                   WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+    CHECK_STATUS("add_dictionary_to_workbuf",
+                 wuffs_zlib__decoder__add_dictionary_to_workbuf(
+                     &dec,
+                     ((wuffs_base__slice_u8){
+                         .ptr = ((uint8_t*)(g_zlib_sheep_dict_ptr)),
+                         .len = g_zlib_sheep_dict_len,
+                     }),
+                     primed));
+    memcpy(g_want_slice_u8.ptr, primed.ptr, primed.len);
+  }
+
+  wuffs_base__io_buffer want =
+      make_io_buffer_from_string(g_zlib_sheep_want_ptr, g_zlib_sheep_want_len);
+
+  // Decode twice with fresh decoders sharing the primed workbuf. The second
+  // time, write one byte per transform_io call, so that it suspends.
+  for (int i = 0; i < 2; i++) {
+    wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+        .data = g_have_slice_u8,
+    });
+    wuffs_base__io_buffer src =
+        make_io_buffer_from_string(g_zlib_sheep_src_ptr, g_zlib_sheep_src_len);
+
+    wuffs_zlib__decoder dec;
+    CHECK_STATUS("initialize", wuffs_zlib__decoder__initialize(
+                                   &dec, sizeof dec, WUFFS_VERSION,
+                                   WUFFS_INITIALIZE__DEFAULT_OPTIONS));
+
+    wuffs_base__status status =
+        wuffs_zlib__decoder__transform_io(&dec, &have, &src, primed);
+    if (status.repr != wuffs_zlib__note__dictionary_required) {
+      RETURN_FAIL("i=%d: transform_io (before dict): have \"%s\", want "
+                  "\"%s\"",
+                  i, status.repr, wuffs_zlib__note__dictionary_required);
+    }
+    wuffs_zlib__decoder__use_primed_dictionary(&dec, 0x0BE0026E,
+                                               g_zlib_sheep_dict_len);
+
+    while (true) {
+      if (i > 0) {
+        have.data.len = have.meta.wi + 1;
+      }
+      status = wuffs_zlib__decoder__transform_io(&dec, &have, &src, primed);
+      if (status.repr != wuffs_base__suspension__short_write) {
+        break;
+      }
+    }
+    if (status.repr) {
+      RETURN_FAIL("i=%d: transform_io (after dict): have \"%s\"", i,
+                  status.repr);
+    }
+    CHECK_STRING(check_io_buffers_equal("", &have, &want));
+  }
+
+  if (memcmp(primed.ptr, g_want_slice_u8.ptr, primed.len)) {
+    RETURN_FAIL("primed workbuf was modified");
+  }
+  return NULL;
+}
+
+#ifdef WUFFS_CONFIG__ENABLE_STATS
+
+// find_stats_counters returns the named function's counters, or NULL.
+const wuffs_base__stats_counters*  //
+find_stats_counters(const wuffs_base__stats* stats, const char* func_name) {
+  for (size_t i = 0; i < stats->num_funcs; i++) {
+    if (!strcmp(stats->func_names[i], func_name)) {
+      return &stats->func_counters[i];
+    }
+  }
+  return NULL;
+}
+
+const char*  //
+test_wuffs_zlib_decode_stats() {
+  CHECK_FOCUS(__func__);
+
+  wuffs_base__io_buffer have = ((wuffs_base__io_buffer){
+      .data = g_have_slice_u8,
+  });
+  wuffs_base__io_buffer src = ((wuffs_base__io_buffer){
+      .data = g_src_slice_u8,
+  });
+  CHECK_STRING(read_file(&src, "test/data/pi.txt.zlib"));
+
+  wuffs_zlib__decoder dec;
+  CHECK_STATUS("initialize",
+               wuffs_zlib__decoder__initialize(
+                   &dec, sizeof dec, WUFFS_VERSION,
+                   WUFFS_INITIALIZE__LEAVE_INTERNAL_BUFFERS_UNINITIALIZED));
+
+  // Limit the dst buffer's length, so that transform_io suspends.
+  const size_t wlimit = 4096;
+  uint64_t num_calls = 0;
+  while (true) {
+    wuffs_base__io_buffer limited_have = have;
+    if (limited_have.data.len > (have.meta.wi + wlimit)) {
+      limited_have.data.len = have.meta.wi + wlimit;
+    }
+    wuffs_base__status status = wuffs_zlib__decoder__transform_io(
+        &dec, &limited_have, &src, g_work_slice_u8);
+    have.meta.wi = limited_have.meta.wi;
+    num_calls++;
+    if (wuffs_base__status__is_ok(&status)) {
+      break;
+    } else if (status.repr != wuffs_base__suspension__short_write) {
+      RETURN_FAIL("transform_io: \"%s\"", status.repr);
+    }
+  }
+  if (num_calls < 2) {
+    RETURN_FAIL("num_calls: have %" PRIu64 ", want >= 2", num_calls);
+  }
+
+  wuffs_base__stats stats[8];
+  size_t n = wuffs_zlib__decoder__stats(&dec, stats, 8);
+  // The zlib decoder has two adler32 hashers and a deflate decoder.
+  if (n != 4) {
+    RETURN_FAIL("stats: have %zu, want 4", n);
+  } else if (strcmp(stats[0].struct_name, "zlib.decoder")) {
+    RETURN_FAIL("stats[0]: have \"%s\", want \"zlib.decoder\"",
+                stats[0].struct_name);
+  } else if (strcmp(stats[3].struct_name, "deflate.decoder")) {
+    RETURN_FAIL("stats[3]: have \"%s\", want \"deflate.decoder\"",
+                stats[3].struct_name);
+  } else if (stats[0].num_src_bytes != src.meta.wi) {
+    RETURN_FAIL("num_src_bytes: have %" PRIu64 ", want %zu",
+                stats[0].num_src_bytes, src.meta.wi);
+  } else if (stats[0].num_dst_bytes != have.meta.wi) {
+    RETURN_FAIL("num_dst_bytes: have %" PRIu64 ", want %zu",
+                stats[0].num_dst_bytes, have.meta.wi);
+  }
+
+  const wuffs_base__stats_counters* c =
+      find_stats_counters(&stats[0], "zlib.decoder.transform_io");
+  if (!c) {
+    RETURN_FAIL("could not find zlib.decoder.transform_io");
+  } else if (c->num_calls != num_calls) {
+    RETURN_FAIL("transform_io num_calls: have %" PRIu64 ", want %" PRIu64,
+                c->num_calls, num_calls);
+  } else if (c->num_suspensions != (num_calls - 1)) {
+    RETURN_FAIL("transform_io num_suspensions: have %" PRIu64
+                ", want %" PRIu64,
+                c->num_suspensions, num_calls - 1);
+  }
+
+  c = find_stats_counters(&stats[3], "deflate.decoder.init_huff");
+  if (!c) {
+    RETURN_FAIL("could not find deflate.decoder.init_huff");
+  } else if (c->num_calls == 0) {
+    RETURN_FAIL("init_huff num_calls: have 0, want > 0");
+  }
+
+  // Passing a short (or NULL) dst still returns the total number.
+  n = wuffs_zlib__decoder__stats(&dec, NULL, 0);
+  if (n != 4) {
+    RETURN_FAIL("stats (NULL dst): have %zu, want 4", n);
+  }
+  return NULL;
+}
+
+#endif  // WUFFS_CONFIG__ENABLE_STATS
+
 // ---------------- Mimic Tests
 
 #ifdef WUFFS_MIMIC
@@ -455,8 +630,15 @@ proc g_tests[] = {
     test_wuffs_zlib_decode_pi,
     test_wuffs_zlib_decode_raw_deflate_romeo,
     test_wuffs_zlib_decode_sheep,
+    test_wuffs_zlib_decode_sheep_primed,
     test_wuffs_zlib_decode_truncated_input,
 
+#ifdef WUFFS_CONFIG__ENABLE_STATS
+
+    test_wuffs_zlib_decode_stats,
+
+#endif  // WUFFS_CONFIG__ENABLE_STATS
+
 #ifdef WUFFS_MIMIC
 
     test_mimic_zlib_decode_midsummer,
@@ -18,12 +18,44 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
+#include <time.h>
 #include <unistd.h>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define WUFFS_TESTLIB_HAVE_RDTSC 1
+#endif
+
+// The "-perf" flag needs Linux and syscall, which _DEFAULT_SOURCE (implied by
+// _GNU_SOURCE, which the "wuffs test" and "wuffs bench" commands pass)
+// declares. The "-threads" flag needs Linux and pthread_setaffinity_np, which
+// _GNU_SOURCE declares.
+#if defined(__linux__) && defined(_DEFAULT_SOURCE)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define WUFFS_TESTLIB_HAVE_PERF_EVENT 1
+#endif
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#include <pthread.h>
+#include <sched.h>
+#define WUFFS_TESTLIB_HAVE_THREADS 1
+#endif
+
+// Variables that a benchmark (running on multiple threads, for the "-threads"
+// flag) can modify are thread-local.
+#if defined(__GNUC__) || defined(__clang__)
+#define WUFFS_TESTLIB_THREAD_LOCAL __thread
+#else
+#define WUFFS_TESTLIB_THREAD_LOCAL
+#endif
+
 #define MIMICLIB_SCRATCH_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
 #define IO_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
 #define PIXEL_BUFFER_ARRAY_SIZE (64 * 1024 * 1024)
 #define TOKEN_BUFFER_ARRAY_SIZE (128 * 1024)
+#define BENCH_SAMPLES_MAX_LEN (1024 * 1024)
 
 #define WUFFS_TESTLIB_ARRAY_SIZE(a) (sizeof(a) / sizeof(a[0]))
 
@@ -38,16 +70,16 @@ uint8_t g_pixel_array_u8[PIXEL_BUFFER_ARRAY_SIZE];
 wuffs_base__token g_have_array_token[TOKEN_BUFFER_ARRAY_SIZE];
 wuffs_base__token g_want_array_token[TOKEN_BUFFER_ARRAY_SIZE];
 
-wuffs_base__slice_u8 g_have_slice_u8;
-wuffs_base__slice_u8 g_want_slice_u8;
-wuffs_base__slice_u8 g_work_slice_u8;
-wuffs_base__slice_u8 g_src_slice_u8;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_u8 g_have_slice_u8;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_u8 g_want_slice_u8;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_u8 g_work_slice_u8;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_u8 g_src_slice_u8;
 
-wuffs_base__slice_u8 g_mimiclib_scratch_slice_u8;
-wuffs_base__slice_u8 g_pixel_slice_u8;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_u8 g_mimiclib_scratch_slice_u8;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_u8 g_pixel_slice_u8;
 
-wuffs_base__slice_token g_have_slice_token;
-wuffs_base__slice_token g_want_slice_token;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_token g_have_slice_token;
+WUFFS_TESTLIB_THREAD_LOCAL wuffs_base__slice_token g_want_slice_token;
 
 void  //
 wuffs_testlib__initialize_global_xxx_slices() {
@@ -100,7 +132,7 @@ unhex(uint8_t b) {
   return 0;
 }
 
-char g_fail_msg[65536] = {0};
+WUFFS_TESTLIB_THREAD_LOCAL char g_fail_msg[65536] = {0};
 
 #define RETURN_FAIL(...)                                                \
   return (snprintf(g_fail_msg, sizeof(g_fail_msg), ##__VA_ARGS__) >= 0) \
@@ -135,13 +167,18 @@ struct {
   bool bench;
   const char* focus;
   uint64_t iterscale;
+  bool json;
+  bool perf;
+  bool rdtsc;
   int reps;
+  int threads;
 } g_flags = {0};
 
 const char*  //
 parse_flags(int argc, char** argv) {
   g_flags.iterscale = 100;
   g_flags.reps = 5;
+  g_flags.threads = 1;
 
   int c = (argc > 0) ? 1 : 0;  // Skip argv[0], the program name.
   for (; c < argc; c++) {
@@ -190,6 +227,30 @@ parse_flags(int argc, char** argv) {
       continue;
     }
 
+    if (!strcmp(arg, "json")) {
+      g_flags.json = true;
+      continue;
+    }
+
+    if (!strcmp(arg, "perf")) {
+#if defined(WUFFS_TESTLIB_HAVE_PERF_EVENT)
+      g_flags.perf = true;
+      continue;
+#else
+      return "-perf is unsupported on this platform (or without "
+             "_DEFAULT_SOURCE)";
+#endif
+    }
+
+    if (!strcmp(arg, "rdtsc")) {
+#if defined(WUFFS_TESTLIB_HAVE_RDTSC)
+      g_flags.rdtsc = true;
+      continue;
+#else
+      return "-rdtsc is unsupported on this platform";
+#endif
+    }
+
     if (!strncmp(arg, "reps=", 5)) {
       arg += 5;
       if (!*arg) {
@@ -207,6 +268,29 @@ parse_flags(int argc, char** argv) {
       continue;
     }
 
+    if (!strncmp(arg, "threads=", 8)) {
+      arg += 8;
+      if (!*arg) {
+        return "missing -threads=N value";
+      }
+      char* end = NULL;
+      long int n = strtol(arg, &end, 10);
+      if (*end) {
+        return "invalid -threads=N value";
+      }
+      if ((n < 1) || (1024 < n)) {
+        return "out-of-range -threads=N value";
+      }
+#if !defined(WUFFS_TESTLIB_HAVE_THREADS)
+      if (n > 1) {
+        return "-threads is unsupported on this platform (or without "
+               "_GNU_SOURCE)";
+      }
+#endif
+      g_flags.threads = n;
+      continue;
+    }
+
     return "unrecognized flag argument";
   }
 
@@ -216,8 +300,8 @@ parse_flags(int argc, char** argv) {
 }
 
 const char* g_proc_package_name = "unknown_package_name";
-const char* g_proc_func_name = "unknown_func_name";
-bool g_in_focus = false;
+WUFFS_TESTLIB_THREAD_LOCAL const char* g_proc_func_name = "unknown_func_name";
+WUFFS_TESTLIB_THREAD_LOCAL bool g_in_focus = false;
 
 #define CHECK_FOCUS(func_name)  \
   g_proc_func_name = func_name; \
@@ -270,20 +354,21 @@ check_focus() {
 
       // See if g_proc_func_name (with or without a "test_" or "bench_" prefix)
       // starts with the [p, q) string.
-      if ((n >= q - p) && !strncmp(g_proc_func_name, p, q - p)) {
+      size_t pq_len = (size_t)(q - p);
+      if ((n >= pq_len) && !strncmp(g_proc_func_name, p, pq_len)) {
         return true;
       }
       const char* unprefixed_proc_func_name = NULL;
       size_t unprefixed_n = 0;
-      if ((n >= q - p) && !strncmp(g_proc_func_name, "test_", 5)) {
+      if ((n >= pq_len) && !strncmp(g_proc_func_name, "test_", 5)) {
         unprefixed_proc_func_name = g_proc_func_name + 5;
         unprefixed_n = n - 5;
-      } else if ((n >= q - p) && !strncmp(g_proc_func_name, "bench_", 6)) {
+      } else if ((n >= pq_len) && !strncmp(g_proc_func_name, "bench_", 6)) {
         unprefixed_proc_func_name = g_proc_func_name + 6;
         unprefixed_n = n - 6;
       }
-      if (unprefixed_proc_func_name && (unprefixed_n >= q - p) &&
-          !strncmp(unprefixed_proc_func_name, p, q - p)) {
+      if (unprefixed_proc_func_name && (unprefixed_n >= pq_len) &&
+          !strncmp(unprefixed_proc_func_name, p, pq_len)) {
         return true;
       }
     }
@@ -322,42 +407,624 @@ typedef struct {
   size_t src_offset1;
 } golden_test;
 
+// ---------------- Benchmark Timing
+
+// By default, each benchmark rep prints one line in the benchstat format (see
+// test_main below), based on the total elapsed time for that rep's
+// iterations.
+//
+// The "-json" flag instead prints one JSON object per line per (non warm up)
+// rep. It also records per-iteration samples, as bench_lap is called at the
+// end of each iteration, so that the JSON can report the min, median (p50)
+// and 99th percentile (p99) iteration time as well as the mean. Recording
+// samples costs one clock read per iteration, which is why it is opt-in. The
+// sample buffer is allocated lazily and grows (up to BENCH_SAMPLES_MAX_LEN
+// samples, with any further iterations not sampled) with the number of
+// iterations, so that it costs nothing without "-json".
+//
+// The "-rdtsc" flag (x86_64 only) additionally reports the number of time
+// stamp counter ticks per byte and per op. On modern x86 CPUs, the TSC runs
+// at a constant (nominal) frequency, regardless of turbo or power saving, so
+// these are "reference cycles", not core clock cycles.
+
 bool g_bench_warm_up;
-struct timeval g_bench_start_tv;
+WUFFS_TESTLIB_THREAD_LOCAL uint64_t g_bench_start_ns;
+WUFFS_TESTLIB_THREAD_LOCAL uint64_t g_bench_lap_ns;
+WUFFS_TESTLIB_THREAD_LOCAL uint64_t g_bench_start_tsc;
+uint64_t* g_bench_samples = NULL;
+size_t g_bench_samples_len;
+size_t g_bench_samples_cap;
+
+// CLOCK_MONOTONIC_RAW and clock_gettime are only declared when the POSIX
+// feature macros are enabled (e.g. "-D_GNU_SOURCE"). Under a strict "-std=c99"
+// without them, the benchmark timer falls back to gettimeofday.
+#if defined(CLOCK_MONOTONIC_RAW)
+const char* g_bench_clock_name = "monotonic_raw";
+#elif defined(CLOCK_MONOTONIC)
+const char* g_bench_clock_name = "monotonic";
+#else
+const char* g_bench_clock_name = "gettimeofday";
+#endif
+
+uint64_t  //
+bench_now_ns() {
+#if defined(CLOCK_MONOTONIC_RAW) || defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+#if defined(CLOCK_MONOTONIC_RAW)
+  clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+  return ((uint64_t)(ts.tv_sec) * 1000000000) + ((uint64_t)(ts.tv_nsec));
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return ((uint64_t)(tv.tv_sec) * 1000000000) +
+         ((uint64_t)(tv.tv_usec) * 1000);
+#endif
+}
+
+uint64_t  //
+bench_now_tsc() {
+#if defined(WUFFS_TESTLIB_HAVE_RDTSC)
+  if (g_flags.rdtsc) {
+    return __rdtsc();
+  }
+#endif
+  return 0;
+}
+
+// ---------------- Benchmark Threads
+
+// The "-threads=N" flag (Linux only) runs each benchmark twice per rep: once
+// on the main thread, as usual, and then concurrently on N threads, each
+// pinned to its own CPU (modulo the number of CPUs available) and each with
+// its own decoders and buffers. The second run reports the aggregate
+// throughput (the total bytes processed over the wall time from when every
+// thread starts timing until the last one finishes) and the scaling
+// efficiency: that aggregate throughput divided by N times the first run's
+// throughput. An efficiency well below 1 suggests contention for shared
+// resources such as memory bandwidth, shared caches or falsely shared cache
+// lines.
+//
+// Only the first (main thread) run records per-iteration samples: bench_lap
+// is a no-op on the N concurrent threads, so their "-json" output reports
+// the aggregate throughput and efficiency but no ns_min, ns_p50, etc.
+
+typedef const char* (*proc)();
+
+typedef struct {
+  int index;
+  proc p;
+  const char* status;
+  bool in_focus;
+  bool rendezvoused;
+  uint64_t iters;
+  uint64_t n_bytes;
+  uint64_t start_ns;
+  uint64_t finish_ns;
+  wuffs_base__slice_u8 slices_u8[6];
+  wuffs_base__slice_token slices_token[2];
+#if defined(WUFFS_TESTLIB_HAVE_THREADS)
+  pthread_t thread;
+#endif
+} bench_thread;
+
+WUFFS_TESTLIB_THREAD_LOCAL bench_thread* g_bench_thread = NULL;
+uint64_t g_bench_single_thread_work;
+uint64_t g_bench_single_thread_nanos;
+
+#if defined(WUFFS_TESTLIB_HAVE_THREADS)
+
+bench_thread* g_bench_threads = NULL;
+pthread_mutex_t g_bench_threads_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t g_bench_threads_cond = PTHREAD_COND_INITIALIZER;
+int g_bench_threads_arrived;
+cpu_set_t g_bench_threads_cpus;
+
+const char*  //
+bench_threads_open() {
+  g_bench_threads =
+      (bench_thread*)(calloc(g_flags.threads, sizeof(bench_thread)));
+  if (!g_bench_threads) {
+    return "-threads: out of memory";
+  }
+  static const size_t lengths_u8[6] = {
+      IO_BUFFER_ARRAY_SIZE,    IO_BUFFER_ARRAY_SIZE,
+      IO_BUFFER_ARRAY_SIZE,    IO_BUFFER_ARRAY_SIZE,
+      PIXEL_BUFFER_ARRAY_SIZE, MIMICLIB_SCRATCH_BUFFER_ARRAY_SIZE,
+  };
+  for (int t = 0; t < g_flags.threads; t++) {
+    bench_thread* bt = &g_bench_threads[t];
+    bt->index = t;
+    // The buffers are large but calloc'ed memory is typically only committed
+    // when a benchmark touches it.
+    for (int i = 0; i < 6; i++) {
+      bt->slices_u8[i].ptr = (uint8_t*)(calloc(lengths_u8[i], 1));
+      bt->slices_u8[i].len = lengths_u8[i];
+      if (!bt->slices_u8[i].ptr) {
+        return "-threads: out of memory";
+      }
+    }
+    for (int i = 0; i < 2; i++) {
+      bt->slices_token[i].ptr = (wuffs_base__token*)(calloc(
+          TOKEN_BUFFER_ARRAY_SIZE, sizeof(wuffs_base__token)));
+      bt->slices_token[i].len = TOKEN_BUFFER_ARRAY_SIZE;
+      if (!bt->slices_token[i].ptr) {
+        return "-threads: out of memory";
+      }
+    }
+  }
+  CPU_ZERO(&g_bench_threads_cpus);
+  if (sched_getaffinity(0, sizeof(g_bench_threads_cpus),
+                        &g_bench_threads_cpus)) {
+    CPU_ZERO(&g_bench_threads_cpus);
+  }
+  return NULL;
+}
+
+// bench_thread_rendezvous waits for all of the benchmark threads to arrive,
+// so that they start timing at the same time. A thread that returns (e.g.
+// because of a failure) without calling bench_start also counts as arriving.
+void  //
+bench_thread_rendezvous(bench_thread* bt) {
+  pthread_mutex_lock(&g_bench_threads_mutex);
+  bt->rendezvoused = true;
+  g_bench_threads_arrived++;
+  if (g_bench_threads_arrived >= g_flags.threads) {
+    pthread_cond_broadcast(&g_bench_threads_cond);
+  } else {
+    while (g_bench_threads_arrived < g_flags.threads) {
+      pthread_cond_wait(&g_bench_threads_cond, &g_bench_threads_mutex);
+    }
+  }
+  pthread_mutex_unlock(&g_bench_threads_mutex);
+}
+
+void*  //
+bench_thread_main(void* arg) {
+  bench_thread* bt = (bench_thread*)(arg);
+
+  int n_cpus = CPU_COUNT(&g_bench_threads_cpus);
+  if (n_cpus > 0) {
+    int nth = bt->index % n_cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &g_bench_threads_cpus) && (nth-- == 0)) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        break;
+      }
+    }
+  }
+
+  g_bench_thread = bt;
+  g_have_slice_u8 = bt->slices_u8[0];
+  g_want_slice_u8 = bt->slices_u8[1];
+  g_work_slice_u8 = bt->slices_u8[2];
+  g_src_slice_u8 = bt->slices_u8[3];
+  g_pixel_slice_u8 = bt->slices_u8[4];
+  g_mimiclib_scratch_slice_u8 = bt->slices_u8[5];
+  g_have_slice_token = bt->slices_token[0];
+  g_want_slice_token = bt->slices_token[1];
+
+  g_proc_func_name = "unknown_func_name";
+  g_fail_msg[0] = 0;
+  g_in_focus = false;
+  bt->status = (*bt->p)();
+  bt->in_focus = g_in_focus;
+  if (!bt->rendezvoused) {
+    bench_thread_rendezvous(bt);
+  }
+  if (bt->status) {
+    // Copy the thread-local g_fail_msg (which bt->status may point to), as
+    // it is freed when this thread exits.
+    bt->status = strdup(bt->status);
+  }
+  return NULL;
+}
+
+void  //
+bench_threads_print(const char* name) {
+  int n = g_flags.threads;
+  uint64_t iters = 0;
+  uint64_t n_bytes = 0;
+  uint64_t start_ns = g_bench_threads[0].start_ns;
+  uint64_t finish_ns = g_bench_threads[0].finish_ns;
+  for (int t = 0; t < n; t++) {
+    bench_thread* bt = &g_bench_threads[t];
+    iters += bt->iters;
+    n_bytes += bt->n_bytes;
+    start_ns = (start_ns < bt->start_ns) ? start_ns : bt->start_ns;
+    finish_ns = (finish_ns > bt->finish_ns) ? finish_ns : bt->finish_ns;
+  }
+  uint64_t nanos = (finish_ns > start_ns) ? (finish_ns - start_ns) : 1;
+  uint64_t work = n_bytes ? n_bytes : iters;
+  double efficiency = 0.0;
+  if (g_bench_single_thread_work > 0) {
+    efficiency = (((double)(work)) / ((double)(nanos))) /
+                 (((double)(n)) * ((double)(g_bench_single_thread_work)) /
+                  ((double)(g_bench_single_thread_nanos)));
+  }
+
+  if (g_flags.json) {
+    printf("{\"package\":\"%s\",\"name\":\"%s\",\"cc\":\"%s\","
+           "\"threads\":%d,\"iters\":%" PRIu64 ",\"n_bytes\":%" PRIu64
+           ",\"ns\":%" PRIu64,
+           g_proc_package_name, name, g_cc, n, iters, n_bytes, nanos);
+    if (n_bytes) {
+      printf(",\"mb_per_s\":%.3f,\"thread_mb_per_s\":[",
+             ((double)(n_bytes)) * 1e3 / ((double)(nanos)));
+      for (int t = 0; t < n; t++) {
+        bench_thread* bt = &g_bench_threads[t];
+        uint64_t bt_nanos = bt->finish_ns - bt->start_ns;
+        printf("%s%.3f", t ? "," : "",
+               ((double)(bt->n_bytes)) * 1e3 /
+                   ((double)(bt_nanos ? bt_nanos : 1)));
+      }
+      printf("]");
+    }
+    printf(",\"scaling_efficiency\":%.3f}\n", efficiency);
+  } else {
+    // The "-%d" suffix follows Go's "BenchmarkFoo-8" convention (for
+    // GOMAXPROCS=8), which benchstat understands.
+    uint64_t kb_per_s = n_bytes * 1000000 / nanos;
+    printf("Benchmark%s/%s-%d\t%8" PRIu64 "\t%8" PRIu64 " ns/op",  //
+           name, g_cc, n, iters, nanos / (iters ? iters : 1));
+    if (n_bytes) {
+      printf("\t%8d.%03d MB/s",  //
+             (int)(kb_per_s / 1000), (int)(kb_per_s % 1000));
+    }
+    printf("\t%8.3f scaling\n", efficiency);
+  }
+  fflush(stdout);
+}
+
+// bench_threads_run runs the p benchmark concurrently on g_flags.threads
+// threads.
+const char*  //
+bench_threads_run(proc p) {
+  g_bench_threads_arrived = 0;
+  for (int t = 0; t < g_flags.threads; t++) {
+    bench_thread* bt = &g_bench_threads[t];
+    bt->p = p;
+    bt->status = NULL;
+    bt->in_focus = false;
+    bt->rendezvoused = false;
+    bt->iters = 0;
+    bt->n_bytes = 0;
+    bt->start_ns = 0;
+    bt->finish_ns = 0;
+    if (pthread_create(&bt->thread, NULL, bench_thread_main, bt)) {
+      return "-threads: could not create thread";
+    }
+  }
+  const char* status = NULL;
+  for (int t = 0; t < g_flags.threads; t++) {
+    bench_thread* bt = &g_bench_threads[t];
+    pthread_join(bt->thread, NULL);
+    if (bt->status && !status) {
+      status = bt->status;
+    }
+  }
+  if (status) {
+    return status;
+  }
+
+  const char* name = g_proc_func_name;
+  if ((strlen(name) >= 6) && !strncmp(name, "bench_", 6)) {
+    name += 6;
+  }
+  if (!g_bench_warm_up) {
+    bench_threads_print(name);
+  }
+  return NULL;
+}
+
+#endif  // defined(WUFFS_TESTLIB_HAVE_THREADS)
+
+// ---------------- Benchmark Performance Counters
+
+// The "-perf" flag (Linux only) measures hardware performance counters, via
+// perf_event_open, over each benchmark rep's iterations. The counters are
+// user-space only, so that they work with the default perf_event_paranoid
+// setting of 2. Counters that the CPU (or hypervisor) doesn't support are
+// skipped, but the cycles counter is required.
+//
+// This lets a regression be attributed to executing more instructions (an
+// algorithmic change) or to the same instructions running more slowly (e.g.
+// more branch or cache misses).
+
+#define BENCH_PERF_NUM_COUNTERS 5
+
+struct {
+  const char* name;
+  uint32_t type;
+  uint64_t config;
+} g_bench_perf_counter_defs[BENCH_PERF_NUM_COUNTERS] = {
+#if defined(WUFFS_TESTLIB_HAVE_PERF_EVENT)
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"l1d_misses", PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+#else
+    {"cycles", 0, 0},
+    {"instructions", 0, 0},
+    {"branch_misses", 0, 0},
+    {"l1d_misses", 0, 0},
+    {"llc_misses", 0, 0},
+#endif
+};
+
+int g_bench_perf_fds[BENCH_PERF_NUM_COUNTERS] = {-1, -1, -1, -1, -1};
+uint64_t g_bench_perf_values[BENCH_PERF_NUM_COUNTERS];
+
+const char*  //
+bench_perf_open() {
+#if defined(WUFFS_TESTLIB_HAVE_PERF_EVENT)
+  for (int i = 0; i < BENCH_PERF_NUM_COUNTERS; i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = g_bench_perf_counter_defs[i].type;
+    attr.config = g_bench_perf_counter_defs[i].config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    g_bench_perf_fds[i] =
+        (int)(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if ((g_bench_perf_fds[i] < 0) && (i == 0)) {
+      RETURN_FAIL(
+          "-perf: could not open the cycles counter: %s (is "
+          "/proc/sys/kernel/perf_event_paranoid at most 2, and does this "
+          "(virtual) machine expose a PMU?)",
+          strerror(errno));
+    }
+  }
+  return NULL;
+#else
+  return "-perf is unsupported on this platform";
+#endif
+}
+
+void  //
+bench_perf_start() {
+#if defined(WUFFS_TESTLIB_HAVE_PERF_EVENT)
+  for (int i = 0; i < BENCH_PERF_NUM_COUNTERS; i++) {
+    if (g_bench_perf_fds[i] >= 0) {
+      ioctl(g_bench_perf_fds[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(g_bench_perf_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+void  //
+bench_perf_finish() {
+#if defined(WUFFS_TESTLIB_HAVE_PERF_EVENT)
+  for (int i = 0; i < BENCH_PERF_NUM_COUNTERS; i++) {
+    if (g_bench_perf_fds[i] >= 0) {
+      ioctl(g_bench_perf_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+  for (int i = 0; i < BENCH_PERF_NUM_COUNTERS; i++) {
+    g_bench_perf_values[i] = 0;
+    if ((g_bench_perf_fds[i] >= 0) &&
+        (read(g_bench_perf_fds[i], &g_bench_perf_values[i],
+              sizeof(g_bench_perf_values[i])) !=
+         sizeof(g_bench_perf_values[i]))) {
+      g_bench_perf_values[i] = 0;
+    }
+  }
+#endif
+}
+
+// bench_perf_ratio returns x/y, scaled by multiplier, or 0 if y is zero.
+double  //
+bench_perf_ratio(uint64_t x, uint64_t y, double multiplier) {
+  return y ? (((double)(x)) * multiplier / ((double)(y))) : 0.0;
+}
+
+// ---------------- Benchmark Timing (continued)
 
 void  //
 bench_start() {
-  gettimeofday(&g_bench_start_tv, NULL);
+#if defined(WUFFS_TESTLIB_HAVE_THREADS)
+  if (g_bench_thread) {
+    bench_thread_rendezvous(g_bench_thread);
+    g_bench_start_ns = bench_now_ns();
+    return;
+  }
+#endif
+  if (g_flags.perf) {
+    bench_perf_start();
+  }
+  g_bench_samples_len = 0;
+  g_bench_start_tsc = bench_now_tsc();
+  g_bench_start_ns = bench_now_ns();
+  g_bench_lap_ns = g_bench_start_ns;
+}
+
+// bench_lap records the time taken by one benchmark iteration: the time since
+// the previous bench_lap call or, for the first iteration, since bench_start.
+// It is a no-op unless per-iteration samples are wanted, and it is a no-op on
+// the "-threads=N" benchmark threads.
+void  //
+bench_lap() {
+  if (!g_flags.json || g_bench_thread) {
+    return;
+  }
+  uint64_t now = bench_now_ns();
+  uint64_t sample = now - g_bench_lap_ns;
+  if ((g_bench_samples_len >= g_bench_samples_cap) &&
+      (g_bench_samples_cap < BENCH_SAMPLES_MAX_LEN)) {
+    size_t n = g_bench_samples_cap ? (2 * g_bench_samples_cap) : 1024;
+    uint64_t* p = (uint64_t*)(realloc(g_bench_samples, n * sizeof(uint64_t)));
+    if (p) {
+      g_bench_samples = p;
+      g_bench_samples_cap = n;
+    }
+    // Don't count the reallocation towards the next iteration's sample.
+    now = bench_now_ns();
+  }
+  if (g_bench_samples_len < g_bench_samples_cap) {
+    g_bench_samples[g_bench_samples_len++] = sample;
+  }
+  g_bench_lap_ns = now;
+}
+
+int  //
+bench_compare_u64(const void* x, const void* y) {
+  uint64_t xx = *((const uint64_t*)(x));
+  uint64_t yy = *((const uint64_t*)(y));
+  return (xx < yy) ? -1 : (xx > yy) ? +1 : 0;
+}
+
+// bench_percentile returns the nearest-rank p'th percentile (p is in the range
+// [0 ..= 100]) of the (sorted) g_bench_samples, or 0 if there are none.
+uint64_t  //
+bench_percentile(uint64_t p) {
+  if (g_bench_samples_len == 0) {
+    return 0;
+  }
+  uint64_t rank = ((p * g_bench_samples_len) + 99) / 100;
+  return g_bench_samples[(rank > 0) ? (rank - 1) : 0];
+}
+
+void  //
+bench_finish_json(const char* name,
+                  uint64_t iters,
+                  uint64_t n_bytes,
+                  uint64_t nanos,
+                  uint64_t tsc) {
+  if (g_bench_samples_len > 0) {
+    qsort(g_bench_samples, g_bench_samples_len, sizeof(g_bench_samples[0]),
+          bench_compare_u64);
+  }
+
+  printf("{\"package\":\"%s\",\"name\":\"%s\",\"cc\":\"%s\","
+         "\"clock\":\"%s\",\"iters\":%" PRIu64 ",\"n_bytes\":%" PRIu64
+         ",\"ns\":%" PRIu64 ",\"ns_per_op\":%" PRIu64,
+         g_proc_package_name, name, g_cc, g_bench_clock_name, iters, n_bytes,
+         nanos, nanos / iters);
+  if (n_bytes) {
+    printf(",\"mb_per_s\":%.3f", ((double)(n_bytes)) * 1e3 / ((double)(nanos)));
+  }
+  printf(",\"samples\":%" PRIu64, (uint64_t)(g_bench_samples_len));
+  if (g_bench_samples_len > 0) {
+    printf(",\"ns_min\":%" PRIu64 ",\"ns_p50\":%" PRIu64
+           ",\"ns_p99\":%" PRIu64 ",\"ns_max\":%" PRIu64,
+           g_bench_samples[0], bench_percentile(50), bench_percentile(99),
+           g_bench_samples[g_bench_samples_len - 1]);
+  }
+  if (g_flags.rdtsc) {
+    printf(",\"tsc_per_op\":%.3f", ((double)(tsc)) / ((double)(iters)));
+    if (n_bytes) {
+      printf(",\"tsc_per_byte\":%.3f", ((double)(tsc)) / ((double)(n_bytes)));
+    }
+  }
+  if (g_flags.perf) {
+    for (int i = 0; i < BENCH_PERF_NUM_COUNTERS; i++) {
+      if (g_bench_perf_fds[i] >= 0) {
+        printf(",\"perf_%s\":%" PRIu64, g_bench_perf_counter_defs[i].name,
+               g_bench_perf_values[i]);
+      }
+    }
+    if (g_bench_perf_fds[1] >= 0) {
+      printf(",\"ipc\":%.3f", bench_perf_ratio(g_bench_perf_values[1],
+                                                g_bench_perf_values[0], 1.0));
+    }
+    // The "per_kb" numbers are per 1024 bytes processed (or per op, for
+    // benchmarks that don't count bytes).
+    uint64_t denominator = n_bytes ? n_bytes : iters;
+    double multiplier = n_bytes ? 1024.0 : 1.0;
+    const char* unit = n_bytes ? "kb" : "op";
+    for (int i = 2; i < BENCH_PERF_NUM_COUNTERS; i++) {
+      if (g_bench_perf_fds[i] >= 0) {
+        printf(",\"%s_per_%s\":%.3f", g_bench_perf_counter_defs[i].name, unit,
+               bench_perf_ratio(g_bench_perf_values[i], denominator,
+                                multiplier));
+      }
+    }
+  }
+  printf("}\n");
+}
+
+// bench_finish_perf_text prints the "-perf" metrics as benchstat-compatible
+// "value unit" pairs, continuing the current (non-JSON) output line.
+void  //
+bench_finish_perf_text(uint64_t iters, uint64_t n_bytes) {
+  if (g_bench_perf_fds[1] >= 0) {
+    printf("\t%8.3f IPC", bench_perf_ratio(g_bench_perf_values[1],
+                                           g_bench_perf_values[0], 1.0));
+  }
+  uint64_t denominator = n_bytes ? n_bytes : iters;
+  double multiplier = n_bytes ? 1024.0 : 1.0;
+  const char* unit = n_bytes ? "KB" : "op";
+  for (int i = 2; i < BENCH_PERF_NUM_COUNTERS; i++) {
+    if (g_bench_perf_fds[i] >= 0) {
+      printf("\t%8.3f %s/%s", bench_perf_ratio(g_bench_perf_values[i],
+                                               denominator, multiplier),
+             g_bench_perf_counter_defs[i].name, unit);
+    }
+  }
 }
 
 void  //
 bench_finish(uint64_t iters, uint64_t n_bytes) {
-  struct timeval bench_finish_tv;
-  gettimeofday(&bench_finish_tv, NULL);
-  int64_t micros =
-      (int64_t)(bench_finish_tv.tv_sec - g_bench_start_tv.tv_sec) * 1000000 +
-      (int64_t)(bench_finish_tv.tv_usec - g_bench_start_tv.tv_usec);
-  uint64_t nanos = 1;
-  if (micros > 0) {
-    nanos = (uint64_t)(micros)*1000;
+  uint64_t now = bench_now_ns();
+  if (g_bench_thread) {
+    g_bench_thread->iters = iters;
+    g_bench_thread->n_bytes = n_bytes;
+    g_bench_thread->start_ns = g_bench_start_ns;
+    g_bench_thread->finish_ns = now;
+    return;
+  }
+
+  uint64_t nanos = now - g_bench_start_ns;
+  uint64_t tsc = bench_now_tsc() - g_bench_start_tsc;
+  if (g_flags.perf) {
+    bench_perf_finish();
+  }
+  if (nanos == 0) {
+    nanos = 1;
+  }
+  if (iters == 0) {
+    iters = 1;
   }
+  g_bench_single_thread_work = n_bytes ? n_bytes : iters;
+  g_bench_single_thread_nanos = nanos;
   uint64_t kb_per_s = n_bytes * 1000000 / nanos;
 
   const char* name = g_proc_func_name;
   if ((strlen(name) >= 6) && !strncmp(name, "bench_", 6)) {
     name += 6;
   }
-  if (g_bench_warm_up) {
+  if (g_flags.json) {
+    if (!g_bench_warm_up) {
+      bench_finish_json(name, iters, n_bytes, nanos, tsc);
+    }
+  } else if (g_bench_warm_up) {
     printf("# (warm up) %s/%s\t%8" PRIu64 ".%06" PRIu64 " seconds\n",  //
            name, g_cc, nanos / 1000000000, (nanos % 1000000000) / 1000);
-  } else if (!n_bytes) {
-    printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64 " ns/op\n",  //
-           name, g_cc, iters, nanos / iters);
   } else {
-    printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64
-           " ns/op\t%8d.%03d MB/s\n",         //
-           name, g_cc, iters, nanos / iters,  //
-           (int)(kb_per_s / 1000), (int)(kb_per_s % 1000));
+    if (!n_bytes) {
+      printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64 " ns/op",  //
+             name, g_cc, iters, nanos / iters);
+    } else {
+      printf("Benchmark%s/%s\t%8" PRIu64 "\t%8" PRIu64
+             " ns/op\t%8d.%03d MB/s",           //
+             name, g_cc, iters, nanos / iters,  //
+             (int)(kb_per_s / 1000), (int)(kb_per_s % 1000));
+    }
+    if (g_flags.perf) {
+      bench_finish_perf_text(iters, n_bytes);
+    }
+    printf("\n");
   }
   // Flush stdout so that "wuffs bench | tee etc" still prints its numbers as
   // soon as they are available.
@@ -389,8 +1056,6 @@ chdir_to_the_wuffs_root_directory() {
          "program";
 }
 
-typedef const char* (*proc)();
-
 int  //
 test_main(int argc, char** argv, proc* tests, proc* benches) {
   wuffs_testlib__initialize_global_xxx_slices();
@@ -410,11 +1075,41 @@ test_main(int argc, char** argv, proc* tests, proc* benches) {
     return 1;
   }
 
+  if (g_flags.threads > 1) {
+    if (!g_flags.bench) {
+      fprintf(stderr, "-threads requires -bench\n");
+      return 1;
+    } else if (g_flags.perf) {
+      fprintf(stderr, "-threads and -perf are mutually exclusive\n");
+      return 1;
+    }
+#if defined(WUFFS_TESTLIB_HAVE_THREADS)
+    status = bench_threads_open();
+    if (status) {
+      fprintf(stderr, "%s\n", status);
+      return 1;
+    }
+#endif
+  }
+  if (g_flags.perf) {
+    if (!g_flags.bench) {
+      fprintf(stderr, "-perf requires -bench\n");
+      return 1;
+    }
+    status = bench_perf_open();
+    if (status) {
+      fprintf(stderr, "%s\n", status);
+      return 1;
+    }
+  }
+
   int reps = 1;
   proc* procs = tests;
   if (g_flags.bench) {
     reps = g_flags.reps + 1;  // +1 for the warm up run.
     procs = benches;
+  }
+  if (g_flags.bench && !g_flags.json) {
     printf("# %s\n# %s version %s\n#\n", g_proc_package_name, g_cc,
            g_cc_version);
     printf(
@@ -436,6 +1131,11 @@ test_main(int argc, char** argv, proc* tests, proc* benches) {
       if (!g_in_focus) {
         continue;
       }
+#if defined(WUFFS_TESTLIB_HAVE_THREADS)
+      if (!status && (g_flags.threads > 1)) {
+        status = bench_threads_run(*p);
+      }
+#endif
       if (status) {
         printf("%-16s%-8sFAIL %s: %s\n", g_proc_package_name, g_cc,
                g_proc_func_name, status);
@@ -448,7 +1148,9 @@ test_main(int argc, char** argv, proc* tests, proc* benches) {
     if (i != 0) {
       continue;
     }
-    if (g_flags.bench) {
+    if (g_flags.json) {
+      // No-op. Every line of "-json" output is a JSON object.
+    } else if (g_flags.bench) {
       printf("# %d benchmarks, 1+%d reps per benchmark, iterscale=%d\n",
              g_tests_run, g_flags.reps, (int)(g_flags.iterscale));
     } else {
@@ -893,6 +1595,7 @@ proc_io_buffers(const char* (*codec_func)(wuffs_base__io_buffer*,
     if (status) {
       return status;
     }
+    bench_lap();
     switch (tcounter) {
       case tcounter_neither:
         break;
@@ -978,6 +1681,7 @@ proc_token_decoder(const char* (*codec_func)(wuffs_base__token_buffer*,
     if (status) {
       return status;
     }
+    bench_lap();
     switch (tcounter) {
       case tcounter_neither:
         break;
@@ -1045,6 +1749,26 @@ do_test_io_buffers(const char* (*codec_func)(wuffs_base__io_buffer*,
 
 // --------
 
+// seek_for_io_redirect handles an "@I/O redirect" note whose more information
+// (an IO_SEEK flavor) asks the caller to reposition src. It assumes that src
+// holds the whole file.
+const char*  //
+seek_for_io_redirect(wuffs_base__image_decoder* b, wuffs_base__io_buffer* src) {
+  wuffs_base__io_buffer empty = wuffs_base__empty_io_buffer();
+  wuffs_base__more_information minfo = wuffs_base__empty_more_information();
+  CHECK_STATUS("tell_me_more", wuffs_base__image_decoder__tell_me_more(
+                                   b, &empty, &minfo, src));
+  if (minfo.flavor != WUFFS_BASE__MORE_INFORMATION__FLAVOR__IO_SEEK) {
+    return "seek_for_io_redirect: unexpected more_information flavor";
+  }
+  uint64_t pos = wuffs_base__more_information__io_seek__position(&minfo);
+  if ((pos < src->meta.pos) || ((pos - src->meta.pos) > src->meta.wi)) {
+    return "seek_for_io_redirect: position is out of bounds";
+  }
+  src->meta.ri = (size_t)(pos - src->meta.pos);
+  return NULL;
+}
+
 const char*  //
 do_run__wuffs_base__image_decoder(wuffs_base__image_decoder* b,
                                   uint64_t* n_bytes_out,
@@ -1069,8 +1793,15 @@ do_run__wuffs_base__image_decoder(wuffs_base__image_decoder* b,
   }
   uint64_t bytes_per_pixel = bits_per_pixel / 8;
 
-  CHECK_STATUS("decode_image_config",
-               wuffs_base__image_decoder__decode_image_config(b, &ic, src));
+  while (true) {
+    wuffs_base__status status =
+        wuffs_base__image_decoder__decode_image_config(b, &ic, src);
+    if (status.repr != wuffs_base__note__i_o_redirect) {
+      CHECK_STATUS("decode_image_config", status);
+      break;
+    }
+    CHECK_STRING(seek_for_io_redirect(b, src));
+  }
   wuffs_base__pixel_config__set(&ic.pixcfg, pixfmt.repr,
                                 WUFFS_BASE__PIXEL_SUBSAMPLING__NONE,
                                 wuffs_base__pixel_config__width(&ic.pixcfg),
@@ -1083,6 +1814,9 @@ do_run__wuffs_base__image_decoder(wuffs_base__image_decoder* b,
         wuffs_base__image_decoder__decode_frame_config(b, &fc, src);
     if (status.repr == wuffs_base__note__end_of_data) {
       break;
+    } else if (status.repr == wuffs_base__note__i_o_redirect) {
+      CHECK_STRING(seek_for_io_redirect(b, src));
+      continue;
     } else {
       CHECK_STATUS("decode_frame_config", status);
     }
@@ -1093,9 +1827,15 @@ do_run__wuffs_base__image_decoder(wuffs_base__image_decoder* b,
             ? WUFFS_BASE__PIXEL_BLEND__SRC
             : WUFFS_BASE__PIXEL_BLEND__SRC_OVER;
 
-    CHECK_STATUS("decode_frame",
-                 wuffs_base__image_decoder__decode_frame(
-                     b, &pb, src, blend, g_work_slice_u8, NULL));
+    while (true) {
+      status = wuffs_base__image_decoder__decode_frame(b, &pb, src, blend,
+                                                       g_work_slice_u8, NULL);
+      if (status.repr != wuffs_base__note__i_o_redirect) {
+        CHECK_STATUS("decode_frame", status);
+        break;
+      }
+      CHECK_STRING(seek_for_io_redirect(b, src));
+    }
 
     if (n_bytes_out) {
       uint64_t frame_width = wuffs_base__frame_config__width(&fc);
@@ -1139,6 +1879,7 @@ do_bench_image_decode(
     src.meta.ri = src_ri;
     CHECK_STRING((*decode_func)(&n_bytes, NULL, wuffs_initialize_flags, pixfmt,
                                 quirks_ptr, quirks_len, &src));
+    bench_lap();
   }
   bench_finish(iters, n_bytes);
   return NULL;
@@ -1186,8 +1927,15 @@ do_test__wuffs_base__image_decoder(
       .data = g_src_slice_u8,
   });
   CHECK_STRING(read_file_fragment(&src, src_filename, src_ri, src_wi));
-  CHECK_STATUS("decode_image_config",
-               wuffs_base__image_decoder__decode_image_config(b, &ic, &src));
+  while (true) {
+    wuffs_base__status status =
+        wuffs_base__image_decoder__decode_image_config(b, &ic, &src);
+    if (status.repr != wuffs_base__note__i_o_redirect) {
+      CHECK_STATUS("decode_image_config", status);
+      break;
+    }
+    CHECK_STRING(seek_for_io_redirect(b, &src));
+  }
 
   uint32_t have_width = wuffs_base__pixel_config__width(&ic.pixcfg);
   if (have_width != want_width) {
@@ -1206,9 +1954,15 @@ do_test__wuffs_base__image_decoder(
   wuffs_base__pixel_buffer pb = ((wuffs_base__pixel_buffer){});
   CHECK_STATUS("set_from_slice", wuffs_base__pixel_buffer__set_from_slice(
                                      &pb, &ic.pixcfg, g_pixel_slice_u8));
-  CHECK_STATUS("decode_frame", wuffs_base__image_decoder__decode_frame(
-                                   b, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC,
-                                   g_work_slice_u8, NULL));
+  while (true) {
+    wuffs_base__status status = wuffs_base__image_decoder__decode_frame(
+        b, &pb, &src, WUFFS_BASE__PIXEL_BLEND__SRC, g_work_slice_u8, NULL);
+    if (status.repr != wuffs_base__note__i_o_redirect) {
+      CHECK_STATUS("decode_frame", status);
+      break;
+    }
+    CHECK_STRING(seek_for_io_redirect(b, &src));
+  }
 
   uint64_t n = wuffs_base__pixel_config__pixbuf_len(&ic.pixcfg);
   if (n < 4) {